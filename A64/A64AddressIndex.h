@@ -0,0 +1,307 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <A64Cpu.h>
+
+/*
+	Address to object index read by exception handlers without a lock.
+	The ranges are kept in an immutable snapshot, in Eytzinger (breadth-first) order with their starts
+	in an array of their own, so the binary search walks down a tree whose top levels share cache
+	lines and only touches the range it ends on. Writers build a new snapshot and swap the published pointer, readers
+	never wait and never retry.
+
+	Old snapshots are reclaimed by epochs. A reader announces the global epoch in a record of a fixed
+	pool before loading the pointer. A snapshot retired at epoch e is freed once no thread has
+	announced an epoch at or below e, since readers announcing a later epoch load the new pointer.
+	Each thread also remembers the range of its last hit, repeated traps on the same function
+	skip the search.
+*/
+
+namespace registry
+{
+	/**
+	 * @brief Epochs announced by the threads reading any index.
+	 *
+	 * Records come from a fixed pool, a read never allocates, locks or registers a thread_local destructor and may
+	 * run in a signal handler. Threads attached outside of handlers keep a record until they exit, the others claim
+	 * one for each read. Reads finding the pool exhausted are counted instead, no snapshot is freed meanwhile.
+	 */
+	class EpochDomain {
+		struct alignas(64) Record {
+			std::atomic<std::uint64_t> epoch{ 0 };   ///< Epoch announced by the reading thread, 0 when idle
+			std::atomic<bool> used{ false };
+		};
+
+	public:
+		static constexpr std::size_t Capacity = 1024; ///< Records in the pool
+
+		static EpochDomain& Global() {
+			static EpochDomain domain;
+			return domain;
+		}
+
+		/**
+		 * @brief Announces the current epoch for the calling thread while it holds a snapshot.
+		 *
+		 * Reads may nest when a handler interrupts a read of the same thread, the outer one keeps its epoch.
+		 */
+		class ReadGuard {
+		public:
+			ReadGuard() : domain(EpochDomain::Global()), record(attachedRecord()), claimed(false) {
+				if (!record)
+					claimed = (record = domain.claim()) != nullptr;
+				if (!record) {
+					domain.overflowReaders.fetch_add(1, std::memory_order_seq_cst);
+					return;
+				}
+
+				outerEpoch = record->epoch.load(std::memory_order_relaxed);
+				if (!outerEpoch)
+					record->epoch.store(domain.epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+			}
+
+			~ReadGuard() {
+				if (!record) {
+					domain.overflowReaders.fetch_sub(1, std::memory_order_release);
+					return;
+				}
+
+				if (!outerEpoch)
+					record->epoch.store(0, std::memory_order_release);
+				if (claimed)
+					record->used.store(false, std::memory_order_release);
+			}
+
+			ReadGuard(const ReadGuard&) = delete;
+			ReadGuard& operator=(const ReadGuard&) = delete;
+
+		private:
+			EpochDomain& domain;
+			Record* record;          ///< nullptr when the pool was exhausted
+			bool claimed;            ///< Claimed for this read only
+			std::uint64_t outerEpoch = 0;
+		};
+
+		/**
+		 * @brief Gives the calling thread a record until it exits, its reads then skip claiming one. Not for signal handlers.
+		 */
+		void Attach() {
+			struct Holder {
+				Record* record = nullptr;
+				~Holder() {
+					if (!record)
+						return;
+					attachedRecord() = nullptr;
+					record->used.store(false, std::memory_order_release);
+				}
+			};
+			static thread_local Holder holder;
+			if (!holder.record && (holder.record = claim()))
+				attachedRecord() = holder.record;
+		}
+
+		/**
+		 * @brief Starts a new epoch once a snapshot was replaced, returns the epoch it was replaced at.
+		 */
+		std::uint64_t Advance() {
+			return epoch.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		/**
+		 * @brief Oldest epoch a thread is still reading at, UINT64_MAX if no thread is reading.
+		 */
+		std::uint64_t OldestReader() const {
+			// A read without a record may have started at any epoch
+			if (overflowReaders.load(std::memory_order_seq_cst))
+				return 0;
+
+			std::uint64_t oldest = UINT64_MAX;
+			std::size_t count = claimedRecords.load(std::memory_order_seq_cst);
+			for (std::size_t index = 0; index < count; ++index) {
+				std::uint64_t announced = records[index].epoch.load(std::memory_order_seq_cst);
+				if (announced)
+					oldest = (std::min)(oldest, announced);
+			}
+			return oldest;
+		}
+
+	private:
+		// Trivially destructible, safe to read from a signal handler
+		static Record*& attachedRecord() {
+			static thread_local Record* record = nullptr;
+			return record;
+		}
+
+		Record* claim() {
+			for (std::size_t index = 0; index < Capacity; ++index) {
+				bool unused = false;
+				if (records[index].used.load(std::memory_order_relaxed) || !records[index].used.compare_exchange_strong(unused, true, std::memory_order_seq_cst))
+					continue;
+
+				// Writers scan the records below the mark, it covers this one before its first announcement
+				std::size_t mark = claimedRecords.load(std::memory_order_seq_cst);
+				while (mark <= index && !claimedRecords.compare_exchange_weak(mark, index + 1, std::memory_order_seq_cst));
+				return &records[index];
+			}
+			return nullptr;
+		}
+
+		std::atomic<std::uint64_t> epoch{ 1 };
+		std::atomic<std::size_t> claimedRecords{ 0 };    ///< Records below it were claimed at least once
+		std::atomic<std::size_t> overflowReaders{ 0 };
+		Record records[Capacity];
+	};
+
+	template<typename T>
+	class AddressIndex {
+	public:
+		struct Range {
+			std::uintptr_t start;
+			std::uintptr_t end;
+			T* value;
+		};
+
+		AddressIndex() : current(new Snapshot({}, nextGeneration())) {}
+
+		~AddressIndex() {
+			delete current.load();
+			for (const Retired& retired : retiredSnapshots)
+				delete retired.snapshot;
+		}
+
+		AddressIndex(const AddressIndex&) = delete;
+		AddressIndex& operator=(const AddressIndex&) = delete;
+
+		/**
+		 * @brief Replaces the indexed ranges, lookups running meanwhile see either the old or the new set.
+		 *
+		 * @param ranges Ranges that don't overlap, in any order.
+		 */
+		void Publish(std::vector<Range> ranges) {
+			std::sort(ranges.begin(), ranges.end(), [](const Range& left, const Range& right) { return left.start < right.start; });
+			Snapshot* snapshot = new Snapshot(std::move(ranges), nextGeneration());
+
+			std::lock_guard<std::mutex> lock(writerMutex);
+			const Snapshot* previous = current.exchange(snapshot);
+
+			// Readers announcing a later epoch load the new snapshot
+			retiredSnapshots.push_back({ previous, EpochDomain::Global().Advance() });
+
+			std::uint64_t oldestReader = EpochDomain::Global().OldestReader();
+			std::erase_if(retiredSnapshots, [&](const Retired& retired) {
+				if (retired.epoch >= oldestReader)
+					return false;
+				delete retired.snapshot;
+				return true;
+			});
+		}
+
+		/**
+		 * @brief Returns the value of the range starting at address, nullptr if no range starts there.
+		 */
+		T* Find(const void* address) const {
+			Range range;
+			return lookup(reinterpret_cast<std::uintptr_t>(address), range) && range.start == reinterpret_cast<std::uintptr_t>(address) ? range.value : nullptr;
+		}
+
+		/**
+		 * @brief Returns the value of the range containing address, nullptr if no range contains it.
+		 */
+		T* FindContaining(const void* address) const {
+			Range range;
+			return lookup(reinterpret_cast<std::uintptr_t>(address), range) ? range.value : nullptr;
+		}
+
+	private:
+		class Snapshot {
+		public:
+			Snapshot(std::vector<Range> sortedRanges, std::uint64_t generation)
+				: keys(sortedRanges.size() + 1), nodes(sortedRanges.size() + 1), generation(generation) {
+				std::size_t rank = 0;
+				fill(sortedRanges, 1, rank);
+			}
+
+			/**
+			 * @brief Returns the range containing address, nullptr if there is none.
+			 */
+			const Range* Search(std::uintptr_t address) const {
+				std::size_t count = keys.size() - 1;
+
+				// Descend the whole tree, the last node where the search turned right starts at or below the address
+				std::size_t node = 1, below = 0;
+				while (node <= count) {
+#ifdef AA_CPU_X64
+					// The descendants four levels down are adjacent, fetch them while this level is compared
+					if (16 * node <= count)
+						_mm_prefetch(reinterpret_cast<const char*>(keys.data() + 16 * node), _MM_HINT_T0);
+#endif // AA_CPU_X64
+					bool right = keys[node] <= address;
+					below = right ? node : below;
+					node = 2 * node + right;
+				}
+
+				if (!below || address >= nodes[below].end)
+					return nullptr;
+				return &nodes[below];
+			}
+
+			std::vector<std::uintptr_t> keys;   ///< Starts in Eytzinger order from index 1, eight per cache line
+			std::vector<Range> nodes;           ///< Ranges in the same order
+			std::uint64_t generation;           ///< Distinguishes snapshots reusing a freed address
+
+		private:
+			void fill(const std::vector<Range>& sortedRanges, std::size_t node, std::size_t& rank) {
+				if (node >= keys.size())
+					return;
+				fill(sortedRanges, 2 * node, rank);
+				keys[node] = sortedRanges[rank].start;
+				nodes[node] = sortedRanges[rank++];
+				fill(sortedRanges, 2 * node + 1, rank);
+			}
+		};
+
+		struct Retired {
+			const Snapshot* snapshot;
+			std::uint64_t epoch;   ///< Epoch the snapshot was replaced at
+		};
+
+		/**
+		 * @brief Copies the range containing address, the snapshot isn't referenced once it returns.
+		 */
+		bool lookup(std::uintptr_t address, Range& found) const {
+			struct Hit {
+				const AddressIndex* index;
+				std::uint64_t generation;
+				Range range;
+			};
+			static thread_local Hit lastHit = {};
+
+			EpochDomain::ReadGuard guard;
+			const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+			bool hit = lastHit.index == this && lastHit.generation == snapshot->generation && address >= lastHit.range.start && address < lastHit.range.end;
+			if (hit)
+				found = lastHit.range;
+			else if (const Range* range = snapshot->Search(address)) {
+				found = *range, hit = true;
+				lastHit = { this, snapshot->generation, found };
+			}
+			return hit;
+		}
+
+		static std::uint64_t nextGeneration() {
+			static std::atomic<std::uint64_t> generation{ 0 };
+			return generation.fetch_add(1) + 1;
+		}
+
+		std::atomic<const Snapshot*> current;
+		std::vector<Retired> retiredSnapshots;
+		std::mutex writerMutex;
+	};
+}
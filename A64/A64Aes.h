@@ -0,0 +1,228 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <A64Cpu.h>
+
+/*
+	AES-128 in counter mode.
+	Counter block n is the 64 bit nonce followed by the 64 bit block index n (both little endian),
+	so the keystream of any byte offset is computed directly and any subrange can be processed on its own.
+	AES-NI is used when the CPU has it, the table free byte implementation is the fallback.
+*/
+
+namespace cipher::aes
+{
+	constexpr std::size_t BlockSize = 16;
+	constexpr std::size_t KeySize = 16;
+	constexpr int Rounds = 10;
+
+	namespace portable
+	{
+		constexpr std::uint8_t SBox[256] = {
+			0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+			0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+			0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+			0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+			0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+			0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+			0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+			0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+			0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+			0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+			0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+			0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+			0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+			0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+			0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+			0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+		};
+
+		inline std::uint8_t Xtime(std::uint8_t value) {
+			return static_cast<std::uint8_t>((value << 1) ^ ((value >> 7) * 0x1B));
+		}
+
+		inline void ExpandKey(const std::uint8_t key[KeySize], std::uint8_t roundKeys[(Rounds + 1) * BlockSize]) {
+			std::memcpy(roundKeys, key, KeySize);
+			std::uint8_t rcon = 1;
+			for (std::size_t i = KeySize; i < (Rounds + 1) * BlockSize; i += 4) {
+				std::uint8_t word[4] = { roundKeys[i - 4], roundKeys[i - 3], roundKeys[i - 2], roundKeys[i - 1] };
+				if (i % KeySize == 0) {
+					std::uint8_t first = word[0];
+					word[0] = SBox[word[1]] ^ rcon;
+					word[1] = SBox[word[2]];
+					word[2] = SBox[word[3]];
+					word[3] = SBox[first];
+					rcon = Xtime(rcon);
+				}
+				for (int j = 0; j < 4; ++j)
+					roundKeys[i + j] = roundKeys[i + j - KeySize] ^ word[j];
+			}
+		}
+
+		inline void EncryptBlock(const std::uint8_t roundKeys[(Rounds + 1) * BlockSize], std::uint8_t state[BlockSize]) {
+			for (std::size_t i = 0; i < BlockSize; ++i)
+				state[i] ^= roundKeys[i];
+
+			for (int round = 1; round <= Rounds; ++round) {
+				// SubBytes and ShiftRows, the state is column major
+				std::uint8_t shifted[BlockSize];
+				for (int column = 0; column < 4; ++column)
+					for (int row = 0; row < 4; ++row)
+						shifted[column * 4 + row] = SBox[state[((column + row) % 4) * 4 + row]];
+
+				// MixColumns, skipped by the last round
+				if (round != Rounds) {
+					for (int column = 0; column < 4; ++column) {
+						std::uint8_t* c = shifted + column * 4;
+						std::uint8_t all = c[0] ^ c[1] ^ c[2] ^ c[3], first = c[0];
+						c[0] ^= all ^ Xtime(c[0] ^ c[1]);
+						c[1] ^= all ^ Xtime(c[1] ^ c[2]);
+						c[2] ^= all ^ Xtime(c[2] ^ c[3]);
+						c[3] ^= all ^ Xtime(c[3] ^ first);
+					}
+				}
+
+				for (std::size_t i = 0; i < BlockSize; ++i)
+					state[i] = shifted[i] ^ roundKeys[round * BlockSize + i];
+			}
+		}
+
+		inline void ApplyCtr(const std::uint8_t key[KeySize], std::uint64_t nonce, std::uint8_t* data, std::size_t size, std::uint64_t offset) {
+			std::uint8_t roundKeys[(Rounds + 1) * BlockSize];
+			ExpandKey(key, roundKeys);
+
+			std::uint64_t block = offset / BlockSize;
+			std::size_t skip = offset % BlockSize;
+			while (size) {
+				std::uint8_t keystream[BlockSize];
+				std::memcpy(keystream, &nonce, 8);
+				std::memcpy(keystream + 8, &block, 8);
+				EncryptBlock(roundKeys, keystream);
+
+				std::size_t count = (std::min)(size, BlockSize - skip);
+				for (std::size_t i = 0; i < count; ++i)
+					data[i] ^= keystream[skip + i];
+
+				data += count, size -= count, skip = 0, ++block;
+			}
+		}
+	}
+
+#ifdef AA_CPU_X64
+	namespace ni
+	{
+		template<int Rcon>
+		AA_TARGET("aes")
+		inline __m128i ExpandStep(__m128i key) {
+			__m128i assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(key, Rcon), 0xFF);
+			key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+			key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+			key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+			return _mm_xor_si128(key, assist);
+		}
+
+		AA_TARGET("aes")
+		inline void ExpandKey(const std::uint8_t key[KeySize], __m128i roundKeys[Rounds + 1]) {
+			roundKeys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+			roundKeys[1] = ExpandStep<0x01>(roundKeys[0]);
+			roundKeys[2] = ExpandStep<0x02>(roundKeys[1]);
+			roundKeys[3] = ExpandStep<0x04>(roundKeys[2]);
+			roundKeys[4] = ExpandStep<0x08>(roundKeys[3]);
+			roundKeys[5] = ExpandStep<0x10>(roundKeys[4]);
+			roundKeys[6] = ExpandStep<0x20>(roundKeys[5]);
+			roundKeys[7] = ExpandStep<0x40>(roundKeys[6]);
+			roundKeys[8] = ExpandStep<0x80>(roundKeys[7]);
+			roundKeys[9] = ExpandStep<0x1B>(roundKeys[8]);
+			roundKeys[10] = ExpandStep<0x36>(roundKeys[9]);
+		}
+
+		AA_TARGET("aes")
+		inline __m128i EncryptBlock(const __m128i roundKeys[Rounds + 1], __m128i block) {
+			block = _mm_xor_si128(block, roundKeys[0]);
+			for (int round = 1; round < Rounds; ++round)
+				block = _mm_aesenc_si128(block, roundKeys[round]);
+			return _mm_aesenclast_si128(block, roundKeys[Rounds]);
+		}
+
+		AA_TARGET("aes")
+		inline void ApplyCtr(const std::uint8_t key[KeySize], std::uint64_t nonce, std::uint8_t* data, std::size_t size, std::uint64_t offset) {
+			__m128i roundKeys[Rounds + 1];
+			ExpandKey(key, roundKeys);
+
+			std::uint64_t block = offset / BlockSize;
+			std::size_t skip = offset % BlockSize;
+			const __m128i one = _mm_set_epi64x(1, 0);
+			__m128i counter = _mm_set_epi64x(static_cast<long long>(block), static_cast<long long>(nonce));
+
+			// Partial first block when the offset isn't block aligned
+			if (skip) {
+				alignas(16) std::uint8_t keystream[BlockSize];
+				_mm_store_si128(reinterpret_cast<__m128i*>(keystream), EncryptBlock(roundKeys, counter));
+				std::size_t count = (std::min)(size, BlockSize - skip);
+				for (std::size_t i = 0; i < count; ++i)
+					data[i] ^= keystream[skip + i];
+				data += count, size -= count;
+				counter = _mm_add_epi64(counter, one);
+			}
+
+			// Eight independent blocks per iteration hide the aesenc latency
+			for (; size >= 8 * BlockSize; data += 8 * BlockSize, size -= 8 * BlockSize) {
+				__m128i b0 = _mm_xor_si128(counter, roundKeys[0]);
+				__m128i b1 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(1, 0)), roundKeys[0]);
+				__m128i b2 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(2, 0)), roundKeys[0]);
+				__m128i b3 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(3, 0)), roundKeys[0]);
+				__m128i b4 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(4, 0)), roundKeys[0]);
+				__m128i b5 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(5, 0)), roundKeys[0]);
+				__m128i b6 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(6, 0)), roundKeys[0]);
+				__m128i b7 = _mm_xor_si128(_mm_add_epi64(counter, _mm_set_epi64x(7, 0)), roundKeys[0]);
+				counter = _mm_add_epi64(counter, _mm_set_epi64x(8, 0));
+
+				for (int round = 1; round < Rounds; ++round) {
+					__m128i roundKey = roundKeys[round];
+					b0 = _mm_aesenc_si128(b0, roundKey), b1 = _mm_aesenc_si128(b1, roundKey);
+					b2 = _mm_aesenc_si128(b2, roundKey), b3 = _mm_aesenc_si128(b3, roundKey);
+					b4 = _mm_aesenc_si128(b4, roundKey), b5 = _mm_aesenc_si128(b5, roundKey);
+					b6 = _mm_aesenc_si128(b6, roundKey), b7 = _mm_aesenc_si128(b7, roundKey);
+				}
+
+				__m128i* out = reinterpret_cast<__m128i*>(data);
+				__m128i lastKey = roundKeys[Rounds];
+				_mm_storeu_si128(out + 0, _mm_xor_si128(_mm_loadu_si128(out + 0), _mm_aesenclast_si128(b0, lastKey)));
+				_mm_storeu_si128(out + 1, _mm_xor_si128(_mm_loadu_si128(out + 1), _mm_aesenclast_si128(b1, lastKey)));
+				_mm_storeu_si128(out + 2, _mm_xor_si128(_mm_loadu_si128(out + 2), _mm_aesenclast_si128(b2, lastKey)));
+				_mm_storeu_si128(out + 3, _mm_xor_si128(_mm_loadu_si128(out + 3), _mm_aesenclast_si128(b3, lastKey)));
+				_mm_storeu_si128(out + 4, _mm_xor_si128(_mm_loadu_si128(out + 4), _mm_aesenclast_si128(b4, lastKey)));
+				_mm_storeu_si128(out + 5, _mm_xor_si128(_mm_loadu_si128(out + 5), _mm_aesenclast_si128(b5, lastKey)));
+				_mm_storeu_si128(out + 6, _mm_xor_si128(_mm_loadu_si128(out + 6), _mm_aesenclast_si128(b6, lastKey)));
+				_mm_storeu_si128(out + 7, _mm_xor_si128(_mm_loadu_si128(out + 7), _mm_aesenclast_si128(b7, lastKey)));
+			}
+
+			for (; size >= BlockSize; data += BlockSize, size -= BlockSize) {
+				__m128i* out = reinterpret_cast<__m128i*>(data);
+				_mm_storeu_si128(out, _mm_xor_si128(_mm_loadu_si128(out), EncryptBlock(roundKeys, counter)));
+				counter = _mm_add_epi64(counter, one);
+			}
+
+			if (size) {
+				alignas(16) std::uint8_t keystream[BlockSize];
+				_mm_store_si128(reinterpret_cast<__m128i*>(keystream), EncryptBlock(roundKeys, counter));
+				for (std::size_t i = 0; i < size; ++i)
+					data[i] ^= keystream[i];
+			}
+		}
+	}
+#endif // AA_CPU_X64
+
+	/**
+	 * @brief XORs data with the keystream starting at byte offset of the stream.
+	 */
+	inline void ApplyCtr(const std::uint8_t key[KeySize], std::uint64_t nonce, std::uint8_t* data, std::size_t size, std::uint64_t offset) {
+#ifdef AA_CPU_X64
+		if (cpu::Supported().aes)
+			return ni::ApplyCtr(key, nonce, data, size, offset);
+#endif // AA_CPU_X64
+		portable::ApplyCtr(key, nonce, data, size, offset);
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#ifndef AA_NOCAPSTONE
+#include <capstone/capstone.h>
+#endif // !AA_NOCAPSTONE
+
+/*
+	Target architecture policies for function sizing.
+	Every policy describes how instructions are decoded and which instruction
+	ends a function. The sizing routines take the policy as a template argument
+	so the terminator checks are resolved at compile time and the per-instruction
+	loop never dispatches on the target.
+
+	Instruction types only need size, address and bytes, which both cs_insn and
+	OpInstruction provide.
+*/
+
+struct ArchX86 {
+	static constexpr bool X64 = false;                      ///< Decode without REX / RIP relative addressing
+	static constexpr std::size_t FixedInstructionSize = 0;  ///< Variable length encoding
+#ifndef AA_NOCAPSTONE
+	static constexpr cs_arch CsArch = CS_ARCH_X86;
+	static constexpr cs_mode CsMode = CS_MODE_32;
+#endif // !AA_NOCAPSTONE
+
+	static constexpr std::uint8_t PaddingByte = 0xCC;       ///< int3 used to align functions
+
+	/**
+	 * @brief Checks for ret, repz ret and ret imm16.
+	 */
+	template<typename Instruction>
+	static bool IsReturn(const Instruction* instruction) {
+		const std::uint8_t* bytes = instruction->bytes;
+		switch (instruction->size) {
+		case 1: return bytes[0] == 0xC3;
+		case 2: return bytes[0] == 0xF3 && bytes[1] == 0xC3;
+		case 3: return bytes[0] == 0xC2;
+		default: return false;
+		}
+	}
+
+	/**
+	 * @brief Checks for an int3 padding instruction.
+	 */
+	template<typename Instruction>
+	static bool IsPadding(const Instruction* instruction) {
+		return instruction->size == 1 && instruction->bytes[0] == PaddingByte;
+	}
+
+	/**
+	 * @brief A function ends on a return that is directly followed by int3 padding.
+	 */
+	template<typename Instruction>
+	static bool IsTerminator(const Instruction* instruction) {
+		const std::uint8_t* next = reinterpret_cast<const std::uint8_t*>(instruction->address) + instruction->size;
+		return IsReturn(instruction) && *next == PaddingByte;
+	}
+};
+
+struct ArchX64 : ArchX86 {
+	static constexpr bool X64 = true;
+#ifndef AA_NOCAPSTONE
+	static constexpr cs_mode CsMode = CS_MODE_64;
+#endif // !AA_NOCAPSTONE
+};
+
+struct ArchArm64 {
+	static constexpr bool X64 = true;
+	static constexpr std::size_t FixedInstructionSize = 4;  ///< A64 instructions are always 4 bytes
+#ifndef AA_NOCAPSTONE
+	static constexpr cs_arch CsArch = CS_ARCH_ARM64;
+	static constexpr cs_mode CsMode = CS_MODE_ARM;
+#endif // !AA_NOCAPSTONE
+
+	static std::uint32_t Word(const std::uint8_t* bytes) {
+		std::uint32_t word;
+		std::memcpy(&word, bytes, sizeof(word));
+		return word;
+	}
+
+	/**
+	 * @brief Checks for ret, retaa and retab.
+	 */
+	template<typename Instruction>
+	static bool IsReturn(const Instruction* instruction) {
+		std::uint32_t word = Word(instruction->bytes);
+		return (word & 0xFFFFFC1F) == 0xD65F0000 || word == 0xD65F0BFF || word == 0xD65F0FFF;
+	}
+
+	/**
+	 * @brief Alignment padding is emitted as udf #0, nop or brk.
+	 */
+	static bool IsPaddingWord(std::uint32_t word) {
+		return word == 0x00000000 || word == 0xD503201F || (word & 0xFFE0001F) == 0xD4200000;
+	}
+
+	template<typename Instruction>
+	static bool IsPadding(const Instruction* instruction) {
+		return IsPaddingWord(Word(instruction->bytes));
+	}
+
+	/**
+	 * @brief A function ends on a return that is directly followed by alignment padding.
+	 */
+	template<typename Instruction>
+	static bool IsTerminator(const Instruction* instruction) {
+		const std::uint8_t* next = reinterpret_cast<const std::uint8_t*>(instruction->address) + FixedInstructionSize;
+		return IsReturn(instruction) && IsPaddingWord(Word(next));
+	}
+};
+
+#if defined(_M_X64) || defined(__x86_64__)
+using ArchNative = ArchX64;
+#elif defined(_M_IX86) || defined(__i386__)
+using ArchNative = ArchX86;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+using ArchNative = ArchArm64;
+#else
+#error Unsupported platform
+#endif
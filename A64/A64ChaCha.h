@@ -0,0 +1,196 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <A64Cpu.h>
+
+/*
+	ChaCha20 with a 64 bit block counter and a zero nonce (the original construction),
+	every function body is encrypted with a key of its own so the nonce isn't needed.
+	Block n of the keystream only depends on n, so any byte offset is reached directly.
+	Four blocks are computed at once, one per vector lane, with SSE2 on x64 and NEON on
+	ARM64 (both baseline, no dispatch), and one at a time elsewhere.
+*/
+
+namespace cipher::chacha
+{
+	constexpr std::size_t BlockSize = 64;
+	constexpr std::size_t KeySize = 32;
+	constexpr int DoubleRounds = 10;
+
+	/**
+	 * @brief Initial state for block 0, words 12 and 13 hold the block counter.
+	 */
+	inline void InitState(const std::uint8_t key[KeySize], std::uint32_t state[16]) {
+		state[0] = 0x61707865, state[1] = 0x3320646e, state[2] = 0x79622d32, state[3] = 0x6b206574; // "expand 32-byte k"
+		std::memcpy(state + 4, key, KeySize);
+		state[12] = state[13] = state[14] = state[15] = 0;
+	}
+
+	namespace portable
+	{
+		inline std::uint32_t Rotl(std::uint32_t value, int count) {
+			return (value << count) | (value >> (32 - count));
+		}
+
+		inline void QuarterRound(std::uint32_t& a, std::uint32_t& b, std::uint32_t& c, std::uint32_t& d) {
+			a += b, d ^= a, d = Rotl(d, 16);
+			c += d, b ^= c, b = Rotl(b, 12);
+			a += b, d ^= a, d = Rotl(d, 8);
+			c += d, b ^= c, b = Rotl(b, 7);
+		}
+
+		/**
+		 * @brief Computes keystream block number block.
+		 */
+		inline void Block(const std::uint32_t state[16], std::uint64_t block, std::uint8_t keystream[BlockSize]) {
+			std::uint32_t input[16], x[16];
+			std::memcpy(input, state, sizeof(input));
+			input[12] = static_cast<std::uint32_t>(block);
+			input[13] = static_cast<std::uint32_t>(block >> 32);
+			std::memcpy(x, input, sizeof(x));
+
+			for (int round = 0; round < DoubleRounds; ++round) {
+				QuarterRound(x[0], x[4], x[8], x[12]);
+				QuarterRound(x[1], x[5], x[9], x[13]);
+				QuarterRound(x[2], x[6], x[10], x[14]);
+				QuarterRound(x[3], x[7], x[11], x[15]);
+				QuarterRound(x[0], x[5], x[10], x[15]);
+				QuarterRound(x[1], x[6], x[11], x[12]);
+				QuarterRound(x[2], x[7], x[8], x[13]);
+				QuarterRound(x[3], x[4], x[9], x[14]);
+			}
+
+			for (int i = 0; i < 16; ++i)
+				x[i] += input[i];
+			std::memcpy(keystream, x, BlockSize);
+		}
+	}
+
+#if defined(AA_CPU_X64) || defined(AA_CPU_ARM64)
+	namespace lanes
+	{
+#ifdef AA_CPU_X64
+		struct Vector {
+			using Type = __m128i;
+			static Type Splat(std::uint32_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+			static Type Load(const std::uint32_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+			static void Store(std::uint32_t* values, Type vector) { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), vector); }
+			static Type Add(Type a, Type b) { return _mm_add_epi32(a, b); }
+			static Type Xor(Type a, Type b) { return _mm_xor_si128(a, b); }
+			template<int Count>
+			static Type Rotl(Type value) { return _mm_or_si128(_mm_slli_epi32(value, Count), _mm_srli_epi32(value, 32 - Count)); }
+		};
+#else
+		struct Vector {
+			using Type = uint32x4_t;
+			static Type Splat(std::uint32_t value) { return vdupq_n_u32(value); }
+			static Type Load(const std::uint32_t* values) { return vld1q_u32(values); }
+			static void Store(std::uint32_t* values, Type vector) { vst1q_u32(values, vector); }
+			static Type Add(Type a, Type b) { return vaddq_u32(a, b); }
+			static Type Xor(Type a, Type b) { return veorq_u32(a, b); }
+			template<int Count>
+			static Type Rotl(Type value) { return vsriq_n_u32(vshlq_n_u32(value, Count), value, 32 - Count); }
+		};
+#endif // AA_CPU_X64
+
+		using V = Vector::Type;
+
+		inline void QuarterRound(V& a, V& b, V& c, V& d) {
+			a = Vector::Add(a, b), d = Vector::Rotl<16>(Vector::Xor(d, a));
+			c = Vector::Add(c, d), b = Vector::Rotl<12>(Vector::Xor(b, c));
+			a = Vector::Add(a, b), d = Vector::Rotl<8>(Vector::Xor(d, a));
+			c = Vector::Add(c, d), b = Vector::Rotl<7>(Vector::Xor(b, c));
+		}
+
+		/**
+		 * @brief Computes keystream blocks block to block + 3, lane j of every word belongs to block + j.
+		 */
+		inline void Blocks4(const std::uint32_t state[16], std::uint64_t block, std::uint8_t keystream[4 * BlockSize]) {
+			V input[16], x[16];
+			for (int i = 0; i < 16; ++i)
+				input[i] = Vector::Splat(state[i]);
+
+			std::uint32_t counterLow[4], counterHigh[4];
+			for (int j = 0; j < 4; ++j) {
+				counterLow[j] = static_cast<std::uint32_t>(block + j);
+				counterHigh[j] = static_cast<std::uint32_t>((block + j) >> 32);
+			}
+			input[12] = Vector::Load(counterLow);
+			input[13] = Vector::Load(counterHigh);
+
+			for (int i = 0; i < 16; ++i)
+				x[i] = input[i];
+
+			for (int round = 0; round < DoubleRounds; ++round) {
+				QuarterRound(x[0], x[4], x[8], x[12]);
+				QuarterRound(x[1], x[5], x[9], x[13]);
+				QuarterRound(x[2], x[6], x[10], x[14]);
+				QuarterRound(x[3], x[7], x[11], x[15]);
+				QuarterRound(x[0], x[5], x[10], x[15]);
+				QuarterRound(x[1], x[6], x[11], x[12]);
+				QuarterRound(x[2], x[7], x[8], x[13]);
+				QuarterRound(x[3], x[4], x[9], x[14]);
+			}
+
+			// Transpose the lanes back into four consecutive blocks
+			std::uint32_t words[16][4];
+			for (int i = 0; i < 16; ++i)
+				Vector::Store(words[i], Vector::Add(x[i], input[i]));
+
+			std::uint32_t blocks[4][16];
+			for (int j = 0; j < 4; ++j)
+				for (int i = 0; i < 16; ++i)
+					blocks[j][i] = words[i][j];
+			std::memcpy(keystream, blocks, sizeof(blocks));
+		}
+	}
+#endif // AA_CPU_X64 || AA_CPU_ARM64
+
+	/**
+	 * @brief XORs size bytes of data with the keystream starting at byte offset of the stream.
+	 */
+	inline void Apply(const std::uint8_t key[KeySize], std::uint8_t* data, std::size_t size, std::uint64_t offset) {
+		std::uint32_t state[16];
+		InitState(key, state);
+
+#if defined(AA_CPU_X64) || defined(AA_CPU_ARM64)
+		constexpr std::size_t StepSize = 4 * BlockSize;
+#else
+		constexpr std::size_t StepSize = BlockSize;
+#endif // AA_CPU_X64 || AA_CPU_ARM64
+
+		std::uint64_t block = offset / BlockSize;
+		std::size_t skip = offset % BlockSize;
+		while (size) {
+			std::uint8_t keystream[StepSize];
+			std::size_t step = StepSize;
+#if defined(AA_CPU_X64) || defined(AA_CPU_ARM64)
+			if (skip + size > BlockSize)
+				lanes::Blocks4(state, block, keystream);
+			else {
+				// Short range, one block is enough
+				portable::Block(state, block, keystream);
+				step = BlockSize;
+			}
+#else
+			portable::Block(state, block, keystream);
+#endif // AA_CPU_X64 || AA_CPU_ARM64
+
+			std::size_t count = (std::min)(size, step - skip);
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				std::uint64_t text, stream;
+				std::memcpy(&text, data + i, 8);
+				std::memcpy(&stream, keystream + skip + i, 8);
+				text ^= stream;
+				std::memcpy(data + i, &text, 8);
+			}
+			for (; i < count; ++i)
+				data[i] ^= keystream[skip + i];
+
+			data += count, size -= count, skip = 0, block += step / BlockSize;
+		}
+	}
+}
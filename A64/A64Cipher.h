@@ -0,0 +1,238 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <A64Cpu.h>
+#include <A64Aes.h>
+#include <A64ChaCha.h>
+
+/*
+	Function body cipher shared by the runtime and the offline packer.
+	The first byte of a function holds the int3 entry trap and is saved separately,
+	so only the bytes after it go through the cipher.
+
+	Every algorithm is a keystream XORed over the body, so encryption and decryption are the
+	same pass and any subrange can be processed alone given its offset in the function:
+	- AesCtr: AES-128 in counter mode, AES-NI when available
+	- ChaCha20: four blocks per vector pass, for CPUs without AES-NI
+	- Xor: the original cipher, every byte inverted and XORed with the low key byte.
+	  It has 256 keys and only obfuscates, but it is the cheapest.
+	AA_CIPHER selects an algorithm at compile time (#define AA_CIPHER ChaCha20), otherwise
+	AES is used when the CPU supports AES-NI and ChaCha20 otherwise.
+*/
+
+namespace cipher
+{
+	using Kernel = void(*)(std::uint8_t* data, std::size_t size, std::uint8_t mask); ///< XORs every byte of data with mask
+
+	namespace kernels
+	{
+		inline void Scalar(std::uint8_t* data, std::size_t size, std::uint8_t mask) {
+			for (std::size_t i = 0; i < size; ++i)
+				data[i] ^= mask;
+		}
+
+		/**
+		 * @brief Number of bytes to process one by one so data + head is aligned on alignment.
+		 */
+		inline std::size_t AlignHead(const std::uint8_t* data, std::size_t size, std::size_t alignment) {
+			std::size_t head = (alignment - (reinterpret_cast<std::uintptr_t>(data) & (alignment - 1))) & (alignment - 1);
+			return head < size ? head : size;
+		}
+
+#ifdef AA_CPU_X64
+		inline void Sse2(std::uint8_t* data, std::size_t size, std::uint8_t mask) {
+			std::size_t head = AlignHead(data, size, 16);
+			Scalar(data, head, mask);
+			data += head, size -= head;
+
+			const __m128i key = _mm_set1_epi8(static_cast<char>(mask));
+			for (; size >= 64; data += 64, size -= 64) {
+				__m128i* block = reinterpret_cast<__m128i*>(data);
+				_mm_store_si128(block + 0, _mm_xor_si128(_mm_load_si128(block + 0), key));
+				_mm_store_si128(block + 1, _mm_xor_si128(_mm_load_si128(block + 1), key));
+				_mm_store_si128(block + 2, _mm_xor_si128(_mm_load_si128(block + 2), key));
+				_mm_store_si128(block + 3, _mm_xor_si128(_mm_load_si128(block + 3), key));
+			}
+			for (; size >= 16; data += 16, size -= 16) {
+				__m128i* block = reinterpret_cast<__m128i*>(data);
+				_mm_store_si128(block, _mm_xor_si128(_mm_load_si128(block), key));
+			}
+			Scalar(data, size, mask);
+		}
+
+		AA_TARGET("avx2")
+		inline void Avx2(std::uint8_t* data, std::size_t size, std::uint8_t mask) {
+			std::size_t head = AlignHead(data, size, 32);
+			Scalar(data, head, mask);
+			data += head, size -= head;
+
+			const __m256i key = _mm256_set1_epi8(static_cast<char>(mask));
+			for (; size >= 128; data += 128, size -= 128) {
+				__m256i* block = reinterpret_cast<__m256i*>(data);
+				_mm256_store_si256(block + 0, _mm256_xor_si256(_mm256_load_si256(block + 0), key));
+				_mm256_store_si256(block + 1, _mm256_xor_si256(_mm256_load_si256(block + 1), key));
+				_mm256_store_si256(block + 2, _mm256_xor_si256(_mm256_load_si256(block + 2), key));
+				_mm256_store_si256(block + 3, _mm256_xor_si256(_mm256_load_si256(block + 3), key));
+			}
+			for (; size >= 32; data += 32, size -= 32) {
+				__m256i* block = reinterpret_cast<__m256i*>(data);
+				_mm256_store_si256(block, _mm256_xor_si256(_mm256_load_si256(block), key));
+			}
+			// Tail of up to 31 bytes: one 16 byte step then bytes
+			if (size >= 16) {
+				__m128i* block = reinterpret_cast<__m128i*>(data);
+				_mm_store_si128(block, _mm_xor_si128(_mm_load_si128(block), _mm256_castsi256_si128(key)));
+				data += 16, size -= 16;
+			}
+			Scalar(data, size, mask);
+		}
+
+		AA_TARGET("avx512f,avx512bw")
+		inline void Avx512(std::uint8_t* data, std::size_t size, std::uint8_t mask) {
+			std::size_t head = AlignHead(data, size, 64);
+			const __m512i key = _mm512_set1_epi8(static_cast<char>(mask));
+
+			// Head and tail are done with masked loads and stores, the bytes outside the mask are never touched
+			if (head) {
+				__mmask64 lanes = (1ull << head) - 1;
+				_mm512_mask_storeu_epi8(data, lanes, _mm512_xor_si512(_mm512_maskz_loadu_epi8(lanes, data), key));
+				data += head, size -= head;
+			}
+			for (; size >= 256; data += 256, size -= 256) {
+				__m512i* block = reinterpret_cast<__m512i*>(data);
+				_mm512_store_si512(block + 0, _mm512_xor_si512(_mm512_load_si512(block + 0), key));
+				_mm512_store_si512(block + 1, _mm512_xor_si512(_mm512_load_si512(block + 1), key));
+				_mm512_store_si512(block + 2, _mm512_xor_si512(_mm512_load_si512(block + 2), key));
+				_mm512_store_si512(block + 3, _mm512_xor_si512(_mm512_load_si512(block + 3), key));
+			}
+			for (; size >= 64; data += 64, size -= 64) {
+				__m512i* block = reinterpret_cast<__m512i*>(data);
+				_mm512_store_si512(block, _mm512_xor_si512(_mm512_load_si512(block), key));
+			}
+			if (size) {
+				__mmask64 lanes = (1ull << size) - 1;
+				_mm512_mask_storeu_epi8(data, lanes, _mm512_xor_si512(_mm512_maskz_loadu_epi8(lanes, data), key));
+			}
+		}
+#endif // AA_CPU_X64
+
+#ifdef AA_CPU_ARM64
+		inline void Neon(std::uint8_t* data, std::size_t size, std::uint8_t mask) {
+			std::size_t head = AlignHead(data, size, 16);
+			Scalar(data, head, mask);
+			data += head, size -= head;
+
+			const uint8x16_t key = vdupq_n_u8(mask);
+			for (; size >= 64; data += 64, size -= 64) {
+				uint8x16x4_t block = vld1q_u8_x4(data);
+				block.val[0] = veorq_u8(block.val[0], key);
+				block.val[1] = veorq_u8(block.val[1], key);
+				block.val[2] = veorq_u8(block.val[2], key);
+				block.val[3] = veorq_u8(block.val[3], key);
+				vst1q_u8_x4(data, block);
+			}
+			for (; size >= 16; data += 16, size -= 16)
+				vst1q_u8(data, veorq_u8(vld1q_u8(data), key));
+			Scalar(data, size, mask);
+		}
+#endif // AA_CPU_ARM64
+	}
+
+	/**
+	 * @brief Selects the widest kernel the CPU supports.
+	 */
+	inline Kernel SelectKernel() {
+#if defined(AA_CPU_X64)
+		if (cpu::Supported().avx512)
+			return kernels::Avx512;
+		if (cpu::Supported().avx2)
+			return kernels::Avx2;
+		return kernels::Sse2; // Baseline of x86-64
+#elif defined(AA_CPU_ARM64)
+		return kernels::Neon; // Baseline of ARM64
+#else
+		return kernels::Scalar;
+#endif
+	}
+
+	/**
+	 * @brief Kernel selected for this CPU, chosen on the first call.
+	 */
+	inline Kernel ActiveKernel() {
+		static const Kernel kernel = SelectKernel();
+		return kernel;
+	}
+
+	enum class Algorithm : std::uint8_t {
+		Xor = 0,
+		AesCtr = 1,
+		ChaCha20 = 2,
+	};
+
+	/**
+	 * @brief Key of one function. AesCtr uses bytes 0-15 as key and 16-23 as nonce,
+	 * ChaCha20 all of them, Xor the first one.
+	 */
+	struct Key {
+		std::uint8_t bytes[32];
+	};
+
+	static_assert(sizeof(Key) == chacha::KeySize && sizeof(Key) >= aes::KeySize + sizeof(std::uint64_t));
+
+	/**
+	 * @brief Algorithm new keys are generated for.
+	 */
+	inline Algorithm DefaultAlgorithm() {
+#if defined(AA_CIPHER)
+		return Algorithm::AA_CIPHER;
+#elif defined(AA_CPU_X64)
+		return cpu::Supported().aes ? Algorithm::AesCtr : Algorithm::ChaCha20;
+#else
+		return Algorithm::ChaCha20;
+#endif // AA_CIPHER
+	}
+
+	/**
+	 * @brief XORs data with the keystream of the key, starting at byte offset of the stream.
+	 *
+	 * Processing a range at its offset gives the same bytes as processing the whole stream.
+	 */
+	inline void Apply(Algorithm algorithm, const Key& key, std::uint8_t* data, std::size_t size, std::uint64_t offset) {
+		switch (algorithm) {
+		case Algorithm::AesCtr: {
+			std::uint64_t nonce;
+			std::memcpy(&nonce, key.bytes + aes::KeySize, sizeof(nonce));
+			aes::ApplyCtr(key.bytes, nonce, data, size, offset);
+			break;
+		}
+		case Algorithm::ChaCha20:
+			chacha::Apply(key.bytes, data, size, offset);
+			break;
+		case Algorithm::Xor:
+		default: {
+			std::uint8_t mask = static_cast<std::uint8_t>(~key.bytes[0]); // ~b ^ k == b ^ ~k
+			if (size < 32)
+				kernels::Scalar(data, size, mask); // Not worth the indirect call and the vector setup
+			else
+				ActiveKernel()(data, size, mask);
+			break;
+		}
+		}
+	}
+
+	/**
+	 * @brief Encrypts the function body in place, skipping the entry byte.
+	 */
+	inline void Encrypt(std::uint8_t* function, std::size_t size, Algorithm algorithm, const Key& key) {
+		if (size > 1)
+			Apply(algorithm, key, function + 1, size - 1, 1);
+	}
+
+	/**
+	 * @brief Reverses Encrypt.
+	 */
+	inline void Decrypt(std::uint8_t* function, std::size_t size, Algorithm algorithm, const Key& key) {
+		Encrypt(function, size, algorithm, key);
+	}
+}
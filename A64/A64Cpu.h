@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define AA_CPU_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define AA_CPU_ARM64
+#include <arm_neon.h>
+#endif
+
+/*
+	Instruction set extensions available at runtime.
+	Kernels built for an extension are compiled with AA_TARGET so the rest of the
+	binary keeps the baseline instruction set, and only run when the matching check passes.
+*/
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AA_TARGET(isa) ///< MSVC emits any intrinsic without a target switch
+#else
+#define AA_TARGET(isa) __attribute__((target(isa)))
+#endif // _MSC_VER
+
+namespace cpu
+{
+#ifdef AA_CPU_X64
+	/**
+	 * @brief Executes cpuid for the leaf and subleaf, registers receives eax, ebx, ecx and edx.
+	 */
+	inline void CpuId(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t registers[4]) {
+#ifdef _MSC_VER
+		__cpuidex(reinterpret_cast<int*>(registers), static_cast<int>(leaf), static_cast<int>(subleaf));
+#else
+		__asm__("cpuid" : "=a"(registers[0]), "=b"(registers[1]), "=c"(registers[2]), "=d"(registers[3]) : "a"(leaf), "c"(subleaf));
+#endif // _MSC_VER
+	}
+
+	/**
+	 * @brief Checks that the OS saves the register state in xcrMask on context switches.
+	 */
+	inline bool OsSavesState(std::uint64_t xcrMask) {
+		std::uint32_t registers[4];
+		CpuId(1, 0, registers);
+		if (!(registers[2] & (1u << 27))) // OSXSAVE
+			return false;
+
+#ifdef _MSC_VER
+		std::uint64_t xcr = _xgetbv(0);
+#else
+		std::uint32_t xcrLow, xcrHigh;
+		__asm__("xgetbv" : "=a"(xcrLow), "=d"(xcrHigh) : "c"(0));
+		std::uint64_t xcr = static_cast<std::uint64_t>(xcrHigh) << 32 | xcrLow;
+#endif // _MSC_VER
+		return (xcr & xcrMask) == xcrMask;
+	}
+
+	/**
+	 * @brief Bytes xsave writes for the register state the OS enables, 0 when it doesn't enable xsave.
+	 */
+	inline std::uint32_t ExtendedStateSize() {
+		std::uint32_t registers[4];
+		CpuId(1, 0, registers);
+		if (!(registers[2] & (1u << 27))) // OSXSAVE
+			return 0;
+
+		CpuId(0xD, 0, registers);
+		return registers[1];
+	}
+
+	struct Features {
+		bool avx2 = false;
+		bool avx512 = false;  ///< AVX-512F and AVX-512BW
+		bool aes = false;     ///< AES-NI
+		bool rdrand = false;
+		bool rdseed = false;
+	};
+
+	inline Features DetectFeatures() {
+		constexpr std::uint64_t avxState = 0x6;      // XMM and YMM
+		constexpr std::uint64_t avx512State = 0xE6;  // XMM, YMM, opmask and ZMM
+
+		Features features;
+		std::uint32_t leaf1[4], leaf7[4];
+		CpuId(1, 0, leaf1);
+		CpuId(7, 0, leaf7);
+
+		features.aes = leaf1[2] & (1u << 25);
+		features.rdrand = leaf1[2] & (1u << 30);
+		features.rdseed = leaf7[1] & (1u << 18);
+		features.avx2 = (leaf7[1] & (1u << 5)) && OsSavesState(avxState);
+		features.avx512 = (leaf7[1] & (1u << 16)) && (leaf7[1] & (1u << 30)) && OsSavesState(avx512State);
+		return features;
+	}
+
+	/**
+	 * @brief Features of this CPU, detected on the first call.
+	 */
+	inline const Features& Supported() {
+		static const Features features = DetectFeatures();
+		return features;
+	}
+#endif // AA_CPU_X64
+}
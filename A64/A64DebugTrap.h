@@ -0,0 +1,222 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <A64LazyImporter.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <linux/hw_breakpoint.h>
+#endif // _WIN32
+
+/*
+	Execute breakpoints in the debug registers of the calling thread.
+	A debug register breaks on an address without writing the code. The page holding it never becomes
+	writable, and no core has to discard the instructions it already fetched from it. There are four per
+	thread, Dr0 to Dr3. Windows sets them with SetThreadContext. Linux only lets a thread program them
+	through perf_event_open(PERF_TYPE_BREAKPOINT). With sigtrap set, a hit raises a synchronous SIGTRAP
+	(si_code TRAP_PERF) at the address, before its instruction runs.
+	Only the thread that armed an address breaks on it. Arming an address the thread already armed
+	counts one more reference to the same register.
+*/
+
+namespace debugtrap {
+	constexpr std::size_t SlotCount = 4; ///< Dr0 to Dr3
+#ifndef _WIN32
+	constexpr int TrapCode = 6;          ///< si_code of a perf event SIGTRAP, TRAP_PERF isn't in every libc
+#endif // !_WIN32
+
+	class ThreadTraps {
+	public:
+		/**
+		 * @brief Returns the debug registers of the calling thread.
+		 */
+		static ThreadTraps& Current() {
+			static thread_local ThreadTraps traps;
+			return traps;
+		}
+
+		ThreadTraps() = default;
+		ThreadTraps(const ThreadTraps&) = delete;
+		ThreadTraps& operator=(const ThreadTraps&) = delete;
+
+		~ThreadTraps() {
+#ifndef _WIN32
+			for (Slot& slot : slots)
+				if (slot.event >= 0)
+					close(slot.event);
+#endif // !_WIN32
+		}
+
+		/**
+		 * @brief Breaks at the address when the calling thread executes it, or counts one more reference to its breakpoint.
+		 *
+		 * @return false If the four registers are in use or the system doesn't let the thread set them.
+		 */
+		bool Arm(std::uintptr_t address) {
+			if (unavailable)
+				return false;
+#ifdef _WIN32
+			if (!initialized && !initialize())
+				return false;
+#endif // _WIN32
+
+			Slot* free = nullptr;
+			for (Slot& slot : slots) {
+				if (slot.references && slot.address == address) {
+					++slot.references;
+					return true;
+				}
+				if (!free && !slot.references && !slot.foreign)
+					free = &slot;
+			}
+
+			if (!free || !program(*free, address, true))
+				return false;
+
+			free->address = address;
+			free->references = 1;
+			return true;
+		}
+
+		/**
+		 * @brief Removes a reference to the breakpoint at the address, and the breakpoint with the last one.
+		 *
+		 * @return true If the thread no longer breaks at the address.
+		 */
+		bool Disarm(std::uintptr_t address) {
+			for (Slot& slot : slots) {
+				if (!slot.references || slot.address != address)
+					continue;
+
+				if (--slot.references != 0)
+					return false;
+
+				program(slot, address, false);
+				return true;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Returns true if the calling thread breaks at the address.
+		 */
+		bool Armed(std::uintptr_t address) const {
+			for (const Slot& slot : slots)
+				if (slot.references && slot.address == address)
+					return true;
+			return false;
+		}
+
+#ifdef _WIN32
+		/**
+		 * @brief Writes the registers into a context the thread resumes with, NtContinue would restore the ones it captured.
+		 */
+		void Load(PCONTEXT context) const {
+			context->Dr0 = slots[0].address;
+			context->Dr1 = slots[1].address;
+			context->Dr2 = slots[2].address;
+			context->Dr3 = slots[3].address;
+			context->Dr7 = control;
+			context->ContextFlags |= CONTEXT_DEBUG_REGISTERS;
+		}
+#endif // _WIN32
+
+	private:
+#ifdef _WIN32
+		// Registers a debugger armed before are kept, the thread only takes the free ones
+		bool initialize() {
+			initialized = true;
+
+			CONTEXT context = {};
+			context.ContextFlags = CONTEXT_DEBUG_REGISTERS;
+			if (!ShadowCall<BOOL>("GetThreadContext", reinterpret_cast<HANDLE>(-2), &context)) { // GetCurrentThread()
+				unavailable = true;
+				return false;
+			}
+
+			const DWORD64 registers[SlotCount] = { context.Dr0, context.Dr1, context.Dr2, context.Dr3 };
+			for (std::size_t index = 0; index < SlotCount; ++index) {
+				slots[index].foreign = (context.Dr7 >> (index * 2)) & 3;
+				if (slots[index].foreign)
+					slots[index].address = static_cast<std::uintptr_t>(registers[index]);
+			}
+			control = context.Dr7;
+			return true;
+		}
+#endif // _WIN32
+
+		struct Slot {
+			std::uintptr_t address = 0;  ///< Address the register breaks at.
+			std::uint32_t references = 0; ///< Calls of the thread returning to the address, the register is armed while not 0.
+			bool foreign = false;         ///< Armed by a debugger before the thread first used the registers, left alone.
+#ifndef _WIN32
+			int event = -1;               ///< perf event of the register, opened at its first use.
+#endif // !_WIN32
+		};
+
+		bool program(Slot& slot, std::uintptr_t address, bool enable) {
+#ifdef _WIN32
+			// Local enable bit, condition and length 0 break on execution
+			std::size_t index = &slot - slots;
+			DWORD64 enableBit = DWORD64(1) << (index * 2);
+			control &= ~(enableBit | (DWORD64(0xF) << (16 + index * 4)));
+			if (enable)
+				control |= enableBit;
+
+			std::uintptr_t previous = slot.address;
+			slot.address = enable ? address : 0;
+			CONTEXT context = {};
+			Load(&context);
+			context.ContextFlags = CONTEXT_DEBUG_REGISTERS;
+			if (ShadowCall<BOOL>("SetThreadContext", reinterpret_cast<HANDLE>(-2), &context)) // GetCurrentThread()
+				return true;
+
+			slot.address = previous;
+			control &= ~enableBit;
+			return false;
+#else
+			if (!enable)
+				return ioctl(slot.event, PERF_EVENT_IOC_DISABLE, 0) == 0;
+
+			perf_event_attr attributes = {};
+			attributes.size = sizeof(attributes);
+			attributes.type = PERF_TYPE_BREAKPOINT;
+			attributes.bp_type = HW_BREAKPOINT_X;
+			attributes.bp_addr = address;
+			attributes.bp_len = sizeof(long);
+			attributes.sample_period = 1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			attributes.remove_on_exec = 1;
+			attributes.sigtrap = 1;
+
+			// An event of the register moves to the address and is enabled by the same call
+			if (slot.event >= 0)
+				return ioctl(slot.event, PERF_EVENT_IOC_MODIFY_ATTRIBUTES, &attributes) == 0;
+
+			// Only the calling thread, on any CPU
+			slot.event = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+			if (slot.event >= 0)
+				return true;
+
+			// No register left, a debugger holds them. Otherwise the kernel or its policy forbid it for good
+			if (errno != ENOSPC)
+				unavailable = true;
+			return false;
+#endif // _WIN32
+		}
+
+		Slot slots[SlotCount];
+		bool unavailable = false;  ///< The registers can't be set, every arm fails without a system call.
+#ifdef _WIN32
+		bool initialized = false;  ///< The registers armed by a debugger were read.
+		DWORD64 control = 0;       ///< Dr7 of the thread.
+#endif // _WIN32
+	};
+}
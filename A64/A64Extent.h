@@ -0,0 +1,519 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <map>
+#include <iterator>
+#include <span>
+#include <algorithm>
+
+#include <A64Arch.h>
+#include <A64Length.h>
+#include <A64Function.h>
+#include <A64ExtentIndex.h>
+
+/*
+	Control flow based function extent discovery.
+	GetFunctionLength stops at the first "ret; int3" it finds, which cuts functions
+	with several exits short and walks past functions that end in a tail jump.
+	Optimized builds produce both, so instead of scanning linearly we follow the
+	branches of the function with a worklist and record every byte we can reach.
+
+	- Conditional branches queue their target and fall through.
+	- Unconditional jumps queue their target unless it is a tail call, meaning a
+	  known entry point, an address before the function, or an address that looks
+	  like a function entry (16 byte aligned with int3 or nop padding right before
+	  it). GCC and clang pad between functions with nops, and inside functions
+	  before loops and labels, so a target after nop padding only belongs to the
+	  function when a conditional branch or a jump table of the function reaches it.
+	- Calls fall through, returns / int3 / ud2 / __fastfail end the block.
+	- Falling into nop or int3 padding ends the block when a likely entry or a known
+	  entry follows the padding, as after a call that doesn't return. Code after nop
+	  padding, and tail jump targets before the boundary, are only kept if the function
+	  continues past them or the code there branches back to them, as at the head of a
+	  loop aligned inside the function.
+	- The next function the caller or the module's extent index knows bounds the walk.
+	- Indirect jumps are resolved as switch dispatch for the table layouts emitted
+	  by MSVC and GCC / clang, otherwise they end the block. Tables without a bound
+	  are never read past the end of the section holding them.
+
+	The result is a list of byte ranges. Ranges separated only by padding are
+	merged, so a regular function yields a single range starting at its entry.
+*/
+
+namespace extent
+{
+	constexpr std::size_t MaxFunctionSpan = 0x100000;     ///< Reachable code further than this from the entry is never followed (1 MB)
+	constexpr std::size_t MaxInstructions = 0x40000;      ///< Abort discovery after this many decoded instructions
+	constexpr std::size_t MaxSwitchEntries = 0x1000;      ///< Upper bound for jump tables without a known bound
+	constexpr std::uintptr_t EntryAlignment = 16;         ///< Alignment compilers use for function entries
+	constexpr std::size_t MaxPadding = 0x40;              ///< Padding runs this long end a function whatever follows them
+
+	/**
+	 * @brief Checks if the bytes right before the address end with a nop, in any of the encodings compilers pad with.
+	 */
+	inline bool FollowsNop(std::uintptr_t address) {
+		// Longer forms only add prefixes (66, 2E) in front of these
+		static constexpr std::uint8_t nops[][8] = {
+			{ 0x90 },
+			{ 0x0F, 0x1F, 0x00 },
+			{ 0x0F, 0x1F, 0x40, 0x00 },
+			{ 0x0F, 0x1F, 0x44, 0x00, 0x00 },
+			{ 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00 },
+			{ 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+		};
+		static constexpr std::size_t sizes[] = { 1, 3, 4, 5, 7, 8 };
+
+		for (std::size_t index = 0; index < std::size(sizes); ++index)
+			if (!std::memcmp(reinterpret_cast<const void*>(address - sizes[index]), nops[index], sizes[index]))
+				return true;
+		return false;
+	}
+
+	/**
+	 * @brief Checks if the address follows int3 padding, which compilers only put between functions.
+	 */
+	inline bool FollowsInt3(std::uintptr_t address) {
+		return reinterpret_cast<const std::uint8_t*>(address)[-1] == 0xCC;
+	}
+
+	/**
+	 * @brief Checks if the address looks like the entry point of another function.
+	 */
+	inline bool IsLikelyEntry(std::uintptr_t address) {
+		return (address % EntryAlignment) == 0 && (FollowsInt3(address) || FollowsNop(address));
+	}
+
+	/**
+	 * @brief Returns the end of the section of the loaded module holding the address, 0 if no loaded module holds it.
+	 */
+	inline std::uintptr_t LoadedSectionEnd(std::uintptr_t address) {
+		LoadedModule module;
+		if (!FindLoadedModule(reinterpret_cast<const void*>(address), module))
+			return 0;
+
+#ifdef _WIN32
+		auto dosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(module.base);
+		auto ntHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(module.base + dosHeader->e_lfanew);
+		const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(ntHeaders);
+		for (WORD index = 0; index < ntHeaders->FileHeader.NumberOfSections; ++index, ++section) {
+			std::uintptr_t begin = module.base + section->VirtualAddress;
+			if (address >= begin && address < begin + section->Misc.VirtualSize)
+				return begin + section->Misc.VirtualSize;
+		}
+#else
+		// Section headers aren't loaded, the segment holding the section is the mapped bound
+		for (const ElfW(Phdr)& segment : module.segments) {
+			std::uintptr_t begin = module.base + segment.p_vaddr;
+			if (segment.p_type == PT_LOAD && address >= begin && address < begin + segment.p_memsz)
+				return begin + segment.p_memsz;
+		}
+#endif // _WIN32
+		return 0;
+	}
+
+	/**
+	 * @brief Checks if the instruction is alignment padding (int3 or any form of nop).
+	 */
+	inline bool IsPadding(const OpInstruction& instruction) {
+		if (instruction.map == 0)
+			return instruction.opcode == 0xCC || (instruction.opcode == 0x90 && !(instruction.rex & 1)); // 41 90 is xchg r8d, eax
+		return instruction.map == 1 && !instruction.vex && instruction.opcode == 0x1F;
+	}
+
+	/**
+	 * @brief Full register number of the ModRM.reg field (REX.R extended).
+	 */
+	inline std::uint8_t RegisterOperand(const OpInstruction& instruction) {
+		return instruction.ModrmReg() | ((instruction.rex & 0x04) << 1);
+	}
+
+	/**
+	 * @brief Full register number of the ModRM.rm field (REX.B extended).
+	 */
+	inline std::uint8_t RmOperand(const OpInstruction& instruction) {
+		return instruction.ModrmRm() | ((instruction.rex & 0x01) << 3);
+	}
+
+	/**
+	 * @brief Full register number of the SIB.base field (REX.B extended).
+	 */
+	inline std::uint8_t SibBase(const OpInstruction& instruction) {
+		return (instruction.sib & 7) | ((instruction.rex & 0x01) << 3);
+	}
+
+	/**
+	 * @brief Full register number of the SIB.index field (REX.X extended), 4 means none.
+	 */
+	inline std::uint8_t SibIndex(const OpInstruction& instruction) {
+		return ((instruction.sib >> 3) & 7) | ((instruction.rex & 0x02) << 2);
+	}
+
+	inline std::uint8_t SibScale(const OpInstruction& instruction) {
+		return std::uint8_t(1) << (instruction.sib >> 6);
+	}
+
+	/*
+		Register state tracked along one linear walk, used to recognize jump tables.
+	*/
+	struct SwitchState {
+		std::uintptr_t leaValue[16] = {};      ///< Address loaded by lea reg, [rip + disp] (0 if unknown)
+		std::uintptr_t table = 0;              ///< Jump table address
+		std::uintptr_t entryBase = 0;          ///< Value entries are relative to (0 for absolute entries)
+		std::uint8_t entrySize = 0;            ///< Size of a jump table entry (4, or 8 for absolute x64 entries)
+		std::uint8_t targetRegister = 0xFF;    ///< Register the dispatch target was loaded into
+		std::size_t bound = 0;                 ///< Entry count from the last cmp reg, imm (0 if unknown)
+	};
+}
+
+/**
+ * @brief Discovers the byte ranges of the function starting at the passed address.
+ *
+ * @param function The function entry point.
+ * @param knownEntries Entry points of other functions sorted by address, jumps to them are treated as tail calls.
+ * @param sections Sections jump tables are read from, when the code isn't in a loaded module (images read from a file).
+ * @return The merged byte ranges of the function sorted by address, the first one starts at the entry.
+ *         An empty list means the function could not be decoded.
+ */
+template<typename Arch = ArchNative>
+inline std::vector<FunctionRange> GetFunctionExtent(void* function, std::span<void* const> knownEntries = {}, std::span<const FunctionRange> sections = {}) {
+	static_assert(Arch::FixedInstructionSize == 0, "Control flow discovery is only implemented for x86");
+	using namespace extent;
+
+	std::vector<FunctionRange> ranges;
+	if (!function)
+		return ranges;
+
+	constexpr std::uint8_t PointerSize = Arch::X64 ? 8 : 4;
+	const std::uintptr_t entry = reinterpret_cast<std::uintptr_t>(function);
+	const std::uintptr_t limit = entry + MaxFunctionSpan;
+
+	// The function ends at the latest where the next function the caller or the module's tables know begins
+	std::uintptr_t boundary = limit;
+	auto nextKnown = std::upper_bound(knownEntries.begin(), knownEntries.end(), function, std::less<void*>());
+	if (nextKnown != knownEntries.end())
+		boundary = std::min(boundary, reinterpret_cast<std::uintptr_t>(*nextKnown));
+	if (sections.empty())
+		if (const FunctionRange* next = FunctionExtentIndex::ForAddress(function).After(entry))
+			boundary = std::min(boundary, next->begin);
+
+	// Ranges of instructions we already decoded by address, used to stop at blocks we walked before
+	std::map<std::uintptr_t, std::uintptr_t> blocks;
+	std::vector<std::uintptr_t> worklist{ entry };
+	std::size_t decoded = 0;
+
+	// Code after nop padding that fall-through ran into, and targets of jumps taken for tail calls before the boundary.
+	// Both are kept if the function turns out to reach them, as loop heads aligned inside the function are
+	std::vector<std::uintptr_t> deferred;
+
+	auto isKnownEntry = [&](std::uintptr_t address) {
+		return address != entry && std::binary_search(knownEntries.begin(), knownEntries.end(), reinterpret_cast<void*>(address), std::less<void*>());
+	};
+
+	auto isVisited = [&](std::uintptr_t address) {
+		auto next = blocks.upper_bound(address);
+		return next != blocks.begin() && address < std::prev(next)->second;
+	};
+
+	// Jumps leaving the function: before the entry, past the boundary, or onto another function.
+	// Only a conditional branch or a jump table keeps a target after nop padding inside the function
+	auto isTailCall = [&](std::uintptr_t target, bool conditional) {
+		if (target < entry || target >= boundary || isKnownEntry(target))
+			return true;
+		return target != entry && IsLikelyEntry(target) && (!conditional || FollowsInt3(target));
+	};
+
+	auto queue = [&](std::uintptr_t target, bool conditional) {
+		if (isTailCall(target, conditional)) {
+			if (target > entry && target < boundary && !isKnownEntry(target))
+				deferred.push_back(target);
+		}
+		else if (!isVisited(target)) {
+			worklist.push_back(target);
+		}
+	};
+
+	// Padding starting at the address and followed by the entry of another function ends the function, whatever ran into it
+	auto paddingEndsFunction = [&](std::uintptr_t address, std::uintptr_t& afterPadding) {
+		OpInstruction padding;
+		afterPadding = address;
+		while (afterPadding < boundary && afterPadding - address < MaxPadding
+			&& OpDecode(reinterpret_cast<const std::uint8_t*>(afterPadding), padding, Arch::X64) && IsPadding(padding))
+			afterPadding += padding.size;
+		return afterPadding >= boundary || afterPadding - address >= MaxPadding || isKnownEntry(afterPadding) || IsLikelyEntry(afterPadding);
+	};
+
+	// Tables are read up to the end of their section
+	auto tableEnd = [&](std::uintptr_t table) -> std::uintptr_t {
+		for (const FunctionRange& section : sections)
+			if (section.Contains(table))
+				return section.end;
+		return sections.empty() ? LoadedSectionEnd(table) : 0;
+	};
+
+	auto walk = [&]() {
+		while (!worklist.empty()) {
+			std::uintptr_t address = worklist.back();
+			worklist.pop_back();
+
+			if (isVisited(address))
+				continue;
+
+			FunctionRange block{ address, address };
+			SwitchState state;
+			OpInstruction instruction;
+			bool fallsThrough = true;
+
+			while (fallsThrough) {
+
+				// Stop when running into a block that was walked already or into another function
+				if (block.end != block.begin && (isVisited(block.end) || isKnownEntry(block.end)))
+					break;
+
+				if (++decoded > MaxInstructions)
+					return false;
+				if (block.end >= boundary) {
+					if (boundary == limit)
+						return false;
+					break;
+				}
+
+				if (!OpDecode(reinterpret_cast<const std::uint8_t*>(block.end), instruction, Arch::X64))
+					return false;
+
+				// Falling into padding before another function, after a call that doesn't return. The padding isn't part of the block
+				std::uintptr_t afterPadding;
+				if (block.end != block.begin && IsPadding(instruction) && paddingEndsFunction(block.end, afterPadding)) {
+					if (instruction.opcode != 0xCC && IsLikelyEntry(afterPadding) && afterPadding < boundary && !isKnownEntry(afterPadding))
+						deferred.push_back(afterPadding);
+					break;
+				}
+
+				const std::uintptr_t next = block.end + instruction.size;
+				const std::uint8_t opcode = instruction.opcode;
+				block.end = next;
+
+				if (instruction.map == 0) {
+					switch (opcode) {
+					case 0xC3: case 0xC2:            // ret
+					case 0xCC:                       // int3
+					case 0xF4:                       // hlt
+						fallsThrough = false;
+						break;
+
+					case 0xCD:                       // int 29h is __fastfail and never returns
+						fallsThrough = instruction.imm != 0x29;
+						break;
+
+					case 0xEB: case 0xE9:            // jmp rel
+						queue(instruction.BranchTarget(), false);
+						fallsThrough = false;
+						break;
+
+					case 0xE0: case 0xE1: case 0xE2: case 0xE3: // loop / jrcxz
+						queue(instruction.BranchTarget(), true);
+						break;
+
+					case 0x3C: case 0x3D:            // cmp al / eax, imm
+						state.bound = static_cast<std::size_t>(instruction.imm) + 1;
+						break;
+
+					case 0x80: case 0x81: case 0x83: // cmp r/m, imm
+						if (instruction.ModrmReg() == 7)
+							state.bound = static_cast<std::size_t>(instruction.imm) + 1;
+						break;
+
+					case 0x8D:                       // lea reg, [rip + disp]
+						if (instruction.ripRelative)
+							state.leaValue[RegisterOperand(instruction)] = next + instruction.disp;
+						else
+							state.leaValue[RegisterOperand(instruction)] = 0;
+						break;
+
+					case 0x8B: case 0x63:            // mov / movsxd reg, [base + index * 4 + disp]
+						if (instruction.hasSib && instruction.ModrmMod() != 3 && SibScale(instruction) == 4 && SibIndex(instruction) != 4) {
+							std::uintptr_t base = state.leaValue[SibBase(instruction)];
+							bool noBase = instruction.ModrmMod() == 0 && (instruction.sib & 7) == 5;
+
+							if (noBase) {
+								// mov reg, [index * 4 + table] with absolute entries (x86)
+								state.table = static_cast<std::uintptr_t>(static_cast<std::uint32_t>(instruction.disp));
+								state.entryBase = 0;
+							}
+							else if (base && instruction.disp) {
+								// MSVC x64: mov reg, [imagebase + index * 4 + table rva], entries are rvas
+								state.table = base + instruction.disp;
+								state.entryBase = base;
+							}
+							else if (base) {
+								// GCC / clang: movsxd reg, [table + index * 4], entries are relative to the table
+								state.table = base;
+								state.entryBase = base;
+							}
+							else {
+								break;
+							}
+
+							state.entrySize = 4;
+							state.targetRegister = RegisterOperand(instruction);
+						}
+						break;
+
+					case 0xFF:
+						if (instruction.ModrmReg() == 4 || instruction.ModrmReg() == 5) {
+
+							// jmp [index * pointer size + table] (absolute jump table, x86 and non PIC x64)
+							if (instruction.ModrmReg() == 4 && instruction.hasSib && instruction.ModrmMod() == 0
+								&& (instruction.sib & 7) == 5 && SibScale(instruction) == PointerSize) {
+								state.table = static_cast<std::uintptr_t>(static_cast<std::uint32_t>(instruction.disp));
+								state.entryBase = 0;
+								state.entrySize = PointerSize;
+								state.targetRegister = 0xFF;
+							}
+							// jmp reg, dispatch through the table loaded into it
+							else if (instruction.ModrmReg() != 4 || instruction.ModrmMod() != 3 || RmOperand(instruction) != state.targetRegister) {
+								state.table = 0;
+							}
+
+							std::uintptr_t end = state.table ? tableEnd(state.table) : 0;
+							if (end > state.table) {
+								std::size_t count = std::min({ state.bound ? state.bound : MaxSwitchEntries, MaxSwitchEntries, (end - state.table) / state.entrySize });
+								for (std::size_t index = 0; index < count; ++index) {
+									const void* slot = reinterpret_cast<const void*>(state.table + index * state.entrySize);
+									std::uintptr_t target;
+
+									if (state.entrySize == sizeof(std::uint64_t)) {
+										std::uint64_t value;
+										std::memcpy(&value, slot, sizeof(value));
+										target = static_cast<std::uintptr_t>(value);
+									}
+									else {
+										std::int32_t value;
+										std::memcpy(&value, slot, sizeof(value));
+										target = state.entryBase ? state.entryBase + value : static_cast<std::uintptr_t>(static_cast<std::uint32_t>(value));
+									}
+
+									// Without a bound the table ends at the first entry that leaves the function
+									if (target < entry || target >= boundary || (!state.bound && IsLikelyEntry(target)))
+										break;
+
+									queue(target, true);
+								}
+							}
+							fallsThrough = false;
+						}
+						break;
+
+					default:
+						// Conditional jumps with an 8 bit displacement
+						if (opcode >= 0x70 && opcode <= 0x7F)
+							queue(instruction.BranchTarget(), true);
+						break;
+					}
+				}
+				else if (instruction.map == 1 && !instruction.vex) {
+					// Conditional jumps with a 32 bit displacement
+					if (opcode >= 0x80 && opcode <= 0x8F)
+						queue(instruction.BranchTarget(), true);
+
+					// ud2
+					if (opcode == 0x0B)
+						fallsThrough = false;
+				}
+			}
+
+			if (block.end > block.begin)
+				blocks.emplace(block.begin, block.end);
+		}
+		return true;
+	};
+
+	// Deferred code belongs to the function if the function continues past it, or if the code branches back into
+	// the function before the next padding that ends one
+	auto isReached = [&](std::uintptr_t address) {
+		if (blocks.upper_bound(address) != blocks.end())
+			return true;
+
+		OpInstruction instruction;
+		for (std::uintptr_t cursor = address; cursor < boundary && !isKnownEntry(cursor) && ++decoded <= MaxInstructions; cursor += instruction.size) {
+			if (!OpDecode(reinterpret_cast<const std::uint8_t*>(cursor), instruction, Arch::X64) || (instruction.map == 0 && instruction.opcode == 0xCC))
+				return false;
+			std::uintptr_t afterPadding;
+			if (cursor != address && IsPadding(instruction) && paddingEndsFunction(cursor, afterPadding))
+				return false;
+
+			bool call = instruction.map == 0 && instruction.opcode == 0xE8;
+			if (instruction.relative && !call && instruction.BranchTarget() > entry && instruction.BranchTarget() <= address)
+				return true;
+		}
+		return false;
+	};
+
+	if (!walk())
+		return {};
+
+	for (bool extended = true; extended;) {
+		extended = false;
+		std::vector<std::uintptr_t> pending;
+		pending.swap(deferred);
+
+		for (std::uintptr_t address : pending) {
+			if (isVisited(address))
+				continue;
+			if (!isReached(address)) {
+				deferred.push_back(address);
+				continue;
+			}
+
+			worklist.push_back(address);
+			if (!walk())
+				return {};
+			extended = true;
+		}
+	}
+
+	// Merge blocks that touch or are only separated by padding
+	auto isPaddingGap = [&](std::uintptr_t begin, std::uintptr_t end) {
+		OpInstruction instruction;
+		while (begin < end) {
+			if (!OpDecode(reinterpret_cast<const std::uint8_t*>(begin), instruction, Arch::X64) || !IsPadding(instruction))
+				return false;
+			begin += instruction.size;
+		}
+		return begin == end;
+	};
+
+	for (const auto& [begin, end] : blocks) {
+		if (!ranges.empty() && (begin <= ranges.back().end || isPaddingGap(ranges.back().end, begin)))
+			ranges.back().end = std::max(ranges.back().end, end);
+		else
+			ranges.push_back({ begin, end });
+	}
+
+	return ranges;
+}
+
+/**
+ * @brief Returns the size of the contiguous range that starts at the function entry.
+ *
+ * Blocks the compiler moved away from the function body (cold paths) are not
+ * included, so the result never covers bytes that belong to another function.
+ * Fixed width architectures fall back to GetFunctionLength.
+ *
+ * @param function The function entry point.
+ * @param knownEntries Entry points of other functions sorted by address, jumps to them are treated as tail calls.
+ * @param sections Sections jump tables are read from, when the code isn't in a loaded module.
+ * @return The size in bytes, or 0 if the function could not be decoded.
+ */
+template<typename Arch = ArchNative>
+inline std::int32_t GetFunctionExtentLength(void* function, std::span<void* const> knownEntries = {}, std::span<const FunctionRange> sections = {}) {
+	if constexpr (Arch::FixedInstructionSize != 0) {
+		return GetFunctionLength<Arch>(function);
+	}
+	else {
+		std::vector<FunctionRange> ranges = GetFunctionExtent<Arch>(function, knownEntries, sections);
+		if (ranges.empty() || ranges.front().begin != reinterpret_cast<std::uintptr_t>(function))
+			return 0;
+		return static_cast<std::int32_t>(ranges.front().Size());
+	}
+}
@@ -0,0 +1,586 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <span>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include <A64Mapping.h>
+#include <A64Module.h>
+#include <A64Pdb.h>
+
+#ifdef _WIN32
+#include <A64LazyImporter.h>
+#endif // _WIN32
+
+/*
+	Function extent index built from the tables the toolchain already emits.
+	Instead of disassembling, the begin / end address of every function in a module
+	is read once into a sorted array and sizes are answered with a binary search.
+
+	- PE: the exception directory (.pdata RUNTIME_FUNCTION entries) of the loaded image,
+	  completed by the procedure symbols of its PDB when the PDB can be found.
+	- ELF: st_size of STT_FUNC symbols in .symtab / .dynsym, plus the FDE ranges in
+	  .eh_frame when the binary is stripped. ELF images are read from their file.
+
+	Functions without an entry (leaf functions without unwind data and no PDB, stripped
+	static functions) are not in the index and have to be measured instead.
+*/
+
+struct FunctionRange {
+	std::uintptr_t begin; ///< First byte of the range
+	std::uintptr_t end;   ///< One past the last byte of the range
+
+	std::size_t Size() const { return end - begin; }
+	bool Contains(std::uintptr_t address) const { return address >= begin && address < end; }
+};
+
+namespace elf
+{
+	// Minimal ELF64 definitions so the parser doesn't depend on <elf.h>
+	struct Header {
+		std::uint8_t ident[16];
+		std::uint16_t type, machine;
+		std::uint32_t version;
+		std::uint64_t entry, phoff, shoff;
+		std::uint32_t flags;
+		std::uint16_t ehsize, phentsize, phnum, shentsize, shnum, shstrndx;
+	};
+
+	struct SectionHeader {
+		std::uint32_t name, type;
+		std::uint64_t flags, addr, offset, size;
+		std::uint32_t link, info;
+		std::uint64_t addralign, entsize;
+	};
+
+	struct ProgramHeader {
+		std::uint32_t type, flags;
+		std::uint64_t offset, vaddr, paddr, filesz, memsz, align;
+	};
+
+	struct Symbol {
+		std::uint32_t name;
+		std::uint8_t info, other;
+		std::uint16_t shndx;
+		std::uint64_t value, size;
+	};
+
+	constexpr std::uint8_t Magic[4] = { 0x7F, 'E', 'L', 'F' };
+	constexpr std::uint8_t Class64 = 2;
+	constexpr std::uint32_t SectionSymtab = 2;
+	constexpr std::uint32_t SectionDynsym = 11;
+	constexpr std::uint32_t SegmentLoad = 1;
+	constexpr std::uint32_t SegmentNote = 4;
+	constexpr std::uint8_t SymbolFunction = 2;
+
+	/*
+		Bounds checked view over an ELF file.
+	*/
+	class File {
+	public:
+		File(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+		bool Valid() const {
+			return size_ >= sizeof(Header) && !std::memcmp(data_, Magic, sizeof(Magic)) && data_[4] == Class64
+				&& Contains(GetHeader()->shoff, std::size_t(GetHeader()->shnum) * sizeof(SectionHeader));
+		}
+
+		const Header* GetHeader() const { return reinterpret_cast<const Header*>(data_); }
+
+		std::span<const SectionHeader> Sections() const {
+			return { reinterpret_cast<const SectionHeader*>(data_ + GetHeader()->shoff), GetHeader()->shnum };
+		}
+
+		std::span<const ProgramHeader> Segments() const {
+			if (!Contains(GetHeader()->phoff, std::size_t(GetHeader()->phnum) * sizeof(ProgramHeader)))
+				return {};
+			return { reinterpret_cast<const ProgramHeader*>(data_ + GetHeader()->phoff), GetHeader()->phnum };
+		}
+
+		const char* SectionName(const SectionHeader& section) const {
+			auto sections = Sections();
+			if (GetHeader()->shstrndx >= sections.size())
+				return "";
+			const SectionHeader& names = sections[GetHeader()->shstrndx];
+			return Contains(names.offset, section.name + 1) ? reinterpret_cast<const char*>(data_ + names.offset + section.name) : "";
+		}
+
+		const SectionHeader* FindSection(const char* name) const {
+			for (const SectionHeader& section : Sections())
+				if (!std::strcmp(SectionName(section), name))
+					return &section;
+			return nullptr;
+		}
+
+		template<typename T>
+		std::span<const T> Contents(const SectionHeader& section) const {
+			if (!Contains(section.offset, section.size))
+				return {};
+			return { reinterpret_cast<const T*>(data_ + section.offset), section.size / sizeof(T) };
+		}
+
+		bool Contains(std::uint64_t offset, std::uint64_t length) const {
+			return offset <= size_ && length <= size_ - offset;
+		}
+
+		const std::uint8_t* Data() const { return data_; }
+		std::size_t Size() const { return size_; }
+
+	private:
+		const std::uint8_t* data_;
+		std::size_t size_;
+	};
+}
+
+class FunctionExtentIndex {
+public:
+	/**
+	 * @brief Adds a function range, Finalize must be called before lookups.
+	 */
+	void Add(std::uintptr_t begin, std::uintptr_t end) {
+		if (end > begin)
+			entries_.push_back({ begin, end });
+	}
+
+	/**
+	 * @brief Sorts the entries and drops duplicates (aliases of the same function).
+	 */
+	void Finalize() {
+		std::sort(entries_.begin(), entries_.end(), [](const FunctionRange& left, const FunctionRange& right) {
+			return left.begin < right.begin || (left.begin == right.begin && left.end > right.end);
+		});
+		entries_.erase(std::unique(entries_.begin(), entries_.end(), [](const FunctionRange& left, const FunctionRange& right) {
+			return left.begin == right.begin;
+		}), entries_.end());
+		entries_.shrink_to_fit();
+	}
+
+	/**
+	 * @brief Returns the range of the function containing the passed address, or nullptr.
+	 */
+	const FunctionRange* Find(std::uintptr_t address) const {
+		auto it = std::upper_bound(entries_.begin(), entries_.end(), address, [](std::uintptr_t value, const FunctionRange& range) {
+			return value < range.begin;
+		});
+		if (it == entries_.begin())
+			return nullptr;
+		--it;
+		return it->Contains(address) ? &*it : nullptr;
+	}
+
+	/**
+	 * @brief Returns the size of the function starting exactly at the passed address, or 0.
+	 */
+	std::size_t Size(const void* function) const {
+		const FunctionRange* range = Find(reinterpret_cast<std::uintptr_t>(function));
+		return range && range->begin == reinterpret_cast<std::uintptr_t>(function) ? range->Size() : 0;
+	}
+
+	/**
+	 * @brief Returns the first function starting after the passed address, or nullptr.
+	 */
+	const FunctionRange* After(std::uintptr_t address) const {
+		auto it = std::upper_bound(entries_.begin(), entries_.end(), address, [](std::uintptr_t value, const FunctionRange& range) {
+			return value < range.begin;
+		});
+		return it != entries_.end() ? &*it : nullptr;
+	}
+
+	/**
+	 * @brief Returns true if [begin, end) overlaps a function of the index.
+	 */
+	bool Overlaps(std::uintptr_t begin, std::uintptr_t end) const {
+		if (Find(begin))
+			return true;
+		auto it = std::lower_bound(entries_.begin(), entries_.end(), begin, [](const FunctionRange& range, std::uintptr_t value) {
+			return range.begin < value;
+		});
+		return it != entries_.end() && it->begin < end;
+	}
+
+	bool Empty() const { return entries_.empty(); }
+	std::size_t Count() const { return entries_.size(); }
+	std::span<const FunctionRange> Entries() const { return entries_; }
+
+	/*
+		x64 exception directory entry: { BeginAddress, EndAddress, UnwindInfoAddress }, relative to the image base.
+	*/
+	struct RuntimeFunction { std::uint32_t begin, end, unwindInfo; };
+
+	/**
+	 * @brief Adds the functions of an x64 exception directory, Finalize must be called before lookups.
+	 *
+	 * Entries that continue the previous one through chained unwind info are merged into it.
+	 *
+	 * @param imageBase Address the image is laid out at, the unwind info is read from there.
+	 */
+	void AddRuntimeFunctions(std::uintptr_t imageBase, std::span<const RuntimeFunction> functions) {
+		constexpr std::uint8_t UnwindFlagChainInfo = 0x4;
+		entries_.reserve(entries_.size() + functions.size());
+
+		for (const RuntimeFunction& function : functions) {
+			std::uint8_t flags = *reinterpret_cast<const std::uint8_t*>(imageBase + (function.unwindInfo & ~1u)) >> 3;
+
+			// Chained entries describe a later part of the previous function
+			if (flags & UnwindFlagChainInfo && !entries_.empty() && entries_.back().end == imageBase + function.begin)
+				entries_.back().end = imageBase + function.end;
+			else
+				Add(imageBase + function.begin, imageBase + function.end);
+		}
+	}
+
+#ifdef _WIN32
+	/**
+	 * @brief Builds the index from the exception directory of a loaded PE image.
+	 *
+	 * Entries that continue the previous one through chained unwind info are merged into it.
+	 * If the PDB named in the debug directory is found next to its recorded path or the image,
+	 * its procedures are added as well, which covers leaf functions without unwind data.
+	 */
+	static FunctionExtentIndex FromPeImage(const void* imageBase) {
+		FunctionExtentIndex index;
+		auto image = reinterpret_cast<const shadow::win::image_t*>(imageBase);
+		auto base = reinterpret_cast<std::uintptr_t>(imageBase);
+
+		const shadow::win::data_directory_t* directory = image->get_directory(shadow::win::directory_entry_exception);
+		if (!directory)
+			return index;
+
+#if defined(_M_ARM64)
+		// ARM64: { BeginAddress, UnwindData }, the length is packed in UnwindData or the first .xdata word
+		struct RuntimeFunction { std::uint32_t begin, unwindData; };
+		auto functions = std::span(reinterpret_cast<const RuntimeFunction*>(base + directory->rva), directory->size / sizeof(RuntimeFunction));
+
+		for (const RuntimeFunction& function : functions) {
+			std::uint32_t length = (function.unwindData & 3) != 0
+				? ((function.unwindData >> 2) & 0x7FF) * 4
+				: (*reinterpret_cast<const std::uint32_t*>(base + function.unwindData) & 0x3FFFF) * 4;
+			index.Add(base + function.begin, base + function.begin + length);
+		}
+#else
+		index.AddRuntimeFunctions(base, std::span(reinterpret_cast<const RuntimeFunction*>(base + directory->rva), directory->size / sizeof(RuntimeFunction)));
+#endif // _M_ARM64
+
+		index.AddImagePdb(imageBase);
+		index.Finalize();
+		return index;
+	}
+#endif // _WIN32
+
+	/**
+	 * @brief Builds the index from the procedure symbols of a PDB.
+	 *
+	 * @param file The PDB file contents.
+	 * @param imageBase Address the image described by the PDB is loaded or mapped at. Its section headers are
+	 *                  read when the PDB doesn't record them, as with PDBs written from LLVM's YAML format.
+	 */
+	static FunctionExtentIndex FromPdbFile(const pdb::File& file, std::uintptr_t imageBase) {
+		FunctionExtentIndex index;
+		index.AddPdb(file, imageBase);
+		index.Finalize();
+		return index;
+	}
+
+	/**
+	 * @brief Maps a PDB from disk and builds its index.
+	 */
+	static FunctionExtentIndex FromPdbPath(const char* path, std::uintptr_t imageBase) {
+		MappedFile mapping(path);
+		return FromPdbFile(pdb::File(mapping.Data(), mapping.Size()), imageBase);
+	}
+
+	/**
+	 * @brief Builds the index from the symbol tables of an ELF file, or its .eh_frame if it has none.
+	 *
+	 * @param file The ELF file contents.
+	 * @param loadBias Difference between runtime addresses and the addresses in the file.
+	 */
+	static FunctionExtentIndex FromElfFile(const elf::File& file, std::uintptr_t loadBias) {
+		FunctionExtentIndex index;
+		if (!file.Valid())
+			return index;
+
+		bool hasSymtab = false;
+
+		for (const elf::SectionHeader& section : file.Sections()) {
+			if (section.type != elf::SectionSymtab && section.type != elf::SectionDynsym)
+				continue;
+
+			hasSymtab |= section.type == elf::SectionSymtab;
+
+			for (const elf::Symbol& symbol : file.Contents<elf::Symbol>(section)) {
+				if ((symbol.info & 0xF) == elf::SymbolFunction && symbol.shndx != 0 && symbol.size != 0)
+					index.Add(loadBias + symbol.value, loadBias + symbol.value + symbol.size);
+			}
+		}
+
+		// Stripped binaries only export their dynamic symbols, the unwind tables still cover everything
+		if (!hasSymtab)
+			index.AddEhFrame(file, loadBias);
+
+		index.Finalize();
+		return index;
+	}
+
+	/**
+	 * @brief Reads an ELF file from disk and builds its index.
+	 */
+	static FunctionExtentIndex FromElfPath(const char* path, std::uintptr_t loadBias) {
+		MappedFile mapping(path);
+		return FromElfFile(elf::File(mapping.Data(), mapping.Size()), loadBias);
+	}
+
+	/**
+	 * @brief Returns the index of the module containing the passed address.
+	 *
+	 * Every module is indexed once, the first time one of its addresses is looked up.
+	 * An empty index is returned if the module can't be found.
+	 */
+	static const FunctionExtentIndex& ForAddress(const void* address) {
+		static std::mutex modulesMutex;
+		static std::unordered_map<std::uintptr_t, std::unique_ptr<FunctionExtentIndex>> modules;
+		static const FunctionExtentIndex empty;
+
+		LoadedModule loaded;
+		if (!FindLoadedModule(address, loaded))
+			return empty;
+
+		std::lock_guard<std::mutex> lock(modulesMutex);
+		std::unique_ptr<FunctionExtentIndex>& module = modules[loaded.base];
+		if (!module) {
+#ifdef _WIN32
+			module = std::make_unique<FunctionExtentIndex>(FromPeImage(reinterpret_cast<const void*>(loaded.base)));
+#else
+			module = std::make_unique<FunctionExtentIndex>(FromElfPath(loaded.path.c_str(), loaded.base));
+#endif // _WIN32
+		}
+		return *module;
+	}
+
+private:
+	/**
+	 * @brief Section headers of the PE image at imageBase, empty if there is no image there.
+	 */
+	static std::span<const pdb::SectionHeader> ImageSections(std::uintptr_t imageBase) {
+		std::uint32_t peOffset;
+		if (!imageBase || std::memcmp(reinterpret_cast<const void*>(imageBase), "MZ", 2))
+			return {};
+		std::memcpy(&peOffset, reinterpret_cast<const void*>(imageBase + 0x3C), sizeof(peOffset));
+		if (std::memcmp(reinterpret_cast<const void*>(imageBase + peOffset), "PE\0\0", 4))
+			return {};
+
+		// File header after the signature: u16 machine, u16 number of sections, ..., u16 size of the optional header at 16
+		std::uint16_t sectionCount, optionalHeaderSize;
+		std::memcpy(&sectionCount, reinterpret_cast<const void*>(imageBase + peOffset + 6), sizeof(sectionCount));
+		std::memcpy(&optionalHeaderSize, reinterpret_cast<const void*>(imageBase + peOffset + 20), sizeof(optionalHeaderSize));
+		return { reinterpret_cast<const pdb::SectionHeader*>(imageBase + peOffset + 24 + optionalHeaderSize), sectionCount };
+	}
+
+	void AddPdb(const pdb::File& file, std::uintptr_t imageBase) {
+		if (!file.Valid())
+			return;
+
+		std::vector<pdb::Function> functions = file.Functions();
+		if (functions.empty())
+			functions = file.Functions(ImageSections(imageBase));
+		entries_.reserve(entries_.size() + functions.size());
+		for (const pdb::Function& function : functions)
+			Add(imageBase + function.rva, imageBase + function.rva + function.size);
+	}
+
+#ifdef _WIN32
+	/**
+	 * @brief Adds the procedures of the PDB referenced by the CodeView record of a loaded image.
+	 *
+	 * The recorded path is tried first, then a file with the same name next to the image.
+	 * A PDB is only used if its GUID matches the image.
+	 */
+	void AddImagePdb(const void* imageBase) {
+		struct DebugDirectory { std::uint32_t characteristics, timeDateStamp; std::uint16_t majorVersion, minorVersion; std::uint32_t type, sizeOfData, addressOfRawData, pointerToRawData; };
+		struct CodeViewRecord { std::uint32_t signature; std::uint8_t guid[16]; std::uint32_t age; char path[1]; };
+		constexpr std::uint32_t DebugTypeCodeView = 2;
+		constexpr std::uint32_t SignatureRsds = 0x53445352; // 'RSDS'
+
+		auto image = reinterpret_cast<const shadow::win::image_t*>(imageBase);
+		auto base = reinterpret_cast<std::uintptr_t>(imageBase);
+
+		const shadow::win::data_directory_t* directory = image->get_directory(shadow::win::directory_entry_debug);
+		if (!directory)
+			return;
+
+		auto entries = std::span(reinterpret_cast<const DebugDirectory*>(base + directory->rva), directory->size / sizeof(DebugDirectory));
+		for (const DebugDirectory& entry : entries) {
+			if (entry.type != DebugTypeCodeView || entry.sizeOfData <= offsetof(CodeViewRecord, path) || !entry.addressOfRawData)
+				continue;
+
+			auto record = reinterpret_cast<const CodeViewRecord*>(base + entry.addressOfRawData);
+			if (record->signature != SignatureRsds)
+				continue;
+
+			std::string recordedPath(record->path, strnlen(record->path, entry.sizeOfData - offsetof(CodeViewRecord, path)));
+			std::string fileName = recordedPath.substr(recordedPath.find_last_of("\\/") + 1);
+
+			char modulePath[MAX_PATH] = {};
+			ShadowCall<DWORD>("GetModuleFileNameA", reinterpret_cast<HMODULE>(const_cast<void*>(imageBase)), modulePath, MAX_PATH);
+			std::string besideImage(modulePath);
+			besideImage = besideImage.substr(0, besideImage.find_last_of("\\/") + 1) + fileName;
+
+			for (const std::string& path : { recordedPath, besideImage }) {
+				MappedFile mapping(path.c_str());
+				pdb::File file(mapping.Data(), mapping.Size());
+				if (file.Valid() && file.MatchesGuid(record->guid)) {
+					AddPdb(file, base);
+					return;
+				}
+			}
+		}
+	}
+#endif // _WIN32
+
+	/*
+		.eh_frame parsing, only what is needed to read FDE ranges.
+	*/
+	static std::uint64_t ReadUleb(const std::uint8_t*& cursor, const std::uint8_t* end) {
+		std::uint64_t value = 0;
+		for (unsigned shift = 0; cursor < end; shift += 7) {
+			std::uint8_t byte = *cursor++;
+			if (shift < 64)
+				value |= std::uint64_t(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+				break;
+		}
+		return value;
+	}
+
+	static std::int64_t ReadSleb(const std::uint8_t*& cursor, const std::uint8_t* end) {
+		std::int64_t value = 0;
+		unsigned shift = 0;
+		std::uint8_t byte = 0;
+		while (cursor < end) {
+			byte = *cursor++;
+			if (shift < 64)
+				value |= std::int64_t(byte & 0x7F) << shift;
+			shift += 7;
+			if (!(byte & 0x80))
+				break;
+		}
+		if (shift < 64 && (byte & 0x40))
+			value |= -(std::int64_t(1) << shift);
+		return value;
+	}
+
+	/**
+	 * @brief Reads a DW_EH_PE encoded pointer, fieldAddress is the file virtual address of the field.
+	 */
+	static bool ReadEncoded(const std::uint8_t*& cursor, const std::uint8_t* end, std::uint8_t encoding, std::uint64_t fieldAddress, std::uint64_t& value) {
+		auto read = [&](auto type) {
+			using T = decltype(type);
+			if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(T)))
+				return false;
+			T raw;
+			std::memcpy(&raw, cursor, sizeof(T));
+			cursor += sizeof(T);
+			value = static_cast<std::uint64_t>(static_cast<std::int64_t>(raw));
+			return true;
+		};
+
+		bool readSucceeded = true;
+		switch (encoding & 0x0F) {
+		case 0x00: readSucceeded = read(std::uint64_t{}); break;
+		case 0x01: value = ReadUleb(cursor, end); break;
+		case 0x02: readSucceeded = read(std::uint16_t{}); value &= 0xFFFF; break;
+		case 0x03: readSucceeded = read(std::uint32_t{}); value &= 0xFFFFFFFF; break;
+		case 0x04: readSucceeded = read(std::uint64_t{}); break;
+		case 0x09: value = static_cast<std::uint64_t>(ReadSleb(cursor, end)); break;
+		case 0x0A: readSucceeded = read(std::int16_t{}); break;
+		case 0x0B: readSucceeded = read(std::int32_t{}); break;
+		case 0x0C: readSucceeded = read(std::int64_t{}); break;
+		default: return false;
+		}
+
+		// Only absolute and pc relative pointers are used for FDE ranges
+		if ((encoding & 0x70) == 0x10)
+			value += fieldAddress;
+		else if ((encoding & 0x70) != 0)
+			return false;
+
+		return readSucceeded;
+	}
+
+	void AddEhFrame(const elf::File& file, std::uintptr_t loadBias) {
+		const elf::SectionHeader* section = file.FindSection(".eh_frame");
+		if (!section || !file.Contains(section->offset, section->size))
+			return;
+
+		const std::uint8_t* begin = file.Data() + section->offset;
+		const std::uint8_t* end = begin + section->size;
+		std::unordered_map<const std::uint8_t*, std::uint8_t> cieEncodings;
+
+		for (const std::uint8_t* record = begin; end - record >= 4;) {
+			std::uint32_t length;
+			std::memcpy(&length, record, sizeof(length));
+			if (length < 4 || length == 0xFFFFFFFF || length > std::uint64_t(end - record - 4))
+				break;
+
+			const std::uint8_t* body = record + 4;
+			const std::uint8_t* next = body + length;
+			std::uint32_t cieOffset;
+			std::memcpy(&cieOffset, body, sizeof(cieOffset));
+			const std::uint8_t* cursor = body + 4;
+
+			if (cieOffset == 0) {
+				// CIE: find the 'R' augmentation, the pointer encoding of its FDEs. A string running past the record ends the section
+				if (cursor == next)
+					break;
+				std::uint8_t version = *cursor++;
+				const char* augmentation = reinterpret_cast<const char*>(cursor);
+				std::size_t augmentationLength = strnlen(augmentation, next - cursor);
+				if (augmentationLength == std::size_t(next - cursor))
+					break;
+				cursor += augmentationLength + 1;
+				ReadUleb(cursor, next);
+				ReadSleb(cursor, next);
+				if (version == 1)
+					++cursor;
+				else
+					ReadUleb(cursor, next);
+
+				std::uint8_t encoding = 0;
+				if (augmentation[0] == 'z') {
+					ReadUleb(cursor, next);
+					for (const char* character = augmentation + 1; *character && cursor < next; ++character) {
+						std::uint64_t ignored;
+						if (*character == 'R')
+							encoding = *cursor++;
+						else if (*character == 'L')
+							++cursor;
+						else if (*character == 'P') {
+							std::uint8_t personality = *cursor++;
+							ReadEncoded(cursor, next, personality & 0x7F, 0, ignored);
+						}
+					}
+				}
+				cieEncodings[record] = encoding;
+			}
+			else {
+				// FDE: the CIE pointer is relative to its own field
+				auto cie = cieEncodings.find(body - cieOffset);
+				std::uint8_t encoding = cie != cieEncodings.end() ? cie->second : 0;
+				std::uint64_t fieldAddress = section->addr + (cursor - begin);
+				std::uint64_t pcBegin, pcRange;
+
+				if (ReadEncoded(cursor, next, encoding, fieldAddress, pcBegin) && ReadEncoded(cursor, next, encoding & 0x0F, 0, pcRange))
+					Add(loadBias + pcBegin, loadBias + pcBegin + pcRange);
+			}
+
+			record = next;
+		}
+	}
+
+	std::vector<FunctionRange> entries_;
+};
@@ -1,14 +1,29 @@
 #pragma once
-#include <windows.h>
-#include <A64Opcode.h>
+#include <cstdint>
+#include <cstring>
+
+#include <A64Arch.h>
 
+#ifdef AA_NOCAPSTONE
+#include <A64Length.h>
+template<typename Arch> using OpSizingSession = OpLengthSession<Arch>; ///< Built-in table-driven length decoder
+#else
+#include <A64Opcode.h>
+template<typename Arch> using OpSizingSession = OpSession<Arch>;       ///< Capstone disassembler
+#endif // AA_NOCAPSTONE
+
+/*
+	Both sizing routines are templated on an architecture policy (A64Arch.h)
+	and default to the architecture Scudo is built for.
+*/
+template<typename Arch = ArchNative>
 inline std::int32_t GetFunctionLength(void* function) {
 
 	if (!function)
 		return 0;
 
 	// Start Address
-	PCHAR functionAddress = PCHAR(function);
+	char* functionAddress = static_cast<char*>(function);
 
 	// Our return variable
 	std::int32_t functionLength = 0;
@@ -21,61 +36,46 @@ inline std::int32_t GetFunctionLength(void* function) {
 	 or create a list of all functions the program recognizes in the pdb and check 
 	 the end address using the start address of functions nearby in memory
 	*/
-	while (functionAddress) { // while valid address
-		
-		// Get the size of the instruction
-		size_t instructionSize = OpDisassemble(functionAddress).GetLength();
-
-		// Check if double int3 is two seperate instructions
-		if (instructionSize == 0x1 && OpDisassemble(functionAddress + 1).GetLength() == 0x1 && (*PWORD(functionAddress) == 0xCCC3)) {
-			functionLength += instructionSize;
-			break;
-		}
-			
-		// Increment to the next instruction
-		functionLength += instructionSize;
-		functionAddress += instructionSize;
-	}
-	return functionLength;
+	bool terminated = OpSizingSession<Arch>::ThreadSession().Walk(functionAddress, [&](const auto* instruction) {
+
+		// Count the instruction towards the function
+		functionLength += instruction->size;
+
+		// Stop on the architecture's return + padding sequence
+		return !Arch::IsTerminator(instruction);
+	});
+
+	// Bytes that can't be decoded are never encrypted
+	return terminated ? functionLength : 0;
 }
 
+template<typename Arch = ArchNative>
 inline std::int32_t GetFunctionLength2(void* function) {
 	if (!function)
 		return 0;
 
 	// Start Address
-	PCHAR functionAddress = reinterpret_cast<PCHAR>(function);
+	char* functionAddress = static_cast<char*>(function);
 
 	// Our return variable
 	std::int32_t functionLength = 0;
 
-	// Loop until we encounter a return instruction (opcode C3)
-	while (true) {
-		std::uint8_t opcode;
-
-		// Disassemble the instruction
-		auto disassembledInstruction = OpDisassemble(functionAddress);
+	// Loop until we encounter a return instruction
+	bool terminated = OpSizingSession<Arch>::ThreadSession().Walk(functionAddress, [&](const auto* instruction) {
 
-		// Get the size of the instruction and its opcode
-		size_t instructionSize = disassembledInstruction.GetLength();
+		// Check if the instruction is a ret
+		if (Arch::IsReturn(instruction))
+			return false;
 
-		// Check if the opcode is a ret and the size is 1 byte
-		if (instructionSize == 1 && disassembledInstruction.GetOpcode() == 0xC3) {
-			break;
-		}
-
-		// Check if the opcode is a double int3 indicating passing
-		if (instructionSize == 1 && OpDisassemble(functionAddress + 1).GetLength() == 1 && (*PBYTE(functionAddress) == 0xCC)) {
-			break;
-		}
+		// Check if the padding instruction is repeated, indicating padding between functions
+		// bytes only holds the current instruction, the next one is read from the code
+		if (Arch::IsPadding(instruction) && !std::memcmp(instruction->bytes, reinterpret_cast<const std::uint8_t*>(instruction->address) + instruction->size, instruction->size))
+			return false;
 
 		// Increment to the next instruction
-		functionLength += static_cast<std::int32_t>(instructionSize);
-		functionAddress += instructionSize;
-
-		// Optional: Add boundary checks or other conditions here
-		// For example, limit the maximum function length or handle invalid instructions
-	}
+		functionLength += static_cast<std::int32_t>(instruction->size);
+		return true;
+	});
 
-	return functionLength;
+	return terminated ? functionLength : 0;
 }
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+	Insert-only hash index from an address to an object, read by exception handlers without a lock.
+	Objects are never removed, so a slot is written once: its value first, then its key with release
+	order, and a reader that sees the key sees the value. Open addressing with linear probing keeps
+	a lookup to a few adjacent slots. Inserts are serialized, when the table is half full they copy
+	it into one twice as large and publish it, older tables stay allocated since a reader may still
+	probe one and every key they hold is in the new table as well.
+*/
+
+namespace registry
+{
+	template<typename T>
+	class HashIndex {
+	public:
+		static constexpr std::size_t InitialCapacity = 256;
+
+		HashIndex() {
+			tables.push_back(std::make_unique<Table>(InitialCapacity));
+			current.store(tables.back().get());
+		}
+
+		HashIndex(const HashIndex&) = delete;
+		HashIndex& operator=(const HashIndex&) = delete;
+
+		/**
+		 * @brief Returns the object of key, nullptr if none was inserted. Wait-free.
+		 */
+		T* Find(std::uintptr_t key) const {
+			return current.load(std::memory_order_acquire)->Find(key);
+		}
+
+		/**
+		 * @brief Returns the object of key, inserting the one make returns if there is none.
+		 *
+		 * @param make Called under the insert lock, returns a std::unique_ptr<T>, empty to insert nothing.
+		 * @return T* The object of key, nullptr if make returned nothing.
+		 */
+		template<typename Make>
+		T* FindOrInsert(std::uintptr_t key, Make&& make) {
+			if (T* value = Find(key))
+				return value;
+
+			std::lock_guard<std::mutex> lock(insertMutex);
+			Table* table = current.load(std::memory_order_relaxed);
+			if (T* value = table->Find(key))
+				return value;
+
+			std::unique_ptr<T> created = make();
+			if (!created)
+				return nullptr;
+
+			if (2 * (entries.size() + 1) > table->Capacity()) {
+				auto grown = std::make_unique<Table>(2 * table->Capacity());
+				for (const Entry& entry : entries)
+					grown->Insert(entry.key, entry.value.get());
+				tables.push_back(std::move(grown));
+				table = tables.back().get();
+				current.store(table, std::memory_order_release);
+			}
+
+			table->Insert(key, created.get());
+			entries.push_back({ key, std::move(created) });
+			return entries.back().value.get();
+		}
+
+	private:
+		struct Entry {
+			std::uintptr_t key;
+			std::unique_ptr<T> value;
+		};
+
+		class Table {
+		public:
+			explicit Table(std::size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+
+			std::size_t Capacity() const { return mask + 1; }
+
+			T* Find(std::uintptr_t key) const {
+				for (std::size_t index = Hash(key) & mask;; index = (index + 1) & mask) {
+					std::uintptr_t slotKey = slots[index].key.load(std::memory_order_acquire);
+					if (slotKey == key)
+						return slots[index].value.load(std::memory_order_relaxed);
+					if (!slotKey)
+						return nullptr;
+				}
+			}
+
+			void Insert(std::uintptr_t key, T* value) {
+				std::size_t index = Hash(key) & mask;
+				while (slots[index].key.load(std::memory_order_relaxed))
+					index = (index + 1) & mask;
+				slots[index].value.store(value, std::memory_order_relaxed);
+				slots[index].key.store(key, std::memory_order_release);
+			}
+
+		private:
+			struct Slot {
+				std::atomic<std::uintptr_t> key{ 0 };   ///< 0 while the slot is free
+				std::atomic<T*> value{ nullptr };
+			};
+
+			// Fibonacci hashing, code addresses differ mostly in their low bits
+			static std::size_t Hash(std::uintptr_t key) {
+				std::uint64_t mixed = static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+				return static_cast<std::size_t>(mixed ^ (mixed >> 32));
+			}
+
+			std::size_t mask;
+			std::unique_ptr<Slot[]> slots;
+		};
+
+		std::atomic<Table*> current{ nullptr };
+		std::vector<std::unique_ptr<Table>> tables;   ///< Every table ever published, the last one is current
+		std::vector<Entry> entries;
+		std::mutex insertMutex;
+	};
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <random>
+#ifndef _WIN32
+#include <sys/random.h>
+#endif // !_WIN32
+#include <A64Cpu.h>
+#include <A64Cipher.h>
+
+/*
+	Per-thread source of function keys.
+	Keys are handed out from a buffer of ChaCha20 keystream that is refilled in one pass every
+	KeysPerRefill keys, so the exception handler only copies 32 bytes: no syscall, lock or allocation.
+	The first key of every refill replaces the generator key (fast key erasure), keys already handed out
+	can't be recomputed from the state left in memory. The generator is seeded from the OS on first use
+	and reseeded every RefillsPerReseed refills.
+*/
+
+namespace cipher
+{
+#ifdef AA_CPU_X64
+	/**
+	 * @brief XORs RDSEED (or RDRAND) output into the buffer, does nothing on CPUs without them.
+	 */
+	AA_TARGET("rdrnd,rdseed")
+	inline void MixHardwareEntropy(std::uint8_t* buffer, std::size_t size) {
+		const cpu::Features& features = cpu::Supported();
+		if (!features.rdseed && !features.rdrand)
+			return;
+
+		for (std::size_t offset = 0; offset < size; offset += sizeof(std::uint64_t)) {
+			unsigned long long value = 0;
+
+			// Both instructions may transiently run out of entropy
+			bool success = false;
+			for (int retry = 0; retry < 16 && !success; ++retry)
+				success = features.rdseed ? _rdseed64_step(&value) : _rdrand64_step(&value);
+			if (!success)
+				return;
+
+			for (std::size_t i = 0; i < sizeof(value) && offset + i < size; ++i)
+				buffer[offset + i] ^= static_cast<std::uint8_t>(value >> (i * 8));
+		}
+	}
+#endif // AA_CPU_X64
+
+	/**
+	 * @brief Fills the buffer with entropy from the OS, mixed with the CPU random number generator when there is one.
+	 */
+	inline void SystemEntropy(std::uint8_t* buffer, std::size_t size) {
+		std::size_t filled = 0;
+#ifndef _WIN32
+		while (filled < size) {
+			ssize_t count = getrandom(buffer + filled, size - filled, 0);
+			if (count <= 0)
+				break;
+			filled += static_cast<std::size_t>(count);
+		}
+#endif // !_WIN32
+
+		// On Windows random_device is backed by RtlGenRandom
+		if (filled < size) {
+			std::random_device device;
+			for (; filled < size; ++filled)
+				buffer[filled] = static_cast<std::uint8_t>(device());
+		}
+
+#ifdef AA_CPU_X64
+		MixHardwareEntropy(buffer, size);
+#endif // AA_CPU_X64
+	}
+
+	class KeyPool {
+	public:
+		static constexpr std::size_t KeysPerRefill = 63;              ///< One more key is generated per refill, it becomes the generator key
+		static constexpr std::uint64_t RefillsPerReseed = 1ull << 16; ///< About 4 million keys between reseeds
+
+		/**
+		 * @brief Pool of the calling thread.
+		 */
+		static KeyPool& Local() {
+			static thread_local KeyPool pool;
+			return pool;
+		}
+
+		/**
+		 * @brief Returns a new key, refilling the pool if it ran out.
+		 */
+		Key Next() {
+			if (next == KeysPerRefill)
+				Refill();
+
+			// Keys are handed out once, the slot is wiped
+			Key key;
+			std::uint8_t* slot = buffer + (1 + next++) * sizeof(Key);
+			std::memcpy(key.bytes, slot, sizeof(Key));
+			std::memset(slot, 0, sizeof(Key));
+			return key;
+		}
+
+	private:
+		void Refill() {
+			if (refills++ % RefillsPerReseed == 0) {
+				std::uint8_t entropy[chacha::KeySize];
+				SystemEntropy(entropy, sizeof(entropy));
+				for (std::size_t i = 0; i < sizeof(entropy); ++i)
+					generatorKey[i] ^= entropy[i];
+			}
+
+			// The keystream is XORed over the buffer, it is all zero here since every slot was handed out and wiped
+			chacha::Apply(generatorKey, buffer, sizeof(buffer), 0);
+
+			std::memcpy(generatorKey, buffer, sizeof(generatorKey));
+			std::memset(buffer, 0, sizeof(generatorKey));
+			next = 0;
+		}
+
+		std::uint8_t generatorKey[chacha::KeySize] = {};
+		std::uint8_t buffer[(1 + KeysPerRefill) * sizeof(Key)] = {};
+		std::size_t next = KeysPerRefill; ///< Index of the next key to hand out, the pool starts empty
+		std::uint64_t refills = 0;
+	};
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <A64Aes.h>
+#include <A64Cipher.h>
+#include <A64KeyPool.h>
+
+/*
+	Function keys derived from a master secret instead of drawn at random.
+	The key of a function is two AES-128 blocks of (function address, epoch, block index) under the
+	master secret, a PRF that takes a few nanoseconds with AES-NI. A protected function only stores
+	a 32 bit epoch and its key is recomputed when it is needed.
+
+	The epoch holds the generation of the master secret in its top 8 bits and a per-function counter
+	in the low 24 bits, advanced at every re-encryption. Rotating the master secret starts a new
+	generation, the secret of an older generation is kept as long as a function is still encrypted
+	with it and its slot is reused once no function is. Generation 0xFF is reserved for keys that
+	aren't derived (functions packed offline).
+*/
+
+namespace cipher
+{
+	class KeySchedule {
+	public:
+		static constexpr std::uint32_t GenerationShift = 24;
+		static constexpr std::uint32_t CounterMask = (1u << GenerationShift) - 1;
+		static constexpr std::uint32_t Generations = 0xFF;          ///< Slots for master secrets
+		static constexpr std::uint32_t ExternalGeneration = 0xFF;   ///< Generation of keys that aren't derived
+
+		/**
+		 * @brief Schedule used by the runtime, its first master secret is generated on the first call.
+		 */
+		static KeySchedule& Global() {
+			static KeySchedule schedule;
+			return schedule;
+		}
+
+		KeySchedule() {
+#ifdef AA_KEYSEED
+			Seed(AA_KEYSEED);
+#else
+			std::lock_guard<std::mutex> lock(rotationMutex);
+			SetSecret(0, KeyPool::Local().Next());
+#endif // AA_KEYSEED
+		}
+
+		/**
+		 * @brief Replaces the master secret with one derived from seed, keys become reproducible across runs.
+		 *
+		 * Must be called before any function is encrypted, AA_KEYSEED does it at startup.
+		 */
+		void Seed(std::uint64_t seed) {
+			std::lock_guard<std::mutex> lock(rotationMutex);
+			Key secret = {};
+			std::memcpy(secret.bytes, &seed, sizeof(seed));
+			SetSecret(0, secret);
+			current.store(0);
+		}
+
+		static std::uint32_t Generation(std::uint32_t epoch) { return epoch >> GenerationShift; }
+
+		/**
+		 * @brief Epoch for the next encryption of a function, under the current master secret.
+		 *
+		 * The master secret of the returned epoch stays available until the epoch is released.
+		 */
+		std::uint32_t Acquire(std::uint32_t previousEpoch) {
+			for (;;) {
+				std::uint32_t generation = current.load();
+				users[generation].fetch_add(1);
+
+				// Rotation only recycles slots that are unused and not current, check it is still current now that it is used
+				if (current.load() == generation)
+					return (generation << GenerationShift) | ((previousEpoch + 1) & CounterMask);
+
+				users[generation].fetch_sub(1);
+			}
+		}
+
+		/**
+		 * @brief Releases the master secret of an epoch once the function isn't encrypted with it anymore.
+		 */
+		void Release(std::uint32_t epoch) {
+			std::uint32_t generation = Generation(epoch);
+			if (generation != ExternalGeneration)
+				users[generation].fetch_sub(1);
+		}
+
+		/**
+		 * @brief Derives the key of a function for an epoch returned by Acquire.
+		 */
+		Key Derive(const void* function, std::uint32_t epoch) const {
+			Key key;
+#ifdef AA_CPU_X64
+			if (cpu::Supported().aes) {
+				DeriveNi(roundKeys[Generation(epoch)], reinterpret_cast<std::uintptr_t>(function), epoch, key.bytes);
+				return key;
+			}
+#endif // AA_CPU_X64
+
+			std::uint64_t blocks[4] = {
+				reinterpret_cast<std::uintptr_t>(function), epoch,
+				reinterpret_cast<std::uintptr_t>(function), epoch | (1ull << 32),
+			};
+			std::memcpy(key.bytes, blocks, sizeof(key.bytes));
+			aes::portable::EncryptBlock(roundKeys[Generation(epoch)], key.bytes);
+			aes::portable::EncryptBlock(roundKeys[Generation(epoch)], key.bytes + aes::BlockSize);
+			return key;
+		}
+
+		/**
+		 * @brief Starts a new generation with a fresh master secret, functions move to it at their next re-encryption.
+		 *
+		 * @return false If every slot is still used by functions encrypted under older secrets.
+		 */
+		bool Rotate() {
+			std::lock_guard<std::mutex> lock(rotationMutex);
+
+			std::uint32_t active = current.load();
+			for (std::uint32_t step = 1; step < Generations; ++step) {
+				std::uint32_t slot = (active + step) % Generations;
+				if (users[slot].load() != 0)
+					continue;
+
+				SetSecret(slot, KeyPool::Local().Next());
+				current.store(slot);
+				return true;
+			}
+			return false;
+		}
+
+	private:
+#ifdef AA_CPU_X64
+		/**
+		 * @brief Derive with AES-NI, both blocks are built in registers and encrypted side by side.
+		 */
+		AA_TARGET("aes")
+		static void DeriveNi(const std::uint8_t* secretRoundKeys, std::uint64_t address, std::uint32_t epoch, std::uint8_t* key) {
+			const __m128i* keys = reinterpret_cast<const __m128i*>(secretRoundKeys);
+			__m128i b0 = _mm_xor_si128(_mm_set_epi64x(static_cast<long long>(epoch), static_cast<long long>(address)), _mm_load_si128(keys));
+			__m128i b1 = _mm_xor_si128(_mm_set_epi64x(static_cast<long long>(epoch | (1ull << 32)), static_cast<long long>(address)), _mm_load_si128(keys));
+			for (int round = 1; round < aes::Rounds; ++round) {
+				__m128i roundKey = _mm_load_si128(keys + round);
+				b0 = _mm_aesenc_si128(b0, roundKey), b1 = _mm_aesenc_si128(b1, roundKey);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(key), _mm_aesenclast_si128(b0, _mm_load_si128(keys + aes::Rounds)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(key) + 1, _mm_aesenclast_si128(b1, _mm_load_si128(keys + aes::Rounds)));
+		}
+#endif // AA_CPU_X64
+
+		void SetSecret(std::uint32_t slot, const Key& secret) {
+			aes::portable::ExpandKey(secret.bytes, roundKeys[slot]);
+		}
+
+		alignas(16) std::uint8_t roundKeys[Generations][(aes::Rounds + 1) * aes::BlockSize] = {}; ///< Expanded master secret of every slot
+		std::atomic<std::uint32_t> users[Generations] = {};   ///< Number of functions encrypted under every slot
+		std::atomic<std::uint32_t> current{ 0 };
+		std::mutex rotationMutex;
+	};
+}
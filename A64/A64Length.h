@@ -0,0 +1,413 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+#include <A64Arch.h>
+
+/*
+	Table-driven x86 / x86-64 instruction length decoder.
+	Function sizing only needs the length of every instruction and a few fields
+	(opcode, ModRM, displacement, immediate), so this replaces capstone on the
+	sizing path. Define AA_NOCAPSTONE to size functions with it and drop the
+	capstone.lib dependency entirely.
+*/
+namespace oplength
+{
+	// Opcode attribute flags
+	enum : std::uint16_t {
+		M   = 0x001, ///< ModRM byte follows the opcode
+		I8  = 0x002, ///< 8 bit immediate
+		I16 = 0x004, ///< 16 bit immediate
+		IZ  = 0x008, ///< 16 bit immediate with 66, 32 bit otherwise
+		IV  = 0x010, ///< 64 bit immediate with REX.W, 16 bit with 66, 32 bit otherwise (mov r, imm)
+		AO  = 0x020, ///< Absolute memory offset, sized by the address size (mov al, moffs)
+		FP  = 0x040, ///< Far pointer, 16:16 with 66, 16:32 otherwise
+		RB  = 0x080, ///< Relative branch with an 8 bit displacement
+		RZ  = 0x100, ///< Relative branch with a 32 bit displacement (16 with 66 outside long mode)
+		GT  = 0x200, ///< Group 3 test, immediate only present when ModRM.reg is 0 or 1
+		N64 = 0x400, ///< Invalid in 64 bit mode
+		BAD = 0x800, ///< Invalid opcode
+	};
+
+	// One byte opcode map
+	constexpr std::array<std::uint16_t, 256> primary = {
+		/*         0         1         2         3          4          5         6         7         8         9         A         B          C          D         E          F  */
+		/* 0 */ M,        M,        M,        M,         I8,        IZ,       N64,      N64,      M,        M,        M,        M,         I8,        IZ,       N64,       0,
+		/* 1 */ M,        M,        M,        M,         I8,        IZ,       N64,      N64,      M,        M,        M,        M,         I8,        IZ,       N64,       N64,
+		/* 2 */ M,        M,        M,        M,         I8,        IZ,       0,        N64,      M,        M,        M,        M,         I8,        IZ,       0,         N64,
+		/* 3 */ M,        M,        M,        M,         I8,        IZ,       0,        N64,      M,        M,        M,        M,         I8,        IZ,       0,         N64,
+		/* 4 */ 0,        0,        0,        0,         0,         0,        0,        0,        0,        0,        0,        0,         0,         0,        0,         0,
+		/* 5 */ 0,        0,        0,        0,         0,         0,        0,        0,        0,        0,        0,        0,         0,         0,        0,         0,
+		/* 6 */ N64,      N64,      M | N64,  M,         0,         0,        0,        0,        IZ,       M | IZ,   I8,       M | I8,    0,         0,        0,         0,
+		/* 7 */ RB,       RB,       RB,       RB,        RB,        RB,       RB,       RB,       RB,       RB,       RB,       RB,        RB,        RB,       RB,        RB,
+		/* 8 */ M | I8,   M | IZ,   M|I8|N64, M | I8,    M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* 9 */ 0,        0,        0,        0,         0,         0,        0,        0,        0,        0,        FP | N64, 0,         0,         0,        0,         0,
+		/* A */ AO,       AO,       AO,       AO,        0,         0,        0,        0,        I8,       IZ,       0,        0,         0,         0,        0,         0,
+		/* B */ I8,       I8,       I8,       I8,        I8,        I8,       I8,       I8,       IV,       IV,       IV,       IV,        IV,        IV,       IV,        IV,
+		/* C */ M | I8,   M | I8,   I16,      0,         M | N64,   M | N64,  M | I8,   M | IZ,   I16 | I8, 0,        I16,      0,         0,         I8,       N64,       0,
+		/* D */ M,        M,        M,        M,         I8 | N64,  I8 | N64, N64,      0,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* E */ RB,       RB,       RB,       RB,        I8,        I8,       I8,       I8,       RZ,       RZ,       FP | N64, RB,        0,         0,        0,         0,
+		/* F */ 0,        0,        0,        0,         0,         0,        M | GT,   M | GT,   0,        0,        0,        0,         0,         0,        M,         M,
+	};
+
+	// Two byte opcode map (0F xx)
+	constexpr std::array<std::uint16_t, 256> secondary = {
+		/*         0         1         2         3          4          5         6         7         8         9         A         B          C          D         E          F  */
+		/* 0 */ M,        M,        M,        M,         BAD,       0,        0,        0,        0,        0,        BAD,      0,         BAD,       M,        0,         M | I8,
+		/* 1 */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* 2 */ M,        M,        M,        M,         BAD,       BAD,      BAD,      BAD,      M,        M,        M,        M,         M,         M,        M,         M,
+		/* 3 */ 0,        0,        0,        0,         0,         0,        BAD,      0,        0,        BAD,      0,        BAD,       BAD,       BAD,      BAD,       BAD,
+		/* 4 */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* 5 */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* 6 */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* 7 */ M | I8,   M | I8,   M | I8,   M | I8,    M,         M,        M,        0,        M,        M,        BAD,      BAD,       M,         M,        M,         M,
+		/* 8 */ RZ,       RZ,       RZ,       RZ,        RZ,        RZ,       RZ,       RZ,       RZ,       RZ,       RZ,       RZ,        RZ,        RZ,       RZ,        RZ,
+		/* 9 */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* A */ 0,        0,        0,        M,         M | I8,    M,        BAD,      BAD,      0,        0,        0,        M,         M | I8,    M,        M,         M,
+		/* B */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M | I8,   M,         M,         M,        M,         M,
+		/* C */ M,        M,        M | I8,   M,         M | I8,    M | I8,   M | I8,   M,        0,        0,        0,        0,         0,         0,        0,         0,
+		/* D */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* E */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+		/* F */ M,        M,        M,        M,         M,         M,        M,        M,        M,        M,        M,        M,         M,         M,        M,         M,
+	};
+
+	// Legacy prefix table, indexed by byte
+	constexpr std::array<bool, 256> legacyPrefix = [] {
+		std::array<bool, 256> table{};
+		for (std::uint8_t prefix : { 0x26, 0x2E, 0x36, 0x3E, 0x64, 0x65, 0x66, 0x67, 0xF0, 0xF2, 0xF3 })
+			table[prefix] = true;
+		return table;
+	}();
+
+	constexpr std::size_t MaxInstructionLength = 15;
+}
+
+/*
+	Decoded instruction.
+	Field names mirror cs_insn where they overlap (size, address, bytes) so the
+	sizing routines can walk either decoder with the same visitor.
+*/
+struct OpInstruction {
+	std::uint64_t address;          ///< Runtime address of the instruction
+	const std::uint8_t* bytes;      ///< Instruction bytes
+	std::uint16_t size;             ///< Instruction length in bytes
+
+	std::uint8_t opcode;            ///< Last opcode byte
+	std::uint8_t map;               ///< Opcode map, 0 = one byte, 1 = 0F, 2 = 0F 38, 3 = 0F 3A (VEX/EVEX/XOP use their map field)
+	std::uint8_t opcodeOffset;      ///< Offset of the opcode byte
+	std::uint8_t rex;               ///< REX prefix or 0
+	bool operandSize;               ///< 66 prefix present
+	bool addressSize;               ///< 67 prefix present
+	bool vex;                       ///< VEX, EVEX or XOP encoded
+
+	bool hasModrm;
+	std::uint8_t modrm;
+	bool hasSib;
+	std::uint8_t sib;
+
+	std::uint8_t dispOffset;        ///< Offset of the displacement, if any
+	std::uint8_t dispSize;          ///< Displacement size in bytes
+	std::int64_t disp;              ///< Sign extended displacement
+
+	std::uint8_t immOffset;         ///< Offset of the immediate, if any
+	std::uint8_t immSize;           ///< Immediate size in bytes (both parts for enter / far pointers)
+	std::int64_t imm;               ///< Sign extended immediate (first part only for enter / far pointers)
+
+	bool ripRelative;               ///< ModRM addresses memory relative to the next instruction
+	bool relative;                  ///< Relative branch, imm holds the displacement
+
+	std::uint8_t ModrmMod() const { return modrm >> 6; }
+	std::uint8_t ModrmReg() const { return (modrm >> 3) & 7; }
+	std::uint8_t ModrmRm() const { return modrm & 7; }
+
+	/**
+	 * @brief Returns the target of a relative branch.
+	 */
+	std::uint64_t BranchTarget() const { return address + size + imm; }
+};
+
+/**
+ * @brief Decodes the x86 instruction at the passed address.
+ *
+ * @param code The instruction bytes, at least 15 bytes must be readable unless the instruction is shorter.
+ * @param instruction Receives the decoded fields.
+ * @param x64 Decode in long mode (REX prefixes, 64 bit moffs, RIP relative addressing).
+ * @return true If the bytes form a valid instruction.
+ */
+inline bool OpDecode(const std::uint8_t* code, OpInstruction& instruction, bool x64 = true) {
+	using namespace oplength;
+
+	instruction = {};
+	instruction.address = reinterpret_cast<std::uint64_t>(code);
+	instruction.bytes = code;
+
+	const std::uint8_t* cursor = code;
+
+	// Legacy prefixes, a REX prefix only counts when it directly precedes the opcode
+	for (;;) {
+		std::uint8_t byte = *cursor;
+		if (legacyPrefix[byte]) {
+			instruction.operandSize |= byte == 0x66;
+			instruction.addressSize |= byte == 0x67;
+			instruction.rex = 0;
+		}
+		else if (x64 && (byte & 0xF0) == 0x40) {
+			instruction.rex = byte;
+		}
+		else {
+			break;
+		}
+
+		if (static_cast<std::size_t>(++cursor - code) >= MaxInstructionLength)
+			return false;
+	}
+
+	bool rexW = (instruction.rex & 0x08) != 0;
+	std::uint16_t flags = 0;
+	std::uint8_t opcode = *cursor;
+
+	// VEX (C4 / C5), EVEX (62) and XOP (8F) are only escapes in 32 bit mode when the next byte has mod 3
+	bool escapeAllowed = x64 || (cursor[1] & 0xC0) == 0xC0;
+
+	if (((opcode == 0xC4 || opcode == 0xC5 || opcode == 0x62) && escapeAllowed)
+		|| (opcode == 0x8F && (cursor[1] & 0x1F) >= 8)) {
+
+		instruction.vex = true;
+
+		if (opcode == 0xC5) {
+			instruction.map = 1;
+			cursor += 2;
+		}
+		else if (opcode == 0x62) {
+			instruction.map = cursor[1] & 0x07;
+			rexW = (cursor[2] & 0x80) != 0;
+			cursor += 4;
+		}
+		else {
+			instruction.map = cursor[1] & 0x1F;
+			rexW = (cursor[2] & 0x80) != 0;
+			cursor += 3;
+		}
+
+		instruction.opcodeOffset = static_cast<std::uint8_t>(cursor - code);
+		instruction.opcode = *cursor++;
+
+		switch (instruction.map) {
+		case 1:
+			// vzeroupper / vzeroall are the only encodings without a ModRM byte
+			flags = instruction.opcode == 0x77 ? 0 : (secondary[instruction.opcode] & I8) | M;
+			break;
+		case 2: case 5: case 6: case 9:
+			flags = M;
+			break;
+		case 3: case 8:
+			flags = M | I8;
+			break;
+		case 10:
+			flags = M | IZ;
+			break;
+		default:
+			return false;
+		}
+
+		// EVEX and XOP do not honour 66 for immediate sizing
+		instruction.operandSize = false;
+	}
+	else {
+		++cursor;
+
+		if (opcode != 0x0F) {
+			flags = primary[opcode];
+		}
+		else if (*cursor == 0x38) {
+			instruction.map = 2;
+			opcode = cursor[1];
+			cursor += 2;
+			flags = M;
+		}
+		else if (*cursor == 0x3A) {
+			instruction.map = 3;
+			opcode = cursor[1];
+			cursor += 2;
+			flags = M | I8;
+		}
+		else {
+			instruction.map = 1;
+			opcode = *cursor++;
+			flags = secondary[opcode];
+		}
+
+		instruction.opcodeOffset = static_cast<std::uint8_t>(cursor - code - 1);
+		instruction.opcode = opcode;
+	}
+
+	if ((flags & BAD) || (x64 && (flags & N64)))
+		return false;
+
+	// ModRM, SIB and displacement
+	if (flags & M) {
+		instruction.hasModrm = true;
+		instruction.modrm = *cursor++;
+
+		std::uint8_t mod = instruction.ModrmMod();
+		std::uint8_t rm = instruction.ModrmRm();
+		bool address16 = !x64 && instruction.addressSize;
+
+		// mov to / from control and debug registers always treats ModRM as a register operand
+		bool registerForm = instruction.map == 1 && !instruction.vex && (instruction.opcode & 0xFC) == 0x20;
+
+		if (mod != 3 && !registerForm) {
+			if (address16) {
+				if (mod == 1)
+					instruction.dispSize = 1;
+				else if (mod == 2 || (rm == 6 && mod == 0))
+					instruction.dispSize = 2;
+			}
+			else {
+				if (rm == 4) {
+					instruction.hasSib = true;
+					instruction.sib = *cursor++;
+				}
+
+				if (mod == 1)
+					instruction.dispSize = 1;
+				else if (mod == 2)
+					instruction.dispSize = 4;
+				else if (rm == 5) {
+					instruction.dispSize = 4;
+					instruction.ripRelative = x64;
+				}
+				else if (instruction.hasSib && (instruction.sib & 7) == 5)
+					instruction.dispSize = 4;
+			}
+		}
+
+		if (instruction.dispSize) {
+			instruction.dispOffset = static_cast<std::uint8_t>(cursor - code);
+			switch (instruction.dispSize) {
+			case 1: instruction.disp = static_cast<std::int8_t>(*cursor); break;
+			case 2: instruction.disp = *reinterpret_cast<const std::int16_t*>(cursor); break;
+			case 4: instruction.disp = *reinterpret_cast<const std::int32_t*>(cursor); break;
+			}
+			cursor += instruction.dispSize;
+		}
+	}
+
+	// Immediates
+	std::uint8_t immSize = 0;
+	std::uint8_t firstImmSize = 0;
+
+	if (flags & GT && instruction.ModrmReg() < 2)
+		flags |= opcode == 0xF6 ? I8 : IZ;
+
+	if (flags & I16)
+		immSize += 2;
+	if (flags & I8)
+		immSize += 1;
+	if (flags & IZ)
+		immSize += rexW ? 4 : instruction.operandSize ? 2 : 4;
+	if (flags & IV)
+		immSize += rexW ? 8 : instruction.operandSize ? 2 : 4;
+	if (flags & AO)
+		immSize += x64 ? (instruction.addressSize ? 4 : 8) : (instruction.addressSize ? 2 : 4);
+	if (flags & FP)
+		immSize += instruction.operandSize ? 4 : 6;
+	if (flags & RB) {
+		immSize += 1;
+		instruction.relative = true;
+	}
+	if (flags & RZ) {
+		immSize += x64 || !instruction.operandSize ? 4 : 2;
+		instruction.relative = true;
+	}
+
+	// enter imm16, imm8 and far pointers only report their first part in imm
+	firstImmSize = flags & I16 ? 2 : flags & FP ? static_cast<std::uint8_t>(immSize - 2) : immSize;
+
+	if (immSize) {
+		instruction.immOffset = static_cast<std::uint8_t>(cursor - code);
+		instruction.immSize = immSize;
+		switch (firstImmSize) {
+		case 1: instruction.imm = static_cast<std::int8_t>(*cursor); break;
+		case 2: instruction.imm = *reinterpret_cast<const std::int16_t*>(cursor); break;
+		case 4: instruction.imm = *reinterpret_cast<const std::int32_t*>(cursor); break;
+		case 8: instruction.imm = *reinterpret_cast<const std::int64_t*>(cursor); break;
+		}
+		cursor += immSize;
+	}
+
+	std::size_t length = cursor - code;
+	if (length > MaxInstructionLength)
+		return false;
+
+	instruction.size = static_cast<std::uint16_t>(length);
+	return true;
+}
+
+/*
+	Capstone-free counterpart of OpSession.
+	Walks instructions with OpDecode and hands the visitor an OpInstruction,
+	so sizing code can be written once against either session. Fixed width
+	architectures skip decoding entirely and only fill size, address and bytes.
+*/
+template<typename Arch = ArchNative>
+class OpLengthSession {
+public:
+	static constexpr std::size_t MaxWalkLength = 0x100000; ///< Upper bound for a single walk (1 MB)
+
+	/**
+	 * @brief Returns the session owned by the calling thread.
+	 */
+	static OpLengthSession& ThreadSession() {
+		thread_local OpLengthSession session;
+		return session;
+	}
+
+	/**
+	 * @brief Decodes the instruction at the passed address.
+	 *
+	 * @return The instruction length, or 0 if the bytes could not be decoded.
+	 */
+	std::size_t Decode(const char* address) {
+		return Next(reinterpret_cast<const std::uint8_t*>(address)) ? instruction_.size : 0;
+	}
+
+	/**
+	 * @brief Walks instructions starting at the passed address until the visitor returns false.
+	 *
+	 * @param visitor Called with every decoded instruction, returns false to stop the walk.
+	 * @return true If the visitor stopped the walk, false if decoding failed or MaxWalkLength was reached.
+	 */
+	template<typename Visitor>
+	bool Walk(const char* address, Visitor&& visitor) {
+		const std::uint8_t* code = reinterpret_cast<const std::uint8_t*>(address);
+		const std::uint8_t* end = code + MaxWalkLength;
+
+		while (code < end && Next(code)) {
+			if (!visitor(static_cast<const OpInstruction*>(&instruction_)))
+				return true;
+			code += instruction_.size;
+		}
+		return false;
+	}
+
+	const OpInstruction* GetInstruction() const {
+		return &instruction_;
+	}
+
+private:
+	bool Next(const std::uint8_t* code) {
+		if constexpr (Arch::FixedInstructionSize != 0) {
+			instruction_.address = reinterpret_cast<std::uint64_t>(code);
+			instruction_.bytes = code;
+			instruction_.size = static_cast<std::uint16_t>(Arch::FixedInstructionSize);
+			return true;
+		}
+		else {
+			return OpDecode(code, instruction_, Arch::X64);
+		}
+	}
+
+	OpInstruction instruction_{};
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <A64LazyImporter.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif // _WIN32
+
+/*
+	Read only memory mapping of a file.
+	Pages are only read from disk when they are touched, so parsers working on large
+	files (PDBs, ELF images) only pay for the parts they actually look at.
+*/
+
+class MappedFile {
+public:
+	MappedFile() = default;
+	explicit MappedFile(const char* path) { Open(path); }
+	~MappedFile() { Close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			Close();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Maps the whole file, returns false if it can't be opened or is empty.
+	 */
+	bool Open(const char* path) {
+		Close();
+#ifdef _WIN32
+		HANDLE file = ShadowCall<HANDLE>("CreateFileA", path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize{};
+		HANDLE mapping = nullptr;
+		if (ShadowCall<BOOL>("GetFileSizeEx", file, &fileSize) && fileSize.QuadPart > 0)
+			mapping = ShadowCall<HANDLE>("CreateFileMappingA", file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (mapping) {
+			data_ = static_cast<const std::uint8_t*>(ShadowCall<LPVOID>("MapViewOfFile", mapping, FILE_MAP_READ, 0, 0, 0));
+			size_ = data_ ? static_cast<std::size_t>(fileSize.QuadPart) : 0;
+			ShadowCall<BOOL>("CloseHandle", mapping);
+		}
+		ShadowCall<BOOL>("CloseHandle", file);
+#else
+		int file = open(path, O_RDONLY | O_CLOEXEC);
+		if (file < 0)
+			return false;
+
+		struct stat status {};
+		if (fstat(file, &status) == 0 && status.st_size > 0) {
+			void* view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if (view != MAP_FAILED) {
+				data_ = static_cast<const std::uint8_t*>(view);
+				size_ = static_cast<std::size_t>(status.st_size);
+			}
+		}
+		close(file);
+#endif // _WIN32
+		return data_ != nullptr;
+	}
+
+	void Close() {
+		if (!data_)
+			return;
+#ifdef _WIN32
+		ShadowCall<BOOL>("UnmapViewOfFile", data_);
+#else
+		munmap(const_cast<std::uint8_t*>(data_), size_);
+#endif // _WIN32
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	bool IsOpen() const { return data_ != nullptr; }
+	const std::uint8_t* Data() const { return data_; }
+	std::size_t Size() const { return size_; }
+
+private:
+	const std::uint8_t* data_ = nullptr;
+	std::size_t size_ = 0;
+};
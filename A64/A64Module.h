@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <A64LazyImporter.h>
+#else
+#include <link.h>
+#endif // _WIN32
+
+/*
+	Lookup of the loaded module (PE image or ELF object) containing an address.
+	Shared by the per-module caches so they agree on what a module is and how it is keyed.
+*/
+
+struct LoadedModule {
+	std::uintptr_t base = 0;   ///< Image base on Windows, load bias on ELF (0 for non PIE executables)
+	std::string path;          ///< File the module was loaded from
+#ifndef _WIN32
+	std::span<const ElfW(Phdr)> segments; ///< Program headers of the loaded object
+#endif // !_WIN32
+};
+
+/**
+ * @brief Finds the module containing the passed address.
+ *
+ * @return false If the address doesn't belong to a loaded module.
+ */
+inline bool FindLoadedModule(const void* address, LoadedModule& module) {
+#ifdef _WIN32
+	PVOID imageBase = nullptr;
+	ShadowCall<PVOID>("RtlPcToFileHeader", const_cast<void*>(address), &imageBase);
+	if (!imageBase)
+		return false;
+
+	char path[MAX_PATH] = {};
+	ShadowCall<DWORD>("GetModuleFileNameA", reinterpret_cast<HMODULE>(imageBase), path, MAX_PATH);
+
+	module.base = reinterpret_cast<std::uintptr_t>(imageBase);
+	module.path = path;
+	return true;
+#else
+	struct ModuleQuery { std::uintptr_t address; LoadedModule* module; bool found; } query{ reinterpret_cast<std::uintptr_t>(address), &module, false };
+
+	dl_iterate_phdr([](dl_phdr_info* info, size_t, void* context) {
+		auto query = static_cast<ModuleQuery*>(context);
+		for (ElfW(Half) segment = 0; segment < info->dlpi_phnum; ++segment) {
+			const ElfW(Phdr)& header = info->dlpi_phdr[segment];
+			std::uintptr_t begin = info->dlpi_addr + header.p_vaddr;
+			if (header.p_type == PT_LOAD && query->address >= begin && query->address < begin + header.p_memsz) {
+				query->module->base = info->dlpi_addr;
+				// The main executable has no name, it is read through /proc
+				query->module->path = info->dlpi_name && *info->dlpi_name ? info->dlpi_name : "/proc/self/exe";
+				query->module->segments = { info->dlpi_phdr, info->dlpi_phnum };
+				query->found = true;
+				return 1;
+			}
+		}
+		return 0;
+	}, &query);
+
+	return query.found;
+#endif // _WIN32
+}
@@ -2,7 +2,9 @@
 #include <iostream>
 #include <cstdint>
 
+#ifndef AA_NOCAPSTONE
 #include <capstone/capstone.h>
+#include <A64Arch.h>
 
 #pragma comment(lib, "capstone.lib")
 
@@ -11,7 +13,7 @@ class OpDisassemble {
 public:
     OpDisassemble(const char* address) {
         // Initialize Capstone
-        if (cs_open(CS_ARCH_X86, CS_MODE_32, &handle_) != CS_ERR_OK) {
+        if (cs_open(ArchNative::CsArch, ArchNative::CsMode, &handle_) != CS_ERR_OK) {
             std::cerr << "Failed to initialize Capstone" << std::endl;
             return;
         }
@@ -47,7 +49,7 @@ public:
         return op_str_;
     }
 
-    BYTE GetOpcode() const {
+    std::uint8_t GetOpcode() const {
         return opcode;
     }
 
@@ -56,5 +58,100 @@ private:
     size_t length_;
     const char* mnemonic_;
     const char* op_str_;
-    BYTE opcode;
-};
\ No newline at end of file
+    std::uint8_t opcode;
+};
+
+/*
+    Long-lived disassembler session.
+    OpDisassemble opens and closes a capstone handle for every instruction, which
+    dominates the cost of sizing a function. A session keeps one handle and one
+    cs_insn alive and decodes with cs_disasm_iter, so walking a function is a
+    single pass with no allocations. Detail mode stays off unless requested.
+    The session decodes for the architecture policy it is instantiated with.
+*/
+template<typename Arch = ArchNative>
+class OpSession {
+public:
+    static constexpr size_t MaxWalkLength = 0x100000; ///< Upper bound for a single walk (1 MB)
+
+    explicit OpSession(bool detail = false) {
+        // Initialize Capstone
+        if (cs_open(Arch::CsArch, Arch::CsMode, &handle_) != CS_ERR_OK) {
+            std::cerr << "Failed to initialize Capstone" << std::endl;
+            return;
+        }
+
+        // Operand details are only needed by callers that inspect operands
+        if (detail)
+            cs_option(handle_, CS_OPT_DETAIL, CS_OPT_ON);
+
+        // Allocate the instruction we decode into for the lifetime of the session
+        insn_ = cs_malloc(handle_);
+    }
+
+    ~OpSession() {
+        if (insn_)
+            cs_free(insn_, 1);
+
+        if (handle_)
+            cs_close(&handle_);
+    }
+
+    OpSession(const OpSession&) = delete;
+    OpSession& operator=(const OpSession&) = delete;
+
+    /**
+     * @brief Returns the session owned by the calling thread.
+     */
+    static OpSession& ThreadSession() {
+        thread_local OpSession session;
+        return session;
+    }
+
+    /**
+     * @brief Decodes the instruction at the passed address.
+     *
+     * @return The instruction length, or 0 if the bytes could not be decoded.
+     */
+    size_t Decode(const char* address) {
+        const uint8_t* code = reinterpret_cast<const uint8_t*>(address);
+        size_t size = 16;
+        uint64_t runtimeAddress = reinterpret_cast<uint64_t>(address);
+
+        if (!insn_ || !cs_disasm_iter(handle_, &code, &size, &runtimeAddress, insn_))
+            return 0;
+
+        return insn_->size;
+    }
+
+    /**
+     * @brief Walks instructions starting at the passed address until the visitor returns false.
+     *
+     * @param visitor Called with every decoded instruction, returns false to stop the walk.
+     * @return true If the visitor stopped the walk, false if decoding failed or MaxWalkLength was reached.
+     */
+    template<typename Visitor>
+    bool Walk(const char* address, Visitor&& visitor) {
+        if (!insn_)
+            return false;
+
+        const uint8_t* code = reinterpret_cast<const uint8_t*>(address);
+        size_t size = MaxWalkLength;
+        uint64_t runtimeAddress = reinterpret_cast<uint64_t>(address);
+
+        while (cs_disasm_iter(handle_, &code, &size, &runtimeAddress, insn_)) {
+            if (!visitor(static_cast<const cs_insn*>(insn_)))
+                return true;
+        }
+        return false;
+    }
+
+    const cs_insn* GetInstruction() const {
+        return insn_;
+    }
+
+private:
+    csh handle_ = 0;
+    cs_insn* insn_ = nullptr;
+};
+#endif // !AA_NOCAPSTONE
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/*
+	Table of functions encrypted offline by scudo-pack.
+	The runtime reserves the table in its own section, the packer finds the section in
+	the linked image, encrypts the listed functions directly in the file and fills the
+	table in place. At startup the runtime only has to register the entries.
+
+	Addresses are relative to the image base on PE and to the load bias on ELF
+	(the virtual address in the file), which is what FindLoadedModule reports as base.
+*/
+
+#ifndef AA_PACKED_CAPACITY
+#define AA_PACKED_CAPACITY 1024 ///< Maximum number of functions scudo-pack can encrypt in one image
+#endif // !AA_PACKED_CAPACITY
+
+#ifdef _MSC_VER
+#pragma section(".scudo", read)
+#define AA_PACKED_SECTION __declspec(allocate(".scudo"))
+#else
+#define AA_PACKED_SECTION __attribute__((section(".scudo"), used))
+#endif // _MSC_VER
+
+namespace packed
+{
+	constexpr char SectionName[] = ".scudo";
+	constexpr std::uint32_t Magic = 0x4B435053; ///< 'SPCK'
+	constexpr std::uint16_t Version = 2;
+
+	struct Header {
+		std::uint32_t magic;
+		std::uint16_t version;
+		std::uint16_t entrySize;
+		std::uint32_t capacity;   ///< Number of entries reserved after the header
+		std::uint32_t count;      ///< Number of entries filled by the packer, 0 in an unpacked image
+	};
+
+	struct Entry {
+		std::uint32_t rva;        ///< Function address relative to the module base
+		std::uint32_t size;       ///< Size of the function in bytes
+		std::uint8_t algorithm;   ///< cipher::Algorithm the function body is encrypted with
+		std::uint8_t firstByte;   ///< Original entry byte, replaced by int3 in the file
+		std::uint8_t reserved[6];
+		std::uint8_t key[32];     ///< cipher::Key the function body is encrypted with
+	};
+
+	template<std::size_t Capacity>
+	struct Table {
+		Header header;
+		Entry entries[Capacity];
+	};
+
+	static_assert(sizeof(Header) == 16 && sizeof(Entry) == 48);
+}
@@ -0,0 +1,572 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <A64LazyImporter.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif // _WIN32
+
+/*
+	Process-wide protection state of the code pages being rewritten.
+	Every page keeps the protection it rests at, the protection it currently has and the number of
+	writers holding it writable. The first writer makes a page writable and the last one restores it,
+	so overlapping writes of neighbouring functions share one change, and a change to the protection
+	a page already has is skipped. Pages changed together are merged into one system call per run of
+	adjacent pages. While a batch is open on a thread, typically for one handler invocation, the pages
+	it released are restored together when it closes, and a page written again meanwhile is never
+	restored in between.
+	Pages never seen before are assumed to rest executable, as code and stub pages do.
+
+	Aliased pages are never made writable. Their memory is remapped to a shared object with two views:
+	the executable one at their address, and a read-write alias the writers are handed instead.
+	On Linux any pages can be remapped onto a memfd, and adjacent aliased runs are merged so the alias
+	of a range stays contiguous. Where memfd_create isn't available, writes go through /proc/self/mem,
+	which the kernel allows whatever the protection of the page. On Windows an image can't be remapped
+	in part, only whole private allocations, such as stub blocks, are swapped for a section.
+	Shared views would follow a fork into the child, which would then write the code of its parent as
+	well. The child copies every aliased run back into private memory at the same address and reopens
+	/proc/self/mem, all stripes are held across the fork so no run is remapped meanwhile.
+*/
+
+namespace protection
+{
+	constexpr std::uintptr_t PageSize = 0x1000; ///< Granularity of protection changes
+	constexpr std::size_t Stripes = 64;         ///< One bit of a 64 bit mask per stripe
+
+	enum Protection : std::uint8_t {
+		NoAccess,
+		ReadWrite,
+		ReadExecute,
+		ReadWriteExecute,
+	};
+
+	class Manager {
+		struct ForkHandlers {};
+
+	public:
+		Manager() = default;
+
+		static Manager& Global() {
+			static Manager manager(ForkHandlers{});
+			return manager;
+		}
+
+		/**
+		 * @brief Makes every page of a range writable until the matching EndWrite, executable pages stay executable.
+		 *
+		 * @param view Receives where the range is written: its alias if every page is aliased, nullptr if it must be
+		 *             written through process memory, the range itself otherwise.
+		 * @return false If a page couldn't be made writable, EndWrite must be called all the same.
+		 */
+		bool BeginWrite(const void* address, std::size_t size, std::uint8_t*& view) {
+			Locked locked(*this, first(address), last(address, size));
+			bool aliased = true, mirrored = true;
+			std::uint8_t* previous = nullptr;
+			for (std::uintptr_t page = locked.first; page <= locked.last; ++page) {
+				State& state = locked.Find(page);
+				++state.writers;
+				aliased &= state.alias && (page == locked.first || state.alias == previous + PageSize);
+				mirrored &= state.mirrored;
+				previous = state.alias;
+			}
+
+			if (aliased) {
+				view = locked.Find(locked.first).alias + reinterpret_cast<std::uintptr_t>(address) % PageSize;
+				return true;
+			}
+			if (mirrored) {
+				view = nullptr;
+				return true;
+			}
+
+			// Pages of several alias runs are written in place
+			view = static_cast<std::uint8_t*>(const_cast<void*>(address));
+			for (std::uintptr_t page = locked.first; page <= locked.last; ++page)
+				locked.Change(page, locked.Find(page), writable(locked.Find(page).resting));
+			return locked.Apply();
+		}
+
+		/**
+		 * @brief Releases the pages of a range, the last writer restores their resting protection.
+		 *
+		 * The restore is deferred to the end of the batch open on this thread, if any.
+		 */
+		void EndWrite(const void* address, std::size_t size) {
+			Locked locked(*this, first(address), last(address, size));
+			for (std::uintptr_t page = locked.first; page <= locked.last; ++page) {
+				State& state = locked.Find(page);
+				if (--state.writers == 0)
+					restore(locked, page, state);
+			}
+			locked.Apply();
+		}
+
+		/**
+		 * @brief Sets the protection the pages of a range rest at, applied once no writer holds them.
+		 *
+		 * Pages no writer holds change at once, even while a batch is open: a page made inaccessible must be before
+		 * the code it holds can be reached again.
+		 */
+		void SetResting(const void* address, std::size_t size, Protection protection) {
+			Locked locked(*this, first(address), last(address, size));
+			for (std::uintptr_t page = locked.first; page <= locked.last; ++page) {
+				State& state = locked.Find(page);
+				state.resting = protection;
+				if (!state.writers)
+					locked.Change(page, state, protection);
+			}
+			locked.Apply();
+		}
+
+		/**
+		 * @brief Restores the pages this thread released during its batch, unless they were written again meanwhile.
+		 */
+		void Flush() {
+			std::vector<std::uintptr_t>& pending = pendingPages();
+			if (pending.empty())
+				return;
+
+			std::sort(pending.begin(), pending.end());
+			pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+			Locked locked(*this, pending);
+			for (std::uintptr_t page : pending) {
+				State& state = locked.Find(page);
+				if (!state.writers)
+					locked.Change(page, state, state.resting);
+			}
+			locked.Apply();
+			pending.clear();
+		}
+
+		/**
+		 * @brief Lets the pages of a range be written through an alias, without protection changes.
+		 *
+		 * Must run while no other thread writes them, the code is copied then remapped.
+		 *
+		 * @return false If the pages can't be aliased here, they are written in place.
+		 */
+		bool Alias(const void* address, std::size_t size) {
+			Locked locked(*this, Locked::AllStripes{});
+			std::uintptr_t firstPage = first(address), lastPage = last(address, size);
+#ifdef _WIN32
+			// Only a whole private allocation can be released and mapped again as a section
+			MEMORY_BASIC_INFORMATION region;
+			if (!ShadowCall<SIZE_T>("VirtualQuery", address, &region, sizeof(region)) || region.Type != MEM_PRIVATE || region.AllocationBase != address || region.RegionSize != (lastPage - firstPage + 1) * PageSize)
+				return false;
+
+			for (std::uintptr_t page = firstPage; page <= lastPage; ++page)
+				if (locked.Find(page).writers || locked.Find(page).alias || locked.Find(page).current != ReadExecute)
+					return false;
+
+			std::size_t length = region.RegionSize;
+			HANDLE section = ShadowCall<HANDLE>("CreateFileMappingW", INVALID_HANDLE_VALUE, nullptr, PAGE_EXECUTE_READWRITE | SEC_COMMIT, 0, static_cast<DWORD>(length), nullptr);
+			if (!section)
+				return false;
+
+			std::uint8_t* alias = static_cast<std::uint8_t*>(ShadowCall<LPVOID>("MapViewOfFile", section, FILE_MAP_WRITE, 0, 0, length));
+			if (!alias) {
+				ShadowCall<BOOL>("CloseHandle", section);
+				return false;
+			}
+			std::memcpy(alias, address, length);
+
+			// Nothing runs from the allocation yet, it is released for the executable view to take its place
+			LPVOID base = const_cast<LPVOID>(address);
+			ShadowCall<BOOL>("VirtualFree", base, 0, MEM_RELEASE);
+			LPVOID view = ShadowCall<LPVOID>("MapViewOfFileEx", section, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, length, base);
+			ShadowCall<BOOL>("CloseHandle", section);
+			if (view != base) {
+				if (view)
+					ShadowCall<BOOL>("UnmapViewOfFile", view);
+				ShadowCall<LPVOID>("VirtualAlloc", base, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+				std::memcpy(base, alias, length);
+				change(reinterpret_cast<std::uintptr_t>(base), length, ReadExecute);
+				ShadowCall<BOOL>("UnmapViewOfFile", alias);
+				return false;
+			}
+#else
+			// Aliased neighbours are remapped along, so the alias of a run stays contiguous
+			while (firstPage && peek(firstPage - 1) && peek(firstPage - 1)->alias)
+				--firstPage;
+			while (peek(lastPage + 1) && peek(lastPage + 1)->alias)
+				++lastPage;
+
+			bool aliased = true;
+			for (std::uintptr_t page = firstPage; page <= lastPage; ++page) {
+				State& state = locked.Find(page);
+				if (state.writers || (!state.alias && (state.current == NoAccess || state.mirrored)))
+					return false;
+				aliased &= state.alias && (page == firstPage || state.alias == locked.Find(page - 1).alias + PageSize);
+			}
+			if (aliased)
+				return true;
+
+			std::size_t length = (lastPage - firstPage + 1) * PageSize;
+			int file = memfd_create("scudo", MFD_CLOEXEC);
+			if (file < 0) {
+				// Writes go through process memory instead, unless it can't be opened either
+				if (processMemory() < 0)
+					return false;
+				for (std::uintptr_t page = first(address); page <= last(address, size); ++page)
+					locked.Find(page).mirrored = !locked.Find(page).alias;
+				return true;
+			}
+
+			void* mapped = ftruncate(file, static_cast<off_t>(length)) == 0 ? mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0) : MAP_FAILED;
+			if (mapped == MAP_FAILED) {
+				close(file);
+				return false;
+			}
+
+			std::uint8_t* alias = static_cast<std::uint8_t*>(mapped);
+			for (std::uintptr_t page = firstPage; page <= lastPage; ++page) {
+				State& state = locked.Find(page);
+				std::memcpy(alias + (page - firstPage) * PageSize, state.alias ? state.alias : reinterpret_cast<std::uint8_t*>(page * PageSize), PageSize);
+			}
+
+			// The executable view replaces the pages at once, threads running them see the same bytes
+			void* view = mmap(reinterpret_cast<void*>(firstPage * PageSize), length, PROT_READ | PROT_EXEC, MAP_SHARED | MAP_FIXED, file, 0);
+			close(file);
+			if (view == MAP_FAILED) {
+				munmap(alias, length);
+				return false;
+			}
+			systemCalls.fetch_add(1, std::memory_order_relaxed);
+#endif // _WIN32
+
+			for (std::uintptr_t page = firstPage; page <= lastPage; ++page) {
+				State& state = locked.Find(page);
+#ifndef _WIN32
+				// Pages keep their protection, the alias they had before is released
+				if (state.current != ReadExecute) {
+					Protection kept = state.current;
+					state.current = ReadExecute;
+					locked.Change(page, state, kept);
+				}
+				if (state.alias)
+					munmap(state.alias, PageSize);
+#endif // !_WIN32
+				state.alias = alias + (page - firstPage) * PageSize;
+				state.mirrored = false;
+			}
+			locked.Apply();
+			return true;
+		}
+
+		/**
+		 * @brief Number of protection changes made since the start, for measurements.
+		 */
+		std::uint64_t SystemCalls() const {
+			return systemCalls.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Defers the restores of this thread until it is destroyed, batches may nest.
+		 */
+		class Batch {
+		public:
+			Batch() { ++batchDepth(); }
+			~Batch() {
+				if (--batchDepth() == 0)
+					Global().Flush();
+			}
+
+			Batch(const Batch&) = delete;
+			Batch& operator=(const Batch&) = delete;
+		};
+
+	private:
+		explicit Manager(ForkHandlers) {
+#ifndef _WIN32
+			pthread_atfork([]() { Global().lockAll(); }, []() { Global().unlockAll(); }, []() {
+				Global().copyAliasesBack();
+				Global().unlockAll();
+			});
+#endif // !_WIN32
+		}
+
+		struct State {
+			Protection resting = ReadExecute;
+			Protection current = ReadExecute;
+			std::uint32_t writers = 0;
+			std::uint8_t* alias = nullptr;   ///< Writable view of the page, nullptr if it is written in place
+			bool mirrored = false;           ///< Written through process memory
+		};
+
+		struct alignas(64) Stripe {
+			std::mutex mutex;
+			std::unordered_map<std::uintptr_t, State> pages;
+		};
+
+		/**
+		 * @brief Holds the stripes of a set of pages, taken in ascending order, and the changes to make under them.
+		 */
+		class Locked {
+		public:
+			Locked(Manager& manager, std::uintptr_t first, std::uintptr_t last) : manager(manager), first(first), last(last) {
+				for (std::uintptr_t page = first; page <= last && ~held; ++page)
+					held |= 1ull << (page % Stripes);
+				lock();
+			}
+
+			Locked(Manager& manager, const std::vector<std::uintptr_t>& sortedPages) : manager(manager), first(0), last(0) {
+				for (std::uintptr_t page : sortedPages)
+					held |= 1ull << (page % Stripes);
+				lock();
+			}
+
+			struct AllStripes {};
+
+			Locked(Manager& manager, AllStripes) : manager(manager), first(0), last(0), held(~0ull) {
+				lock();
+			}
+
+			~Locked() {
+				for (std::uint64_t pending = held; pending; pending &= pending - 1)
+					manager.stripes[std::countr_zero(pending)].mutex.unlock();
+			}
+
+			Locked(const Locked&) = delete;
+			Locked& operator=(const Locked&) = delete;
+
+			State& Find(std::uintptr_t page) {
+				return manager.stripes[page % Stripes].pages[page];
+			}
+
+			/**
+			 * @brief Queues a change of page to protection, skipped if the page already has it.
+			 */
+			void Change(std::uintptr_t page, Manager::State& state, Protection protection) {
+				if (state.current != protection)
+					changes.push_back({ page, protection, &state });
+			}
+
+			/**
+			 * @brief Makes the queued changes, one system call per run of adjacent pages going to the same protection.
+			 */
+			bool Apply() {
+				bool applied = true;
+				for (std::size_t begin = 0, end; begin < changes.size(); begin = end) {
+					for (end = begin + 1; end < changes.size() && changes[end].page == changes[end - 1].page + 1 && changes[end].protection == changes[begin].protection; ++end);
+
+					bool changed = manager.change(changes[begin].page * PageSize, (end - begin) * PageSize, changes[begin].protection);
+					for (std::size_t index = begin; index < end; ++index)
+						if (changed)
+							changes[index].state->current = changes[index].protection;
+					applied &= changed;
+				}
+				changes.clear();
+				return applied;
+			}
+
+		private:
+			struct PendingChange {
+				std::uintptr_t page;
+				Protection protection;
+				Manager::State* state;
+			};
+
+			void lock() {
+				for (std::uint64_t pending = held; pending; pending &= pending - 1)
+					manager.stripes[std::countr_zero(pending)].mutex.lock();
+			}
+
+			Manager& manager;
+
+		public:
+			const std::uintptr_t first;
+			const std::uintptr_t last;
+
+		private:
+			std::uint64_t held = 0;
+			std::vector<PendingChange> changes;   ///< In ascending page order
+		};
+
+		// State of a page if it was ever seen, the stripe of the page must be held
+		State* peek(std::uintptr_t page) {
+			auto found = stripes[page % Stripes].pages.find(page);
+			return found != stripes[page % Stripes].pages.end() ? &found->second : nullptr;
+		}
+
+		static std::uintptr_t first(const void* address) {
+			return reinterpret_cast<std::uintptr_t>(address) / PageSize;
+		}
+
+		static std::uintptr_t last(const void* address, std::size_t size) {
+			return (reinterpret_cast<std::uintptr_t>(address) + (size ? size : 1) - 1) / PageSize;
+		}
+
+		static Protection writable(Protection resting) {
+			return resting == ReadExecute || resting == ReadWriteExecute ? ReadWriteExecute : ReadWrite;
+		}
+
+		static int& batchDepth() {
+			static thread_local int depth = 0;
+			return depth;
+		}
+
+		static std::vector<std::uintptr_t>& pendingPages() {
+			static thread_local std::vector<std::uintptr_t> pages;
+			return pages;
+		}
+
+		// Restores a page no writer holds, at the end of the batch of this thread if one is open
+		static void restore(Locked& locked, std::uintptr_t page, State& state) {
+			if (state.current == state.resting)
+				return;
+			if (batchDepth())
+				pendingPages().push_back(page);
+			else
+				locked.Change(page, state, state.resting);
+		}
+
+		bool change(std::uintptr_t address, std::size_t size, Protection protection) {
+			systemCalls.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+			using VirtualProtectFunc = BOOL(WINAPI*)(LPVOID, SIZE_T, DWORD, PDWORD);
+			static VirtualProtectFunc virtualProtect = reinterpret_cast<VirtualProtectFunc>(
+				ShadowCall<FARPROC>("GetProcAddress", ShadowCall<HMODULE>("LoadLibraryA", "kernel32.dll"), "VirtualProtect"));
+
+			static constexpr DWORD flags[] = { PAGE_NOACCESS, PAGE_READWRITE, PAGE_EXECUTE_READ, PAGE_EXECUTE_READWRITE };
+			DWORD oldProtection;
+			return virtualProtect && virtualProtect(reinterpret_cast<LPVOID>(address), size, flags[protection], &oldProtection);
+#else
+			static constexpr int flags[] = { PROT_NONE, PROT_READ | PROT_WRITE, PROT_READ | PROT_EXEC, PROT_READ | PROT_WRITE | PROT_EXEC };
+			return mprotect(reinterpret_cast<void*>(address), size, flags[protection]) == 0;
+#endif // _WIN32
+		}
+
+#ifndef _WIN32
+	public:
+		/**
+		 * @brief Descriptor of /proc/self/mem, -1 if it can't be opened.
+		 */
+		static int processMemory() {
+			return processMemoryDescriptor();
+		}
+
+	private:
+		static int& processMemoryDescriptor() {
+			static int descriptor = open("/proc/self/mem", O_RDWR | O_CLOEXEC);
+			return descriptor;
+		}
+
+		void lockAll() {
+			for (Stripe& stripe : stripes)
+				stripe.mutex.lock();
+		}
+
+		void unlockAll() {
+			for (Stripe& stripe : stripes)
+				stripe.mutex.unlock();
+		}
+
+		// Runs in the child of a fork with every stripe held, the forking thread is the only one left
+		void copyAliasesBack() {
+			for (Stripe& stripe : stripes)
+				for (auto& [firstPage, firstState] : stripe.pages) {
+					State* previous = firstPage ? peek(firstPage - 1) : nullptr;
+					if (!firstState.alias || (previous && previous->alias && previous->alias + PageSize == firstState.alias))
+						continue;
+
+					// A run is copied whole from its first page, its other pages are skipped once their alias is gone
+					std::uintptr_t lastPage = firstPage;
+					for (State* next; (next = peek(lastPage + 1)) && next->alias == peek(lastPage)->alias + PageSize; ++lastPage);
+
+					std::size_t length = (lastPage - firstPage + 1) * PageSize;
+					std::uint8_t* alias = firstState.alias;
+					void* copy = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+					if (copy == MAP_FAILED)
+						continue; // The run stays shared
+
+					std::memcpy(copy, alias, length);
+					if (mremap(copy, length, length, MREMAP_MAYMOVE | MREMAP_FIXED, reinterpret_cast<void*>(firstPage * PageSize)) == MAP_FAILED) {
+						munmap(copy, length);
+						continue;
+					}
+					munmap(alias, length);
+
+					// The copy is read-write, the pages get back the protection they had
+					for (std::uintptr_t begin = firstPage, end; begin <= lastPage; begin = end) {
+						for (end = begin + 1; end <= lastPage && peek(end)->current == peek(begin)->current; ++end);
+						change(begin * PageSize, (end - begin) * PageSize, peek(begin)->current);
+					}
+					for (std::uintptr_t page = firstPage; page <= lastPage; ++page)
+						peek(page)->alias = nullptr;
+				}
+
+			// The descriptor still refers to the memory of the parent
+			int& descriptor = processMemoryDescriptor();
+			if (descriptor >= 0) {
+				close(descriptor);
+				descriptor = open("/proc/self/mem", O_RDWR | O_CLOEXEC);
+			}
+		}
+#endif // !_WIN32
+		Stripe stripes[Stripes];
+		std::atomic<std::uint64_t> systemCalls{ 0 };
+	};
+
+	/**
+	 * @brief Holds a range writable for its lifetime, the range is written through View.
+	 *
+	 * Ranges written through process memory are copied in and written back when the range is released, so
+	 * writers of the same page must hold ranges that don't overlap.
+	 */
+	class Writable {
+	public:
+		Writable(const void* address, std::size_t size) : address(static_cast<const std::uint8_t*>(address)), size(size) {
+			success = Manager::Global().BeginWrite(address, size, view);
+#ifndef _WIN32
+			if (success && !view) {
+				buffer = std::make_unique<std::uint8_t[]>(size);
+				view = buffer.get();
+				success = pread(Manager::processMemory(), view, size, static_cast<off_t>(reinterpret_cast<std::uintptr_t>(address))) == static_cast<ssize_t>(size);
+			}
+#endif // !_WIN32
+		}
+
+		~Writable() {
+#ifndef _WIN32
+			if (buffer && success)
+				pwrite(Manager::processMemory(), buffer.get(), size, static_cast<off_t>(reinterpret_cast<std::uintptr_t>(address)));
+#endif // !_WIN32
+			Manager::Global().EndWrite(address, size);
+		}
+
+		Writable(const Writable&) = delete;
+		Writable& operator=(const Writable&) = delete;
+
+		explicit operator bool() const { return success; }
+
+		/**
+		 * @brief Returns where the byte at an address of the range is written.
+		 */
+		template<typename T>
+		T* View(T* at) const {
+			return reinterpret_cast<T*>(view + (reinterpret_cast<const std::uint8_t*>(at) - address));
+		}
+
+	private:
+		const std::uint8_t* address;
+		std::size_t size;
+		std::uint8_t* view = nullptr;
+		std::unique_ptr<std::uint8_t[]> buffer;
+		bool success = false;
+	};
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+
+/*
+	Page granular state of large protected functions.
+	The whole pages inside a function are left inaccessible while encrypted, the first access faults
+	and only that page is decrypted, with the seekable cipher at the offset of the page in the
+	function. Each page is keyed from an epoch of its own, so the pages a call touched are
+	re-encrypted under a new key when it returns while the others are never rewritten.
+	The pages holding the entry and the tail of the function are shared with neighbouring code and
+	stay executable, they are decrypted with the function when a call enters it.
+*/
+
+namespace paging
+{
+	constexpr std::uintptr_t PageSize = 0x1000; ///< Granularity of page protection
+
+	/**
+	 * @brief State of one interior page.
+	 */
+	struct Page {
+		std::atomic<bool> plaintext{ true }; ///< Decrypted and executable, otherwise encrypted and inaccessible
+		std::uint32_t epoch = 0;             ///< Epoch the page key is derived from while it is encrypted
+	};
+
+	/**
+	 * @brief Whole pages of a function behind its entry, empty unless the function spans at least minimumPages of them.
+	 */
+	class Interior {
+	public:
+		Interior() = default;
+
+		/**
+		 * @param entryLength Bytes of the entry that must stay readable, the page holding them is never part of the interior.
+		 */
+		Interior(const void* function, std::size_t size, std::size_t entryLength, std::size_t minimumPages) {
+			std::uintptr_t start = reinterpret_cast<std::uintptr_t>(function);
+			std::uintptr_t first = (start + entryLength + PageSize - 1) & ~(PageSize - 1);
+			std::uintptr_t last = (start + size) & ~(PageSize - 1);
+			if (!minimumPages || last <= first || (last - first) / PageSize < minimumPages)
+				return;
+
+			begin = reinterpret_cast<std::uint8_t*>(first);
+			end = reinterpret_cast<std::uint8_t*>(last);
+			pages = std::make_unique<Page[]>(Count());
+		}
+
+		explicit operator bool() const { return pages != nullptr; }
+
+		std::uint8_t* Begin() const { return begin; }
+		std::uint8_t* End() const { return end; }
+		std::size_t Count() const { return static_cast<std::size_t>(end - begin) / PageSize; }
+
+		bool Contains(const void* address) const {
+			return pages && address >= begin && address < end;
+		}
+
+		/**
+		 * @brief Index of the page holding address, which must be inside the interior.
+		 */
+		std::size_t IndexOf(const void* address) const {
+			return static_cast<std::size_t>(static_cast<const std::uint8_t*>(address) - begin) / PageSize;
+		}
+
+		std::uint8_t* Address(std::size_t index) const { return begin + index * PageSize; }
+
+		Page& operator[](std::size_t index) const { return pages[index]; }
+
+	private:
+		std::uint8_t* begin = nullptr;
+		std::uint8_t* end = nullptr;
+		std::unique_ptr<Page[]> pages;
+	};
+}
@@ -0,0 +1,338 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <span>
+#include <algorithm>
+
+/*
+	Minimal PDB reader, no DIA or msdia140.dll required.
+	Only the streams needed to list functions are read:
+
+	- MSF superblock and stream directory
+	- DBI stream (3): module list and the optional debug header
+	- Section header stream referenced by the debug header, to turn segment:offset into an RVA
+	- The symbol part of every module stream, S_GPROC32 / S_LPROC32 (and their _ID / _DPC variants)
+
+	Type, global symbol and line number streams are never touched, so with a memory mapped
+	file only a small part of the PDB is read from disk.
+*/
+
+namespace pdb
+{
+	constexpr char Magic[32] = "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0";
+	constexpr std::uint32_t NilStream = 0xFFFFFFFF;
+	constexpr std::uint16_t NilStreamIndex = 0xFFFF;
+	constexpr std::uint32_t InfoStream = 1;
+	constexpr std::uint32_t DbiStream = 3;
+	constexpr std::size_t DebugSectionHeaders = 5; ///< Index of the section header stream in the optional debug header
+	constexpr std::uint32_t ModuleSignatureC13 = 4;
+
+	enum SymbolKind : std::uint16_t {
+		S_LPROC32 = 0x110F,
+		S_GPROC32 = 0x1110,
+		S_LPROC32_ID = 0x1146,
+		S_GPROC32_ID = 0x1147,
+		S_LPROC32_DPC = 0x1155,
+		S_LPROC32_DPC_ID = 0x1156,
+	};
+
+	struct SuperBlock {
+		char magic[32];
+		std::uint32_t blockSize;
+		std::uint32_t freeBlockMapBlock;
+		std::uint32_t numBlocks;
+		std::uint32_t numDirectoryBytes;
+		std::uint32_t unknown;
+		std::uint32_t blockMapAddress;   ///< Block holding the block list of the stream directory
+	};
+
+	struct InfoHeader {
+		std::uint32_t version;
+		std::uint32_t signature;
+		std::uint32_t age;
+		std::uint8_t guid[16];           ///< Matches the GUID of the RSDS record in the image
+	};
+
+	struct DbiHeader {
+		std::int32_t versionSignature;
+		std::uint32_t versionHeader;
+		std::uint32_t age;
+		std::uint16_t globalStreamIndex;
+		std::uint16_t buildNumber;
+		std::uint16_t publicStreamIndex;
+		std::uint16_t pdbDllVersion;
+		std::uint16_t symRecordStream;
+		std::uint16_t pdbDllRebuild;
+		std::int32_t moduleInfoSize;
+		std::int32_t sectionContributionSize;
+		std::int32_t sectionMapSize;
+		std::int32_t sourceInfoSize;
+		std::int32_t typeServerMapSize;
+		std::uint32_t mfcTypeServerIndex;
+		std::int32_t optionalDebugHeaderSize;
+		std::int32_t ecSubstreamSize;
+		std::uint16_t flags;
+		std::uint16_t machine;
+		std::uint32_t padding;
+	};
+
+	/*
+		Fixed part of a DBI module record, followed by the module and object file names.
+	*/
+	struct ModuleInfo {
+		std::uint32_t unused;
+		std::uint8_t sectionContribution[28];
+		std::uint16_t flags;
+		std::uint16_t symbolStream;
+		std::uint32_t symbolBytes;       ///< Size of the symbol records, including the signature
+		std::uint32_t c11Bytes;
+		std::uint32_t c13Bytes;
+		std::uint16_t sourceFileCount;
+		std::uint16_t padding;
+		std::uint32_t unused2;
+		std::uint32_t sourceFileNameIndex;
+		std::uint32_t pdbFilePathNameIndex;
+	};
+
+	struct ProcSymbol {
+		std::uint32_t parent;
+		std::uint32_t end;
+		std::uint32_t next;
+		std::uint32_t codeSize;
+		std::uint32_t debugStart;
+		std::uint32_t debugEnd;
+		std::uint32_t typeIndex;
+		std::uint32_t codeOffset;
+		std::uint16_t segment;
+		std::uint8_t flags;
+	};
+
+	struct SectionHeader {
+		char name[8];
+		std::uint32_t virtualSize;
+		std::uint32_t virtualAddress;
+		std::uint32_t sizeOfRawData;
+		std::uint32_t pointerToRawData;
+		std::uint32_t pointerToRelocations;
+		std::uint32_t pointerToLinenumbers;
+		std::uint16_t numberOfRelocations;
+		std::uint16_t numberOfLinenumbers;
+		std::uint32_t characteristics;
+	};
+
+	static_assert(sizeof(SuperBlock) == 56 && sizeof(DbiHeader) == 64 && sizeof(ModuleInfo) == 64 && sizeof(SectionHeader) == 40);
+
+	struct Function {
+		std::uint32_t rva;
+		std::uint32_t size;
+	};
+
+	/*
+		Bounds checked view over a PDB file.
+		The stream directory is read once on construction, streams are copied out on demand.
+	*/
+	class File {
+	public:
+		File(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {
+			if (size_ < sizeof(SuperBlock) || std::memcmp(data_, Magic, sizeof(Magic)))
+				return;
+
+			std::memcpy(&superBlock_, data_, sizeof(superBlock_));
+			std::uint32_t blockSize = superBlock_.blockSize;
+			if (blockSize != 512 && blockSize != 1024 && blockSize != 2048 && blockSize != 4096)
+				return;
+			if (std::uint64_t(superBlock_.numBlocks) * blockSize > size_)
+				return;
+
+			// The directory is itself stored in blocks, listed in the block at blockMapAddress
+			std::uint32_t directoryBlocks = (superBlock_.numDirectoryBytes + blockSize - 1) / blockSize;
+			if (directoryBlocks > blockSize / sizeof(std::uint32_t) || !ValidBlock(superBlock_.blockMapAddress))
+				return;
+
+			std::vector<std::uint32_t> blockList(directoryBlocks);
+			std::memcpy(blockList.data(), Block(superBlock_.blockMapAddress), directoryBlocks * sizeof(std::uint32_t));
+
+			directory_.resize((superBlock_.numDirectoryBytes + 3) / 4);
+			if (!ReadBlocks(blockList, superBlock_.numDirectoryBytes, reinterpret_cast<std::uint8_t*>(directory_.data())) || directory_.empty())
+				return;
+
+			// { numStreams, sizes[numStreams], blocks of stream 0, blocks of stream 1, ... }
+			std::uint64_t streamCount = directory_[0];
+			if (streamCount + 1 > directory_.size())
+				return;
+
+			streamBlocks_.resize(streamCount + 1);
+			std::uint64_t blockIndex = 1 + streamCount;
+			for (std::uint32_t stream = 0; stream < streamCount; ++stream) {
+				streamBlocks_[stream] = static_cast<std::uint32_t>(blockIndex);
+				blockIndex += BlockCount(StreamSize(stream));
+			}
+			if (blockIndex > directory_.size())
+				return;
+
+			streamBlocks_[streamCount] = static_cast<std::uint32_t>(blockIndex);
+			streamCount_ = static_cast<std::uint32_t>(streamCount);
+		}
+
+		bool Valid() const { return streamCount_ > DbiStream; }
+		std::uint32_t StreamCount() const { return streamCount_; }
+
+		std::uint32_t StreamSize(std::uint32_t stream) const {
+			std::uint32_t size = 1 + std::size_t(stream) < directory_.size() ? directory_[1 + stream] : NilStream;
+			return size == NilStream ? 0 : size;
+		}
+
+		/**
+		 * @brief Copies up to maxSize bytes of a stream into buffer, returns false if the stream is missing or corrupt.
+		 */
+		bool ReadStream(std::uint32_t stream, std::vector<std::uint8_t>& buffer, std::size_t maxSize = SIZE_MAX) const {
+			buffer.clear();
+			if (stream >= streamCount_)
+				return false;
+
+			std::size_t size = (std::min)(std::size_t(StreamSize(stream)), maxSize);
+			std::span<const std::uint32_t> blocks(directory_.data() + streamBlocks_[stream], BlockCount(size));
+			buffer.resize(size);
+			return ReadBlocks(blocks, size, buffer.data());
+		}
+
+		/**
+		 * @brief Compares the GUID of the info stream with the one recorded in the image.
+		 */
+		bool MatchesGuid(const std::uint8_t guid[16]) const {
+			std::vector<std::uint8_t> info;
+			if (!ReadStream(InfoStream, info, sizeof(InfoHeader)) || info.size() < sizeof(InfoHeader))
+				return false;
+			return !std::memcmp(reinterpret_cast<const InfoHeader*>(info.data())->guid, guid, 16);
+		}
+
+		/**
+		 * @brief Lists the RVA and code size of every procedure in the module streams.
+		 *
+		 * Static and leaf functions are included, they have a symbol even without unwind data.
+		 * Returns an empty list if the PDB has no section headers to resolve addresses with.
+		 *
+		 * @param imageSections Section headers of the image, used when the PDB doesn't record them.
+		 */
+		std::vector<Function> Functions(std::span<const SectionHeader> imageSections = {}) const {
+			std::vector<Function> functions;
+			std::vector<std::uint8_t> dbi;
+			if (!ReadStream(DbiStream, dbi) || dbi.size() < sizeof(DbiHeader))
+				return functions;
+
+			DbiHeader header;
+			std::memcpy(&header, dbi.data(), sizeof(header));
+			if (header.versionSignature != -1)
+				return functions;
+
+			// Substreams follow the header in this order, the debug header is last
+			std::uint64_t moduleBegin = sizeof(DbiHeader);
+			std::uint64_t moduleEnd = moduleBegin + std::uint32_t(header.moduleInfoSize);
+			std::uint64_t debugBegin = moduleEnd + std::uint32_t(header.sectionContributionSize) + std::uint32_t(header.sectionMapSize)
+				+ std::uint32_t(header.sourceInfoSize) + std::uint32_t(header.typeServerMapSize) + std::uint32_t(header.ecSubstreamSize);
+			std::uint64_t debugEnd = debugBegin + std::uint32_t(header.optionalDebugHeaderSize);
+			if (debugEnd > dbi.size())
+				return functions;
+
+			std::vector<SectionHeader> sections = ReadSections(dbi.data() + debugBegin, debugEnd - debugBegin);
+			if (sections.empty())
+				sections.assign(imageSections.begin(), imageSections.end());
+			if (sections.empty())
+				return functions;
+
+			std::vector<std::uint8_t> symbols;
+			for (std::uint64_t offset = moduleBegin; offset + sizeof(ModuleInfo) <= moduleEnd;) {
+				ModuleInfo module;
+				std::memcpy(&module, dbi.data() + offset, sizeof(module));
+
+				// Skip the module and object names, records are 4 byte aligned
+				const char* names = reinterpret_cast<const char*>(dbi.data() + offset + sizeof(ModuleInfo));
+				std::size_t remaining = moduleEnd - offset - sizeof(ModuleInfo);
+				std::size_t moduleName = strnlen(names, remaining);
+				std::size_t objectName = moduleName < remaining ? strnlen(names + moduleName + 1, remaining - moduleName - 1) : 0;
+				offset = (offset + sizeof(ModuleInfo) + moduleName + objectName + 2 + 3) & ~std::uint64_t(3);
+
+				if (module.symbolStream == NilStreamIndex || module.symbolBytes <= sizeof(std::uint32_t))
+					continue;
+				if (ReadStream(module.symbolStream, symbols, module.symbolBytes))
+					AddProcedures(symbols, sections, functions);
+			}
+			return functions;
+		}
+
+	private:
+		std::size_t BlockCount(std::size_t bytes) const { return (bytes + superBlock_.blockSize - 1) / superBlock_.blockSize; }
+		bool ValidBlock(std::uint32_t block) const { return block < superBlock_.numBlocks; }
+		const std::uint8_t* Block(std::uint32_t block) const { return data_ + std::size_t(block) * superBlock_.blockSize; }
+
+		bool ReadBlocks(std::span<const std::uint32_t> blocks, std::size_t size, std::uint8_t* destination) const {
+			for (std::uint32_t block : blocks) {
+				if (!ValidBlock(block))
+					return false;
+				std::size_t chunk = (std::min)(size, std::size_t(superBlock_.blockSize));
+				std::memcpy(destination, Block(block), chunk);
+				destination += chunk;
+				size -= chunk;
+			}
+			return size == 0;
+		}
+
+		std::vector<SectionHeader> ReadSections(const std::uint8_t* debugHeader, std::size_t debugHeaderSize) const {
+			std::vector<SectionHeader> sections;
+			std::uint16_t stream;
+			if (debugHeaderSize < (DebugSectionHeaders + 1) * sizeof(stream))
+				return sections;
+
+			std::memcpy(&stream, debugHeader + DebugSectionHeaders * sizeof(stream), sizeof(stream));
+			std::vector<std::uint8_t> contents;
+			if (stream == NilStreamIndex || !ReadStream(stream, contents))
+				return sections;
+
+			sections.resize(contents.size() / sizeof(SectionHeader));
+			std::memcpy(sections.data(), contents.data(), sections.size() * sizeof(SectionHeader));
+			return sections;
+		}
+
+		static void AddProcedures(std::span<const std::uint8_t> symbols, std::span<const SectionHeader> sections, std::vector<Function>& functions) {
+			std::uint32_t signature;
+			if (symbols.size() < sizeof(signature))
+				return;
+			std::memcpy(&signature, symbols.data(), sizeof(signature));
+			if (signature != ModuleSignatureC13)
+				return;
+
+			// Records: { u16 length (excluding itself), u16 kind, data }
+			for (std::size_t offset = sizeof(signature); offset + 4 <= symbols.size();) {
+				std::uint16_t length, kind;
+				std::memcpy(&length, symbols.data() + offset, sizeof(length));
+				std::memcpy(&kind, symbols.data() + offset + 2, sizeof(kind));
+				if (length < sizeof(kind) || offset + 2 + length > symbols.size())
+					break;
+
+				switch (kind) {
+				case S_LPROC32: case S_GPROC32:
+				case S_LPROC32_ID: case S_GPROC32_ID:
+				case S_LPROC32_DPC: case S_LPROC32_DPC_ID:
+					if (length >= sizeof(kind) + offsetof(ProcSymbol, flags)) {
+						ProcSymbol procedure{};
+						std::memcpy(&procedure, symbols.data() + offset + 4, offsetof(ProcSymbol, flags));
+						if (procedure.codeSize && procedure.segment >= 1 && procedure.segment <= sections.size())
+							functions.push_back({ sections[procedure.segment - 1].virtualAddress + procedure.codeOffset, procedure.codeSize });
+					}
+					break;
+				}
+
+				offset += 2 + length;
+			}
+		}
+
+		const std::uint8_t* data_;
+		std::size_t size_;
+		SuperBlock superBlock_{};
+		std::vector<std::uint32_t> directory_;
+		std::vector<std::uint32_t> streamBlocks_; ///< Index into directory_ of the first block of every stream
+		std::uint32_t streamCount_ = 0;
+	};
+}
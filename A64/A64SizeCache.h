@@ -0,0 +1,486 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <span>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include <A64Mapping.h>
+#include <A64Module.h>
+#include <A64Aes.h>
+#include <A64KeyPool.h>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif // !_WIN32
+
+/*
+	Persistent function size cache.
+	Sizes measured by one run are written to a file and reused by the next run of the same
+	binary, so a warm start doesn't disassemble anything again.
+
+	A size decides how many bytes are encrypted, so the files live in a directory only the
+	user can write (~/.cache/scudo, mode 0700 and owned by the user, or %LOCALAPPDATA%\Scudo)
+	and are authenticated with a key kept next to them. A size of 1 would leave the body in
+	plaintext and an oversized one would encrypt the neighbouring functions, so files without
+	a valid MAC are ignored and rewritten.
+
+	The file is named after the identity of the module (PE timestamp / checksum / image size,
+	or the ELF build-id) and is only trusted if the identity stored in its header matches.
+	Layout: Header, then Entry[count] sorted by RVA. The header carries a MAC (AES CBC-MAC) and
+	every entry a check value keyed with it, so lookups validate the entries they read without
+	touching the rest of the file.
+
+	New sizes are kept in memory and written back on Flush (or when the cache is destroyed at
+	exit) through a new temporary file that replaces the old one.
+*/
+
+class FunctionSizeCache {
+public:
+	static constexpr std::uint32_t Magic = 0x43535341;   ///< 'ASSC'
+	static constexpr std::uint16_t Version = 2;
+	static constexpr std::size_t IdentitySize = 32;
+
+	enum IdentityKind : std::uint8_t {
+		IdentityPe = 1,       ///< Timestamp, checksum and size of image
+		IdentityBuildId = 2,  ///< ELF NT_GNU_BUILD_ID note
+		IdentityFile = 3,     ///< Size and modification time of the ELF file, when it has no build-id
+	};
+
+	struct Header {
+		std::uint32_t magic;
+		std::uint16_t version;
+		std::uint16_t entrySize;
+		std::uint8_t identity[IdentitySize];
+		std::uint64_t count;
+		std::uint64_t mac;        ///< Covers every field above, keyed
+	};
+
+	struct Entry {
+		std::uint32_t rva;
+		std::uint32_t size;
+		std::uint64_t check;      ///< Keyed with the header MAC, rva and size
+	};
+
+	explicit FunctionSizeCache(const LoadedModule& module) : base_(module.base) {
+		std::string directory = Directory();
+		std::uint8_t key[cipher::aes::KeySize];
+		if (directory.empty() || !ReadKey(directory, key) || !ReadIdentity(module, identity_))
+			return;
+
+		cipher::aes::portable::ExpandKey(key, roundKeys_);
+		path_ = directory + "scudo-" + Hex(Fnv(identity_, sizeof(identity_))) + ".cache";
+		Map();
+	}
+
+	~FunctionSizeCache() { Flush(); }
+
+	FunctionSizeCache(const FunctionSizeCache&) = delete;
+	FunctionSizeCache& operator=(const FunctionSizeCache&) = delete;
+
+	/**
+	 * @brief Returns false if the module has no usable identity, nothing is cached then.
+	 */
+	bool Enabled() const { return !path_.empty(); }
+
+	/**
+	 * @brief Returns the cached size of the function starting at the passed address, or 0.
+	 */
+	std::size_t Lookup(const void* function) {
+		std::uint32_t rva;
+		if (!Rva(function, rva))
+			return 0;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto pending = pending_.find(rva);
+		if (pending != pending_.end())
+			return pending->second;
+
+		// Binary search only touches the pages on the search path
+		auto it = std::lower_bound(entries_.begin(), entries_.end(), rva, [](const Entry& entry, std::uint32_t value) {
+			return entry.rva < value;
+		});
+		if (it == entries_.end() || it->rva != rva)
+			return 0;
+
+		if (it->check != Check(mac_, it->rva, it->size)) {
+			dirty_ = true;
+			return 0;
+		}
+		return it->size;
+	}
+
+	/**
+	 * @brief Records a measured size, written to disk on the next Flush.
+	 */
+	void Store(const void* function, std::size_t size) {
+		std::uint32_t rva;
+		if (!Enabled() || !Rva(function, rva) || !size || size > UINT32_MAX)
+			return;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		pending_[rva] = static_cast<std::uint32_t>(size);
+	}
+
+	/**
+	 * @brief Writes the cached and newly recorded sizes back to disk if anything changed.
+	 *
+	 * @return false If the file could not be replaced (for example while another process maps it).
+	 */
+	bool Flush() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!Enabled() || (pending_.empty() && !dirty_))
+			return true;
+
+		// Merge the valid mapped entries with the new ones, new measurements win
+		std::vector<Entry> merged;
+		merged.reserve(entries_.size() + pending_.size());
+		for (const auto& [rva, size] : pending_)
+			merged.push_back({ rva, size, 0 });
+		for (const Entry& entry : entries_)
+			if (entry.check == Check(mac_, entry.rva, entry.size) && !pending_.count(entry.rva))
+				merged.push_back(entry);
+
+		std::sort(merged.begin(), merged.end(), [](const Entry& left, const Entry& right) { return left.rva < right.rva; });
+
+		Header header{ Magic, Version, sizeof(Entry), {}, merged.size(), 0 };
+		std::memcpy(header.identity, identity_, sizeof(identity_));
+		header.mac = HeaderMac(header);
+		for (Entry& entry : merged)
+			entry.check = Check(header.mac, entry.rva, entry.size);
+
+		std::vector<std::uint8_t> contents(sizeof(header) + merged.size() * sizeof(Entry));
+		std::memcpy(contents.data(), &header, sizeof(header));
+		std::memcpy(contents.data() + sizeof(header), merged.data(), merged.size() * sizeof(Entry));
+
+		// Created exclusively under an unpredictable name, a file or link planted there is never written through
+		std::uint64_t suffix;
+		cipher::SystemEntropy(reinterpret_cast<std::uint8_t*>(&suffix), sizeof(suffix));
+		std::string temporary = path_ + "." + Hex(suffix) + ".tmp";
+		if (!CreateNew(temporary, contents))
+			return false;
+
+		// The old file has to be unmapped before it can be replaced on Windows
+		Unmap();
+#ifdef _WIN32
+		bool replaced = ShadowCall<BOOL>("MoveFileExA", temporary.c_str(), path_.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+		bool replaced = std::rename(temporary.c_str(), path_.c_str()) == 0;
+#endif // _WIN32
+		if (!replaced)
+			std::remove(temporary.c_str());
+
+		pending_.clear();
+		dirty_ = false;
+		Map();
+		return replaced;
+	}
+
+	/**
+	 * @brief Returns the cache of the module containing the passed address, or nullptr.
+	 */
+	static FunctionSizeCache* ForAddress(const void* address) {
+		LoadedModule loaded;
+		if (!FindLoadedModule(address, loaded))
+			return nullptr;
+
+		std::lock_guard<std::mutex> lock(ModulesMutex());
+		std::unique_ptr<FunctionSizeCache>& module = Modules()[loaded.base];
+		if (!module)
+			module = std::make_unique<FunctionSizeCache>(loaded);
+		return module->Enabled() ? module.get() : nullptr;
+	}
+
+	/**
+	 * @brief Writes back the caches of every module.
+	 */
+	static void FlushAll() {
+		std::lock_guard<std::mutex> lock(ModulesMutex());
+		for (auto& [base, module] : Modules())
+			module->Flush();
+	}
+
+private:
+	static std::mutex& ModulesMutex() {
+		static std::mutex modulesMutex;
+		return modulesMutex;
+	}
+
+	static std::unordered_map<std::uintptr_t, std::unique_ptr<FunctionSizeCache>>& Modules() {
+		static std::unordered_map<std::uintptr_t, std::unique_ptr<FunctionSizeCache>> modules;
+		return modules;
+	}
+
+	bool Rva(const void* function, std::uint32_t& rva) const {
+		std::uintptr_t address = reinterpret_cast<std::uintptr_t>(function);
+		if (address < base_ || address - base_ > UINT32_MAX)
+			return false;
+		rva = static_cast<std::uint32_t>(address - base_);
+		return true;
+	}
+
+	/**
+	 * @brief Maps the cache file and validates its header, an invalid file is treated as empty.
+	 */
+	void Map() {
+		entries_ = {};
+		mac_ = 0;
+		if (!mapping_.Open(path_.c_str()))
+			return;
+
+		Header header;
+		if (mapping_.Size() < sizeof(Header)) {
+			Unmap();
+			return;
+		}
+		std::memcpy(&header, mapping_.Data(), sizeof(header));
+
+		bool valid = header.magic == Magic && header.version == Version && header.entrySize == sizeof(Entry)
+			&& !std::memcmp(header.identity, identity_, sizeof(identity_))
+			&& header.count == (mapping_.Size() - sizeof(Header)) / sizeof(Entry)
+			&& mapping_.Size() == sizeof(Header) + header.count * sizeof(Entry)
+			&& header.mac == HeaderMac(header);
+		if (!valid) {
+			Unmap();
+			dirty_ = true;
+			return;
+		}
+
+		mac_ = header.mac;
+		entries_ = { reinterpret_cast<const Entry*>(mapping_.Data() + sizeof(Header)), static_cast<std::size_t>(header.count) };
+	}
+
+	void Unmap() {
+		entries_ = {};
+		mapping_.Close();
+	}
+
+	static bool ReadIdentity(const LoadedModule& module, std::uint8_t (&identity)[IdentitySize]) {
+		std::memset(identity, 0, IdentitySize);
+#ifdef _WIN32
+		auto image = reinterpret_cast<const shadow::win::image_t*>(module.base);
+		std::uint32_t fields[] = {
+			image->get_nt_headers()->file_header.timedate_stamp,
+			image->get_optional_header()->checksum,
+			image->get_optional_header()->size_image,
+			image->get_nt_headers()->file_header.machine,
+		};
+		identity[0] = IdentityPe;
+		std::memcpy(identity + 4, fields, sizeof(fields));
+		return true;
+#else
+		constexpr std::uint32_t NoteGnuBuildId = 3;
+
+		// The build-id note is loaded with the object, no file access needed
+		for (const ElfW(Phdr)& segment : module.segments) {
+			if (segment.p_type != PT_NOTE)
+				continue;
+
+			auto note = reinterpret_cast<const std::uint8_t*>(module.base + segment.p_vaddr);
+			auto end = note + segment.p_memsz;
+			while (end - note >= 12) {
+				std::uint32_t nameSize, descriptionSize, type;
+				std::memcpy(&nameSize, note, 4);
+				std::memcpy(&descriptionSize, note + 4, 4);
+				std::memcpy(&type, note + 8, 4);
+				const std::uint8_t* name = note + 12;
+				const std::uint8_t* description = name + ((nameSize + 3) & ~3u);
+				if (description + descriptionSize > end)
+					break;
+
+				if (type == NoteGnuBuildId && nameSize == 4 && !std::memcmp(name, "GNU", 4)) {
+					identity[0] = IdentityBuildId;
+					identity[1] = static_cast<std::uint8_t>((std::min)(std::size_t(descriptionSize), IdentitySize - 2));
+					std::memcpy(identity + 2, description, identity[1]);
+					return true;
+				}
+				note = description + ((descriptionSize + 3) & ~3u);
+			}
+		}
+
+		struct stat status {};
+		if (stat(module.path.c_str(), &status) != 0)
+			return false;
+
+		std::uint64_t fields[] = { static_cast<std::uint64_t>(status.st_size), static_cast<std::uint64_t>(status.st_mtime), static_cast<std::uint64_t>(status.st_ino) };
+		identity[0] = IdentityFile;
+		std::memcpy(identity + 8, fields, sizeof(fields));
+		return true;
+#endif // _WIN32
+	}
+
+	/**
+	 * @brief Returns the private cache directory of the user, created if needed, or an empty string if there is none safe to use.
+	 */
+	static std::string Directory() {
+#ifdef _WIN32
+		// The profile of the user is only accessible to the user, the directory inherits its ACL
+		char path[MAX_PATH] = {};
+		DWORD length = ShadowCall<DWORD>("GetEnvironmentVariableA", "LOCALAPPDATA", path, MAX_PATH);
+		if (!length || length >= MAX_PATH)
+			return {};
+
+		std::string directory = std::string(path, length) + "\\Scudo";
+		ShadowCall<BOOL>("CreateDirectoryA", directory.c_str(), nullptr);
+
+		// A junction could point the files anywhere
+		DWORD attributes = ShadowCall<DWORD>("GetFileAttributesA", directory.c_str());
+		if (attributes == INVALID_FILE_ATTRIBUTES || !(attributes & FILE_ATTRIBUTE_DIRECTORY) || (attributes & FILE_ATTRIBUTE_REPARSE_POINT))
+			return {};
+		return directory + "\\";
+#else
+		std::string directory;
+		const char* cache = std::getenv("XDG_CACHE_HOME");
+		const char* home = std::getenv("HOME");
+		if (cache && *cache == '/')
+			directory = cache;
+		else if (home && *home == '/')
+			directory = std::string(home) + "/.cache";
+		else
+			return {};
+
+		mkdir(directory.c_str(), 0700);
+		directory += "/scudo";
+		mkdir(directory.c_str(), 0700);
+
+		// Only a directory of the user that nobody else can write keeps the files and the key private
+		struct stat status {};
+		if (lstat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode) || status.st_uid != geteuid() || (status.st_mode & 077))
+			return {};
+		return directory + "/";
+#endif // _WIN32
+	}
+
+	/**
+	 * @brief Reads the MAC key of the user, generating it on first use.
+	 */
+	static bool ReadKey(const std::string& directory, std::uint8_t (&key)[cipher::aes::KeySize]) {
+		std::string path = directory + "key";
+#ifdef _WIN32
+		HANDLE file = ShadowCall<HANDLE>("CreateFileA", path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OPEN_REPARSE_POINT, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			cipher::SystemEntropy(key, sizeof(key));
+			return CreateNew(path, std::vector<std::uint8_t>(key, key + sizeof(key)));
+		}
+
+		DWORD read = 0;
+		BOOL success = ShadowCall<BOOL>("ReadFile", file, key, DWORD(sizeof(key)), &read, nullptr);
+		ShadowCall<BOOL>("CloseHandle", file);
+		return success && read == sizeof(key);
+#else
+		int file = open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+		if (file < 0 && errno == ENOENT) {
+			cipher::SystemEntropy(key, sizeof(key));
+			return CreateNew(path, std::vector<std::uint8_t>(key, key + sizeof(key)));
+		}
+		if (file < 0)
+			return false;
+
+		struct stat status {};
+		bool valid = fstat(file, &status) == 0 && S_ISREG(status.st_mode) && status.st_uid == geteuid() && !(status.st_mode & 077)
+			&& read(file, key, sizeof(key)) == static_cast<ssize_t>(sizeof(key));
+		close(file);
+		return valid;
+#endif // _WIN32
+	}
+
+	/**
+	 * @brief Creates the file, failing if anything exists under its path, and writes the contents to disk.
+	 */
+	static bool CreateNew(const std::string& path, const std::vector<std::uint8_t>& contents) {
+#ifdef _WIN32
+		HANDLE file = ShadowCall<HANDLE>("CreateFileA", path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		DWORD written = 0;
+		bool success = ShadowCall<BOOL>("WriteFile", file, contents.data(), static_cast<DWORD>(contents.size()), &written, nullptr)
+			&& written == contents.size() && ShadowCall<BOOL>("FlushFileBuffers", file);
+		ShadowCall<BOOL>("CloseHandle", file);
+		if (!success)
+			ShadowCall<BOOL>("DeleteFileA", path.c_str());
+		return success;
+#else
+		int file = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0600);
+		if (file < 0)
+			return false;
+
+		bool success = true;
+		for (std::size_t offset = 0; success && offset < contents.size();) {
+			ssize_t count = write(file, contents.data() + offset, contents.size() - offset);
+			success = count > 0;
+			offset += success ? static_cast<std::size_t>(count) : 0;
+		}
+		success = success && fsync(file) == 0;
+		close(file);
+		if (!success)
+			unlink(path.c_str());
+		return success;
+#endif // _WIN32
+	}
+
+	static std::uint64_t Fnv(const void* data, std::size_t size) {
+		std::uint64_t hash = 0xCBF29CE484222325;
+		for (std::size_t i = 0; i < size; ++i)
+			hash = (hash ^ static_cast<const std::uint8_t*>(data)[i]) * 0x100000001B3;
+		return hash;
+	}
+
+	// CBC-MAC over the fields before the MAC, always the same length
+	std::uint64_t HeaderMac(const Header& header) const {
+		constexpr std::size_t length = offsetof(Header, mac);
+		std::uint8_t data[(length + cipher::aes::BlockSize - 1) / cipher::aes::BlockSize * cipher::aes::BlockSize] = {};
+		std::memcpy(data, &header, length);
+
+		std::uint8_t state[cipher::aes::BlockSize] = {};
+		for (std::size_t offset = 0; offset < sizeof(data); offset += cipher::aes::BlockSize) {
+			for (std::size_t i = 0; i < cipher::aes::BlockSize; ++i)
+				state[i] ^= data[offset + i];
+			cipher::aes::portable::EncryptBlock(roundKeys_, state);
+		}
+
+		std::uint64_t mac;
+		std::memcpy(&mac, state, sizeof(mac));
+		return mac;
+	}
+
+	// One block keyed with the header MAC, so entries can't be moved between files
+	std::uint64_t Check(std::uint64_t headerMac, std::uint32_t rva, std::uint32_t size) const {
+		std::uint8_t state[cipher::aes::BlockSize];
+		std::memcpy(state, &headerMac, sizeof(headerMac));
+		std::memcpy(state + 8, &rva, sizeof(rva));
+		std::memcpy(state + 12, &size, sizeof(size));
+		cipher::aes::portable::EncryptBlock(roundKeys_, state);
+
+		std::uint64_t check;
+		std::memcpy(&check, state, sizeof(check));
+		return check;
+	}
+
+	static std::string Hex(std::uint64_t value) {
+		char text[17];
+		std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(value));
+		return text;
+	}
+
+	std::uintptr_t base_;
+	std::uint8_t identity_[IdentitySize] = {};
+	std::string path_;
+	MappedFile mapping_;
+	std::span<const Entry> entries_;
+	std::uint64_t mac_ = 0;
+	std::uint8_t roundKeys_[(cipher::aes::Rounds + 1) * cipher::aes::BlockSize] = {};
+	std::unordered_map<std::uint32_t, std::uint32_t> pending_;
+	bool dirty_ = false;
+	std::mutex mutex_;
+};
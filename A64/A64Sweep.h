@@ -0,0 +1,288 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <tlhelp32.h>
+#include <A64LazyImporter.h>
+#else
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+#include <dirent.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/syscall.h>
+#endif // _WIN32
+
+/*
+	Safe points of the epoch sweeper.
+	A function can only be re-encrypted once no thread runs it: no thread may have its instruction pointer,
+	or a return address on its stack, inside the body. The sweeper first puts the breakpoint back on the
+	entries of the functions it expires, so calls made from then on trap and wait. Every other thread is then
+	examined once. Its registers and the words of its stack, from the stack pointer to the end of the stack,
+	are compared with the bodies. The scan is conservative: any word pointing into a body keeps the function
+	plaintext until the next sweep. A thread examined after the breakpoints were planted can't enter the
+	functions again, so the threads never have to be stopped together.
+	Windows suspends the threads one at a time. Linux can't suspend a thread, so each thread scans its own
+	stack in a signal handler and reports back. A thread interrupted on its alternate signal stack is running
+	a handler, and the frames it interrupted are on its regular stack, whose stack pointer was saved where the
+	scan can't find it. Such a thread keeps every function plaintext, as a thread that doesn't answer does.
+*/
+
+namespace sweep {
+	constexpr auto AckTimeout = std::chrono::milliseconds(100); ///< Threads that haven't scanned their stack by then keep every function plaintext
+
+	struct Range {
+		std::uintptr_t begin, end; ///< Body of a function past its entry, [begin, end)
+	};
+
+	class Scan {
+	public:
+		/**
+		 * @brief Prepares the scan of the bodies, sorted by address and disjoint.
+		 */
+		explicit Scan(std::vector<Range> bodies) : bodies(std::move(bodies)), busy(new std::atomic<bool>[this->bodies.size()]) {
+			for (std::size_t index = 0; index < this->bodies.size(); ++index)
+				busy[index].store(false, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Returns true if a thread may still be running the body.
+		 */
+		bool Busy(std::size_t index) const {
+			return busy[index].load(std::memory_order_acquire);
+		}
+
+#ifdef _WIN32
+		/**
+		 * @brief Examines every other thread of the process, suspending one at a time.
+		 */
+		void Examine() {
+			// ShadowCall locks and may allocate, the calls made while a thread is suspended are resolved beforehand
+			using GetThreadContextFunc = BOOL(WINAPI*)(HANDLE, LPCONTEXT);
+			using VirtualQueryFunc = SIZE_T(WINAPI*)(LPCVOID, PMEMORY_BASIC_INFORMATION, SIZE_T);
+			using ResumeThreadFunc = DWORD(WINAPI*)(HANDLE);
+			using CloseHandleFunc = BOOL(WINAPI*)(HANDLE);
+			HMODULE kernel32 = ShadowCall<HMODULE>("LoadLibraryA", "kernel32.dll");
+			GetThreadContextFunc getThreadContext = reinterpret_cast<GetThreadContextFunc>(ShadowCall<FARPROC>("GetProcAddress", kernel32, "GetThreadContext"));
+			VirtualQueryFunc virtualQuery = reinterpret_cast<VirtualQueryFunc>(ShadowCall<FARPROC>("GetProcAddress", kernel32, "VirtualQuery"));
+			ResumeThreadFunc resumeThread = reinterpret_cast<ResumeThreadFunc>(ShadowCall<FARPROC>("GetProcAddress", kernel32, "ResumeThread"));
+			CloseHandleFunc closeHandle = reinterpret_cast<CloseHandleFunc>(ShadowCall<FARPROC>("GetProcAddress", kernel32, "CloseHandle"));
+			if (!getThreadContext || !virtualQuery || !resumeThread || !closeHandle) {
+				markAll();
+				return;
+			}
+
+			HANDLE snapshot = ShadowCall<HANDLE>("CreateToolhelp32Snapshot", TH32CS_SNAPTHREAD, 0);
+			if (snapshot == INVALID_HANDLE_VALUE) {
+				markAll();
+				return;
+			}
+
+			DWORD process = ShadowCall<DWORD>("GetCurrentProcessId");
+			DWORD self = ShadowCall<DWORD>("GetCurrentThreadId");
+
+			THREADENTRY32 entry = {};
+			entry.dwSize = sizeof(entry);
+			for (BOOL more = ShadowCall<BOOL>("Thread32First", snapshot, &entry); more; more = ShadowCall<BOOL>("Thread32Next", snapshot, &entry)) {
+				if (entry.th32OwnerProcessID != process || entry.th32ThreadID == self)
+					continue;
+
+				// Threads that exited meanwhile can't be opened
+				HANDLE thread = ShadowCall<HANDLE>("OpenThread", THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE, entry.th32ThreadID);
+				if (!thread)
+					continue;
+
+				// Nothing is allocated or locked while the thread is suspended, it may hold the heap lock
+				if (ShadowCall<DWORD>("SuspendThread", thread) != DWORD(-1)) {
+					CONTEXT context = {};
+					context.ContextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER;
+
+					MEMORY_BASIC_INFORMATION stack = {};
+					if (getThreadContext(thread, &context) && virtualQuery(reinterpret_cast<LPCVOID>(context.Rsp), &stack, sizeof(stack))) {
+						const DWORD64 registers[] = { context.Rax, context.Rcx, context.Rdx, context.Rbx, context.Rsp, context.Rbp, context.Rsi, context.Rdi,
+							context.R8, context.R9, context.R10, context.R11, context.R12, context.R13, context.R14, context.R15, context.Rip };
+						for (DWORD64 value : registers)
+							mark(static_cast<std::uintptr_t>(value));
+
+						// The committed stack runs from the stack pointer up to its base in one region
+						markStack(static_cast<std::uintptr_t>(context.Rsp), reinterpret_cast<std::uintptr_t>(stack.BaseAddress) + stack.RegionSize);
+					}
+					else
+						markAll();
+
+					resumeThread(thread);
+				}
+				closeHandle(thread);
+			}
+			closeHandle(snapshot);
+		}
+#else
+		/**
+		 * @brief Examines every other thread of the process, each one scans its own stack when it receives the signal.
+		 *
+		 * @param signal Signal whose handler calls OnSignal.
+		 */
+		void Examine(int signal) {
+			readStacks();
+			listThreads();
+
+			current.store(this, std::memory_order_seq_cst);
+
+			pid_t process = getpid();
+			for (Thread& thread : threads)
+				if (syscall(SYS_tgkill, process, thread.tid, signal) != 0)
+					thread.done.store(true, std::memory_order_relaxed); // Exited meanwhile
+
+			// Threads blocking the signal, or stopped, never answer. They may be running a body
+			auto deadline = std::chrono::steady_clock::now() + AckTimeout;
+			for (Thread& thread : threads) {
+				while (!thread.done.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline)
+					std::this_thread::yield();
+
+				if (!thread.done.load(std::memory_order_acquire) && threadExists(thread.tid))
+					markAll();
+			}
+
+			// Handlers still reading the scan finish before it goes away
+			current.store(nullptr, std::memory_order_seq_cst);
+			while (readers.load(std::memory_order_seq_cst))
+				std::this_thread::yield();
+		}
+
+		/**
+		 * @brief Scans the stack of the calling thread for the running scan, from its signal handler. Async-signal-safe.
+		 *
+		 * @param context The ucontext_t of the interrupted thread.
+		 * @return false If no scan is running, the signal wasn't sent by the sweeper or arrived once the scan ended.
+		 */
+		static bool OnSignal(void* context) {
+			readers.fetch_add(1, std::memory_order_seq_cst);
+			Scan* scan = current.load(std::memory_order_seq_cst);
+			if (scan)
+				scan->scanSelf(static_cast<ucontext_t*>(context)->uc_mcontext.gregs);
+			readers.fetch_sub(1, std::memory_order_seq_cst);
+			return scan != nullptr;
+		}
+#endif // _WIN32
+
+	private:
+		void mark(std::uintptr_t word) {
+			auto next = std::upper_bound(bodies.begin(), bodies.end(), word, [](std::uintptr_t value, const Range& body) { return value < body.begin; });
+			if (next != bodies.begin() && word < (next - 1)->end)
+				busy[next - 1 - bodies.begin()].store(true, std::memory_order_relaxed);
+		}
+
+		void markAll() {
+			for (std::size_t index = 0; index < bodies.size(); ++index)
+				busy[index].store(true, std::memory_order_relaxed);
+		}
+
+		void markStack(std::uintptr_t begin, std::uintptr_t end) {
+			for (const std::uintptr_t* word = reinterpret_cast<const std::uintptr_t*>((begin + sizeof(std::uintptr_t) - 1) & ~(sizeof(std::uintptr_t) - 1));
+				word < reinterpret_cast<const std::uintptr_t*>(end); ++word)
+				mark(*word);
+		}
+
+#ifndef _WIN32
+		struct Thread {
+			pid_t tid;
+			std::atomic<bool> done{ false }; ///< The thread scanned its stack, or exited.
+		};
+
+		// Mappings of the process, the stack of a thread ends with the mapping holding its stack pointer
+		void readStacks() {
+			FILE* maps = std::fopen("/proc/self/maps", "r");
+			if (!maps)
+				return;
+
+			// Lines longer than the buffer are read in pieces, only the first one holds the range
+			char line[512];
+			for (bool lineStart = true; std::fgets(line, sizeof(line), maps); lineStart = std::strchr(line, '\n') != nullptr) {
+				if (!lineStart)
+					continue;
+
+				char* cursor = line;
+				std::uintptr_t begin = std::strtoull(cursor, &cursor, 16);
+				std::uintptr_t end = std::strtoull(cursor + 1, nullptr, 16);
+				mappings.push_back({ begin, end });
+			}
+			std::fclose(maps);
+		}
+
+		void listThreads() {
+			DIR* tasks = opendir("/proc/self/task");
+			if (!tasks)
+				return;
+
+			pid_t self = static_cast<pid_t>(syscall(SYS_gettid));
+			std::vector<pid_t> tids;
+			while (dirent* task = readdir(tasks)) {
+				pid_t tid = static_cast<pid_t>(std::atoi(task->d_name));
+				if (tid > 0 && tid != self)
+					tids.push_back(tid);
+			}
+			closedir(tasks);
+
+			threads = std::vector<Thread>(tids.size());
+			for (std::size_t index = 0; index < tids.size(); ++index)
+				threads[index].tid = tids[index];
+		}
+
+		static bool threadExists(pid_t tid) {
+			char path[64];
+			std::snprintf(path, sizeof(path), "/proc/self/task/%d", static_cast<int>(tid));
+			return access(path, F_OK) == 0;
+		}
+
+		// The frames below a handler running on the alternate stack are on the regular stack, which isn't known here
+		static bool onAlternateStack(std::uintptr_t stackPointer) {
+			stack_t alternate;
+			return sigaltstack(nullptr, &alternate) == 0 && !(alternate.ss_flags & SS_DISABLE)
+				&& stackPointer - reinterpret_cast<std::uintptr_t>(alternate.ss_sp) < alternate.ss_size;
+		}
+
+		void scanSelf(const greg_t* registers) {
+			pid_t self = static_cast<pid_t>(syscall(SYS_gettid));
+			Thread* thread = nullptr;
+			for (Thread& candidate : threads)
+				if (candidate.tid == self)
+					thread = &candidate;
+
+			// Threads started after the list was taken started after the breakpoints were planted
+			if (!thread || thread->done.load(std::memory_order_relaxed))
+				return;
+
+			for (int index = REG_R8; index <= REG_RIP; ++index)
+				mark(static_cast<std::uintptr_t>(registers[index]));
+
+			std::uintptr_t stackPointer = static_cast<std::uintptr_t>(registers[REG_RSP]);
+			auto mapping = std::upper_bound(mappings.begin(), mappings.end(), stackPointer, [](std::uintptr_t value, const Range& range) { return value < range.begin; });
+			if (!onAlternateStack(stackPointer) && mapping != mappings.begin() && stackPointer < (mapping - 1)->end)
+				markStack(stackPointer, (mapping - 1)->end);
+			else
+				markAll();
+
+			thread->done.store(true, std::memory_order_release);
+		}
+
+		std::vector<Range> mappings;  ///< Mappings of the process in address order, read before the threads are signaled.
+		std::vector<Thread> threads;  ///< Threads signaled, the sweeping thread excluded.
+
+		static inline std::atomic<Scan*> current{ nullptr }; ///< Scan the signal handlers report to.
+		static inline std::atomic<int> readers{ 0 };         ///< Signal handlers reading the current scan.
+#endif // !_WIN32
+
+		std::vector<Range> bodies;
+		std::unique_ptr<std::atomic<bool>[]> busy;
+	};
+}
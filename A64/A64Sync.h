@@ -0,0 +1,225 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <thread>
+
+#include <A64Cpu.h>
+
+/*
+	Synchronization of protected calls without a lock shared by every function.
+	Each function keeps its call state in one atomic word: the phase of the function (encrypted,
+	decrypting, plaintext, encrypting) and the number of calls running it. Calls entering or leaving
+	a plaintext function only update the word. The call that finds the function encrypted, or
+	leaves it last, owns the transition and the other calls wait for it, spinning briefly then parked
+	on the word. Work on a single code page, such as decrypting it, is serialized through a set of
+	striped locks.
+*/
+
+namespace concurrency
+{
+	constexpr int SpinCount = 128;             ///< Pauses before a waiting call is parked
+	constexpr std::uintptr_t PageSize = 0x1000; ///< Granularity of page protection changes
+
+	inline void Pause() {
+#if defined(AA_CPU_X64)
+		_mm_pause();
+#elif defined(AA_CPU_ARM64) && defined(_MSC_VER)
+		__yield();
+#elif defined(AA_CPU_ARM64)
+		__asm__ __volatile__("yield");
+#else
+		std::this_thread::yield();
+#endif // AA_CPU_X64
+	}
+
+	/**
+	 * @brief Waits until word no longer holds value, spinning for a short transition then parking the thread.
+	 */
+	inline void WaitWhile(const std::atomic<std::uint32_t>& word, std::uint32_t value) {
+		for (int spin = 0; spin < SpinCount; ++spin) {
+			if (word.load(std::memory_order_acquire) != value)
+				return;
+			Pause();
+		}
+		word.wait(value, std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Phase and running calls of a protected function in one atomic word.
+	 *
+	 * Enter and Leave tell the call whether it owns a transition, the owner does the work and ends it with
+	 * EndDecryption or EndEncryption. Calls arriving meanwhile wait for it.
+	 */
+	class CallState {
+	public:
+		enum Phase : std::uint32_t {
+			Encrypted,
+			Decrypting,
+			Plaintext,
+			Encrypting,
+		};
+
+		static constexpr std::uint32_t PhaseMask = 3;
+		static constexpr std::uint32_t Released = 4;   ///< Decrypted for good, calls are still counted but never encrypt again
+		static constexpr std::uint32_t CallUnit = 8;   ///< Calls are counted above the flags
+
+		/**
+		 * @brief Counts a call.
+		 *
+		 * @return true If the function is encrypted, the call must decrypt it then call EndDecryption.
+		 */
+		bool Enter() {
+			std::uint32_t state = word.load(std::memory_order_acquire);
+			for (;;) {
+				Phase phase = static_cast<Phase>(state & PhaseMask);
+				if (phase == Decrypting || phase == Encrypting) {
+					WaitWhile(word, state);
+					state = word.load(std::memory_order_acquire);
+					continue;
+				}
+
+				bool first = phase == Encrypted;
+				std::uint32_t next = first ? (Decrypting | CallUnit) : state + CallUnit;
+				if (word.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_acquire))
+					return first;
+			}
+		}
+
+		/**
+		 * @brief Ends a call.
+		 *
+		 * @return true If it was the last call of a protected function, the call must encrypt it then call EndEncryption.
+		 */
+		bool Leave() {
+			std::uint32_t state = word.load(std::memory_order_acquire);
+			for (;;) {
+				bool last = state / CallUnit == 1 && !(state & Released);
+				std::uint32_t next = last ? Encrypting : state - CallUnit;
+				if (word.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_acquire))
+					return last;
+			}
+		}
+
+		/**
+		 * @brief Ends the decryption, calls waiting for it enter the body.
+		 */
+		void EndDecryption() {
+			word.fetch_add(Plaintext - Decrypting, std::memory_order_release);
+			word.notify_all();
+		}
+
+		/**
+		 * @brief Ends the encryption, the next call decrypts again.
+		 */
+		void EndEncryption() {
+			word.store(Encrypted, std::memory_order_release);
+			word.notify_all();
+		}
+
+		/**
+		 * @brief Starts the encryption of a plaintext function whatever its count, for functions whose calls never leave (AA_MODE_EPOCH).
+		 *
+		 * @return true If the function was plaintext, the caller must encrypt it then call EndEncryption, or call CancelEncryption.
+		 */
+		bool Expire() {
+			std::uint32_t state = word.load(std::memory_order_acquire);
+			for (;;) {
+				if ((state & Released) || static_cast<Phase>(state & PhaseMask) != Plaintext)
+					return false;
+				if (word.compare_exchange_weak(state, Encrypting, std::memory_order_acq_rel, std::memory_order_acquire))
+					return true;
+			}
+		}
+
+		/**
+		 * @brief Gives up an encryption started by Expire, calls waiting for it enter the plaintext function.
+		 */
+		void CancelEncryption() {
+			word.fetch_sub(Encrypting - Plaintext, std::memory_order_release);
+			word.notify_all();
+		}
+
+		/**
+		 * @brief Leaves the function plaintext for good once no transition is running.
+		 *
+		 * @param decrypt Receives whether the function is encrypted, the caller must decrypt it then call EndDecryption.
+		 * @return false If the function was already released.
+		 */
+		bool Release(bool& decrypt) {
+			std::uint32_t state = word.load(std::memory_order_acquire);
+			for (;;) {
+				if (state & Released)
+					return false;
+
+				Phase phase = static_cast<Phase>(state & PhaseMask);
+				if (phase == Decrypting || phase == Encrypting) {
+					WaitWhile(word, state);
+					state = word.load(std::memory_order_acquire);
+					continue;
+				}
+
+				decrypt = phase == Encrypted;
+				std::uint32_t next = (decrypt ? (state & ~PhaseMask) | Decrypting : state) | Released;
+				if (word.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_acquire))
+					return true;
+			}
+		}
+
+	private:
+		std::atomic<std::uint32_t> word{ Encrypted };
+	};
+
+	/**
+	 * @brief Striped locks serializing the work on code pages.
+	 *
+	 * Threads reaching the same encrypted page decrypt it once, the others wait for it. Unrelated pages take
+	 * different stripes and are worked on in parallel.
+	 */
+	class PageLocks {
+	public:
+		static constexpr std::size_t Stripes = 64; ///< One bit of a 64 bit mask per stripe
+
+		static PageLocks& Global() {
+			static PageLocks locks;
+			return locks;
+		}
+
+		/**
+		 * @brief Holds the stripes of every page of a range, taken in ascending order so ranges can't deadlock.
+		 */
+		class Guard {
+		public:
+			Guard(PageLocks& locks, const void* address, std::size_t size) : locks(locks) {
+				std::uintptr_t first = reinterpret_cast<std::uintptr_t>(address) / PageSize;
+				std::uintptr_t last = (reinterpret_cast<std::uintptr_t>(address) + (size ? size : 1) - 1) / PageSize;
+				for (std::uintptr_t page = first; page <= last && ~held; ++page)
+					held |= 1ull << (page % Stripes);
+
+				for (std::uint64_t pending = held; pending; pending &= pending - 1)
+					locks.stripes[std::countr_zero(pending)].mutex.lock();
+			}
+
+			~Guard() {
+				for (std::uint64_t pending = held; pending; pending &= pending - 1)
+					locks.stripes[std::countr_zero(pending)].mutex.unlock();
+			}
+
+			Guard(const Guard&) = delete;
+			Guard& operator=(const Guard&) = delete;
+
+		private:
+			PageLocks& locks;
+			std::uint64_t held = 0;
+		};
+
+	private:
+		struct alignas(64) Stripe {
+			std::mutex mutex;
+		};
+
+		Stripe stripes[Stripes];
+	};
+}
@@ -0,0 +1,292 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <A64LazyImporter.h>
+#else
+#include <sys/mman.h>
+#endif // _WIN32
+
+#include <A64Length.h>
+#include <A64PageProtection.h>
+
+/*
+	Entry thunks for functions protected without an entry trap (x86-64).
+	The entry of the function is overwritten with a jmp rel32 to a stub of its own, which loads
+	a context pointer in r11 and jumps to a shared dispatcher. The instructions the jmp displaced
+	are relocated behind the stub and followed by a jmp back into the body, so the dispatcher
+	enters the body while the jmp stays in place and every call goes through it.
+	Stubs live in blocks allocated within rel32 range of the functions they serve.
+*/
+
+namespace thunk
+{
+	constexpr std::size_t JumpLength = 5;          ///< jmp rel32 written over the entry
+	constexpr std::size_t AbsoluteJumpLength = 14; ///< jmp [rip+0] followed by the target
+	constexpr std::size_t StubLength = 24;         ///< mov r11, imm64 then an absolute jmp to the dispatcher
+	constexpr std::size_t SlotSize = 64;           ///< Stub, relocated entry and the jmp back
+	constexpr std::size_t BlockSize = 0x10000;     ///< Stub memory is allocated at the Windows allocation granularity
+	constexpr std::int64_t Reach = 0x7FF00000;     ///< Distance a block may be from a function, a bit under 2 GB
+
+	inline bool FitsRel32(std::int64_t distance) {
+		return distance >= INT32_MIN && distance <= INT32_MAX;
+	}
+
+	/**
+	 * @brief Writes jmp rel32 to target at the passed address.
+	 *
+	 * @param view Where the bytes of at are written, at itself unless its pages are written through an alias.
+	 */
+	inline void WriteJump(const std::uint8_t* at, const void* target, std::uint8_t* view) {
+		std::int32_t distance = static_cast<std::int32_t>(reinterpret_cast<std::intptr_t>(target) - reinterpret_cast<std::intptr_t>(at + JumpLength));
+		view[0] = 0xE9;
+		std::memcpy(view + 1, &distance, sizeof(distance));
+	}
+
+	/**
+	 * @brief Checks that the bytes at the passed address are already the jmp rel32 to target.
+	 */
+	inline bool IsJump(const std::uint8_t* at, const void* target) {
+		std::int32_t distance;
+		std::memcpy(&distance, at + 1, sizeof(distance));
+		return at[0] == 0xE9 && reinterpret_cast<std::intptr_t>(at + JumpLength) + distance == reinterpret_cast<std::intptr_t>(target);
+	}
+
+	/**
+	 * @brief Writes jmp [rip+0] followed by target at the passed address, reaches anywhere.
+	 */
+	inline void WriteAbsoluteJump(std::uint8_t* at, const void* target) {
+		const std::uint8_t jump[6] = { 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00 };
+		std::memcpy(at, jump, sizeof(jump));
+		std::memcpy(at + sizeof(jump), &target, sizeof(target));
+	}
+
+	/**
+	 * @brief Checks that no relative branch of the function lands inside its first length bytes.
+	 *
+	 * Those bytes are replaced by a jmp or a breakpoint that counts a call, a branch into them would execute
+	 * half an instruction and a jump back to the entry would be taken for a new call. Calls to the entry
+	 * (recursion) are fine. Bytes that can't be decoded fail the check.
+	 */
+	inline bool EntryIsUnreferenced(const std::uint8_t* function, std::size_t functionSize, std::size_t length) {
+		OpInstruction instruction;
+		for (std::size_t offset = 0; offset < functionSize; offset += instruction.size) {
+			if (!OpDecode(function + offset, instruction))
+				return false;
+
+			if (instruction.relative) {
+				std::int64_t target = static_cast<std::int64_t>(offset + instruction.size) + instruction.imm;
+				bool call = instruction.map == 0 && instruction.opcode == 0xE8;
+				if (target >= (call ? 1 : 0) && target < static_cast<std::int64_t>(length))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Copies the instructions covering the first minimum bytes at code to destination.
+	 *
+	 * RIP relative operands and rel32 branches are adjusted to the new address, rel8 jmp and jcc are widened
+	 * to rel32. Other short branches (loop, jrcxz) can't be relocated.
+	 *
+	 * @param available Number of bytes that belong to the code, instructions may not cross it.
+	 * @param view Where the bytes of destination are written, destination itself unless written through an alias.
+	 * @param copied Receives the number of bytes of code that were relocated.
+	 * @return Number of bytes written to destination, at most capacity, 0 if the code can't be relocated.
+	 */
+	inline std::size_t RelocateInstructions(const std::uint8_t* code, std::size_t available, std::size_t minimum, const std::uint8_t* destination, std::uint8_t* view, std::size_t capacity, std::size_t& copied) {
+		std::size_t written = 0;
+		for (copied = 0; copied < minimum;) {
+			OpInstruction instruction;
+			if (!OpDecode(code + copied, instruction) || copied + instruction.size > available)
+				return 0;
+
+			std::int64_t target = static_cast<std::int64_t>(instruction.address + instruction.size) + instruction.imm;
+			const std::uint8_t* at = destination + written;
+			std::uint8_t* out = view + written;
+			std::size_t length = instruction.size;
+
+			if (instruction.relative && instruction.immSize == sizeof(std::int8_t)) {
+				// jmp rel8 becomes E9 rel32, jcc rel8 becomes 0F 8x rel32
+				bool jump = instruction.opcode == 0xEB;
+				if ((!jump && (instruction.opcode & 0xF0) != 0x70) || instruction.size != 2)
+					return 0;
+
+				length = jump ? 5 : 6;
+				if (written + length > capacity)
+					return 0;
+				if (jump)
+					out[0] = 0xE9;
+				else
+					out[0] = 0x0F, out[1] = static_cast<std::uint8_t>(0x80 | (instruction.opcode & 0x0F));
+
+				std::int64_t distance = target - reinterpret_cast<std::intptr_t>(at + length);
+				if (!FitsRel32(distance))
+					return 0;
+				std::int32_t relocated = static_cast<std::int32_t>(distance);
+				std::memcpy(out + length - sizeof(relocated), &relocated, sizeof(relocated));
+			}
+			else {
+				if (written + length > capacity)
+					return 0;
+				std::memcpy(out, code + copied, length);
+
+				// rel32 branches and RIP relative operands keep their target
+				std::int64_t field = 0;
+				std::uint8_t fieldOffset = 0;
+				if (instruction.relative) {
+					if (instruction.immSize != sizeof(std::int32_t))
+						return 0;
+					fieldOffset = instruction.immOffset, field = instruction.imm;
+				}
+				else if (instruction.ripRelative)
+					fieldOffset = instruction.dispOffset, field = instruction.disp;
+
+				if (fieldOffset) {
+					std::int64_t relocated = field + (reinterpret_cast<std::intptr_t>(code + copied) - reinterpret_cast<std::intptr_t>(at));
+					if (!FitsRel32(relocated))
+						return 0;
+					std::int32_t displacement = static_cast<std::int32_t>(relocated);
+					std::memcpy(out + fieldOffset, &displacement, sizeof(displacement));
+				}
+			}
+
+			copied += instruction.size;
+			written += length;
+		}
+
+		return written;
+	}
+
+	/**
+	 * @brief Fills a slot with the instructions covering the first minimum bytes at code, followed by a jmp back to the next one.
+	 *
+	 * Running the slot is equivalent to running those instructions in place, so the bytes at code can be replaced.
+	 *
+	 * @param view Where the slot is written, the slot itself unless its pages are written through an alias. Must be writable.
+	 * @return Number of bytes of code the slot replaces, 0 if the instructions can't be relocated.
+	 */
+	inline std::size_t BuildResume(const std::uint8_t* slot, std::uint8_t* view, std::size_t capacity, const void* code, std::size_t available, std::size_t minimum) {
+		const std::uint8_t* instructions = static_cast<const std::uint8_t*>(code);
+
+		std::size_t copied;
+		std::size_t written = RelocateInstructions(instructions, available, minimum, slot, view, capacity - AbsoluteJumpLength, copied);
+		if (!written)
+			return 0;
+
+		WriteAbsoluteJump(view + written, instructions + copied);
+		return copied;
+	}
+
+	/**
+	 * @brief Fills a slot with the stub of a function and its relocated entry.
+	 *
+	 * The stub sets r11 to context and jumps to dispatcher, the relocated entry starts at slot + StubLength.
+	 *
+	 * @param view Where the slot is written, as for BuildResume.
+	 * @return false If the entry can't be relocated, the function must keep its entry.
+	 */
+	inline bool BuildSlot(const std::uint8_t* slot, std::uint8_t* view, const void* function, std::size_t functionSize, const void* context, const void* dispatcher) {
+		std::size_t copied = BuildResume(slot + StubLength, view + StubLength, SlotSize - StubLength, function, functionSize, JumpLength);
+		if (!copied || !EntryIsUnreferenced(static_cast<const std::uint8_t*>(function), functionSize, copied))
+			return false;
+
+		// mov r11, context
+		view[0] = 0x49, view[1] = 0xBB;
+		std::memcpy(view + 2, &context, sizeof(context));
+		WriteAbsoluteJump(view + 10, dispatcher);
+		return true;
+	}
+
+	/**
+	 * @brief Hands out stub slots within rel32 range of a function.
+	 *
+	 * Blocks are mapped execute-read, slots are filled through a temporary protection change, or through the alias
+	 * of the block with AA_DUAL_MAPPING, and never released since a thread may still be running through one.
+	 */
+	class SlotAllocator {
+	public:
+		static SlotAllocator& Global() {
+			static SlotAllocator allocator;
+			return allocator;
+		}
+
+		/**
+		 * @brief Returns an unused slot within reach of the function, nullptr if no memory is free near it.
+		 */
+		std::uint8_t* Allocate(const void* function) {
+			std::lock_guard<std::mutex> lock(mutex);
+
+			std::intptr_t origin = reinterpret_cast<std::intptr_t>(function);
+			for (Block& block : blocks) {
+				std::intptr_t base = reinterpret_cast<std::intptr_t>(block.base);
+				if (block.used < BlockSize && FitsRel32(base - origin) && FitsRel32(base + static_cast<std::intptr_t>(BlockSize) - origin)) {
+					std::uint8_t* slot = block.base + block.used;
+					block.used += SlotSize;
+					return slot;
+				}
+			}
+
+			std::uint8_t* base = MapNear(origin);
+			if (!base)
+				return nullptr;
+#ifdef AA_DUAL_MAPPING
+			protection::Manager::Global().Alias(base, BlockSize);
+#endif // AA_DUAL_MAPPING
+
+			blocks.push_back({ base, SlotSize });
+			return base;
+		}
+
+	private:
+		struct Block {
+			std::uint8_t* base;
+			std::size_t used;
+		};
+
+		static std::uint8_t* MapNear(std::intptr_t origin) {
+#ifdef _WIN32
+			// Walk the address space around the function for a free range
+			std::intptr_t address = ((origin > Reach ? origin - Reach : 0) + BlockSize - 1) & ~static_cast<std::intptr_t>(BlockSize - 1);
+			while (address < origin + Reach) {
+				MEMORY_BASIC_INFORMATION region;
+				if (!ShadowCall<SIZE_T>("VirtualQuery", reinterpret_cast<LPCVOID>(address), &region, sizeof(region)))
+					break;
+
+				std::intptr_t regionEnd = reinterpret_cast<std::intptr_t>(region.BaseAddress) + region.RegionSize;
+				if (region.State == MEM_FREE && regionEnd - address >= static_cast<std::intptr_t>(BlockSize)) {
+					LPVOID base = ShadowCall<LPVOID>("VirtualAlloc", reinterpret_cast<LPVOID>(address), BlockSize, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READ);
+					if (base)
+						return static_cast<std::uint8_t*>(base);
+				}
+
+				address = (regionEnd + BlockSize - 1) & ~static_cast<std::intptr_t>(BlockSize - 1);
+			}
+#else
+			// Hint addresses at growing distances below and above the function, the kernel takes a free hint as is
+			for (std::intptr_t distance = BlockSize; distance < Reach; distance *= 2) {
+				for (std::intptr_t hint : { origin - distance, origin + distance }) {
+					void* base = mmap(reinterpret_cast<void*>(hint & ~static_cast<std::intptr_t>(BlockSize - 1)), BlockSize, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+					if (base == MAP_FAILED)
+						continue;
+
+					std::intptr_t mapped = reinterpret_cast<std::intptr_t>(base);
+					if (FitsRel32(mapped - origin) && FitsRel32(mapped + static_cast<std::intptr_t>(BlockSize) - origin))
+						return static_cast<std::uint8_t*>(base);
+					munmap(base, BlockSize);
+				}
+			}
+#endif // _WIN32
+			return nullptr;
+		}
+
+		std::vector<Block> blocks;
+		std::mutex mutex;
+	};
+}
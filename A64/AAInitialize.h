@@ -3,15 +3,32 @@
 
 #include <string>
 #include <vector>
+#include <chrono>
+#ifdef _WIN32
 #include <winsock2.h>
 #include <ws2tcpip.h>
 #include <winternl.h>
+#else
+#include <cstdio>
+#include <cwchar>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <unistd.h>
+#endif // _WIN32
 
 #include <A64XorStr.h>
+#ifdef _WIN32
 #include <A64LazyImporter.h>
+#endif // _WIN32
 #include <AADecryption.h>
 
+#ifdef _WIN32
 #pragma comment(lib, "Ws2_32.lib")
+#else
+typedef int SOCKET;
+constexpr SOCKET INVALID_SOCKET = -1;
+constexpr int SOCKET_ERROR = -1;
+#endif // _WIN32
 
 class UserRequestHandler {
 public:
@@ -30,11 +47,10 @@ public:
     UserRequestHandler(std::string userEmail, std::string userToken) : serverRequest({ .email = userEmail, .token = userToken }) {};
 
     AA_STATUS_CODES sendUserRequest(const char* serverAddress, const char* port) {
-        WSADATA wsaData;
         SOCKET connectSocket = INVALID_SOCKET;
-        struct addrinfo* result = nullptr, hints = { 0 };
+        struct addrinfo* result = nullptr, hints = {};
 
-        if (ShadowCall<int>(shadow::hash_t(x_("WSAStartup")), MAKEWORD(2, 2), &wsaData) != 0) { // WSAStartup(MAKEWORD(2, 2), &wsaData)
+        if (!socketStartup()) {
             statusCode = wsastartup_failed;
             return statusCode;
         }
@@ -43,21 +59,21 @@ public:
         hints.ai_socktype = SOCK_STREAM;
         hints.ai_protocol = IPPROTO_TCP;
         if (getaddrinfo(serverAddress, port, &hints, &result) != 0) {
-            ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+            socketCleanup();
             statusCode = getaddrinfo_failed;
             return statusCode;
         }
 
         for (struct addrinfo* ptr = result; ptr != nullptr; ptr = ptr->ai_next) {
             if ((connectSocket = socket(ptr->ai_family, ptr->ai_socktype, ptr->ai_protocol)) == INVALID_SOCKET) continue;
-            if (ShadowCall<int>(shadow::hash_t(x_("connect")), connectSocket, ptr->ai_addr, (int)ptr->ai_addrlen) != SOCKET_ERROR) break;
-            ShadowCall<int>(shadow::hash_t(x_("closesocket")), connectSocket);
+            if (socketConnect(connectSocket, ptr->ai_addr, (int)ptr->ai_addrlen) != SOCKET_ERROR) break;
+            socketClose(connectSocket);
             connectSocket = INVALID_SOCKET;
         }
 
         freeaddrinfo(result);
         if (connectSocket == INVALID_SOCKET) {
-            ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+            socketCleanup();
             statusCode = failed_to_connect_to_server;
             return statusCode;
         }
@@ -84,9 +100,9 @@ public:
         headers += userClientDataHashed;
 
         // Send the request
-        if (ShadowCall<int>(shadow::hash_t(x_("send")), connectSocket, headers.data(), headers.size(), 0) == SOCKET_ERROR) {
-            ShadowCall<int>(shadow::hash_t(x_("closesocket")), connectSocket);
-            ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+        if (socketSend(connectSocket, headers.data(), (int)headers.size()) == SOCKET_ERROR) {
+            socketClose(connectSocket);
+            socketCleanup();
             statusCode = failed_to_send;
             return statusCode;
         }
@@ -95,15 +111,15 @@ public:
         int responseLength;
 
         // Read the response
-        if ((responseLength = ShadowCall<int>(shadow::hash_t(x_("recv")), connectSocket, serverResponse, sizeof(serverResponse), 0)) == SOCKET_ERROR) {
-            ShadowCall<int>(shadow::hash_t(x_("closesocket")), connectSocket);
-            ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+        if ((responseLength = socketReceive(connectSocket, serverResponse, sizeof(serverResponse))) == SOCKET_ERROR) {
+            socketClose(connectSocket);
+            socketCleanup();
             statusCode = failed_to_recv;
             return statusCode;
         }
 
-        ShadowCall<int>(shadow::hash_t(x_("closesocket")), connectSocket);
-        ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+        socketClose(connectSocket);
+        socketCleanup();
 
         // Parsing the HTTP response body
         std::string responseStr(serverResponse, responseLength);
@@ -178,6 +194,7 @@ public:
             break;
         }
 
+#ifdef _WIN32
         // Initialize UNICODE_STRING structs
         UNICODE_STRING msgBody;
         UNICODE_STRING msgCaption;
@@ -201,6 +218,10 @@ public:
         };
 
         ShadowCall<int>(shadow::hash_t(x_("ZwRaiseHardError")), 0x50000018L, 0x00000003L, 3, (PULONG_PTR)msgParams, NULL, &ErrorResponse);
+#else
+        // There is no message box to raise, report on the standard error
+        fprintf(stderr, "%ls: %ls\n", cCaption, cBody);
+#endif // _WIN32
 
         errorMessageDisplayed = true;
 
@@ -231,6 +252,54 @@ private:
         return hash;
     }
 
+    // Socket calls go through the shadow importer on Windows, POSIX sockets need no startup
+    static bool socketStartup() {
+#ifdef _WIN32
+        WSADATA wsaData;
+        return ShadowCall<int>(shadow::hash_t(x_("WSAStartup")), MAKEWORD(2, 2), &wsaData) == 0; // WSAStartup(MAKEWORD(2, 2), &wsaData)
+#else
+        return true;
+#endif // _WIN32
+    }
+
+    static void socketCleanup() {
+#ifdef _WIN32
+        ShadowCall<int>(shadow::hash_t(x_("WSACleanup")));
+#endif // _WIN32
+    }
+
+    static int socketConnect(SOCKET socket, const sockaddr* address, int addressLength) {
+#ifdef _WIN32
+        return ShadowCall<int>(shadow::hash_t(x_("connect")), socket, address, addressLength);
+#else
+        return connect(socket, address, static_cast<socklen_t>(addressLength));
+#endif // _WIN32
+    }
+
+    static int socketSend(SOCKET socket, const char* data, int length) {
+#ifdef _WIN32
+        return ShadowCall<int>(shadow::hash_t(x_("send")), socket, data, length, 0);
+#else
+        return static_cast<int>(send(socket, data, static_cast<size_t>(length), 0));
+#endif // _WIN32
+    }
+
+    static int socketReceive(SOCKET socket, char* buffer, int length) {
+#ifdef _WIN32
+        return ShadowCall<int>(shadow::hash_t(x_("recv")), socket, buffer, length, 0);
+#else
+        return static_cast<int>(recv(socket, buffer, static_cast<size_t>(length), 0));
+#endif // _WIN32
+    }
+
+    static void socketClose(SOCKET socket) {
+#ifdef _WIN32
+        ShadowCall<int>(shadow::hash_t(x_("closesocket")), socket);
+#else
+        close(socket);
+#endif // _WIN32
+    }
+
     UserRequest serverRequest;
 };
 #endif // AA_INIT_A
\ No newline at end of file
@@ -5,6 +5,8 @@ thread_local Scudo* Scudo::currentEncryptedFunction; // A pointer to the current
 
 typename Scudo::EncryptedFunctionMap Scudo::encryptedFunctions; // A map of all our encrypted functions
 
+registry::AddressIndex<Scudo> Scudo::functionIndex; // Snapshot of the map the handler reads without locking
+
 std::atomic<bool> Scudo::isExceptionHandlingInitialized(false); // An atomic bool to determine if the exception handler is already initialized
 
 std::mutex Scudo::encryptedFunctionsMutex; // A mutex to ensure thread safety
@@ -13,8 +15,154 @@ std::vector<std::unique_ptr<Scudo>> Scudo::protectedFunctions{};
 
 std::unique_ptr<UserRequestHandler> Scudo::userRequestHandler = nullptr;
 
+SIZE_T Scudo::pagedMinPages = AA_PAGED_MIN_PAGES;
+
 PVOID Scudo::exceptionHandler = NULL;
 
+std::jthread Scudo::keyRotationThread;
+
+std::jthread Scudo::sweeperThread;
+
+thread_local std::vector<Scudo::ReturnFrame> Scudo::returnFrames;
+
+registry::HashIndex<Scudo::PatchedReturn> Scudo::patchedReturns;
+
+// Filled in the image file by scudo-pack, empty otherwise
+AA_PACKED_SECTION packed::Table<AA_PACKED_CAPACITY> scudoPackedTable = { { packed::Magic, packed::Version, sizeof(packed::Entry), AA_PACKED_CAPACITY, 0 }, {} };
+
+namespace {
+    // Reads the table through an opaque pointer, its contents are written after compilation
+    const packed::Table<AA_PACKED_CAPACITY>* packedTable() {
+        const packed::Table<AA_PACKED_CAPACITY>* volatile tableAddress = &scudoPackedTable;
+        return tableAddress;
+    }
+
+    /*
+        Threads parallelFor spreads its indices over, started as batches first need them and parked between batches.
+        Never destroyed, workers may still be parked when static destructors run. A forked child has none of its
+        parent's workers, and a batch started while another one runs on the pool, from another thread or from a body,
+        runs on its calling thread alone.
+    */
+    class WorkerPool {
+    public:
+        static WorkerPool& Global() {
+            static WorkerPool* pool = new WorkerPool();
+            return *pool;
+        }
+
+        /**
+         * @brief Runs work(context) on the calling thread and up to helpers workers, returns once every one of them left it.
+         */
+        void Run(size_t helpers, void (*work)(void*), void* context) {
+            std::unique_lock<std::mutex> running(runMutex, std::try_to_lock);
+#ifndef _WIN32
+            if (running.owns_lock() && owner != getpid())
+                running.unlock();
+#endif // !_WIN32
+            if (!running.owns_lock()) {
+                work(context);
+                return;
+            }
+
+            helpers = (std::min)(helpers, size_t((std::max)(1u, std::thread::hardware_concurrency()) - 1));
+            while (workers.size() < helpers)
+                workers.emplace_back([this]() { workerLoop(); });
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = work, jobContext = context, wanted = helpers;
+            }
+            wake.notify_all();
+            work(context);
+
+            // Workers that didn't pick the job up by now have nothing left to do
+            std::unique_lock<std::mutex> lock(mutex);
+            wanted = 0;
+            done.wait(lock, [this]() { return active == 0; });
+        }
+
+    private:
+        void workerLoop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                wake.wait(lock, [this]() { return wanted != 0; });
+                --wanted, ++active;
+                void (*work)(void*) = job;
+                void* context = jobContext;
+
+                lock.unlock();
+                work(context);
+                lock.lock();
+
+                if (--active == 0)
+                    done.notify_one();
+            }
+        }
+
+        std::mutex runMutex;               ///< Held by the thread running a batch on the pool
+        std::vector<std::thread> workers;  ///< Grown under runMutex
+#ifndef _WIN32
+        pid_t owner = getpid();            ///< Process the workers run in
+#endif // !_WIN32
+
+        std::mutex mutex;
+        std::condition_variable wake, done;
+        void (*job)(void*) = nullptr;
+        void* jobContext = nullptr;
+        size_t wanted = 0;                 ///< Workers still to join the running batch
+        size_t active = 0;                 ///< Workers running it
+    };
+
+    // Runs body(index) for every index in [0, count), spread over up to one worker thread per core
+    template<typename Body>
+    void parallelFor(size_t count, size_t indicesPerWorker, Body&& body) {
+        struct Batch {
+            size_t count;
+            Body& body;
+            std::atomic<size_t> nextIndex{ 0 };
+        } batch{ count, body };
+
+        // The calling thread works as well
+        WorkerPool::Global().Run((count + indicesPerWorker - 1) / indicesPerWorker - (count != 0), [](void* context) {
+            Batch& batch = *static_cast<Batch*>(context);
+            for (size_t index; (index = batch.nextIndex.fetch_add(1, std::memory_order_relaxed)) < batch.count;)
+                batch.body(index);
+        }, &batch);
+    }
+
+    // The entries save the whole register state the OS enables with xsave, sized before the first of them can run
+    void sizeExtendedState() {
+#ifdef AA_CPU_X64
+        static std::once_flag sized;
+        std::call_once(sized, []() { extendedStateSize = cpu::ExtendedStateSize(); });
+#endif // AA_CPU_X64
+    }
+
+    // Entry of a return address, nullptr if its instruction can't be relocated
+    Scudo::PatchedReturn* findReturn(uintptr_t returnAddress) {
+
+        // The entry and its resume slot are kept once the breakpoint is removed, the caller is likely to call again
+        return Scudo::patchedReturns.FindOrInsert(returnAddress, [returnAddress]() -> std::unique_ptr<Scudo::PatchedReturn> {
+#ifdef AA_CPU_X64
+            // Calls still return there while the address breaks, they resume in a copy of the instruction
+            BYTE* resume = thunk::SlotAllocator::Global().Allocate(reinterpret_cast<void*>(returnAddress));
+            if (!resume)
+                return nullptr;
+
+            protection::Writable memResume(resume, thunk::SlotSize);
+            if (!memResume || !thunk::BuildResume(resume, memResume.View(resume), thunk::SlotSize, reinterpret_cast<void*>(returnAddress), oplength::MaxInstructionLength, 1))
+                return nullptr;
+
+            std::unique_ptr<Scudo::PatchedReturn> created = std::make_unique<Scudo::PatchedReturn>();
+            created->resume = resume;
+            return created;
+#else
+            return nullptr;
+#endif // AA_CPU_X64
+        });
+    }
+}
+
 #ifdef AA_USECALLBACK
 EXTERN_C VOID topLevelHandler(PEXCEPTION_RECORD exceptionRecord, PCONTEXT contextRecord) {
     // Always check if the user is authenticated
@@ -23,6 +171,27 @@ EXTERN_C VOID topLevelHandler(PEXCEPTION_RECORD exceptionRecord, PCONTEXT contex
         return;
     }
 
+    // Inaccessible pages of a paged function are decrypted when reached, writes keep faulting and are dispatched
+    if (exceptionRecord->ExceptionCode == EXCEPTION_ACCESS_VIOLATION && exceptionRecord->NumberParameters >= 2 && exceptionRecord->ExceptionInformation[0] != 1) {
+        if (Scudo::pageFaultRoutine(reinterpret_cast<void*>(exceptionRecord->ExceptionInformation[1])))
+            RtlRestoreContext(contextRecord, NULL);
+        return;
+    }
+
+#ifdef AA_DEBUG_REGISTERS
+    // A debug register of this thread broke at a return address, the routine already set the registers the thread resumes with
+    if (exceptionRecord->ExceptionCode == EXCEPTION_SINGLE_STEP && debugtrap::ThreadTraps::Current().Armed(reinterpret_cast<uintptr_t>(exceptionRecord->ExceptionAddress))) {
+        {
+            // Pages written for the return are restored here, RtlRestoreContext doesn't return
+            protection::Manager::Batch protectionBatch;
+            contextRecord->Rip = reinterpret_cast<DWORD64>(Scudo::returnBreakpointRoutine(exceptionRecord->ExceptionAddress, reinterpret_cast<uintptr_t*>(contextRecord->Rsp)));
+        }
+        contextRecord->EFlags |= (1 << 16);
+        RtlRestoreContext(contextRecord, NULL);
+        return;
+    }
+#endif // AA_DEBUG_REGISTERS
+
     // If the exception isn't a breakpoint, look for another handler
     if (exceptionRecord->ExceptionCode != EXCEPTION_BREAKPOINT) {
         RtlRestoreContext(contextRecord, NULL);
@@ -33,20 +202,24 @@ EXTERN_C VOID topLevelHandler(PEXCEPTION_RECORD exceptionRecord, PCONTEXT contex
     void* exceptionAddress = exceptionRecord->ExceptionAddress;
 
     /*
-    * Use INT3 instruction breakpoint at return address found on the stack to trigger an exception which will
+    * In AA_MODE_RETURN_PATCH, an INT3 instruction breakpoint at the return address found on the stack triggers an exception which will
     * allow the program to re-encrypt the function immediately after it's done executing.
     */
     if (!Scudo::isEncryptedFunction(exceptionAddress)) // Check if the breakpoint occured at an encrypted function
     {
-        // Get the encrypted function's object from the return address associated with it
-        if ((Scudo::currentEncryptedFunction = Scudo::returnAddressToFunction(exceptionAddress)), Scudo::currentEncryptedFunction == nullptr) {
+        // End the call returning there and remove the breakpoint once no other call returns there
+        void* resumeAddress;
+        {
+            // Pages written for the return are restored here, RtlRestoreContext doesn't return
+            protection::Manager::Batch protectionBatch;
+            resumeAddress = Scudo::returnBreakpointRoutine(exceptionAddress, reinterpret_cast<uintptr_t*>(contextRecord->Rsp));
+        }
+        if (!resumeAddress) {
             RtlRestoreContext(contextRecord, NULL);
             return;
         }
 
-        // Re-encrypt the function aswell as remove the breakpoint from the return address
-        Scudo::currentEncryptedFunction->encryptionRoutine();
-
+        contextRecord->Rip = reinterpret_cast<DWORD64>(resumeAddress);
         contextRecord->EFlags |= (1 << 16);
         RtlRestoreContext(contextRecord, NULL);
         return;
@@ -61,11 +234,12 @@ EXTERN_C VOID topLevelHandler(PEXCEPTION_RECORD exceptionRecord, PCONTEXT contex
     // Create a pointer to the rspAddress
     uintptr_t* returnAddressPtr = reinterpret_cast<uintptr_t*>(contextRecord->Rsp);
 
-    // Dereference the pointer to retrieve the return address value
-    Scudo::currentEncryptedFunction->lastReturnAddress = *returnAddressPtr;
-
-    // Decrypts the function and puts breakpoint on return address
-    Scudo::currentEncryptedFunction->decryptionRoutine();
+    // Decrypts the function and redirects its return to the re-encryption trampoline
+    {
+        // Pages written for the call are restored here, RtlRestoreContext doesn't return
+        protection::Manager::Batch protectionBatch;
+        contextRecord->Rip = reinterpret_cast<DWORD64>(Scudo::currentEncryptedFunction->decryptionRoutine(returnAddressPtr));
+    }
 
     // Resume execution
     contextRecord->EFlags |= (1 << 16);
@@ -74,14 +248,74 @@ EXTERN_C VOID topLevelHandler(PEXCEPTION_RECORD exceptionRecord, PCONTEXT contex
 }
 #endif // !AA_USECALLBACK
 
+EXTERN_C PVOID thunkEnterHandler(Scudo* encryptedFunction, uintptr_t* returnAddressPtr) {
+    // Threads calling protected functions are the ones trapping, they read the index with a record of their own
+    registry::EpochDomain::Global().Attach();
+
+    // Pages written for the call are restored together before it enters the body
+    protection::Manager::Batch protectionBatch;
+
+    // The body is entered through the relocated copy of the instructions the jmp replaced
+    return encryptedFunction->decryptionRoutine(returnAddressPtr);
+}
+
+EXTERN_C uintptr_t returnHandler(uintptr_t* returnAddressPtr) {
+    // Pages written for the return are restored together before the caller resumes
+    protection::Manager::Batch protectionBatch;
+
+    // Calls of this thread an exception unwound never came back through here
+    Scudo::releaseFrames(returnAddressPtr);
+
+    Scudo::ReturnFrame frame = Scudo::returnFrames.back();
+    Scudo::returnFrames.pop_back();
+
+    // Re-encrypt the function if this was the last call running it
+    frame.function->encryptionRoutine();
+
+    return frame.returnAddress;
+}
+
+#ifndef _WIN32
+EXTERN_C PVOID returnBreakpointHandler(void* returnAddress, uintptr_t* stackPointer) {
+    // Pages written for the return are restored together before the caller resumes
+    protection::Manager::Batch protectionBatch;
+
+    // The signal handler only resumes here for an address that held a breakpoint, it always has a resume slot
+    return Scudo::returnBreakpointRoutine(returnAddress, stackPointer);
+}
+
+EXTERN_C VOID pageFaultHandler(void* address) {
+    // Pages written for the fault are restored together before the access is retried
+    protection::Manager::Batch protectionBatch;
 
+    // The access would fault again forever, end the process as an unhandled fault would
+    if (!Scudo::pageFaultRoutine(address))
+        abort();
+}
+#endif // !_WIN32
 
-void AAPROTECT(void* functionAddress) {
+void AAPROTECT(void* functionAddress, AA_PROTECTION_MODE mode) {
     // Always check if the user is authenticated
     if (!Scudo::userRequestHandler->isAuthenticated())
         return;
 
-    Scudo::protectedFunctions.push_back(std::make_unique<Scudo>(functionAddress));
+    Scudo::protectedFunctions.push_back(std::make_unique<Scudo>(functionAddress, mode));
+}
+
+void AAPROTECT_MANY(std::span<void*> functionAddresses, AA_PROTECTION_MODE mode) {
+    // Always check if the user is authenticated
+    if (!Scudo::userRequestHandler->isAuthenticated())
+        return;
+
+    Scudo::ProtectBatch(functionAddresses, mode);
+}
+
+void AAPROTECT_PACKED() {
+    // Always check if the user is authenticated
+    if (!Scudo::userRequestHandler->isAuthenticated())
+        return;
+
+    Scudo::RegisterPacked();
 }
 
 void AAUNPROTECT() {
@@ -97,80 +331,392 @@ void AAInit(std::string userEmail, std::string userToken) {
     // Initialize The Request Handler
     Scudo::userRequestHandler = std::make_unique<UserRequestHandler>(userEmail, userToken);
 
+    // Generate the master secret function keys are derived from, and rotate it from now on
+    cipher::KeySchedule::Global();
+    Scudo::startKeyRotation();
+
     // Send the request to our server
     Scudo::userRequestHandler->sendUserRequest(x_("auth.asylus.online"), x_("8080"));
 }
 
-Scudo::Scudo(void* functionAddress)
-    : functionAddress(functionAddress), 
-    functionSize(GetFunctionLength(functionAddress)) {
+Scudo::Scudo(void* functionAddress, AA_PROTECTION_MODE mode)
+    : functionAddress(functionAddress),
+    functionSize(0) {
+
+    // Protected functions are tail call targets while measuring, and may not share bytes with this one
+    std::vector<void*> protectedEntries = sortedProtectedEntries();
+    functionSize = functionAddress ? measureFunction(functionAddress, protectedEntries) : 0;
 
     // Ensure valid function pointer was passed
     if (!functionAddress || !functionSize)
         throw std::invalid_argument(x_("Invalid functionAddress or functionSize"));
+    if (overlapsProtected(functionAddress, functionSize, protectedEntries))
+        throw std::invalid_argument(x_("Function overlaps a protected function"));
 
     // Always check if the user is authenticated
     if (!userRequestHandler->isAuthenticated())
         return;
         
-    // Set the XOR byte to a random value (TODO - Encrypt with a 3 sequencial xor operations with 3 xor keys)
-    xorKey = randomKey();
+    // Take the first epoch of the function, its key is derived from it
+    algorithm = cipher::DefaultAlgorithm();
+    epoch = cipher::KeySchedule::Global().Acquire(0);
 
-    // Check if the handler has already been initialized
-    if (!isExceptionHandlingInitialized.load()) {
+#ifdef AA_DUAL_MAPPING
+    // Remap the pages of the function before its code is first written, it is written through an alias from then on
+    protection::Manager::Global().Alias(functionAddress, functionSize);
+#endif // AA_DUAL_MAPPING
 
-        // Install our exception handler
-#ifndef AA_USECALLBACK
-        exceptionHandler = ShadowCall<PVOID>(shadow::hash_t(x_("RtlAddVectoredExceptionHandler")), 1, ExceptionHandler);
-#else
-        InstallCallback(true);
-#endif // !AA_USECALLBACK
+    // Functions whose entry can't be relocated keep the entry trap, epoch functions get their entry byte back while plaintext
+    this->mode = mode == AA_MODE_THUNK && !installThunk() ? AA_MODE_BREAKPOINT : mode;
+    if (this->mode != AA_MODE_THUNK && this->mode != AA_MODE_EPOCH)
+        relocateEntry();
+    splitPages();
 
-        // Tell the atomic bool that the handler is now installed
-        isExceptionHandlingInitialized.store(true);
-    }
+    if (this->mode == AA_MODE_EPOCH)
+        startSweeper();
+
+    // Check if the handler has already been initialized, thunk mode doesn't need it unless pages fault
+    if (this->mode != AA_MODE_THUNK || interior)
+        installHandler();
 
     // Encrypt the function
     encryptFunction(functionAddress, functionSize);
 
     // Store the encrypted function in the map
+    std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
     encryptedFunctions[functionAddress] = this;
+    publishFunctions();
+}
+
+Scudo::Scudo(void* functionAddress, SIZE_T functionSize, DeferEncryption)
+    : functionAddress(functionAddress),
+    functionSize(functionSize),
+    firstByte(0),
+    algorithm(cipher::DefaultAlgorithm()),
+    epoch(0) {
+}
+
+void Scudo::installHandler() {
+
+    // Handlers only claim epoch records from the pool, this thread keeps one until it exits
+    registry::EpochDomain::Global().Attach();
+
+    // Check if the handler has already been initialized
+    if (isExceptionHandlingInitialized.load())
+        return;
+
+    // Install our exception handler
+    sizeExtendedState();
+#if !defined(_WIN32)
+    InstallSignalHandler(true, SignalHandler);
+#elif !defined(AA_USECALLBACK)
+    exceptionHandler = ShadowCall<PVOID>(shadow::hash_t(x_("RtlAddVectoredExceptionHandler")), 1, ExceptionHandler);
+#else
+    InstallCallback(true);
+#endif // !_WIN32
+
+    // Tell the atomic bool that the handler is now installed
+    isExceptionHandlingInitialized.store(true);
+}
+
+void Scudo::RotateMasterSecret() {
+    cipher::KeySchedule::Global().Rotate();
+}
+
+void Scudo::startKeyRotation() {
+#if !defined(AA_KEYSEED) && AA_KEY_ROTATION_SECONDS > 0
+    if (keyRotationThread.joinable())
+        return;
+
+    keyRotationThread = std::jthread([](std::stop_token stopToken) {
+        std::mutex sleepMutex;
+        std::condition_variable_any sleep;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+
+        // Sleep for the interval, waking early only to stop
+        while (!sleep.wait_for(lock, stopToken, std::chrono::seconds(AA_KEY_ROTATION_SECONDS), [] { return false; }) && !stopToken.stop_requested())
+            RotateMasterSecret();
+    });
+#endif // !AA_KEYSEED && AA_KEY_ROTATION_SECONDS > 0
+}
+
+void Scudo::startSweeper() {
+    if (sweeperThread.joinable())
+        return;
+
+    sweeperThread = std::jthread([](std::stop_token stopToken) {
+        std::mutex sleepMutex;
+        std::condition_variable_any sleep;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+
+        // Sleep for the epoch, waking early only to stop
+        while (!sleep.wait_for(lock, stopToken, std::chrono::milliseconds(AA_EPOCH_MILLISECONDS), [] { return false; }) && !stopToken.stop_requested())
+            SweepEpoch();
+    });
+}
+
+void Scudo::SweepEpoch() {
+    auto idleSince = (std::chrono::steady_clock::now() - std::chrono::milliseconds(AA_EPOCH_MILLISECONDS)).time_since_epoch().count();
+
+    // Functions decrypted an epoch ago start encrypting, calls trapping on them from now on wait for the sweep
+    std::vector<Scudo*> expired;
+    {
+        std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
+        for (const auto& pair : encryptedFunctions) {
+            Scudo* encryptedFunction = pair.second;
+            if (encryptedFunction->mode == AA_MODE_EPOCH && encryptedFunction->decryptedAt.load(std::memory_order_relaxed) <= idleSince && encryptedFunction->callState.Expire())
+                expired.push_back(encryptedFunction);
+        }
+    }
+    if (expired.empty())
+        return;
+
+    // Calls still running the body can't be stopped, the ones made from now on trap on the entry
+    std::sort(expired.begin(), expired.end(), [](const Scudo* left, const Scudo* right) { return left->functionAddress < right->functionAddress; });
+    {
+        protection::Manager::Batch protectionBatch;
+        for (Scudo* encryptedFunction : expired) {
+            protection::Writable memEntry(encryptedFunction->functionAddress, sizeof(BYTE));
+            *memEntry.View(static_cast<BYTE*>(encryptedFunction->functionAddress)) = BREAKPOINT_BYTE;
+        }
+    }
+
+    // A thread whose instruction pointer or stack points into a body may still be running it
+    std::vector<sweep::Range> bodies;
+    bodies.reserve(expired.size());
+    for (Scudo* encryptedFunction : expired) {
+        uintptr_t entry = reinterpret_cast<uintptr_t>(encryptedFunction->functionAddress);
+        bodies.push_back({ entry + 1, entry + encryptedFunction->functionSize });
+    }
+
+    sweep::Scan scan(std::move(bodies));
+#ifdef _WIN32
+    scan.Examine();
+#else
+    scan.Examine(AA_SWEEP_SIGNAL);
+#endif // _WIN32
+
+    // Idle functions are encrypted, busy ones get their entry byte back for the next sweep
+    {
+        protection::Manager::Batch protectionBatch;
+        for (size_t index = 0; index < expired.size(); ++index) {
+            Scudo* encryptedFunction = expired[index];
+            if (!scan.Busy(index)) {
+                encryptedFunction->reencrypt();
+                continue;
+            }
+
+            protection::Writable memEntry(encryptedFunction->functionAddress, sizeof(BYTE));
+            *memEntry.View(static_cast<BYTE*>(encryptedFunction->functionAddress)) = encryptedFunction->firstByte;
+        }
+    }
+
+    for (size_t index = 0; index < expired.size(); ++index) {
+        if (scan.Busy(index))
+            expired[index]->callState.CancelEncryption();
+        else
+            expired[index]->callState.EndEncryption();
+    }
+}
+
+void Scudo::RegisterPacked() {
+
+    const packed::Table<AA_PACKED_CAPACITY>* table = packedTable();
+
+    if (table->header.magic != packed::Magic || table->header.version != packed::Version || table->header.entrySize != sizeof(packed::Entry))
+        return;
+
+    size_t count = (std::min)(size_t(table->header.count), size_t(AA_PACKED_CAPACITY));
+    if (!count)
+        return;
+
+    // Entries are relative to the module the table lives in
+    LoadedModule module;
+    if (!FindLoadedModule(table, module))
+        return;
+
+    std::vector<std::unique_ptr<Scudo>> batch;
+    batch.reserve(count);
+    for (uint32_t index = 0; index < count; ++index) {
+        const packed::Entry& entry = table->entries[index];
+        batch.push_back(std::make_unique<Scudo>(reinterpret_cast<void*>(module.base + entry.rva), SIZE_T(entry.size), DeferEncryption{}));
+        batch.back()->algorithm = static_cast<cipher::Algorithm>(entry.algorithm);
+
+        // The key was drawn by the packer, the epoch points at its entry
+        batch.back()->epoch = (cipher::KeySchedule::ExternalGeneration << cipher::KeySchedule::GenerationShift) | index;
+        batch.back()->firstByte = entry.firstByte;
+    }
+
+    installHandler();
+
+    {
+        std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
+        encryptedFunctions.reserve(encryptedFunctions.size() + batch.size());
+
+        // Registering twice would keep the second object around after the first one decrypted the function
+        std::erase_if(batch, [](const std::unique_ptr<Scudo>& encryptedFunction) {
+            return encryptedFunctions.count(encryptedFunction->functionAddress) != 0;
+        });
+        for (const std::unique_ptr<Scudo>& encryptedFunction : batch)
+            encryptedFunctions[encryptedFunction->functionAddress] = encryptedFunction.get();
+        publishFunctions();
+    }
+
+    protectedFunctions.reserve(protectedFunctions.size() + batch.size());
+    std::move(batch.begin(), batch.end(), std::back_inserter(protectedFunctions));
+}
+
+void Scudo::ProtectBatch(std::span<void* const> functionAddresses, AA_PROTECTION_MODE mode) {
+
+    // Work on every function once, in address order
+    std::vector<void*> functions(functionAddresses.begin(), functionAddresses.end());
+    std::sort(functions.begin(), functions.end(), std::less<void*>());
+    functions.erase(std::unique(functions.begin(), functions.end()), functions.end());
+
+    if (!functions.empty() && !functions.front())
+        throw std::invalid_argument(x_("Invalid functionAddress or functionSize"));
+
+    // Skip functions that are already protected, every other one is a tail call target while measuring
+    std::vector<void*> protectedEntries = sortedProtectedEntries();
+    std::erase_if(functions, [&](void* function) { return std::binary_search(protectedEntries.begin(), protectedEntries.end(), function, std::less<void*>()); });
+
+    std::vector<void*> knownEntries;
+    std::merge(protectedEntries.begin(), protectedEntries.end(), functions.begin(), functions.end(), std::back_inserter(knownEntries), std::less<void*>());
+
+    if (functions.empty())
+        return;
+
+    // Measure every function in parallel
+    std::vector<SIZE_T> sizes(functions.size());
+    parallelFor(functions.size(), 32, [&](size_t index) {
+        sizes[index] = measureFunction(functions[index], knownEntries);
+    });
+
+    // Validate everything before any code is modified
+    for (size_t index = 0; index < functions.size(); ++index) {
+        if (!sizes[index])
+            throw std::invalid_argument(x_("Invalid functionAddress or functionSize"));
+        if (index && static_cast<BYTE*>(functions[index - 1]) + sizes[index - 1] > static_cast<BYTE*>(functions[index]))
+            throw std::invalid_argument(x_("Overlapping functions in batch"));
+        if (overlapsProtected(functions[index], sizes[index], protectedEntries))
+            throw std::invalid_argument(x_("Function overlaps a protected function"));
+    }
+
+    // Always check if the user is authenticated
+    if (!userRequestHandler->isAuthenticated())
+        return;
+
+    std::vector<std::unique_ptr<Scudo>> batch;
+    batch.reserve(functions.size());
+    for (size_t index = 0; index < functions.size(); ++index) {
+        batch.push_back(std::make_unique<Scudo>(functions[index], sizes[index], DeferEncryption{}));
+        batch.back()->epoch = cipher::KeySchedule::Global().Acquire(0);
+        batch.back()->mode = mode == AA_MODE_THUNK && !batch.back()->installThunk() ? AA_MODE_BREAKPOINT : mode;
+        if (batch.back()->mode != AA_MODE_THUNK && batch.back()->mode != AA_MODE_EPOCH)
+            batch.back()->relocateEntry();
+        batch.back()->splitPages();
+    }
+
+    if (mode == AA_MODE_EPOCH)
+        startSweeper();
+
+    if (std::any_of(batch.begin(), batch.end(), [](const std::unique_ptr<Scudo>& encryptedFunction) { return encryptedFunction->mode != AA_MODE_THUNK || encryptedFunction->interior; }))
+        installHandler();
+
+    // Register the whole batch before its code is encrypted, the registry grows only once
+    {
+        std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
+        encryptedFunctions.reserve(encryptedFunctions.size() + batch.size());
+        for (const std::unique_ptr<Scudo>& encryptedFunction : batch)
+            encryptedFunctions[encryptedFunction->functionAddress] = encryptedFunction.get();
+        publishFunctions();
+    }
+
+    // Coalesce the pages of neighbouring functions into ranges [first, last) of the batch
+    struct PageRange { uintptr_t begin, end; size_t first, last; };
+    std::vector<PageRange> ranges;
+    for (size_t index = 0; index < batch.size(); ++index) {
+        uintptr_t begin = reinterpret_cast<uintptr_t>(batch[index]->functionAddress) & ~(PAGE_LENGTH - 1);
+        uintptr_t end = (reinterpret_cast<uintptr_t>(batch[index]->functionAddress) + batch[index]->functionSize + PAGE_LENGTH - 1) & ~(PAGE_LENGTH - 1);
+
+        if (!ranges.empty() && begin <= ranges.back().end) {
+            ranges.back().end = (std::max)(ranges.back().end, end);
+            ranges.back().last = index + 1;
+        }
+        else
+            ranges.push_back({ begin, end, index, index + 1 });
+    }
+
+#ifdef AA_DUAL_MAPPING
+    // Remap the ranges before any code is encrypted, their code is then written through an alias
+    for (const PageRange& range : ranges)
+        protection::Manager::Global().Alias(reinterpret_cast<void*>(range.begin), range.end - range.begin);
+#endif // AA_DUAL_MAPPING
+
+    // One protection change per range, ranges are encrypted in parallel
+    parallelFor(ranges.size(), 4, [&](size_t index) {
+        const PageRange& range = ranges[index];
+        {
+            protection::Writable memRange(reinterpret_cast<void*>(range.begin), range.end - range.begin);
+            for (size_t function = range.first; function < range.last; ++function)
+                if (!batch[function]->interior)
+                    batch[function]->encryptBytes(batch[function]->functionAddress, batch[function]->functionSize, memRange.View(static_cast<BYTE*>(batch[function]->functionAddress)));
+        }
+
+        // Paged functions take the pages of their own, writes through process memory may not overlap
+        for (size_t function = range.first; function < range.last; ++function)
+            if (batch[function]->interior)
+                batch[function]->encryptFunction(batch[function]->functionAddress, batch[function]->functionSize);
+    });
+
+    protectedFunctions.reserve(protectedFunctions.size() + batch.size());
+    std::move(batch.begin(), batch.end(), std::back_inserter(protectedFunctions));
 }
 
 Scudo::~Scudo() {
 
-    // Decrypt the function
-    decryptFunction(functionAddress, functionSize);
+    // Decrypt the function, unless it is running and already decrypted
+    removeProtection();
 
     // Lock the mutex to prevent race-conditions
     std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
 
     // Remove the encrypted function from the map
     encryptedFunctions.erase(functionAddress);
+    publishFunctions();
 }
 
 void Scudo::UnprotectAll()
 {
-    // Call the deconstructor for every function that is already protected
-    for (const auto& encryptedFunction : protectedFunctions) {
-        encryptedFunction->~Scudo();
-    }
+    // No sweep may start or be running while the functions are unprotected, nor signal the threads once the handler is removed
+    sweeperThread = std::jthread();
+
+    // Destroy every function that is already protected, the deconstructor decrypts it. Destroyed once, their members own memory
+    protectedFunctions.clear();
 
     // Check if the handler is initialized
     if (isExceptionHandlingInitialized.load()) { 
 
         // Remove the exception handler to the stack
-#ifndef AA_USECALLBACK
+#if !defined(_WIN32)
+        InstallSignalHandler(false, nullptr);
+#elif !defined(AA_USECALLBACK)
         ShadowCall<ULONG>(shadow::hash_t(x_("RtlRemoveVectoredExceptionHandler")), exceptionHandler);
 #else
         InstallCallback(false);
-#endif // !AA_USECALLBACK     
+#endif // !_WIN32
 
         // Tell the atomic bool that the handler is no longer installed
         isExceptionHandlingInitialized.store(false);
     }
+
+#ifndef AA_NOSIZECACHE
+    // Persist the sizes measured during this run for the next start
+    FunctionSizeCache::FlushAll();
+#endif // !AA_NOSIZECACHE
 }
 
+#ifdef _WIN32
 LONG NTAPI Scudo::ExceptionHandler(EXCEPTION_POINTERS* exceptionInfo) {
 
     // Always check if the user is authenticated
@@ -180,6 +726,23 @@ LONG NTAPI Scudo::ExceptionHandler(EXCEPTION_POINTERS* exceptionInfo) {
     // Shorten the pointer chain for simplicity
     PEXCEPTION_RECORD exceptionRecord = exceptionInfo->ExceptionRecord;
 
+    // Pages written while handling the exception are restored together before the thread resumes
+    protection::Manager::Batch protectionBatch;
+
+    // Inaccessible pages of a paged function are decrypted when reached, writes keep faulting and are passed on
+    if (exceptionRecord->ExceptionCode == EXCEPTION_ACCESS_VIOLATION && exceptionRecord->NumberParameters >= 2 && exceptionRecord->ExceptionInformation[0] != 1)
+        return pageFaultRoutine(reinterpret_cast<void*>(exceptionRecord->ExceptionInformation[1])) ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+
+#ifdef AA_DEBUG_REGISTERS
+    // A debug register of this thread broke at a return address, before running its instruction
+    if (exceptionRecord->ExceptionCode == EXCEPTION_SINGLE_STEP && debugtrap::ThreadTraps::Current().Armed(reinterpret_cast<uintptr_t>(exceptionRecord->ExceptionAddress))) {
+        PCONTEXT contextRecord = exceptionInfo->ContextRecord;
+        contextRecord->Rip = reinterpret_cast<DWORD64>(returnBreakpointRoutine(exceptionRecord->ExceptionAddress, reinterpret_cast<uintptr_t*>(contextRecord->Rsp)));
+        debugtrap::ThreadTraps::Current().Load(contextRecord);
+        return EXCEPTION_CONTINUE_EXECUTION;
+    }
+#endif // AA_DEBUG_REGISTERS
+
     // If the exception isn't a breakpoint, look for another handler
     if (exceptionRecord->ExceptionCode != EXCEPTION_BREAKPOINT)
         return EXCEPTION_CONTINUE_SEARCH;
@@ -187,19 +750,24 @@ LONG NTAPI Scudo::ExceptionHandler(EXCEPTION_POINTERS* exceptionInfo) {
     // Get the address where the exception occured
     void* exceptionAddress = exceptionRecord->ExceptionAddress;
 
+    // Shorten the pointer chain for simplicity
+    PCONTEXT contextRecord = exceptionInfo->ContextRecord;
+
     /*
-    * Use INT3 instruction breakpoint at return address found on the stack to trigger an exception which will
+    * In AA_MODE_RETURN_PATCH, an INT3 instruction breakpoint at the return address found on the stack triggers an exception which will
     * allow the program to re-encrypt the function immediately after it's done executing.
     */
     if (!isEncryptedFunction(exceptionAddress)) // Check if the breakpoint occured at an encrypted function
     {
-        // Get the encrypted function's object from the return address associated with it
-        if ((currentEncryptedFunction = returnAddressToFunction(exceptionAddress)), currentEncryptedFunction == nullptr)
+        // End the call returning there and remove the breakpoint once no other call returns there
+        void* resumeAddress = returnBreakpointRoutine(exceptionAddress, reinterpret_cast<uintptr_t*>(contextRecord->Rsp));
+        if (!resumeAddress)
             return EXCEPTION_CONTINUE_SEARCH;
 
-        // Re-encrypt the function aswell as remove the breakpoint from the return address
-        currentEncryptedFunction->encryptionRoutine();
-
+        contextRecord->Rip = reinterpret_cast<DWORD64>(resumeAddress);
+#ifdef AA_DEBUG_REGISTERS
+        debugtrap::ThreadTraps::Current().Load(contextRecord);
+#endif // AA_DEBUG_REGISTERS
         return EXCEPTION_CONTINUE_EXECUTION;
     }
 
@@ -207,172 +775,549 @@ LONG NTAPI Scudo::ExceptionHandler(EXCEPTION_POINTERS* exceptionInfo) {
     if ((currentEncryptedFunction = getEncryptedFunction(exceptionAddress)), currentEncryptedFunction == nullptr)
         return EXCEPTION_CONTINUE_SEARCH;
 
-    // Shorten the pointer chain for simplicity
-    PCONTEXT contextRecord = exceptionInfo->ContextRecord;
-
     // Create a pointer to the rspAddress
     uintptr_t* returnAddressPtr = reinterpret_cast<uintptr_t*>(contextRecord->Rsp);
 
-    // Dereference the pointer to retrieve the return address value
-    currentEncryptedFunction->lastReturnAddress = *returnAddressPtr;
+    // Decrypts the function and redirects its return to the re-encryption trampoline
+    contextRecord->Rip = reinterpret_cast<DWORD64>(currentEncryptedFunction->decryptionRoutine(returnAddressPtr));
 
-    // Decrypts the function and puts breakpoint on return address
-    currentEncryptedFunction->decryptionRoutine();
+#ifdef AA_DEBUG_REGISTERS
+    // The thread resumes with the debug registers armed for the call, not the ones captured with the exception
+    debugtrap::ThreadTraps::Current().Load(contextRecord);
+#endif // AA_DEBUG_REGISTERS
 
     // Resume execution
     return EXCEPTION_CONTINUE_EXECUTION;
 }
+#else
+void Scudo::SignalHandler(int signal, siginfo_t* info, void* context) {
+
+    // The epoch sweeper asks every thread to scan its own stack
+    if (signal == AA_SWEEP_SIGNAL && info->si_code == SI_TKILL && info->si_pid == getpid() && sweep::Scan::OnSignal(context))
+        return;
+
+    // isAuthenticated may report the failure, which isn't async-signal-safe. Nothing is protected unless authenticated
+    if (!userRequestHandler || userRequestHandler->statusCode != UserRequestHandler::authenticated) {
+        ChainSignal(signal, info, context);
+        return;
+    }
+
+    // Shorten the pointer chain for simplicity
+    greg_t* registers = static_cast<ucontext_t*>(context)->uc_mcontext.gregs;
+
+    // Inaccessible pages of a paged function are decrypted when reached, writes keep faulting and are passed on
+    if (signal == SIGSEGV) {
+        Scudo* encryptedFunction = registers[REG_ERR] & 2 ? nullptr : getContainingFunction(info->si_addr);
+        if (!encryptedFunction || !encryptedFunction->interior.Contains(info->si_addr)) {
+            ChainSignal(signal, info, context);
+            return;
+        }
+
+        // pageFaultEntry decrypts the page then retries the access, below the red zone of the interrupted code
+        uintptr_t* stackPointer = reinterpret_cast<uintptr_t*>(registers[REG_RSP] - 128);
+        *--stackPointer = static_cast<uintptr_t>(registers[REG_RIP]);
+        *--stackPointer = reinterpret_cast<uintptr_t>(info->si_addr);
+        registers[REG_RSP] = reinterpret_cast<greg_t>(stackPointer);
+        registers[REG_RIP] = reinterpret_cast<greg_t>(&pageFaultEntry);
+        return;
+    }
+
+    // Everything else is a trap
+    if (signal != SIGTRAP) {
+        ChainSignal(signal, info, context);
+        return;
+    }
+
+#ifdef AA_DEBUG_REGISTERS
+    // A debug register of this thread broke at a return address, before running its instruction. Only the ones it armed deliver TRAP_PERF there
+    if (info->si_code == debugtrap::TrapCode && info->si_addr == reinterpret_cast<void*>(registers[REG_RIP]) && patchedReturns.Find(static_cast<uintptr_t>(registers[REG_RIP]))) {
+        registers[REG_R11] = registers[REG_RIP];
+        registers[REG_RIP] = reinterpret_cast<greg_t>(&returnBreakpointEntry);
+        return;
+    }
+#endif // AA_DEBUG_REGISTERS
 
+    // INT3 is reported by the kernel itself, other traps belong to debuggers
+    if (info->si_code != SI_KERNEL) {
+        ChainSignal(signal, info, context);
+        return;
+    }
+
+    // Get the address where the exception occured, the instruction pointer is past the INT3
+    void* exceptionAddress = reinterpret_cast<BYTE*>(registers[REG_RIP]) - 1;
+
+    // Calls enter through the thunk dispatcher, the function is decrypted once the signal returned
+    if (Scudo* encryptedFunction = getEncryptedFunction(exceptionAddress)) {
+        registers[REG_R11] = reinterpret_cast<greg_t>(encryptedFunction);
+        registers[REG_RIP] = reinterpret_cast<greg_t>(&thunkEntry);
+        return;
+    }
+
+    // In AA_MODE_RETURN_PATCH, the call returning to a breakpoint is ended the same way
+    if (patchedReturns.Find(reinterpret_cast<uintptr_t>(exceptionAddress))) {
+        registers[REG_R11] = reinterpret_cast<greg_t>(exceptionAddress);
+        registers[REG_RIP] = reinterpret_cast<greg_t>(&returnBreakpointEntry);
+        return;
+    }
+
+    ChainSignal(signal, info, context);
+}
+#endif // _WIN32
+
+
+std::vector<void*> Scudo::sortedProtectedEntries() {
+    std::vector<void*> entries;
+    {
+        std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
+        entries.reserve(encryptedFunctions.size());
+        for (const auto& pair : encryptedFunctions)
+            entries.push_back(pair.first);
+    }
+    std::sort(entries.begin(), entries.end(), std::less<void*>());
+    return entries;
+}
+
+bool Scudo::overlapsProtected(void* functionAddress, SIZE_T functionSize, std::span<void* const> protectedEntries) {
+
+    // Either end inside a protected function, or a protected function starting inside this one
+    BYTE* begin = static_cast<BYTE*>(functionAddress);
+    BYTE* end = begin + functionSize;
+    auto next = std::upper_bound(protectedEntries.begin(), protectedEntries.end(), functionAddress, std::less<void*>());
+    return functionIndex.FindContaining(begin) || functionIndex.FindContaining(end - 1) || (next != protectedEntries.end() && static_cast<BYTE*>(*next) < end);
+}
+
+SIZE_T Scudo::measureFunction(void* functionAddress, std::span<void* const> knownEntries) {
+
+    // The module's unwind / symbol tables give exact sizes without disassembling
+    const FunctionExtentIndex& extentIndex = FunctionExtentIndex::ForAddress(functionAddress);
+    if (SIZE_T indexedSize = extentIndex.Size(functionAddress))
+        return indexedSize;
+    uintptr_t begin = reinterpret_cast<uintptr_t>(functionAddress);
+
+#ifndef AA_NOSIZECACHE
+    // Sizes measured by a previous run of the same binary are reused without touching the code, unless they run into a function the tables know
+    FunctionSizeCache* sizeCache = FunctionSizeCache::ForAddress(functionAddress);
+    if (sizeCache)
+        if (SIZE_T cachedSize = sizeCache->Lookup(functionAddress))
+            if (!extentIndex.Overlaps(begin, begin + cachedSize))
+                return cachedSize;
+#endif // !AA_NOSIZECACHE
+
+    // Otherwise follow the function's control flow
+    SIZE_T measuredSize = GetFunctionExtentLength(functionAddress, knownEntries);
+
+    // The tables win over the walk: code inside an indexed function isn't a function of its own, and a walk running into the next one ends there
+    if (measuredSize && extentIndex.Overlaps(begin, begin + measuredSize)) {
+        const FunctionRange* next = extentIndex.After(begin);
+        measuredSize = extentIndex.Find(begin) || !next ? 0 : next->begin - begin;
+    }
+
+#ifndef AA_NOSIZECACHE
+    if (sizeCache && measuredSize)
+        sizeCache->Store(functionAddress, measuredSize);
+#endif // !AA_NOSIZECACHE
+
+    return measuredSize;
+}
 
 bool Scudo::isEncryptedFunction(void* functionAddress) {
-    return encryptedFunctions.find(functionAddress) != encryptedFunctions.end();
+    return functionIndex.Find(functionAddress) != nullptr;
 }
 
 Scudo* Scudo::getEncryptedFunction(void* functionAddress) {
-    std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
-    auto it = encryptedFunctions.find(functionAddress);
-    if (it != encryptedFunctions.end()) {
-        return it->second;
-    }
-    return nullptr;
+    return functionIndex.Find(functionAddress);
 }
 
-Scudo* Scudo::returnAddressToFunction(void* returnAddress) {
-    std::lock_guard<std::mutex> lock(encryptedFunctionsMutex);
+Scudo* Scudo::getContainingFunction(void* address) {
+    return functionIndex.FindContaining(address);
+}
+
+void Scudo::publishFunctions() {
+    std::vector<registry::AddressIndex<Scudo>::Range> ranges;
+    ranges.reserve(encryptedFunctions.size());
     for (const auto& pair : encryptedFunctions) {
-        Scudo* encryptedFunction = pair.second;
-        if (encryptedFunction->lastReturnAddress == reinterpret_cast<uintptr_t>(returnAddress)) {
-            return encryptedFunction;
+        uintptr_t start = reinterpret_cast<uintptr_t>(pair.first);
+        ranges.push_back({ start, start + pair.second->functionSize, pair.second });
+    }
+
+    functionIndex.Publish(std::move(ranges));
+}
+
+void* Scudo::returnBreakpointRoutine(void* returnAddress, uintptr_t* stackPointer) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(returnAddress);
+
+    // The ret popped the slot right below the stack pointer, calls below it are over
+    uintptr_t* returnAddressPtr = stackPointer - 1;
+    releaseFrames(returnAddressPtr);
+
+    if (!returnFrames.empty()) {
+        ReturnFrame frame = returnFrames.back();
+        if ((frame.patched || frame.trapped) && frame.returnAddressPtr == returnAddressPtr && frame.returnAddress == address) {
+            returnFrames.pop_back();
+
+            void* resumeAddress = frame.trapped ? untrapReturn(address) : unpatchReturn(address);
+            frame.function->encryptionRoutine();
+            return resumeAddress;
         }
     }
-    return nullptr;
+
+    // A call of another thread or an outer call of this one returns there, or the caller's code reached the breakpoint another way
+    PatchedReturn* patched = patchedReturns.Find(address);
+    return patched ? patched->resume : nullptr;
 }
 
-void Scudo::encryptFunction(void* function, SIZE_T size) {
+bool Scudo::pageFaultRoutine(void* address) {
+    Scudo* encryptedFunction = getContainingFunction(address);
+    if (!encryptedFunction || !encryptedFunction->interior.Contains(address))
+        return false;
+
+    // Only the page reached is decrypted, it stays plaintext until the last call running the function returns
+    return encryptedFunction->decryptPage(encryptedFunction->interior.IndexOf(address));
+}
+
+void Scudo::releaseFrames(uintptr_t* returnAddressPtr) {
+    while (!returnFrames.empty() && returnFrames.back().returnAddressPtr < returnAddressPtr) {
+        ReturnFrame frame = returnFrames.back();
+        returnFrames.pop_back();
+
+        if (frame.trapped)
+            untrapReturn(frame.returnAddress);
+        else if (frame.patched)
+            unpatchReturn(frame.returnAddress);
+        frame.function->encryptionRoutine();
+    }
+}
+
+bool Scudo::patchReturn(uintptr_t returnAddress) {
+    PatchedReturn* patched = findReturn(returnAddress);
+    if (!patched)
+        return false;
+
+    std::lock_guard<std::mutex> lock(patched->mutex);
+    if (patched->references++ != 0)
+        return true;
 
     // Set the protection
-    MemoryProtect memFunction = MemoryProtect(functionAddress, functionSize, PAGE_EXECUTE_READWRITE);
+    protection::Writable memReturn(reinterpret_cast<void*>(returnAddress), sizeof(BYTE));
+
+    // Save instruction at return address and place illegal instruction
+    patched->originalByte = *reinterpret_cast<BYTE*>(returnAddress);
+    *memReturn.View(reinterpret_cast<BYTE*>(returnAddress)) = BREAKPOINT_BYTE;
+    return true;
+}
+
+void* Scudo::unpatchReturn(uintptr_t returnAddress) {
+    PatchedReturn* patched = patchedReturns.Find(returnAddress);
+    if (!patched)
+        return reinterpret_cast<void*>(returnAddress);
 
-    // Save the first byte for the function
-    this->firstByte = *static_cast<BYTE*>(function);
+    std::lock_guard<std::mutex> lock(patched->mutex);
+    if (patched->references == 0)
+        return reinterpret_cast<void*>(returnAddress);
 
-    // Skip the first byte and encrypt the rest
-    for (SIZE_T i = 1; i < size; ++i) {
-        BYTE* pByte = static_cast<BYTE*>(function) + i; // Get a pointer to the current byte in the function
-        *pByte = ~(*pByte);                             // Invert byte bits
-        *pByte ^= this->xorKey;                         // XOR the left shifted byte
+    // Other calls still return there
+    if (--patched->references != 0)
+        return patched->resume;
+
+    // Set the protection
+    protection::Writable memReturn(reinterpret_cast<void*>(returnAddress), sizeof(BYTE));
+
+    // Reset the return address to normal
+    *memReturn.View(reinterpret_cast<BYTE*>(returnAddress)) = patched->originalByte;
+    return reinterpret_cast<void*>(returnAddress);
+}
+
+bool Scudo::trapReturn([[maybe_unused]] uintptr_t returnAddress) {
+#ifdef AA_DEBUG_REGISTERS
+    // The caller's code is left alone, only this thread breaks there. Other returns there while it does resume in the copy
+    return findReturn(returnAddress) && debugtrap::ThreadTraps::Current().Arm(returnAddress);
+#else
+    return false;
+#endif // AA_DEBUG_REGISTERS
+}
+
+void* Scudo::untrapReturn(uintptr_t returnAddress) {
+#ifdef AA_DEBUG_REGISTERS
+    // An outer call of this thread still returns there
+    if (!debugtrap::ThreadTraps::Current().Disarm(returnAddress))
+        return patchedReturns.Find(returnAddress)->resume;
+#endif // AA_DEBUG_REGISTERS
+    return reinterpret_cast<void*>(returnAddress);
+}
+
+void Scudo::encryptFunction(void* function, SIZE_T size) {
+
+    // The interior pages of a paged function are encrypted one by one, the head is encrypted with the entry
+    SIZE_T head = interior ? interior.Begin() - static_cast<BYTE*>(function) : size;
+    {
+        // Set the protection, neighbouring functions share the pages
+        protection::Writable memFunction(function, head);
+
+        // Encrypt while the memory is writable
+        encryptBytes(function, head, memFunction.View(static_cast<BYTE*>(function)));
     }
 
+    if (!interior)
+        return;
+
+    // The tail shares its page with the code that follows the function, it stays executable
+    SIZE_T tail = static_cast<BYTE*>(function) + size - interior.End();
+    if (tail) {
+        protection::Writable memTail(interior.End(), tail);
+        cipher::Apply(this->algorithm, functionKey(), memTail.View(interior.End()), tail, interior.End() - static_cast<BYTE*>(function));
+    }
+
+    // Pages no call reached are still encrypted under their own key
+    for (size_t page = 0; page < interior.Count(); ++page)
+        encryptPage(page);
+}
+
+void Scudo::encryptBytes(void* function, SIZE_T size, BYTE* view) {
+
+    if (mode == AA_MODE_THUNK) {
+        // The entry stays a jmp to the stub, only the body behind it is encrypted
+        cipher::Apply(this->algorithm, functionKey(), view + thunk::JumpLength, size - thunk::JumpLength, thunk::JumpLength);
+
+        // Written once, calls may be running through it on the next encryptions
+        if (!thunk::IsJump(static_cast<BYTE*>(function), thunkSlot))
+            thunk::WriteJump(static_cast<BYTE*>(function), thunkSlot, view);
+        return;
+    }
+
+    // Save the first byte for the function, a relocated entry keeps its breakpoint between encryptions
+    if (*view != BREAKPOINT_BYTE)
+        this->firstByte = *view;
+
+    // Skip the first byte and encrypt the rest, the packer uses the same cipher
+    cipher::Encrypt(view, size, this->algorithm, functionKey());
+
     // Set the first byte to the debug byte
-    *static_cast<BYTE*>(functionAddress) = BREAKPOINT_BYTE;
+    *view = BREAKPOINT_BYTE;
 }
 
 void Scudo::decryptFunction(void* function, SIZE_T size) {
 
-    // Set the protection
-    MemoryProtect memFunction = MemoryProtect(function, size, PAGE_EXECUTE_READWRITE);
+    // The interior pages of a paged function are decrypted as calls reach them
+    SIZE_T head = interior ? interior.Begin() - static_cast<BYTE*>(function) : size;
+    {
+        // Set the protection, neighbouring functions share the pages
+        protection::Writable memFunction(function, head);
+        BYTE* view = memFunction.View(static_cast<BYTE*>(function));
+
+        if (mode == AA_MODE_THUNK) {
+            // The jmp to the stub stays on the entry
+            cipher::Apply(this->algorithm, functionKey(), view + thunk::JumpLength, head - thunk::JumpLength, thunk::JumpLength);
+        }
+        else {
+            // Restore the first byte of the function, calls enter a relocated entry through its copy instead
+            if (!relocatedEntry)
+                *view = this->firstByte;
+
+            // Skip the first byte and decrypt the rest
+            cipher::Decrypt(view, head, this->algorithm, functionKey());
+        }
+    }
+
+    SIZE_T tail = interior ? static_cast<BYTE*>(function) + size - interior.End() : 0;
+    if (tail) {
+        protection::Writable memTail(interior.End(), tail);
+        cipher::Apply(this->algorithm, functionKey(), memTail.View(interior.End()), tail, interior.End() - static_cast<BYTE*>(function));
+    }
+
+    // The master secret of this epoch is no longer needed by the function
+    cipher::KeySchedule::Global().Release(this->epoch);
+}
+
+void Scudo::splitPages() {
+    // The page of the entry stays readable, the entry breakpoint or jmp must be reached to count a call
+    interior = paging::Interior(functionAddress, functionSize, thunk::JumpLength, pagedMinPages);
+}
+
+void Scudo::encryptPage(size_t page) {
+    BYTE* address = interior.Address(page);
+    concurrency::PageLocks::Guard pages(concurrency::PageLocks::Global(), address, PAGE_LENGTH);
+
+    paging::Page& state = interior[page];
+    if (!state.plaintext.load(std::memory_order_acquire))
+        return;
 
-    // Restore the first byte of the function
-    *static_cast<BYTE*>(function) = this->firstByte;
+    // Each page moves to an epoch of its own, pages no call reached keep theirs
+    state.epoch = cipher::KeySchedule::Global().Acquire(state.epoch);
 
-    // Skip the first byte and decrypt the rest
-    for (SIZE_T i = 1; i < size; ++i) {
-        BYTE* pByte = static_cast<BYTE*>(function) + i; // Get a pointer to the current byte in the function
-        *pByte ^= this->xorKey;                         // XOR the right shifted byte
-        *pByte = ~(*pByte);                             // Invert byte bits
+    {
+        protection::Writable memPage(address, PAGE_LENGTH);
+        cipher::Apply(this->algorithm, cipher::KeySchedule::Global().Derive(functionAddress, state.epoch), memPage.View(address), PAGE_LENGTH, address - static_cast<BYTE*>(functionAddress));
     }
+
+    // The page rests inaccessible until a call reaches it again, before the calls waiting for the encryption enter
+    protection::Manager::Global().SetResting(address, PAGE_LENGTH, protection::NoAccess);
+    state.plaintext.store(false, std::memory_order_release);
+}
+
+bool Scudo::decryptPage(size_t page) {
+    BYTE* address = interior.Address(page);
+    concurrency::PageLocks::Guard pages(concurrency::PageLocks::Global(), address, PAGE_LENGTH);
+
+    // Another thread reaching the page decrypted it first
+    paging::Page& state = interior[page];
+    if (state.plaintext.load(std::memory_order_acquire))
+        return true;
+
+    {
+        protection::Writable memPage(address, PAGE_LENGTH);
+        if (!memPage)
+            return false;
+        cipher::Apply(this->algorithm, cipher::KeySchedule::Global().Derive(functionAddress, state.epoch), memPage.View(address), PAGE_LENGTH, address - static_cast<BYTE*>(functionAddress));
+    }
+
+    // Executable at once, threads faulting on the page meanwhile retry as soon as they get its lock
+    protection::Manager::Global().SetResting(address, PAGE_LENGTH, protection::ReadExecute);
+
+    // The master secret of the page epoch is no longer needed by it
+    cipher::KeySchedule::Global().Release(state.epoch);
+    state.plaintext.store(true, std::memory_order_release);
+    return true;
 }
 
 void Scudo::encryptionRoutine()
 {
-    // Set the protection
-    MemoryProtect memFunction = MemoryProtect((PVOID)currentEncryptedFunction->lastReturnAddress, sizeof(BYTE), PAGE_EXECUTE_READWRITE);
+    // Recursive calls and calls of other threads may still be running the body
+    if (!callState.Leave())
+        return;
 
-    // Reset the return address to normal
-    *static_cast<BYTE*>((PVOID)this->lastReturnAddress) = this->lastReturnAddressByte;
+    // Re-Encrypt the function, calls arriving meanwhile wait to decrypt it again
+    reencrypt();
+    callState.EndEncryption();
+}
 
-    // Generate a new key to ensure a new encryption
-    this->xorKey = randomKey();
+void Scudo::reencrypt() {
+    // Advance the epoch to ensure a new key, under the current master secret. Packed functions move to derived keys as well
+    this->algorithm = cipher::DefaultAlgorithm();
+    this->epoch = cipher::KeySchedule::Global().Acquire(this->epoch);
 
-    // Re-Encrypt the function
     this->encryptFunction(this->functionAddress, this->functionSize);
 }
 
-void Scudo::decryptionRoutine()
+void* Scudo::decryptionRoutine(uintptr_t* returnAddressPtr)
 {
-    // Set the protection
-    MemoryProtect memFunction = MemoryProtect((PVOID)currentEncryptedFunction->lastReturnAddress, sizeof(BYTE), PAGE_EXECUTE_READWRITE);
+    // Calls of this thread at or below this stack slot are over, an exception unwound them
+    releaseFrames(returnAddressPtr + 1);
 
-    // Save instruction at return address
-    currentEncryptedFunction->lastReturnAddressByte = *reinterpret_cast<BYTE*>(currentEncryptedFunction->lastReturnAddress);
+    // Calls of an epoch function aren't followed, it stays plaintext with its entry byte back until a sweep finds it idle
+    if (this->mode == AA_MODE_EPOCH) {
+        enterCall();
+        return functionAddress;
+    }
 
-    // Place illegal instruction at return address
-    *reinterpret_cast<BYTE*>(currentEncryptedFunction->lastReturnAddress) = BREAKPOINT_BYTE;
+    ReturnFrame frame = { this, *returnAddressPtr, returnAddressPtr, false, false };
+
+    // Break at the return address with a debug register, or place a breakpoint there. Calls whose return instruction can't be relocated use the trampoline
+    if (this->mode == AA_MODE_RETURN_PATCH) {
+        frame.trapped = trapReturn(frame.returnAddress);
+        if (!frame.trapped)
+            frame.patched = patchReturn(frame.returnAddress);
+    }
+
+    // Keep the return address on the shadow stack of this thread, the caller's code is never written
+    if (!frame.patched && !frame.trapped)
+        *returnAddressPtr = reinterpret_cast<uintptr_t>(&returnTrampoline);
+    returnFrames.push_back(frame);
 
     // Decrypt the function
-    currentEncryptedFunction->decryptFunction(currentEncryptedFunction->functionAddress, currentEncryptedFunction->functionSize);
+    enterCall();
+
+    return relocatedEntry ? relocatedEntry : functionAddress;
 }
 
-inline uint64_t Scudo::randomKey() {
+void Scudo::enterCall() {
+    // Only the first call running the body decrypts it, calls arriving meanwhile wait for it
+    if (!callState.Enter())
+        return;
+
+    decryptFunction(functionAddress, functionSize);
+    decryptedAt.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    callState.EndDecryption();
+}
+
+bool Scudo::installThunk() {
+#ifdef AA_CPU_X64
+    sizeExtendedState();
+    if (functionSize <= thunk::JumpLength)
+        return false;
+
+    BYTE* slot = thunk::SlotAllocator::Global().Allocate(functionAddress);
+    if (!slot)
+        return false;
 
-    // Encrypted array representing 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz
-    static unsigned char alphaNumericCharacters[] =
     {
+        // Stub memory is execute-read, other stubs on the page may be running
+        protection::Writable memSlot(slot, thunk::SlotSize);
+        if (!memSlot || !thunk::BuildSlot(slot, memSlot.View(slot), functionAddress, functionSize, this, reinterpret_cast<const void*>(&thunkEntry)))
+            return false;
+    }
 
-        0x4c, 0xc5, 0x45, 0xc2, 0x4a, 0xcb, 0x4b, 0xc8,
-        0x48, 0xd1, 0x2d, 0xad, 0x2a, 0xb2, 0x33, 0xb3,
-        0x30, 0xb0, 0x39, 0xb9, 0x36, 0xbe, 0x3f, 0xbf,
-        0x3c, 0xbc, 0x35, 0xb5, 0x32, 0xba, 0x3b, 0xbb,
-        0x38, 0xb8, 0x1, 0x81, 0xdd, 0x5d, 0xda, 0x22,
-        0xa3, 0x23, 0xa0, 0x20, 0x29, 0xa9, 0xa6, 0xae,
-        0x2f, 0xaf, 0x2c, 0xac, 0x25, 0xa5, 0xa2, 0xaa,
-        0x2b, 0xab, 0x28, 0xa8, 0x31, 0xb1, 0x74
-    };
+    std::memcpy(entryBytes, functionAddress, thunk::JumpLength);
+    thunkSlot = slot;
+    relocatedEntry = slot + thunk::StubLength;
+    return true;
+#else
+    return false;
+#endif // AA_CPU_X64
+}
 
-    // Prevent excessive math when generating a new key
-    static bool decrypted = false;
+void Scudo::relocateEntry() {
+#ifdef AA_CPU_X64
+    BYTE* slot = thunk::SlotAllocator::Global().Allocate(functionAddress);
+    if (!slot)
+        return;
 
-    // Decrypt the array upon first call
-    if (!decrypted) {
-        for (unsigned int index = 0; index < sizeof(alphaNumericCharacters); ++index)
-        {
-            unsigned char c = alphaNumericCharacters[index];
-            c = ~c;
-            c ^= 0x9d;
-            c = -c;
-            c = ~c;
-            c -= 0x46;
-            c = (c >> 0x7) | (c << 0x1);
-            c ^= 0xd;
-            c += index;
-            c = ~c;
-            c = -c;
-            c -= index;
-            c ^= 0xf8;
-            c -= 0x49;
-            c ^= 0x22;
-            c = -c;
-            alphaNumericCharacters[index] = c;
-        }
-        decrypted = true;
+    // Stub memory is execute-read, other slots on the page may be running
+    protection::Writable memSlot(slot, thunk::SlotSize);
+    SIZE_T copied = memSlot ? thunk::BuildResume(slot, memSlot.View(slot), thunk::SlotSize, functionAddress, functionSize, 1) : 0;
+
+    // A branch back to the entry would trap and be counted as a new call
+    if (copied && thunk::EntryIsUnreferenced(static_cast<BYTE*>(functionAddress), functionSize, copied))
+        relocatedEntry = slot;
+#endif // AA_CPU_X64
+}
+
+void Scudo::removeProtection() {
+    // Calls still running the body return through the trampoline, leaving must not encrypt it again
+    bool encrypted = false;
+    if (!callState.Release(encrypted))
+        return;
+
+    if (encrypted)
+        decryptFunction(functionAddress, functionSize);
+
+    // Interior pages may be encrypted whatever the phase, calls only decrypt the pages they reach
+    for (size_t page = 0; page < interior.Count(); ++page)
+        decryptPage(page);
+
+    if (relocatedEntry) {
+        // Set the protection
+        protection::Writable memFunction(functionAddress, thunk::JumpLength);
+
+        // Restore the entry the jmp or the breakpoint replaced, the slot itself is never released
+        if (mode == AA_MODE_THUNK)
+            std::memcpy(memFunction.View(functionAddress), entryBytes, thunk::JumpLength);
+        else
+            *memFunction.View(static_cast<BYTE*>(functionAddress)) = firstByte;
     }
 
-    // Initialize randomized information
-    std::random_device rd; 
-    std::mt19937_64 gen(rd()); 
-    std::uniform_int_distribution<> dis(0, sizeof(alphaNumericCharacters) - 2);
-    std::string key(KEY_LENGTH, ' '); 
+    // Calls that waited for the decryption enter the body
+    if (encrypted)
+        callState.EndDecryption();
+}
 
-    // Populate all characters in the key with random characters
-    for (char& c : key) 
-        c = alphaNumericCharacters[dis(gen)];
+cipher::Key Scudo::functionKey() const {
 
-    // Generate a new Xor Key value
-    uint64_t intValue = 1; 
-    for (char c : key) {
-        intValue *= 1000;
-        intValue += c;
+    // Keys of functions packed offline aren't derived, the packer drew them at random
+    if (cipher::KeySchedule::Generation(epoch) == cipher::KeySchedule::ExternalGeneration) {
+        cipher::Key key;
+        std::memcpy(key.bytes, packedTable()->entries[epoch & cipher::KeySchedule::CounterMask].key, sizeof(key.bytes));
+        return key;
     }
 
-    return intValue;
+    return cipher::KeySchedule::Global().Derive(functionAddress, epoch);
 }
\ No newline at end of file
@@ -3,15 +3,70 @@
 
 #define LAZY_IMPORTER_RESOLVE_FORWARDED_EXPORTS
 
+#include <span>
+#include <thread>
+#include <stop_token>
+#include <condition_variable>
 #include <AAInitialize.h>
+#ifdef _WIN32
 #include <A64LazyImporter.h>
+#endif // _WIN32
 #include <A64XorStr.h>
+#ifdef _WIN32
 #include <A64Protect.h>
-#include <A64Function.h>
+#endif // _WIN32
+#include <A64PageProtection.h>
+#include <A64Extent.h>
+#include <A64Cipher.h>
+#include <A64KeySchedule.h>
+#include <A64Packed.h>
+#include <A64Thunk.h>
+#include <A64Sync.h>
+#include <A64AddressIndex.h>
+#include <A64HashIndex.h>
+#include <A64Paging.h>
+#ifndef AA_NOSIZECACHE
+#include <A64SizeCache.h>
+#endif // !AA_NOSIZECACHE
+#ifdef AA_DEBUG_REGISTERS
+#include <A64DebugTrap.h>
+#endif // AA_DEBUG_REGISTERS
+#include <A64Sweep.h>
+#ifdef _WIN32
 #include "Callback/AACallback.h"
+#else
+#include "Signal/AASignal.h"
+#endif // _WIN32
+#include "Thunk/AAThunk.h"
 
 constexpr BYTE BREAKPOINT_BYTE = 0xCC; ///< Intel ICE debugging byte
-constexpr size_t KEY_LENGTH = 10; ///< Length of the random key
+constexpr SIZE_T PAGE_LENGTH = 0x1000; ///< Granularity of page protection changes
+
+#ifndef AA_KEY_ROTATION_SECONDS
+#define AA_KEY_ROTATION_SECONDS 300 ///< Interval between master secret rotations, 0 disables the rotation thread
+#endif // !AA_KEY_ROTATION_SECONDS
+
+// Define AA_DUAL_MAPPING to write protected code through a read-write alias of its pages instead of changing their protection
+
+// Define AA_DEBUG_REGISTERS to break at return addresses (AA_MODE_RETURN_PATCH) with a debug register of the calling thread instead of an INT3
+
+#ifndef AA_EPOCH_MILLISECONDS
+#define AA_EPOCH_MILLISECONDS 5 ///< Interval between sweeps re-encrypting the idle functions of AA_MODE_EPOCH
+#endif // !AA_EPOCH_MILLISECONDS
+
+#ifndef AA_PAGED_MIN_PAGES
+#define AA_PAGED_MIN_PAGES 0 ///< Functions spanning at least this many whole pages are decrypted page by page as calls reach them, 0 disables it
+#endif // !AA_PAGED_MIN_PAGES
+
+/**
+* @brief How calls to a protected function are intercepted.
+*/
+enum AA_PROTECTION_MODE {
+    AA_MODE_BREAKPOINT,    ///< INT3 on the entry, the function returns through a re-encryption trampoline, one exception per call
+    AA_MODE_THUNK,         ///< jmp on the entry to a stub that decrypts and re-encrypts in user mode, no exception (x64 only)
+    AA_MODE_RETURN_PATCH,  ///< INT3 on the entry and on the caller's return address, two exceptions per call. Exceptions may propagate out of the function
+    AA_MODE_EPOCH,         ///< INT3 on the entry only, the function stays plaintext until a sweep finds no thread running it, one exception per burst of calls
+};
 
 /**
 * @brief Library proxy for Scudo class initializer.
@@ -19,8 +74,26 @@ constexpr size_t KEY_LENGTH = 10; ///< Length of the random key
 * Places the function in the protected function list
 *
 * @param functionAddress The function pointer to be encrypted.
+* @param mode How calls are intercepted, functions whose entry can't be relocated fall back to AA_MODE_BREAKPOINT.
 */
-extern void AAPROTECT(void* functionAddress);
+extern void AAPROTECT(void* functionAddress, AA_PROTECTION_MODE mode = AA_MODE_BREAKPOINT);
+
+/**
+* @brief Library proxy for protecting many functions at once.
+*
+* Sizes the functions in parallel and encrypts them with one protection change per page range
+*
+* @param functionAddresses The function pointers to be encrypted.
+* @param mode How calls are intercepted, for every function of the batch.
+*/
+extern void AAPROTECT_MANY(std::span<void*> functionAddresses, AA_PROTECTION_MODE mode = AA_MODE_BREAKPOINT);
+
+/**
+* @brief Library proxy for registering the functions encrypted offline by scudo-pack.
+*
+* Must run before any packed function is called, their entry byte is an int3 in the image file.
+*/
+extern void AAPROTECT_PACKED();
 
 /**
 * @brief Library proxy to unprotect every function.
@@ -49,9 +122,22 @@ public:
      * Initializer for Scudo that encrypts the function and ensures all variables are set for decryption.
      *
      * @param functionAddress The function pointer to be encrypted.
+     * @param mode How calls are intercepted, falls back to AA_MODE_BREAKPOINT if the thunk can't be installed.
      * @throws std::invalid_argument If the function address or size is invalid.
      */
-    Scudo(void* functionAddress);
+    Scudo(void* functionAddress, AA_PROTECTION_MODE mode = AA_MODE_BREAKPOINT);
+
+    struct DeferEncryption {}; ///< Tag for objects whose function is encrypted by the caller
+
+    /**
+     * @brief Constructor for an already measured function, used by batch protection.
+     *
+     * Only sets the members, the caller installs the handler, registers and encrypts the function.
+     *
+     * @param functionAddress The function pointer to be encrypted.
+     * @param functionSize The measured size of the function.
+     */
+    Scudo(void* functionAddress, SIZE_T functionSize, DeferEncryption);
 
     /**
      * @brief Destructor for Scudo class.
@@ -65,9 +151,63 @@ public:
      */
     static void UnprotectAll();
 
+    /**
+     * @brief Protects many functions at once.
+     *
+     * Functions are sized in parallel, then encrypted with a single protection change per range of adjacent pages.
+     * Functions that are already protected are skipped.
+     *
+     * @param functionAddresses The function pointers to be encrypted.
+     * @param mode How calls are intercepted, for every function of the batch.
+     * @throws std::invalid_argument If a function can't be measured or overlaps another one. Nothing is encrypted then.
+     */
+    static void ProtectBatch(std::span<void* const> functionAddresses, AA_PROTECTION_MODE mode = AA_MODE_BREAKPOINT);
+
+    /**
+     * @brief Registers the functions listed in the packed table filled by scudo-pack.
+     *
+     * The functions are already encrypted in the image, so nothing is measured or encrypted.
+     * Does nothing if the image wasn't packed.
+     */
+    static void RegisterPacked();
+
+    /**
+     * @brief Installs the exception handler (instrumentation callback, or signal handler on Linux) if it isn't installed yet.
+     */
+    static void installHandler();
+
+    /**
+     * @brief Replaces the master secret function keys are derived from.
+     *
+     * Functions are re-keyed under the new secret at their next re-encryption.
+     */
+    static void RotateMasterSecret();
+
+    /**
+     * @brief Starts the thread rotating the master secret every AA_KEY_ROTATION_SECONDS.
+     *
+     * Does nothing when keys are reproducible (AA_KEYSEED) or the rotation is disabled.
+     */
+    static void startKeyRotation();
+
+    /**
+     * @brief Starts the thread sweeping the functions of AA_MODE_EPOCH every AA_EPOCH_MILLISECONDS, if it isn't running.
+     */
+    static void startSweeper();
+
+    /**
+     * @brief Re-encrypts the functions of AA_MODE_EPOCH plaintext for at least an epoch that no thread is running.
+     *
+     * Their entry breakpoints are planted first, then every other thread is examined once. Functions a thread may
+     * still be running stay plaintext until the next sweep. Entries and bodies are each written in one batch.
+     */
+    static void SweepEpoch();
+
     static std::vector<std::unique_ptr<Scudo>> protectedFunctions; ///< List of our protected functions to prevent class from going out of scope after initialization
     static std::unique_ptr<UserRequestHandler> userRequestHandler; ///< userRequestHandler
+    static SIZE_T pagedMinPages; ///< Whole pages a function must span to be paged, AA_PAGED_MIN_PAGES unless changed before protecting it
 
+#ifdef _WIN32
     /**
      * @brief Exception handler for handling and parsing ICE debug instructions placed on functions.
      *
@@ -75,6 +215,18 @@ public:
      * @return LONG Returns the exception handling status.
      */
     static LONG NTAPI ExceptionHandler(EXCEPTION_POINTERS* exceptionInfo);
+#else
+    /**
+     * @brief Signal handler for the traps and faults of protected functions on Linux. Async-signal-safe.
+     *
+     * Only looks the address up and resumes the thread in the matching entry of thunkIns.S, which handles the call.
+     *
+     * @param signal SIGTRAP or SIGSEGV.
+     * @param info The signal information.
+     * @param context The ucontext_t of the interrupted thread, its registers are written to resume it elsewhere.
+     */
+    static void SignalHandler(int signal, siginfo_t* info, void* context);
+#endif // _WIN32
 
     /**
      * @brief Checks if the address passed is the entry point to an already encrypted function.
@@ -94,12 +246,101 @@ public:
     static Scudo* getEncryptedFunction(void* functionAddress);
 
     /**
-     * @brief Returns the class object of the function encrypted with the specified return address.
+     * @brief Returns the class object of the encrypted function containing the passed address.
      *
-     * @param returnAddress The return address to retrieve the class object for.
-     * @return Scudo* Pointer to the Scudo object.
+     * @param address Any address inside the function.
+     * @return Scudo* Pointer to the Scudo object, nullptr if no encrypted function contains the address.
+     */
+    static Scudo* getContainingFunction(void* address);
+
+    /**
+     * @brief Publishes the map of encrypted functions to the index read by the handler, encryptedFunctionsMutex must be held.
+     */
+    static void publishFunctions();
+
+    /**
+     * @brief Routine for the handler when a breakpoint planted at a return address is hit (AA_MODE_RETURN_PATCH).
+     *
+     * Ends the call of this thread returning there, if any, and removes the breakpoint once no other call returns there.
+     *
+     * @param returnAddress The address of the breakpoint.
+     * @param stackPointer The stack pointer after the return.
+     * @return void* Address to resume at, nullptr if no breakpoint was planted there.
+     */
+    static void* returnBreakpointRoutine(void* returnAddress, uintptr_t* stackPointer);
+
+    /**
+     * @brief Routine for the handler when an inaccessible page of a paged function is read or executed.
+     *
+     * @param address The address the access faulted at.
+     * @return true If the page was decrypted, or another thread decrypted it meanwhile, and the access can be retried.
+     */
+    static bool pageFaultRoutine(void* address);
+
+    /**
+     * @brief Ends the calls of this thread whose return address slot is below the passed one.
+     *
+     * Their frames were unwound by an exception without returning.
+     *
+     * @param returnAddressPtr Stack slot of the return address of the call returning now.
+     */
+    static void releaseFrames(uintptr_t* returnAddressPtr);
+
+    /**
+     * @brief Plants a breakpoint at a return address, or counts one more call returning there.
+     *
+     * @return false If the instruction at the return address can't be relocated, the call must use the trampoline.
      */
-    static Scudo* returnAddressToFunction(void* returnAddress);
+    static bool patchReturn(uintptr_t returnAddress);
+
+    /**
+     * @brief Removes a call returning to a patched return address, and the breakpoint with the last one.
+     *
+     * @return void* Address to resume at, the relocated instruction while other calls still return there.
+     */
+    static void* unpatchReturn(uintptr_t returnAddress);
+
+    /**
+     * @brief Breaks at a return address with a debug register of the calling thread (AA_DEBUG_REGISTERS).
+     *
+     * @return false If no register is free or the instruction can't be relocated, the breakpoint is planted instead.
+     */
+    static bool trapReturn(uintptr_t returnAddress);
+
+    /**
+     * @brief Removes a call of this thread returning to a trapped return address, and the debug register with the last one.
+     *
+     * @return void* Address to resume at, the relocated instruction while an outer call of the thread still returns there.
+     */
+    static void* untrapReturn(uintptr_t returnAddress);
+
+    /**
+     * @brief Measures the function at the passed address.
+     *
+     * The function is looked up in the extent index of its module (.pdata / PDB / ELF symbols) first. Functions that
+     * aren't indexed take the size cached on disk by a previous run of the same binary, or are measured by following
+     * their control flow, treating the known entries as tail call targets. A cached size running into an indexed
+     * function is measured again, a measured one ends where the next indexed function begins and is rejected inside one.
+     *
+     * @param functionAddress The function to measure.
+     * @param knownEntries Entry points of other protected functions, sorted by address.
+     * @return SIZE_T The size of the function in bytes, 0 if it could not be measured.
+     */
+    static SIZE_T measureFunction(void* functionAddress, std::span<void* const> knownEntries);
+
+    /**
+     * @brief Returns the entry points of the protected functions sorted by address, encryptedFunctionsMutex must not be held.
+     */
+    static std::vector<void*> sortedProtectedEntries();
+
+    /**
+     * @brief Checks if the function shares bytes with a protected function, both would encrypt them under different keys.
+     *
+     * @param functionAddress The function to check.
+     * @param functionSize The size of the function.
+     * @param protectedEntries Entry points of the protected functions, sorted by address.
+     */
+    static bool overlapsProtected(void* functionAddress, SIZE_T functionSize, std::span<void* const> protectedEntries);
 
     /**
      * @brief Encrypts the function using B64 encryption.
@@ -110,7 +351,18 @@ public:
     void encryptFunction(void* function, SIZE_T size);
 
     /**
-     * @brief Decrypts the function by XORing with the debug byte.
+     * @brief Encrypts the function bytes, the memory must already be writable.
+     *
+     * @param function The function to encrypt.
+     * @param size The size of the function.
+     * @param view Where the function is written, from the protection::Writable held by the caller.
+     */
+    void encryptBytes(void* function, SIZE_T size, BYTE* view);
+
+    /**
+     * @brief Decrypts the function with its key and restores the entry byte.
+     *
+     * The interior pages of a paged function are left encrypted, calls decrypt them as they reach them.
      *
      * @param function The function to decrypt.
      * @param size The size of the function.
@@ -118,21 +370,80 @@ public:
     void decryptFunction(void* function, SIZE_T size);
 
     /**
-     * @brief Routine for the handler to re-encrypt the function immediately after it finishes executing.
+     * @brief Sets up the interior pages of the function if it spans at least pagedMinPages of them.
+     *
+     * Must run before the function is first encrypted.
+     */
+    void splitPages();
+
+    /**
+     * @brief Encrypts an interior page decrypted by a call and makes it inaccessible, under a new epoch of its own.
+     */
+    void encryptPage(size_t page);
+
+    /**
+     * @brief Decrypts an interior page and makes it executable again.
+     *
+     * @return false If the protection of the page couldn't be changed.
+     */
+    bool decryptPage(size_t page);
+
+    /**
+     * @brief Routine to end a call when it returns, re-encrypts the function once no call is running it.
      */
     void encryptionRoutine();
 
     /**
-     * @brief Routine for the handler to decrypt the function immediately after being called.
+     * @brief Routine for the handler to start a call, decrypts the function if no other call is running it.
+     *
+     * The call is recorded on the shadow stack of the thread. Its return address is swapped for the re-encryption
+     * trampoline, or gets a breakpoint or a debug register in AA_MODE_RETURN_PATCH.
+     *
+     * @param returnAddressPtr Stack slot holding the return address of the call.
+     * @return void* Address to resume at, the relocated entry when the entry keeps its breakpoint.
+     */
+    void* decryptionRoutine(uintptr_t* returnAddressPtr);
+
+    /**
+     * @brief Counts a call running the function, decrypts it for the first one.
+     */
+    void enterCall();
+
+    /**
+     * @brief Encrypts the function again under a new epoch, the caller owns the encryption of its call state.
      */
-    void decryptionRoutine();
+    void reencrypt();
 
     /**
-     * @brief Generates a new key every time the function needs to be re-encrypted.
+     * @brief Builds the stub of the function and its relocated entry, the function must still be plaintext.
      *
-     * @return uint64_t The generated random key.
+     * The jmp to the stub is written by encryptBytes.
+     *
+     * @return false If thunks aren't supported or the entry can't be relocated.
+     */
+    bool installThunk();
+
+    /**
+     * @brief Copies the first instruction of the function so its entry breakpoint can stay while calls run it.
+     *
+     * Every call then traps and is counted. Functions whose entry can't be relocated get their entry byte back
+     * while they run, and calls made meanwhile aren't counted.
+     */
+    void relocateEntry();
+
+    /**
+     * @brief Decrypts the function for good and restores its entry, unless a call is still running it.
+     */
+    void removeProtection();
+
+    /**
+     * @brief Returns the key the function is encrypted with.
+     *
+     * Derived from the master secret and the epoch, or read from the packed table for functions packed offline.
+     *
+     * @return cipher::Key The key of the current epoch.
      */
-    inline uint64_t randomKey();
+    cipher::Key functionKey() const;
 
     // For encryption and decryption
     void* functionAddress;     ///< Address of the function.
@@ -142,16 +453,48 @@ public:
     BYTE firstByte;            ///< First byte of the function.
 
     // For Encryption
-    uint64_t xorKey;           ///< XOR key for encryption.
-    uintptr_t lastReturnAddress; ///< Last return address for decryption.
-    BYTE lastReturnAddressByte; ///< Last return address byte for decryption.
+    cipher::Algorithm algorithm; ///< Cipher the function body is encrypted with.
+    uint32_t epoch;            ///< Master secret generation and counter the key is derived from, advanced at every re-encryption.
+
+    // For calls
+    AA_PROTECTION_MODE mode = AA_MODE_BREAKPOINT; ///< How calls to the function are intercepted.
+    BYTE* relocatedEntry = nullptr;     ///< Copy of the first instructions calls enter the body through, the entry keeps its breakpoint or jmp.
+    concurrency::CallState callState;          ///< Phase of the function and calls running it on any thread, released once it is decrypted for good.
+    std::atomic<std::chrono::steady_clock::rep> decryptedAt{ 0 }; ///< When the function was last decrypted, swept an epoch later in AA_MODE_EPOCH.
+
+    // For paged functions
+    paging::Interior interior;          ///< Whole pages inside the function, inaccessible while encrypted and decrypted one at a time, empty if it isn't paged.
+
+    // For thunk mode
+    BYTE* thunkSlot = nullptr;          ///< Stub of the function followed by its relocated entry.
+    BYTE entryBytes[thunk::JumpLength] = {}; ///< Entry bytes the jmp to the stub replaced.
+
+    struct ReturnFrame {
+        Scudo* function;                ///< Function the call entered.
+        uintptr_t returnAddress;        ///< Return address of the caller.
+        uintptr_t* returnAddressPtr;    ///< Stack slot of the return address.
+        bool patched;                   ///< The return address holds a breakpoint, otherwise the slot points at returnTrampoline.
+        bool trapped;                   ///< A debug register of the thread breaks at the return address instead.
+    };
+
+    struct PatchedReturn {
+        BYTE originalByte = 0;          ///< Byte the breakpoint replaced.
+        uint32_t references = 0;        ///< Calls returning to the address, on any thread, the breakpoint is planted while not 0.
+        BYTE* resume = nullptr;         ///< Relocated instruction at the address, run while the breakpoint stays.
+        std::mutex mutex;               ///< Serializes planting and removing the breakpoint.
+    };
 
     // For Handler
     static thread_local Scudo* currentEncryptedFunction; ///< Pointer to the currently selected encrypted function.
-    static EncryptedFunctionMap encryptedFunctions;      ///< Map of all encrypted functions.
+    static EncryptedFunctionMap encryptedFunctions;      ///< Map of all encrypted functions, written under encryptedFunctionsMutex.
+    static registry::AddressIndex<Scudo> functionIndex;  ///< Ranges of the encrypted functions, read by the handler without a lock.
     static std::atomic<bool> isExceptionHandlingInitialized; ///< Atomic bool to determine if the exception handler is already initialized.
     static std::mutex encryptedFunctionsMutex;              ///< Add mutex for thread safety
     static PVOID exceptionHandler;                          ///< Exception handler
+    static std::jthread keyRotationThread;                  ///< Thread rotating the master secret
+    static std::jthread sweeperThread;                      ///< Thread re-encrypting the idle functions of AA_MODE_EPOCH
+    static thread_local std::vector<ReturnFrame> returnFrames; ///< Shadow stack of the protected calls running on this thread, innermost last
+    static registry::HashIndex<PatchedReturn> patchedReturns; ///< Return addresses that held a breakpoint, looked up without a lock
 };
 
 #endif // SCUDO_H
\ No newline at end of file
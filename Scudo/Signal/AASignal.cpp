@@ -0,0 +1,65 @@
+#include "AASignal.h"
+
+namespace {
+    constexpr int handledSignals[] = { SIGTRAP, SIGSEGV, AA_SWEEP_SIGNAL };
+
+    struct sigaction previousActions[sizeof(handledSignals) / sizeof(handledSignals[0])]; // Handlers installed before ours, in the order of handledSignals
+
+    struct sigaction* previousAction(int signal) {
+        for (size_t index = 0; index < sizeof(handledSignals) / sizeof(handledSignals[0]); ++index)
+            if (handledSignals[index] == signal)
+                return &previousActions[index];
+        return nullptr;
+    }
+}
+
+bool InstallSignalHandler(bool installHandler, SignalRoutine routine) {
+
+    for (size_t index = 0; index < sizeof(handledSignals) / sizeof(handledSignals[0]); ++index) {
+        if (!installHandler) {
+            sigaction(handledSignals[index], &previousActions[index], nullptr);
+            continue;
+        }
+
+        // Faults on an exhausted stack are handled on the alternate stack, if the thread has one
+        struct sigaction action = {};
+        action.sa_sigaction = routine;
+        action.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+
+        if (sigaction(handledSignals[index], &action, &previousActions[index]) != 0)
+            return false;
+    }
+    return true;
+}
+
+void ChainSignal(int signal, siginfo_t* info, void* context) {
+    struct sigaction* previous = previousAction(signal);
+    if (!previous)
+        return;
+
+    if (previous->sa_flags & SA_SIGINFO) {
+        previous->sa_sigaction(signal, info, context);
+        return;
+    }
+
+    if (previous->sa_handler == SIG_IGN)
+        return;
+
+    if (previous->sa_handler != SIG_DFL) {
+        previous->sa_handler(signal);
+        return;
+    }
+
+    // A late sweep signal and signals ignored by default keep our handler, a real-time sweep signal would terminate the process
+    if (signal == AA_SWEEP_SIGNAL || signal == SIGURG || signal == SIGCHLD || signal == SIGWINCH)
+        return;
+
+    // A fault retries the access and faults again under the default action, a trap is already past its INT3 and a sent signal isn't retried
+    struct sigaction defaultAction = {};
+    defaultAction.sa_handler = SIG_DFL;
+    sigemptyset(&defaultAction.sa_mask);
+    sigaction(signal, &defaultAction, nullptr);
+    if (signal == SIGTRAP || info->si_code <= 0)
+        raise(signal);
+}
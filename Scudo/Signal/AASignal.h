@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <signal.h>
+#include <ucontext.h>
+
+#if !defined(__x86_64__)
+#error The signal backend reads and writes x86-64 registers
+#endif // !__x86_64__
+
+/*
+	Linux counterpart of the vectored exception handler.
+	SIGTRAP is raised by the INT3 of an entry or a patched return address, SIGSEGV by the inaccessible
+	pages of a paged function, and AA_SWEEP_SIGNAL is sent by the epoch sweeper. The handler only looks
+	the address up in the wait-free indexes and points the thread at an entry of thunkIns.S, it never
+	allocates or takes a lock. The call is then handled by that entry on the stack of the thread, once
+	the signal returned, like thunk mode calls.
+	Signals that aren't ours are passed on to the handlers installed before.
+*/
+
+// The Go runtime preempts its threads with SIGURG and takes over its handler, then no thread answers the sweeper and every
+// sweep times out. Processes running Go code, or anything else using SIGURG, define this to a free real-time signal such as 40
+#ifndef AA_SWEEP_SIGNAL
+#define AA_SWEEP_SIGNAL SIGURG ///< Sent by the epoch sweeper to every thread to scan its own stack, ignored by default if it arrives late
+#endif // !AA_SWEEP_SIGNAL
+
+// Windows names of the types the runtime is written with
+typedef std::uint8_t BYTE;
+typedef std::size_t SIZE_T;
+typedef void* PVOID;
+typedef void VOID;
+#define EXTERN_C extern "C"
+
+typedef void (*SignalRoutine)(int signal, siginfo_t* info, void* context);
+
+/**
+ * @brief Installs the routine for SIGTRAP, SIGSEGV and AA_SWEEP_SIGNAL, or restores the handlers installed before it.
+ */
+extern bool InstallSignalHandler(bool installHandler, SignalRoutine routine);
+
+/**
+ * @brief Passes a signal the routine didn't handle on to the handler installed before it. Async-signal-safe.
+ *
+ * Signals without a handler of their own get their default action, terminating the process.
+ */
+extern void ChainSignal(int signal, siginfo_t* info, void* context);
@@ -0,0 +1,30 @@
+#pragma once
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include "../Signal/AASignal.h"
+#endif // _WIN32
+#include <cstdint>
+
+/*
+	Dispatcher of the functions protected in thunk mode and shared return trampoline (thunkIns.asm).
+	thunkEntry is reached from the stub of a function with its Scudo object in r11. It calls
+	thunkEnterHandler, which decrypts the function and points the return address at returnTrampoline,
+	then enters the body. The entry trap of breakpoint mode swaps the return address the same way.
+	returnTrampoline calls returnHandler, which ends the call and hands back the return address of
+	the caller from the shadow stack of the thread. The function is re-encrypted once no call of any
+	thread is running it. The handlers are compiled code that may clear the upper halves of the vector
+	registers, every entry saves the whole register state the OS enables with xsave (fxsave without it).
+	On Linux the same entries are built from thunkIns.S, with the System V registers. The signal
+	handler does no work itself, it resumes the thread in thunkEntry for an entry trap, in
+	returnBreakpointEntry for a patched return address and in pageFaultEntry for an inaccessible
+	page of a paged function.
+*/
+
+EXTERN_C VOID thunkEntry(void);
+EXTERN_C VOID returnTrampoline(void);
+#ifndef _WIN32
+EXTERN_C VOID returnBreakpointEntry(void);
+EXTERN_C VOID pageFaultEntry(void);
+#endif // !_WIN32
+EXTERN_C std::uint64_t extendedStateSize; ///< Bytes xsave writes for the state the OS enables, 0 to save with fxsave
@@ -0,0 +1,119 @@
+extrn thunkEnterHandler : proc
+extrn returnHandler : proc
+
+; Saves the register state below rsp and aligns it, xsave covers the AVX state when the OS enables it. Clobbers rax and rdx
+SaveState MACRO
+	LOCAL fxsaveState, stateSaved
+	mov	rax, extendedStateSize
+	test	rax, rax
+	jz	fxsaveState
+	sub	rsp, rax
+	and	rsp, -64
+	xor	eax, eax
+	mov	[rsp+200h], rax ; The xsave header must be zero
+	mov	[rsp+208h], rax
+	mov	[rsp+210h], rax
+	mov	[rsp+218h], rax
+	mov	[rsp+220h], rax
+	mov	[rsp+228h], rax
+	mov	[rsp+230h], rax
+	mov	[rsp+238h], rax
+	mov	eax, -1
+	mov	edx, -1
+	xsave	[rsp]
+	jmp	stateSaved
+fxsaveState:
+	sub	rsp, 200h
+	and	rsp, -16
+	fxsave	[rsp]
+stateSaved:
+ENDM
+
+; Restores the state SaveState saved at rsp. Clobbers rax and rdx
+RestoreState MACRO
+	LOCAL fxrstorState, stateRestored
+	cmp	extendedStateSize, 0
+	je	fxrstorState
+	mov	eax, -1
+	mov	edx, -1
+	xrstor	[rsp]
+	jmp	stateRestored
+fxrstorState:
+	fxrstor	[rsp]
+stateRestored:
+ENDM
+
+.data
+
+; Bytes xsave writes for the state the OS enables, 0 to save with fxsave. Set before the first entry can run
+PUBLIC extendedStateSize
+extendedStateSize QWORD 0
+
+.code
+
+; Reached from the stub of a function, r11 holds its Scudo object and [rsp] the return address of the call
+thunkEntry PROC FRAME
+	push	rbp
+	.pushreg rbp
+	mov	rbp, rsp
+	.setframe rbp, 0
+	.endprolog
+
+	; backup argument registers, the saved state keeps xmm0 to xmm5 (__vectorcall) with their upper halves
+	sub	rsp, 20h
+	mov	[rbp-08h], rcx
+	mov	[rbp-10h], rdx
+	mov	[rbp-18h], r8
+	mov	[rbp-20h], r9
+	SaveState
+
+	sub	rsp, 20h ; Home space
+	mov	rcx, r11
+	lea	rdx, [rbp+8] ; Return address slot
+	call	thunkEnterHandler
+	mov	r11, rax
+	add	rsp, 20h
+
+	; restore argument registers
+	RestoreState
+	mov	rcx, [rbp-08h]
+	mov	rdx, [rbp-10h]
+	mov	r8, [rbp-18h]
+	mov	r9, [rbp-20h]
+	lea	rsp, [rbp]
+	pop	rbp
+
+	; Enter the body through its relocated entry, it returns to returnTrampoline
+	jmp	r11
+thunkEntry ENDP
+
+; A protected function returned here instead of to its caller, rax and xmm0 to xmm3 (__vectorcall) hold its return value
+returnTrampoline PROC FRAME
+	push	rax ; Slot for the return address of the caller
+	.pushreg rax
+	push	rbp
+	.pushreg rbp
+	mov	rbp, rsp
+	.setframe rbp, 0
+	.endprolog
+
+	; backup return registers, the saved state keeps the upper halves of __m256 results
+	sub	rsp, 10h
+	mov	[rbp-08h], rax
+	SaveState
+
+	sub	rsp, 20h ; Home space
+	lea	rcx, [rbp+8] ; Slot the return address was popped from
+	call	returnHandler
+	mov	[rbp+8], rax
+	add	rsp, 20h
+
+	; restore return registers
+	RestoreState
+	mov	rax, [rbp-08h]
+	lea	rsp, [rbp]
+	pop	rbp
+	ret
+returnTrampoline ENDP
+
+END
@@ -0,0 +1,559 @@
+/*
+    scudo-pack: encrypts functions of a linked image ahead of time.
+
+    Usage: scudo-pack <image> <manifest> [-o <output>] [--pdb <pdb>] [--cipher aes|chacha20|xor]
+
+    The manifest lists one function per line, either as a hexadecimal RVA (0x1234) or as a
+    symbol name (ELF symbol tables, PE exports). Blank lines and lines starting with # are ignored.
+
+    Every listed function is measured, its entry byte is replaced by int3 and its body is
+    encrypted in the file with a key of its own (AES-128 CTR unless --cipher says otherwise).
+    The keys, sizes and entry bytes are written to the packed table reserved by the runtime
+    in the .scudo section, AAPROTECT_PACKED registers them at startup.
+*/
+
+// The packer always uses the built-in length decoder, it has no capstone dependency
+#ifndef AA_NOCAPSTONE
+#define AA_NOCAPSTONE
+#endif // !AA_NOCAPSTONE
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <optional>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // _WIN32
+
+#include <A64Extent.h>
+#include <A64ExtentIndex.h>
+#include <A64Cipher.h>
+#include <A64KeyPool.h>
+#include <A64Packed.h>
+
+namespace {
+    constexpr uint8_t BREAKPOINT_BYTE = 0xCC;
+    constexpr size_t VIEW_PADDING = 0x1000; ///< Readable bytes around the laid out image, sizing looks behind entries
+
+    struct Section {
+        std::string name;
+        uint64_t rva;
+        uint64_t virtualSize;
+        uint64_t fileOffset;
+        uint64_t fileSize;
+    };
+
+    /*
+        A linked image read from disk, with its sections laid out at their RVAs in a view
+        so the sizing code can work on it like on a loaded module.
+    */
+    struct Image {
+        std::vector<uint8_t> file;
+        std::vector<Section> sections;
+        bool pe = false;
+        bool x64 = false;
+        uint64_t viewBegin = 0;                      ///< Lowest RVA in the view
+        std::vector<uint8_t> view;
+        std::vector<uint64_t> relocations;           ///< Sorted RVAs of every relocated field
+        std::vector<std::pair<std::string, uint64_t>> symbols;
+
+        uint8_t* At(uint64_t rva) { return view.data() + VIEW_PADDING + (rva - viewBegin); }
+
+        bool InView(uint64_t rva, uint64_t size) const {
+            return rva >= viewBegin && rva - viewBegin <= view.size() - 2 * VIEW_PADDING && size <= view.size() - 2 * VIEW_PADDING - (rva - viewBegin);
+        }
+
+        /**
+         * @brief Returns the file offset of [rva, rva + size) if it is file backed within one section.
+         */
+        std::optional<uint64_t> FileOffset(uint64_t rva, uint64_t size) const {
+            for (const Section& section : sections) {
+                if (rva >= section.rva && rva - section.rva + size <= section.fileSize)
+                    return section.fileOffset + (rva - section.rva);
+            }
+            return std::nullopt;
+        }
+
+        const Section* FindSection(const char* name) const {
+            for (const Section& section : sections)
+                if (section.name == name)
+                    return &section;
+            return nullptr;
+        }
+
+        bool HasRelocation(uint64_t rva, uint64_t size) const {
+            // A relocated pointer that starts up to 7 bytes before the function still overlaps it
+            uint64_t begin = rva >= 7 ? rva - 7 : 0;
+            auto it = std::lower_bound(relocations.begin(), relocations.end(), begin);
+            return it != relocations.end() && *it < rva + size;
+        }
+    };
+
+    template<typename T>
+    bool Read(const std::vector<uint8_t>& file, uint64_t offset, T& value) {
+        if (offset > file.size() || sizeof(T) > file.size() - offset)
+            return false;
+        std::memcpy(&value, file.data() + offset, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Writes the file next to the path, then moves it over the path once it is on disk.
+     *
+     * A failed or short write leaves the original file untouched, even when the image is packed in place.
+     */
+    bool WriteReplacing(const char* path, const std::vector<uint8_t>& contents) {
+        uint64_t suffix;
+        cipher::SystemEntropy(reinterpret_cast<uint8_t*>(&suffix), sizeof(suffix));
+        char name[32];
+        std::snprintf(name, sizeof(name), ".%016llx.tmp", static_cast<unsigned long long>(suffix));
+        std::string temporary = std::string(path) + name;
+
+        // Created exclusively, a file or link planted under the name is never written through
+        FILE* file = std::fopen(temporary.c_str(), "wbx");
+        if (!file)
+            return false;
+
+        bool written = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size() && std::fflush(file) == 0;
+#ifdef _WIN32
+        written = written && _commit(_fileno(file)) == 0;
+#else
+        written = written && fsync(fileno(file)) == 0;
+#endif // _WIN32
+        written = std::fclose(file) == 0 && written;
+
+        // An image packed in place keeps its permissions, the executable bit in particular
+        std::error_code error;
+        std::filesystem::file_status original = std::filesystem::status(path, error);
+        if (written && std::filesystem::exists(original))
+            std::filesystem::permissions(temporary, original.permissions(), error);
+        error.clear();
+
+        if (written)
+            std::filesystem::rename(temporary, path, error);
+        if (!written || error) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void LayoutView(Image& image) {
+        uint64_t begin = UINT64_MAX, end = 0;
+        for (const Section& section : image.sections) {
+            begin = (std::min)(begin, section.rva);
+            end = (std::max)(end, section.rva + (std::max)(section.virtualSize, section.fileSize));
+        }
+        if (begin > end)
+            begin = end = 0;
+
+        image.viewBegin = begin;
+        image.view.assign(VIEW_PADDING + (end - begin) + VIEW_PADDING, 0);
+        for (const Section& section : image.sections) {
+            if (section.fileOffset + section.fileSize <= image.file.size())
+                std::memcpy(image.At(section.rva), image.file.data() + section.fileOffset, section.fileSize);
+        }
+    }
+
+    /*
+        PE
+    */
+    bool LoadPe(Image& image, std::string& error) {
+        uint32_t ntOffset = 0, signature = 0;
+        uint16_t machine = 0, sectionCount = 0, optionalSize = 0, magic = 0;
+        if (!Read(image.file, 0x3C, ntOffset) || !Read(image.file, ntOffset, signature) || signature != 0x00004550
+            || !Read(image.file, ntOffset + 4, machine) || !Read(image.file, ntOffset + 6, sectionCount)
+            || !Read(image.file, ntOffset + 20, optionalSize) || !Read(image.file, ntOffset + 24, magic)) {
+            error = "invalid PE headers";
+            return false;
+        }
+
+        if (machine != 0x8664 && machine != 0x14C) {
+            error = "unsupported PE machine";
+            return false;
+        }
+
+        image.pe = true;
+        image.x64 = machine == 0x8664;
+
+        uint64_t optional = ntOffset + 24;
+        uint64_t directories = optional + (magic == 0x20B ? 112 : 96);
+        uint64_t sectionTable = optional + optionalSize;
+
+        for (uint16_t index = 0; index < sectionCount; ++index) {
+            char name[9] = {};
+            uint32_t virtualSize, rva, rawSize, rawOffset;
+            uint64_t header = sectionTable + index * 40ull;
+            if (!Read(image.file, header + 8, virtualSize) || !Read(image.file, header + 12, rva)
+                || !Read(image.file, header + 16, rawSize) || !Read(image.file, header + 20, rawOffset)) {
+                error = "truncated section table";
+                return false;
+            }
+            std::memcpy(name, image.file.data() + header, 8);
+            image.sections.push_back({ name, rva, virtualSize, rawOffset, (std::min)(rawSize, virtualSize ? virtualSize : rawSize) });
+        }
+        LayoutView(image);
+
+        // Base relocations: blocks of { page RVA, block size, u16 type:4 offset:12 }
+        uint32_t relocationRva = 0, relocationSize = 0;
+        Read(image.file, directories + 5 * 8, relocationRva);
+        Read(image.file, directories + 5 * 8 + 4, relocationSize);
+        if (auto offset = image.FileOffset(relocationRva, relocationSize); offset && relocationSize) {
+            for (uint64_t block = *offset; block + 8 <= *offset + relocationSize;) {
+                uint32_t page = 0, blockSize = 0;
+                Read(image.file, block, page);
+                Read(image.file, block + 4, blockSize);
+                if (blockSize < 8)
+                    break;
+                for (uint64_t entry = block + 8; entry + 2 <= block + blockSize; entry += 2) {
+                    uint16_t value = 0;
+                    Read(image.file, entry, value);
+                    if (value >> 12)
+                        image.relocations.push_back(page + (value & 0xFFF));
+                }
+                block += blockSize;
+            }
+        }
+        std::sort(image.relocations.begin(), image.relocations.end());
+
+        // Export names
+        uint32_t exportRva = 0, exportSize = 0;
+        Read(image.file, directories, exportRva);
+        Read(image.file, directories + 4, exportSize);
+        if (exportRva && exportSize && image.InView(exportRva, 40)) {
+            uint8_t* directory = image.At(exportRva);
+            uint32_t nameCount, functionsRva, namesRva, ordinalsRva;
+            std::memcpy(&nameCount, directory + 24, 4);
+            std::memcpy(&functionsRva, directory + 28, 4);
+            std::memcpy(&namesRva, directory + 32, 4);
+            std::memcpy(&ordinalsRva, directory + 36, 4);
+            for (uint32_t index = 0; index < nameCount && image.InView(namesRva + index * 4ull, 4) && image.InView(ordinalsRva + index * 2ull, 2); ++index) {
+                uint32_t nameRva, functionRva;
+                uint16_t ordinal;
+                std::memcpy(&nameRva, image.At(namesRva + index * 4ull), 4);
+                std::memcpy(&ordinal, image.At(ordinalsRva + index * 2ull), 2);
+                if (!image.InView(functionsRva + ordinal * 4ull, 4) || !image.InView(nameRva, 1))
+                    continue;
+                std::memcpy(&functionRva, image.At(functionsRva + ordinal * 4ull), 4);
+                image.symbols.push_back({ reinterpret_cast<const char*>(image.At(nameRva)), functionRva });
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Builds the .pdata index of a PE image laid out in its view.
+     */
+    FunctionExtentIndex PeExtentIndex(Image& image) {
+        FunctionExtentIndex index;
+        uint32_t ntOffset = 0, exceptionRva = 0, exceptionSize = 0;
+        uint16_t magic = 0;
+        Read(image.file, 0x3C, ntOffset);
+        Read(image.file, ntOffset + 24, magic);
+        uint64_t directories = ntOffset + 24 + (magic == 0x20B ? 112 : 96);
+        Read(image.file, directories + 3 * 8, exceptionRva);
+        Read(image.file, directories + 3 * 8 + 4, exceptionSize);
+        if (!image.x64 || !exceptionRva || !image.InView(exceptionRva, exceptionSize))
+            return index;
+
+        // x64: { BeginAddress, EndAddress, UnwindInfoAddress }, chained entries continue the previous one
+        uint64_t previousEnd = 0;
+        uint64_t chainBegin = 0;
+        for (uint64_t entry = exceptionRva; entry + 12 <= uint64_t(exceptionRva) + exceptionSize; entry += 12) {
+            uint32_t function[3];
+            std::memcpy(function, image.At(entry), sizeof(function));
+            bool chained = image.InView(function[2] & ~1u, 1) && (*image.At(function[2] & ~1u) >> 3) & 0x4;
+            if (!(chained && previousEnd == function[0]))
+                chainBegin = function[0];
+            index.Add(reinterpret_cast<uintptr_t>(image.At(chainBegin)), reinterpret_cast<uintptr_t>(image.At(function[1])));
+            previousEnd = function[1];
+        }
+        index.Finalize();
+        return index;
+    }
+
+    /*
+        ELF
+    */
+    bool LoadElf(Image& image, std::string& error) {
+        elf::File file(image.file.data(), image.file.size());
+        if (!file.Valid()) {
+            error = "only ELF64 images are supported";
+            return false;
+        }
+        if (file.GetHeader()->type != 2 && file.GetHeader()->type != 3) {
+            error = "only linked executables and shared objects can be packed";
+            return false;
+        }
+        if (file.GetHeader()->machine != 62) {
+            error = "unsupported ELF machine";
+            return false;
+        }
+        image.x64 = true;
+
+        constexpr uint64_t SectionAlloc = 0x2;
+        constexpr uint32_t SectionNoBits = 8, SectionRela = 4, SectionRel = 9;
+
+        for (const elf::SectionHeader& section : file.Sections()) {
+            if (!(section.flags & SectionAlloc))
+                continue;
+            image.sections.push_back({ file.SectionName(section), section.addr, section.size, section.offset, section.type == SectionNoBits ? 0 : section.size });
+        }
+        LayoutView(image);
+
+        // Dynamic relocations, ET_REL objects were rejected above
+        for (const elf::SectionHeader& section : file.Sections()) {
+            if (!(section.flags & SectionAlloc) || (section.type != SectionRela && section.type != SectionRel))
+                continue;
+            size_t entrySize = section.type == SectionRela ? 24 : 16;
+            for (uint64_t entry = section.offset; entry + entrySize <= section.offset + section.size; entry += entrySize) {
+                uint64_t offset;
+                if (Read(image.file, entry, offset))
+                    image.relocations.push_back(offset);
+            }
+        }
+        std::sort(image.relocations.begin(), image.relocations.end());
+
+        for (const elf::SectionHeader& section : file.Sections()) {
+            if (section.type != elf::SectionSymtab && section.type != elf::SectionDynsym)
+                continue;
+            const elf::SectionHeader& strings = file.Sections()[section.link < file.Sections().size() ? section.link : 0];
+            for (const elf::Symbol& symbol : file.Contents<elf::Symbol>(section)) {
+                if ((symbol.info & 0xF) == elf::SymbolFunction && symbol.shndx != 0 && file.Contains(strings.offset, symbol.name + 1))
+                    image.symbols.push_back({ reinterpret_cast<const char*>(image.file.data() + strings.offset + symbol.name), symbol.value });
+            }
+        }
+        return true;
+    }
+
+    /*
+        Packing
+    */
+    bool ResolveManifest(Image& image, const char* path, std::vector<uint64_t>& functions) {
+        std::ifstream manifest(path);
+        if (!manifest) {
+            std::fprintf(stderr, "scudo-pack: can't open manifest %s\n", path);
+            return false;
+        }
+
+        bool resolved = true;
+        for (std::string line; std::getline(manifest, line);) {
+            line.erase(std::remove_if(line.begin(), line.end(), [](char c) { return c == '\r' || c == ' ' || c == '\t'; }), line.end());
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            if (line.rfind("0x", 0) == 0) {
+                functions.push_back(std::stoull(line, nullptr, 16));
+                continue;
+            }
+
+            auto symbol = std::find_if(image.symbols.begin(), image.symbols.end(), [&](const auto& entry) { return entry.first == line; });
+            if (symbol == image.symbols.end()) {
+                std::fprintf(stderr, "scudo-pack: symbol %s not found\n", line.c_str());
+                resolved = false;
+                continue;
+            }
+            functions.push_back(symbol->second);
+        }
+
+        std::sort(functions.begin(), functions.end());
+        functions.erase(std::unique(functions.begin(), functions.end()), functions.end());
+        return resolved;
+    }
+
+    /**
+     * @brief PE image checksum, only updated if the image had one.
+     */
+    void UpdatePeChecksum(std::vector<uint8_t>& file) {
+        uint32_t ntOffset = 0, checksum = 0;
+        Read(file, 0x3C, ntOffset);
+        uint64_t checksumOffset = ntOffset + 24 + 64;
+        if (!Read(file, checksumOffset, checksum) || !checksum)
+            return;
+
+        uint64_t sum = 0;
+        for (uint64_t offset = 0; offset < file.size(); offset += 2) {
+            if (offset == checksumOffset || offset == checksumOffset + 2)
+                continue;
+            uint16_t word = file[offset] | (offset + 1 < file.size() ? file[offset + 1] << 8 : 0);
+            sum += word;
+            sum = (sum & 0xFFFF) + (sum >> 16);
+        }
+        checksum = static_cast<uint32_t>(((sum & 0xFFFF) + (sum >> 16)) & 0xFFFF) + static_cast<uint32_t>(file.size());
+        std::memcpy(file.data() + checksumOffset, &checksum, sizeof(checksum));
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* input = nullptr;
+    const char* manifestPath = nullptr;
+    const char* output = nullptr;
+    const char* pdbPath = nullptr;
+    cipher::Algorithm algorithm = cipher::Algorithm::AesCtr;
+
+    for (int index = 1; index < argc; ++index) {
+        if (!std::strcmp(argv[index], "-o") && index + 1 < argc)
+            output = argv[++index];
+        else if (!std::strcmp(argv[index], "--pdb") && index + 1 < argc)
+            pdbPath = argv[++index];
+        else if (!std::strcmp(argv[index], "--cipher") && index + 1 < argc) {
+            const char* name = argv[++index];
+            if (!std::strcmp(name, "aes"))
+                algorithm = cipher::Algorithm::AesCtr;
+            else if (!std::strcmp(name, "chacha20"))
+                algorithm = cipher::Algorithm::ChaCha20;
+            else if (!std::strcmp(name, "xor"))
+                algorithm = cipher::Algorithm::Xor;
+            else {
+                std::fprintf(stderr, "scudo-pack: unknown cipher %s\n", name);
+                return 2;
+            }
+        }
+        else if (!input)
+            input = argv[index];
+        else if (!manifestPath)
+            manifestPath = argv[index];
+    }
+
+    if (!input || !manifestPath) {
+        std::fprintf(stderr, "usage: scudo-pack <image> <manifest> [-o <output>] [--pdb <pdb>] [--cipher aes|chacha20|xor]\n");
+        return 2;
+    }
+
+    Image image;
+    {
+        std::ifstream stream(input, std::ios::binary);
+        image.file.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    std::string error;
+    bool loaded = image.file.size() >= 2 && image.file[0] == 'M' && image.file[1] == 'Z' ? LoadPe(image, error) : LoadElf(image, error);
+    if (!loaded) {
+        std::fprintf(stderr, "scudo-pack: %s: %s\n", input, error.c_str());
+        return 1;
+    }
+
+    // Locate the table reserved by the runtime
+    const Section* tableSection = image.FindSection(packed::SectionName);
+    std::optional<uint64_t> tableOffset;
+    packed::Header header{};
+    for (uint64_t offset = 0; tableSection && offset + sizeof(header) <= tableSection->fileSize; offset += 4) {
+        Read(image.file, tableSection->fileOffset + offset, header);
+        if (header.magic == packed::Magic) {
+            tableOffset = tableSection->fileOffset + offset;
+            break;
+        }
+    }
+    if (!tableOffset || header.version != packed::Version || header.entrySize != sizeof(packed::Entry)
+        || *tableOffset + sizeof(header) + uint64_t(header.capacity) * sizeof(packed::Entry) > tableSection->fileOffset + tableSection->fileSize) {
+        std::fprintf(stderr, "scudo-pack: %s: no packed table, is Scudo linked in?\n", input);
+        return 1;
+    }
+    if (header.count) {
+        std::fprintf(stderr, "scudo-pack: %s: image is already packed\n", input);
+        return 1;
+    }
+
+    std::vector<uint64_t> functions;
+    if (!ResolveManifest(image, manifestPath, functions))
+        return 1;
+
+    if (functions.size() > header.capacity) {
+        std::fprintf(stderr, "scudo-pack: %zu functions listed, the table holds %u (AA_PACKED_CAPACITY)\n", functions.size(), header.capacity);
+        return 1;
+    }
+
+    // Size with the PDB, then the unwind / symbol tables, then by following the control flow
+    FunctionExtentIndex pdbIndex = pdbPath ? FunctionExtentIndex::FromPdbPath(pdbPath, reinterpret_cast<uintptr_t>(image.At(0))) : FunctionExtentIndex();
+    FunctionExtentIndex imageIndex = image.pe ? PeExtentIndex(image)
+        : FunctionExtentIndex::FromElfFile(elf::File(image.file.data(), image.file.size()), reinterpret_cast<uintptr_t>(image.At(0)));
+
+    // Listed functions and those of the tables end the control flow walk, the view isn't a loaded module it could query
+    std::vector<void*> knownEntries;
+    for (uint64_t rva : functions)
+        knownEntries.push_back(image.At(rva));
+    for (const FunctionExtentIndex* index : { &pdbIndex, &imageIndex })
+        for (const FunctionRange& range : index->Entries())
+            knownEntries.push_back(reinterpret_cast<void*>(range.begin));
+    std::sort(knownEntries.begin(), knownEntries.end(), std::less<void*>());
+    knownEntries.erase(std::unique(knownEntries.begin(), knownEntries.end()), knownEntries.end());
+
+    // Jump tables are read within the sections laid out in the view
+    std::vector<FunctionRange> sections;
+    for (const Section& section : image.sections)
+        sections.push_back({ reinterpret_cast<uintptr_t>(image.At(section.rva)), reinterpret_cast<uintptr_t>(image.At(section.rva)) + (std::max)(section.virtualSize, section.fileSize) });
+
+    std::vector<packed::Entry> entries;
+    uint64_t previousEnd = 0;
+
+    for (uint64_t rva : functions) {
+        if (!image.InView(rva, 1)) {
+            std::fprintf(stderr, "scudo-pack: skipping 0x%llx, it is outside the image\n", static_cast<unsigned long long>(rva));
+            continue;
+        }
+
+        void* function = image.At(rva);
+        size_t size = pdbIndex.Size(function);
+        if (!size)
+            size = imageIndex.Size(function);
+        if (!size)
+            size = image.x64 ? GetFunctionExtentLength<ArchX64>(function, knownEntries, sections) : GetFunctionExtentLength<ArchX86>(function, knownEntries, sections);
+
+        std::optional<uint64_t> offset = image.FileOffset(rva, size);
+        if (!size || !offset) {
+            std::fprintf(stderr, "scudo-pack: skipping 0x%llx, it can't be measured\n", static_cast<unsigned long long>(rva));
+            continue;
+        }
+        if (image.HasRelocation(rva, size)) {
+            std::fprintf(stderr, "scudo-pack: skipping 0x%llx, it contains relocations\n", static_cast<unsigned long long>(rva));
+            continue;
+        }
+        if (rva < previousEnd) {
+            std::fprintf(stderr, "scudo-pack: skipping 0x%llx, it overlaps the previous function\n", static_cast<unsigned long long>(rva));
+            continue;
+        }
+        previousEnd = rva + size;
+
+        packed::Entry entry{};
+        entry.rva = static_cast<uint32_t>(rva);
+        entry.size = static_cast<uint32_t>(size);
+        entry.algorithm = static_cast<uint8_t>(algorithm);
+
+        cipher::Key key = cipher::KeyPool::Local().Next();
+        std::memcpy(entry.key, key.bytes, sizeof(entry.key));
+
+        // Same transform as Scudo::encryptBytes
+        uint8_t* bytes = image.file.data() + *offset;
+        entry.firstByte = bytes[0];
+        cipher::Encrypt(bytes, size, algorithm, key);
+        bytes[0] = BREAKPOINT_BYTE;
+
+        entries.push_back(entry);
+    }
+
+    header.count = static_cast<uint32_t>(entries.size());
+    std::memcpy(image.file.data() + *tableOffset, &header, sizeof(header));
+    std::memcpy(image.file.data() + *tableOffset + sizeof(header), entries.data(), entries.size() * sizeof(packed::Entry));
+
+    if (image.pe)
+        UpdatePeChecksum(image.file);
+
+    const char* destination = output ? output : input;
+    if (!WriteReplacing(destination, image.file)) {
+        std::fprintf(stderr, "scudo-pack: can't write %s\n", destination);
+        return 1;
+    }
+
+    std::printf("scudo-pack: %zu of %zu functions encrypted in %s\n", entries.size(), functions.size(), destination);
+    return entries.size() == functions.size() ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+#include <cstring>
+#include <vector>
+#include <A64Cipher.h>
+#include <A64KeyPool.h>
+#include <A64KeySchedule.h>
+#include "ScudoTest.h"
+
+namespace {
+    struct NamedKernel {
+        const char* name;
+        cipher::Kernel kernel;
+    };
+
+    // XOR kernels this CPU can run, the scalar loop first
+    std::vector<NamedKernel> SupportedKernels() {
+        std::vector<NamedKernel> supported = { { "scalar", cipher::kernels::Scalar } };
+#ifdef AA_CPU_X64
+        supported.push_back({ "sse2", cipher::kernels::Sse2 });
+        if (cpu::Supported().avx2)
+            supported.push_back({ "avx2", cipher::kernels::Avx2 });
+        if (cpu::Supported().avx512)
+            supported.push_back({ "avx512", cipher::kernels::Avx512 });
+#elif defined(AA_CPU_ARM64)
+        supported.push_back({ "neon", cipher::kernels::Neon });
+#endif // AA_CPU_X64
+        return supported;
+    }
+
+    constexpr cipher::Algorithm Algorithms[] = { cipher::Algorithm::Xor, cipher::Algorithm::AesCtr, cipher::Algorithm::ChaCha20 };
+    constexpr const char* AlgorithmNames[] = { "xor", "aes-ctr", "chacha20" };
+
+    /**
+     * @brief Parses a hex string of published test vector bytes.
+     */
+    std::vector<std::uint8_t> Hex(const char* text) {
+        std::vector<std::uint8_t> bytes;
+        for (; text[0] && text[1]; text += 2) {
+            auto digit = [](char c) { return static_cast<std::uint8_t>(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10); };
+            bytes.push_back(static_cast<std::uint8_t>(digit(text[0]) << 4 | digit(text[1])));
+        }
+        return bytes;
+    }
+
+    bool Equals(const std::uint8_t* actual, const std::vector<std::uint8_t>& expected) {
+        return std::memcmp(actual, expected.data(), expected.size()) == 0;
+    }
+
+    // FIPS-197 C.1, and the all-zero key and block (the first vector of the AESAVS known-answer tests)
+    const char* AesKey = "000102030405060708090a0b0c0d0e0f";
+    const char* AesPlain = "00112233445566778899aabbccddeeff";
+    const char* AesCipher = "69c4e0d86a7b0430d8cdb78070b4c55a";
+    const char* AesZeroCipher = "66e94bd4ef8a2c3b884cfa59ca342b2e";
+
+    // AES-128 of the counter block of block 7 under the zero key and nonce, from openssl enc -aes-128-ecb
+    const char* AesZeroCounter7 = "bf394a2ddce8f8e5ec02aaacae413005";
+
+    // ChaCha20 keystream blocks 0 and 1 for the zero key and nonce (draft-agl-tls-chacha20poly1305, test vector 1)
+    const char* ChaChaZeroBlock0 = "76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7"
+                                   "da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586";
+    const char* ChaChaZeroBlock1 = "9f07e7be5551387a98ba977c732d080dcb0f29a048e3656912c6533e32ee7aed"
+                                   "29b721769ce64e43d57133b074d839d531ed1f28510afb45ace10a1f4b794d6f";
+
+    void Fill(std::uint8_t* data, std::size_t size, std::uint32_t seed) {
+        for (std::size_t i = 0; i < size; ++i) {
+            seed = seed * 1103515245 + 12345;
+            data[i] = static_cast<std::uint8_t>(seed >> 16);
+        }
+    }
+}
+
+TEST("cipher/kernels match the scalar loop")
+{
+    alignas(64) std::uint8_t expected[512 + 64], actual[512 + 64];
+
+    // Every length and misalignment covers the scalar head, the vector loops and the tail of each kernel
+    for (const NamedKernel& kernel : SupportedKernels()) {
+        for (std::size_t misalignment = 0; misalignment < 64; misalignment += 7) {
+            for (std::size_t size = 0; size <= 512; ++size) {
+                Fill(expected, sizeof(expected), static_cast<std::uint32_t>(size));
+                std::memcpy(actual, expected, sizeof(actual));
+
+                cipher::kernels::Scalar(expected + misalignment, size, 0xA5);
+                kernel.kernel(actual + misalignment, size, 0xA5);
+                if (std::memcmp(expected, actual, sizeof(actual)) != 0) {
+                    std::printf("    %s differs at size %zu misalignment %zu\n", kernel.name, size, misalignment);
+                    CHECK(!"kernel output");
+                    return;
+                }
+            }
+        }
+    }
+}
+
+TEST("cipher/ranges decrypt at their offset")
+{
+    std::uint8_t plain[3000], whole[3000], pieces[3000];
+    Fill(plain, sizeof(plain), 7);
+
+    for (cipher::Algorithm algorithm : Algorithms) {
+        cipher::Key key = cipher::KeyPool::Local().Next();
+
+        // The whole buffer in one pass, then the same stream range by range
+        std::memcpy(whole, plain, sizeof(plain));
+        cipher::Apply(algorithm, key, whole, sizeof(whole), 0);
+        CHECK(std::memcmp(whole, plain, sizeof(plain)) != 0);
+
+        std::memcpy(pieces, plain, sizeof(plain));
+        for (std::size_t offset = 0, step = 1; offset < sizeof(pieces); offset += step, step = step * 3 % 97 + 1) {
+            std::size_t size = offset + step > sizeof(pieces) ? sizeof(pieces) - offset : step;
+            cipher::Apply(algorithm, key, pieces + offset, size, offset);
+        }
+        CHECK(std::memcmp(whole, pieces, sizeof(whole)) == 0);
+
+        // Decrypt is the same pass and skips the entry byte, whose stream byte is applied alone
+        cipher::Encrypt(whole, sizeof(whole), algorithm, key);
+        cipher::Apply(algorithm, key, whole, 1, 0);
+        CHECK(std::memcmp(whole, plain, sizeof(plain)) == 0);
+    }
+}
+
+TEST("cipher/AES matches the FIPS-197 vectors")
+{
+    const std::uint8_t zeroKey[cipher::aes::KeySize] = {};
+    std::vector<std::uint8_t> key = Hex(AesKey);
+
+    // Portable block cipher
+    std::uint8_t roundKeys[(cipher::aes::Rounds + 1) * cipher::aes::BlockSize];
+    std::vector<std::uint8_t> block = Hex(AesPlain);
+    cipher::aes::portable::ExpandKey(key.data(), roundKeys);
+    cipher::aes::portable::EncryptBlock(roundKeys, block.data());
+    CHECK(Equals(block.data(), Hex(AesCipher)));
+
+    std::uint8_t zero[cipher::aes::BlockSize] = {};
+    cipher::aes::portable::ExpandKey(zeroKey, roundKeys);
+    cipher::aes::portable::EncryptBlock(roundKeys, zero);
+    CHECK(Equals(zero, Hex(AesZeroCipher)));
+
+    // Counter mode under the zero key and nonce: keystream block n is the cipher of the counter block { 0, n }
+    std::uint8_t stream[8 * cipher::aes::BlockSize] = {};
+    cipher::aes::portable::ApplyCtr(zeroKey, 0, stream, sizeof(stream), 0);
+    CHECK(Equals(stream, Hex(AesZeroCipher)) && Equals(stream + 7 * cipher::aes::BlockSize, Hex(AesZeroCounter7)));
+
+#ifdef AA_CPU_X64
+    if (!cpu::Supported().aes) {
+        std::printf("    no AES-NI, portable path only\n");
+        return;
+    }
+
+    __m128i niRoundKeys[cipher::aes::Rounds + 1];
+    cipher::aes::ni::ExpandKey(key.data(), niRoundKeys);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(block.data()), cipher::aes::ni::EncryptBlock(niRoundKeys, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Hex(AesPlain).data()))));
+    CHECK(Equals(block.data(), Hex(AesCipher)));
+
+    // The eight block loop, the single block loop and a partial block at an unaligned offset
+    std::memset(stream, 0, sizeof(stream));
+    cipher::aes::ni::ApplyCtr(zeroKey, 0, stream, sizeof(stream), 0);
+    CHECK(Equals(stream, Hex(AesZeroCipher)) && Equals(stream + 7 * cipher::aes::BlockSize, Hex(AesZeroCounter7)));
+
+    std::memset(stream, 0, sizeof(stream));
+    cipher::aes::ni::ApplyCtr(zeroKey, 0, stream, cipher::aes::BlockSize, 0);
+    CHECK(Equals(stream, Hex(AesZeroCipher)));
+
+    std::memset(stream, 0, sizeof(stream));
+    cipher::aes::ni::ApplyCtr(zeroKey, 0, stream, 5, 7 * cipher::aes::BlockSize + 3);
+    CHECK(std::memcmp(stream, Hex(AesZeroCounter7).data() + 3, 5) == 0);
+#endif // AA_CPU_X64
+}
+
+TEST("cipher/ChaCha20 matches the published keystream")
+{
+    const std::uint8_t zeroKey[cipher::chacha::KeySize] = {};
+    std::vector<std::uint8_t> block0 = Hex(ChaChaZeroBlock0), block1 = Hex(ChaChaZeroBlock1);
+    std::uint32_t state[16];
+    cipher::chacha::InitState(zeroKey, state);
+
+    // One block at a time
+    std::uint8_t keystream[4 * cipher::chacha::BlockSize];
+    cipher::chacha::portable::Block(state, 0, keystream);
+    cipher::chacha::portable::Block(state, 1, keystream + cipher::chacha::BlockSize);
+    CHECK(Equals(keystream, block0) && Equals(keystream + cipher::chacha::BlockSize, block1));
+
+    // Apply takes the one block path for a range within a block
+    std::uint8_t data[4 * cipher::chacha::BlockSize] = {};
+    cipher::chacha::Apply(zeroKey, data, cipher::chacha::BlockSize, 0);
+    cipher::chacha::Apply(zeroKey, data + cipher::chacha::BlockSize, cipher::chacha::BlockSize, cipher::chacha::BlockSize);
+    CHECK(Equals(data, block0) && Equals(data + cipher::chacha::BlockSize, block1));
+
+#if defined(AA_CPU_X64) || defined(AA_CPU_ARM64)
+    // Four blocks at once, one per lane, and the lanes Apply uses for longer ranges
+    cipher::chacha::lanes::Blocks4(state, 0, keystream);
+    CHECK(Equals(keystream, block0) && Equals(keystream + cipher::chacha::BlockSize, block1));
+
+    std::memset(data, 0, sizeof(data));
+    cipher::chacha::Apply(zeroKey, data, sizeof(data), 0);
+    CHECK(Equals(data, block0) && Equals(data + cipher::chacha::BlockSize, block1));
+    CHECK(std::memcmp(data, keystream, sizeof(data)) == 0);
+#endif // AA_CPU_X64 || AA_CPU_ARM64
+}
+
+TEST("cipher/key pool hands out distinct keys")
+{
+    std::vector<cipher::Key> keys;
+    for (std::size_t i = 0; i < 4 * cipher::KeyPool::KeysPerRefill; ++i)
+        keys.push_back(cipher::KeyPool::Local().Next());
+
+    for (std::size_t i = 1; i < keys.size(); ++i)
+        CHECK(std::memcmp(keys[i - 1].bytes, keys[i].bytes, sizeof(cipher::Key)) != 0);
+}
+
+BENCHMARK("cipher/xor kernels from 32 B to 64 KB")
+{
+    std::vector<std::uint8_t> buffer(64 * 1024 + 64);
+    std::uint8_t* data = buffer.data() + (64 - reinterpret_cast<std::uintptr_t>(buffer.data()) % 64) % 64;
+
+    for (const NamedKernel& kernel : SupportedKernels()) {
+        for (std::size_t size = 32; size <= 64 * 1024; size *= 2) {
+            std::size_t iterations = (std::size_t(64) << 20) / size;
+            double nanoseconds = scudotest::NanosecondsPer(iterations, [&](std::size_t) { kernel.kernel(data, size, 0x5A); });
+
+            char label[64];
+            std::snprintf(label, sizeof(label), "%s, %zu B", kernel.name, size);
+            scudotest::Report(label, size / nanoseconds, "GB/s");
+        }
+    }
+    scudotest::Consume(data[0]);
+}
+
+BENCHMARK("cipher/algorithms on a 1 KB function")
+{
+    std::uint8_t function[1024];
+    Fill(function, sizeof(function), 1);
+    cipher::Key key = cipher::KeyPool::Local().Next();
+
+    // The original cipher: one byte at a time
+    double scalar = scudotest::NanosecondsPer(200000, [&](std::size_t) { cipher::kernels::Scalar(function + 1, sizeof(function) - 1, key.bytes[0]); });
+    scudotest::Report("byte loop", scalar, "ns");
+
+    for (std::size_t i = 0; i < std::size(Algorithms); ++i) {
+        double nanoseconds = scudotest::NanosecondsPer(200000, [&](std::size_t) { cipher::Encrypt(function, sizeof(function), Algorithms[i], key); });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s (%.2fx the byte loop)", AlgorithmNames[i], nanoseconds / scalar);
+        scudotest::Report(label, nanoseconds, "ns");
+    }
+    scudotest::Consume(function[1]);
+}
+
+BENCHMARK("cipher/keys")
+{
+    std::uint64_t folded = 0;
+    double pooled = scudotest::NanosecondsPer(4000000, [&](std::size_t) { folded += cipher::KeyPool::Local().Next().bytes[0]; });
+    scudotest::Report("KeyPool::Next", 1e3 / pooled, "M keys/s");
+
+    cipher::KeySchedule& schedule = cipher::KeySchedule::Global();
+    std::uint32_t epoch = schedule.Acquire(0);
+    double derived = scudotest::NanosecondsPer(4000000, [&](std::size_t i) { folded += schedule.Derive(reinterpret_cast<const void*>(i * 16), epoch).bytes[0]; });
+    schedule.Release(epoch);
+    scudotest::Report("KeySchedule::Derive", derived, "ns");
+    scudotest::Consume(folded);
+}
@@ -0,0 +1,226 @@
+#include <A64Arch.h>
+#include <A64Length.h>
+#include <A64Opcode.h>
+#include <A64Function.h>
+#include <A64ExtentIndex.h>
+#include "ScudoTest.h"
+#include "Fixtures/LengthCorpus.h"
+
+namespace {
+    SCUDO_NOINLINE int CorpusAnchor() { return 0; }
+
+    /**
+     * @brief Functions of the test binary, real compiler output for the decoders to agree on.
+     */
+    std::span<const FunctionRange> Corpus() {
+        return FunctionExtentIndex::ForAddress(reinterpret_cast<const void*>(&CorpusAnchor)).Entries();
+    }
+
+    /**
+     * @brief First functions of the corpus, the sample every sizing path walks.
+     */
+    std::vector<FunctionRange> Sample(std::size_t count) {
+        std::vector<FunctionRange> sample;
+        for (const FunctionRange& function : Corpus()) {
+            if (sample.size() == count)
+                break;
+            if (function.Size() >= 16)
+                sample.push_back(function);
+        }
+        return sample;
+    }
+
+    /**
+     * @brief Decodes a corpus instruction by instruction and counts the lengths that differ from objdump's.
+     */
+    template<std::size_t Count>
+    std::size_t LengthMismatches(const std::uint8_t* code, const std::uint8_t (&lengths)[Count], bool x64) {
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < Count; code += lengths[i++]) {
+            OpInstruction instruction;
+            bool decoded = OpDecode(code, instruction, x64);
+            if (decoded && instruction.size == lengths[i])
+                continue;
+
+            if (mismatches++ < 20) {
+                std::printf("    %s mode, objdump %u bytes, OpDecode %u:", x64 ? "long" : "legacy", lengths[i], decoded ? instruction.size : 0u);
+                for (std::uint8_t byte = 0; byte < lengths[i]; ++byte)
+                    std::printf(" %02x", code[byte]);
+                std::printf("\n");
+            }
+        }
+        return mismatches;
+    }
+}
+
+TEST("decoder/agrees with objdump on the length corpus")
+{
+    // Fixtures/LengthCorpus.h, checked in so every build, capstone or not, compares the decoder with a reference
+    std::size_t longMode = LengthMismatches(lengthcorpus::LongModeCode, lengthcorpus::LongModeLengths, true);
+    std::size_t legacyMode = LengthMismatches(lengthcorpus::LegacyModeCode, lengthcorpus::LegacyModeLengths, false);
+
+    std::printf("    %zu long mode, %zu legacy mode instructions\n", std::size(lengthcorpus::LongModeLengths), std::size(lengthcorpus::LegacyModeLengths));
+    CHECK(longMode == 0);
+    CHECK(legacyMode == 0);
+}
+
+BENCHMARK("decoder/sizing a function")
+{
+    std::vector<FunctionRange> sample = Sample(500);
+    if (sample.empty()) {
+        std::printf("    the test binary has no function index\n");
+        return;
+    }
+
+    // Instructions of the sample, counted by the built-in decoder
+    std::size_t instructions = 0;
+    for (const FunctionRange& function : sample) {
+        OpLengthSession<>::ThreadSession().Walk(reinterpret_cast<const char*>(function.begin), [&](const OpInstruction* instruction) {
+            ++instructions;
+            return instruction->address + instruction->size < function.end;
+        });
+    }
+    std::printf("    %zu functions, %zu instructions\n", sample.size(), instructions);
+
+    double length = scudotest::NanosecondsPer(20, [&](std::size_t) {
+        for (const FunctionRange& function : sample)
+            OpLengthSession<>::ThreadSession().Walk(reinterpret_cast<const char*>(function.begin), [&](const OpInstruction* instruction) {
+                return instruction->address + instruction->size < function.end;
+            });
+    }) / instructions;
+    scudotest::Report("OpLengthSession", length, "ns/instruction");
+
+#ifndef AA_NOCAPSTONE
+    double session = scudotest::NanosecondsPer(20, [&](std::size_t) {
+        for (const FunctionRange& function : sample)
+            OpSession<>::ThreadSession().Walk(reinterpret_cast<const char*>(function.begin), [&](const cs_insn* instruction) {
+                return instruction->address + instruction->size < function.end;
+            });
+    }) / instructions;
+    scudotest::Report("OpSession", session, "ns/instruction");
+
+    // The original path: a capstone handle opened and closed for every instruction
+    double perInstruction = scudotest::NanosecondsPer(1, [&](std::size_t) {
+        for (const FunctionRange& function : sample) {
+            for (std::uintptr_t address = function.begin; address < function.end;) {
+                std::size_t size = OpDisassemble(reinterpret_cast<const char*>(address)).GetLength();
+                if (!size)
+                    break;
+                address += size;
+            }
+        }
+    }) / instructions;
+    scudotest::Report("OpDisassemble per instruction", perInstruction, "ns/instruction");
+    scudotest::Report("OpSession speedup", perInstruction / session, "x");
+#endif // !AA_NOCAPSTONE
+}
+
+#ifndef AA_NOCAPSTONE
+namespace {
+    /**
+     * @brief GetFunctionLength as it was before OpSession: two capstone handles per instruction, one for the int3 look-ahead.
+     */
+    std::int32_t PerInstructionLength(const FunctionRange& function) {
+        const char* address = reinterpret_cast<const char*>(function.begin);
+        std::int32_t length = 0;
+        while (reinterpret_cast<std::uintptr_t>(address) < function.end) {
+            std::size_t size = OpDisassemble(address).GetLength();
+            if (!size)
+                return 0;
+            if (size == 1 && OpDisassemble(address + 1).GetLength() == 1 && *reinterpret_cast<const std::uint16_t*>(address) == 0xCCC3)
+                return length + 1;
+            length += static_cast<std::int32_t>(size);
+            address += size;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Functions of the corpus ending in ret followed by int3, where both sizing paths stop within the function.
+     */
+    std::vector<FunctionRange> ReturnPaddedFunctions() {
+        std::vector<FunctionRange> functions;
+        for (const FunctionRange& function : Corpus()) {
+            const std::uint8_t* end = reinterpret_cast<const std::uint8_t*>(function.end);
+            if (function.Size() >= 2 && end[-1] == 0xC3 && end[0] == 0xCC)
+                functions.push_back(function);
+        }
+        return functions;
+    }
+}
+
+TEST("decoder/GetFunctionLength sizes like the per-instruction path")
+{
+    std::vector<FunctionRange> functions = ReturnPaddedFunctions();
+    std::size_t mismatches = 0;
+    for (const FunctionRange& function : functions)
+        mismatches += GetFunctionLength(reinterpret_cast<void*>(function.begin)) != PerInstructionLength(function);
+
+    std::printf("    %zu functions, %zu mismatches\n", functions.size(), mismatches);
+    CHECK(!functions.empty() && mismatches == 0);
+}
+
+BENCHMARK("decoder/GetFunctionLength per function")
+{
+    std::vector<FunctionRange> functions = ReturnPaddedFunctions();
+    if (functions.empty())
+        return;
+
+    // Every function once, then the largest one, the startup cost of AAPROTECT on a few thousand functions
+    auto largest = std::max_element(functions.begin(), functions.end(), [](const FunctionRange& left, const FunctionRange& right) {
+        return left.Size() < right.Size();
+    });
+    std::vector<std::pair<const char*, std::vector<FunctionRange>>> samples = { { "all", functions }, { "largest", { *largest } } };
+
+    char label[96];
+    for (const auto& [name, sample] : samples) {
+        std::int64_t folded = 0;
+        double session = scudotest::NanosecondsPer(10, [&](std::size_t) {
+            for (const FunctionRange& function : sample)
+                folded += GetFunctionLength(reinterpret_cast<void*>(function.begin));
+        }) / sample.size();
+        double perInstruction = scudotest::NanosecondsPer(1, [&](std::size_t) {
+            for (const FunctionRange& function : sample)
+                folded += PerInstructionLength(function);
+        }) / sample.size();
+        scudotest::Consume(static_cast<std::uint64_t>(folded));
+
+        std::snprintf(label, sizeof(label), "GetFunctionLength, %s (%zu functions, %zu bytes max)", name, sample.size(), sample.size() == 1 ? sample[0].Size() : largest->Size());
+        scudotest::Report(label, session, "ns/function");
+        std::snprintf(label, sizeof(label), "per-instruction OpDisassemble, %s", name);
+        scudotest::Report(label, perInstruction, "ns/function");
+        std::snprintf(label, sizeof(label), "OpSession speedup, %s", name);
+        scudotest::Report(label, perInstruction / session, "x");
+    }
+}
+
+TEST("decoder/agrees with capstone on the test binary")
+{
+    std::span<const FunctionRange> corpus = Corpus();
+    CHECK(corpus.size() >= 100);
+
+    // Both decoders walk every function linearly, capstone sets the instruction boundaries
+    std::size_t instructions = 0, mismatches = 0;
+    OpSession<>& capstone = OpSession<>::ThreadSession();
+    for (const FunctionRange& function : corpus) {
+        capstone.Walk(reinterpret_cast<const char*>(function.begin), [&](const cs_insn* expected) {
+            OpInstruction actual;
+            bool decoded = OpDecode(reinterpret_cast<const std::uint8_t*>(expected->address), actual);
+            ++instructions;
+
+            if (!decoded || actual.size != expected->size) {
+                if (mismatches++ < 20) {
+                    std::printf("    %s %s: capstone %u bytes, OpDecode %u:", expected->mnemonic, expected->op_str, expected->size, decoded ? actual.size : 0u);
+                    for (std::uint16_t i = 0; i < expected->size; ++i)
+                        std::printf(" %02x", expected->bytes[i]);
+                    std::printf("\n");
+                }
+            }
+            return expected->address + expected->size < function.end;
+        });
+    }
+
+    std::printf("    %zu functions, %zu instructions, %zu mismatches\n", corpus.size(), instructions, mismatches);
+    CHECK(mismatches == 0);
+}
+#endif // !AA_NOCAPSTONE
@@ -0,0 +1,169 @@
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <A64ExtentIndex.h>
+#include "ScudoTest.h"
+
+namespace {
+    SCUDO_NOINLINE int IndexAnchor() { return 0; }
+
+#ifndef _WIN32
+    struct Symbol {
+        std::uintptr_t value;
+        std::size_t size;
+    };
+
+    /**
+     * @brief Sized functions of an ELF file as GNU nm lists them, empty if nm isn't installed.
+     */
+    std::vector<Symbol> NmFunctions(const std::string& path) {
+        std::vector<Symbol> symbols;
+        FILE* output = popen(("nm -S --defined-only '" + path + "' 2>/dev/null").c_str(), "r");
+        if (!output)
+            return symbols;
+
+        char line[4096], type;
+        unsigned long long value, size;
+        while (std::fgets(line, sizeof(line), output))
+            if (std::sscanf(line, "%llx %llx %c", &value, &size, &type) == 3 && (type == 't' || type == 'T' || type == 'W' || type == 'w') && size)
+                symbols.push_back({ static_cast<std::uintptr_t>(value), static_cast<std::size_t>(size) });
+        pclose(output);
+        return symbols;
+    }
+
+    std::vector<std::uint8_t> ReadFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    /**
+     * @brief Makes the symbol tables of an ELF file unrecognizable, as if it was stripped.
+     */
+    void Strip(std::vector<std::uint8_t>& image) {
+        auto header = reinterpret_cast<const elf::Header*>(image.data());
+        auto sections = reinterpret_cast<elf::SectionHeader*>(image.data() + header->shoff);
+        for (std::uint16_t index = 0; index < header->shnum; ++index)
+            if (sections[index].type == elf::SectionSymtab || sections[index].type == elf::SectionDynsym)
+                sections[index].type = 0;
+    }
+
+    /**
+     * @brief The test binary and its load bias. The path is resolved, /proc/self/exe would name nm in its process.
+     */
+    bool TestBinary(LoadedModule& module) {
+        char resolved[PATH_MAX];
+        if (!FindLoadedModule(reinterpret_cast<const void*>(&IndexAnchor), module) || !realpath(module.path.c_str(), resolved))
+            return false;
+        module.path = resolved;
+        return true;
+    }
+#endif // !_WIN32
+}
+
+#ifndef _WIN32
+TEST("index/ELF symbols agree with nm")
+{
+    LoadedModule module;
+    CHECK(TestBinary(module));
+    std::vector<Symbol> symbols = NmFunctions(module.path);
+    if (symbols.empty()) {
+        std::printf("    nm not found, skipped\n");
+        return;
+    }
+
+    // Every sized function nm lists has the same size in the index, aliases included
+    FunctionExtentIndex index = FunctionExtentIndex::FromElfPath(module.path.c_str(), module.base);
+    std::size_t mismatches = 0;
+    for (const Symbol& symbol : symbols)
+        if (index.Size(reinterpret_cast<const void*>(module.base + symbol.value)) != symbol.size && mismatches++ < 10)
+            std::printf("    0x%llx: nm %zu bytes, index %zu\n", static_cast<unsigned long long>(symbol.value), symbol.size,
+                index.Size(reinterpret_cast<const void*>(module.base + symbol.value)));
+
+    std::printf("    %zu functions\n", symbols.size());
+    CHECK(symbols.size() > 100 && mismatches == 0);
+    CHECK(index.Find(reinterpret_cast<std::uintptr_t>(&IndexAnchor)) != nullptr);
+}
+
+TEST("index/.eh_frame covers a stripped binary")
+{
+    LoadedModule module;
+    CHECK(TestBinary(module));
+    std::vector<Symbol> symbols = NmFunctions(module.path);
+    std::vector<std::uint8_t> image = ReadFile(module.path);
+    if (symbols.empty() || image.empty()) {
+        std::printf("    nm not found, skipped\n");
+        return;
+    }
+
+    // Without symbol tables the index falls back to the FDEs, one per function the compiler emitted unwind info for
+    Strip(image);
+    FunctionExtentIndex index = FunctionExtentIndex::FromElfFile(elf::File(image.data(), image.size()), module.base);
+    std::size_t covered = 0;
+    for (const Symbol& symbol : symbols)
+        covered += index.Size(reinterpret_cast<const void*>(module.base + symbol.value)) == symbol.size;
+
+    std::printf("    %zu of %zu functions sized by their FDE\n", covered, symbols.size());
+    CHECK(index.Count() > 100);
+    CHECK(covered * 100 >= symbols.size() * 90);
+}
+
+TEST("index/a CIE running past its record ends .eh_frame")
+{
+    LoadedModule module;
+    CHECK(TestBinary(module));
+    std::vector<std::uint8_t> image = ReadFile(module.path);
+    if (image.empty())
+        return;
+    Strip(image);
+
+    elf::File file(image.data(), image.size());
+    const elf::SectionHeader* section = file.FindSection(".eh_frame");
+    CHECK(section != nullptr);
+    if (!section)
+        return;
+
+    // The first record is a CIE, fill it from the augmentation string on with a string that never ends
+    std::uint8_t* record = image.data() + section->offset;
+    std::uint32_t length, cieOffset;
+    std::memcpy(&length, record, sizeof(length));
+    std::memcpy(&cieOffset, record + 4, sizeof(cieOffset));
+    CHECK(cieOffset == 0 && length > 8);
+    std::memset(record + 9, 'z', length - 5);
+
+    FunctionExtentIndex index = FunctionExtentIndex::FromElfFile(file, module.base);
+    CHECK(index.Empty());
+}
+#endif // !_WIN32
+
+TEST("index/chained unwind info continues the previous function")
+{
+    // An image with unwind info at 0x200, chained unwind info at 0x210 and code from 0x1000
+    std::vector<std::uint8_t> image(0x2000);
+    image[0x200] = 0x01;
+    image[0x210] = 0x01 | (0x4 << 3);
+    auto base = reinterpret_cast<std::uintptr_t>(image.data());
+
+    const FunctionExtentIndex::RuntimeFunction functions[] = {
+        { 0x1000, 0x1040, 0x200 },
+        { 0x1040, 0x1080, 0x210 },  // second part of the first function
+        { 0x1080, 0x10A0, 0x201 },  // unwind info address with the low bit set, as in some linkers' output
+        { 0x10C0, 0x10E0, 0x210 },  // chained, but not contiguous with the previous entry
+        { 0x10E0, 0x1100, 0x211 },  // continues it
+    };
+
+    FunctionExtentIndex index;
+    index.AddRuntimeFunctions(base, functions);
+    index.Finalize();
+
+    CHECK(index.Count() == 3);
+    CHECK(index.Size(image.data() + 0x1000) == 0x80);
+    CHECK(index.Size(image.data() + 0x1040) == 0);
+    CHECK(index.Size(image.data() + 0x1080) == 0x20);
+    CHECK(index.Size(image.data() + 0x10C0) == 0x40);
+    CHECK(index.Find(base + 0x10A0) == nullptr && index.Find(base + 0x107F) != nullptr);
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <A64Extent.h>
+#include <A64ExtentIndex.h>
+#include "ScudoTest.h"
+
+namespace {
+    /*
+        Hand-assembled code to size, aligned like a text section. Bytes not written are int3, so a walk that
+        goes wrong stops in the buffer. Passing the buffer as the only section keeps the module index out.
+    */
+    struct Code {
+        alignas(64) std::uint8_t bytes[0x100];
+
+        Code() { std::memset(bytes, 0xCC, sizeof(bytes)); }
+
+        Code& At(std::size_t offset, std::initializer_list<std::uint8_t> code) {
+            std::copy(code.begin(), code.end(), bytes + offset);
+            return *this;
+        }
+
+        std::uintptr_t Address(std::size_t offset) const { return reinterpret_cast<std::uintptr_t>(bytes + offset); }
+
+        std::vector<FunctionRange> Extent(std::span<void* const> knownEntries = {}) {
+            FunctionRange section{ Address(0), Address(sizeof(bytes)) };
+            return GetFunctionExtent<ArchX64>(bytes, knownEntries, std::span<const FunctionRange>(&section, 1));
+        }
+
+        // The extent is the single range [0, end)
+        bool Spans(const std::vector<FunctionRange>& ranges, std::size_t end) const {
+            return ranges.size() == 1 && ranges[0].begin == Address(0) && ranges[0].end == Address(end);
+        }
+    };
+
+    SCUDO_NOINLINE int ExtentAnchor() { return 0; }
+
+    /**
+     * @brief Executable segment of the test binary, the section its functions are sized within.
+     */
+    FunctionRange TextSegment() {
+        LoadedModule module;
+        if (!FindLoadedModule(reinterpret_cast<const void*>(&ExtentAnchor), module))
+            return {};
+#ifdef _WIN32
+        auto dosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(module.base);
+        auto ntHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(module.base + dosHeader->e_lfanew);
+        const IMAGE_SECTION_HEADER* section = IMAGE_FIRST_SECTION(ntHeaders);
+        for (WORD index = 0; index < ntHeaders->FileHeader.NumberOfSections; ++index, ++section)
+            if (section->Characteristics & IMAGE_SCN_MEM_EXECUTE)
+                return { module.base + section->VirtualAddress, module.base + section->VirtualAddress + section->Misc.VirtualSize };
+#else
+        for (const ElfW(Phdr)& segment : module.segments)
+            if (segment.p_type == PT_LOAD && (segment.p_flags & PF_X))
+                return { module.base + segment.p_vaddr, module.base + segment.p_vaddr + segment.p_memsz };
+#endif // _WIN32
+        return {};
+    }
+}
+
+TEST("extent/a call that doesn't return ends at the padding")
+{
+    // push rbp; mov rbp, rsp; call abort, then nopl padding or int3 up to the next function
+    for (bool int3 : { false, true }) {
+        Code code;
+        code.At(0x00, { 0x55, 0x48, 0x89, 0xE5, 0xE8, 0x00, 0x00, 0x00, 0x00 });
+        if (!int3)
+            code.At(0x09, { 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00 });
+        code.At(0x10, { 0x55, 0x48, 0x89, 0xE5, 0xC3 });
+        CHECK(code.Spans(code.Extent(), 0x09));
+    }
+
+    // Unaligned, the next function is only known from the list of entries
+    Code code;
+    code.At(0x00, { 0xE8, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x31, 0xC0, 0xC3 });
+    void* next = code.bytes + 0x07;
+    CHECK(code.Spans(code.Extent({ &next, 1 }), 0x05));
+}
+
+TEST("extent/a tail jump leaves the function")
+{
+    // test rdi, rdi; je tail; xor eax, eax; ret; tail: jmp 0x20, the entry of another function after int3
+    Code code;
+    code.At(0x00, { 0x48, 0x85, 0xFF, 0x74, 0x03, 0x31, 0xC0, 0xC3, 0xE9, 0x13, 0x00, 0x00, 0x00 });
+    code.At(0x10, { 0x31, 0xC0, 0xC3 });
+    code.At(0x20, { 0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3 });
+    CHECK(code.Spans(code.Extent(), 0x0D));
+}
+
+TEST("extent/a jump table reaches every case")
+{
+    // cmp edi, 3; ja default; lea rdx, [table]; movsxd rax, [rdx + rdi * 4]; add rax, rdx; jmp rax
+    Code code;
+    code.At(0x00, { 0x83, 0xFF, 0x03, 0x77, 0x28, 0x48, 0x8D, 0x15, 0x34, 0x00, 0x00, 0x00, 0x48, 0x63, 0x04, 0xBA, 0x48, 0x01, 0xD0, 0xFF, 0xE0 });
+
+    // Four cases returning their index, then the default
+    for (std::uint8_t index = 0; index < 4; ++index)
+        code.At(0x15 + index * 6, { 0xB8, index, 0x00, 0x00, 0x00, 0xC3 });
+    code.At(0x2D, { 0x31, 0xC0, 0xC3 });
+
+    // Entries relative to the table at 0x40, data after the code
+    for (std::int32_t index = 0; index < 4; ++index) {
+        std::int32_t entry = 0x15 + index * 6 - 0x40;
+        std::memcpy(code.bytes + 0x40 + index * 4, &entry, sizeof(entry));
+    }
+    CHECK(code.Spans(code.Extent(), 0x30));
+}
+
+TEST("extent/every return of the function is kept")
+{
+    // test edi, edi; jne 1f; xor eax, eax; ret; 1: cmp edi, 1; jne 2f; mov eax, 1; ret; 2: lea eax, [rdi + rdi]; ret
+    Code code;
+    code.At(0x00, { 0x85, 0xFF, 0x75, 0x03, 0x31, 0xC0, 0xC3, 0x83, 0xFF, 0x01, 0x75, 0x06, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3, 0x8D, 0x04, 0x3F, 0xC3 });
+    code.At(0x20, { 0xC3 });
+    CHECK(code.Spans(code.Extent(), 0x16));
+}
+
+TEST("extent/a loop aligned inside the function is kept")
+{
+    // xor eax, eax; nopw and nopl up to 0x10; loop: add eax, edi; dec edi; jne loop; ret
+    Code code;
+    code.At(0x00, { 0x31, 0xC0, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x44, 0x00, 0x00 });
+    code.At(0x10, { 0x01, 0xF8, 0xFF, 0xCF, 0x75, 0xFA, 0xC3 });
+    CHECK(code.Spans(code.Extent(), 0x17));
+
+    // The same loop behind a jump over the padding
+    code.At(0x00, { 0xEB, 0x0E });
+    CHECK(code.Spans(code.Extent(), 0x17));
+}
+
+TEST("extent/functions of the test binary stay within their symbols")
+{
+    // Sized like a file image, by control flow alone, then like a loaded module, bounded by the next function of the index.
+    // Cold parts the compiler split off are packed unaligned, ending in calls that don't return with no padding to stop at
+    FunctionRange text = TextSegment();
+    std::span<const FunctionRange> functions = FunctionExtentIndex::ForAddress(reinterpret_cast<const void*>(&ExtentAnchor)).Entries();
+    CHECK(text.Size() != 0 && functions.size() > 100);
+
+    std::size_t measured = 0, within = 0, beyondNext = 0;
+    for (std::size_t index = 0; index < functions.size(); ++index) {
+        const FunctionRange& function = functions[index];
+        if (!text.Contains(function.begin) || function.begin % extent::EntryAlignment || function.Size() < 2)
+            continue;
+
+        std::size_t size = GetFunctionExtentLength<ArchX64>(reinterpret_cast<void*>(function.begin), {}, std::span<const FunctionRange>(&text, 1));
+        if (!size)
+            continue;
+        ++measured;
+        within += size <= function.Size();
+
+        std::size_t loaded = GetFunctionExtentLength<ArchX64>(reinterpret_cast<void*>(function.begin));
+        if (index + 1 < functions.size() && function.begin + loaded > functions[index + 1].begin)
+            ++beyondNext;
+    }
+
+    std::printf("    %zu of %zu functions measured within their symbol\n", within, measured);
+    CHECK(measured > functions.size() / 2);
+    CHECK(within * 100 >= measured * 95);
+    CHECK(beyondNext == 0);
+}
@@ -0,0 +1,1343 @@
+#pragma once
+#include <cstdint>
+
+/*
+    Generated by lengths.py from libc.so.6 and hand-written encodings, do not edit.
+    Instructions are concatenated, the length of each as decoded by GNU objdump.
+*/
+
+namespace lengthcorpus
+{
+    constexpr std::uint8_t LongModeLengths[] = {
+        1, 5, 5, 5, 5, 5, 5, 1, 1, 7, 7, 9, 8, 2, 7, 2, 5, 8, 2, 3, 5, 7, 6, 7, 2, 6, 2, 5, 10, 5, 8, 2,
+        6, 3, 2, 2, 6, 2, 6, 2, 6, 2, 5, 5, 5, 2, 5, 2, 2, 5, 2, 9, 5, 2, 5, 2, 1, 5, 5, 2, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 2, 7, 3, 3, 3, 2, 4, 2, 2, 5, 5, 5, 5, 5, 5, 7, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 7, 7, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 2, 8, 5, 5, 5,
+        4, 5, 2, 5, 2, 3, 3, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 8, 3, 5, 5, 2, 5, 5, 2, 3, 7, 2, 2, 2, 2, 2,
+        2, 5, 5, 5, 5, 5, 5, 5, 5, 7, 5, 4, 8, 5, 8, 5, 5, 7, 5, 5, 3, 2, 4, 7, 2, 3, 4, 2, 6, 2, 4, 1,
+        5, 5, 5, 4, 2, 10, 2, 9, 4, 1, 2, 2, 8, 5, 5, 4, 2, 2, 4, 3, 2, 2, 5, 7, 3, 2, 5, 7, 2, 2, 2, 2,
+        4, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3, 4, 6, 3, 2, 2, 3, 7, 3, 5, 3, 2, 5, 3, 2, 3, 2, 2, 4, 4, 2, 2,
+        3, 4, 4, 2, 4, 2, 5, 2, 5, 6, 5, 6, 5, 5, 5, 5, 5, 2, 7, 1, 2, 4, 2, 6, 4, 4, 8, 2, 2, 5, 2, 4,
+        5, 5, 2, 2, 5, 9, 5, 5, 5, 5, 4, 2, 11, 3, 5, 2, 2, 2, 5, 2, 5, 5, 5, 5, 9, 7, 2, 5, 2, 2, 2, 9,
+        2, 3, 3, 2, 2, 7, 2, 6, 4, 4, 3, 3, 4, 4, 6, 2, 4, 3, 2, 2, 2, 8, 5, 3, 2, 5, 2, 2, 4, 3, 5, 6,
+        5, 5, 5, 5, 6, 5, 5, 1, 4, 2, 5, 2, 2, 5, 4, 4, 5, 3, 4, 2, 2, 4, 3, 5, 3, 3, 2, 4, 4, 3, 5, 4,
+        5, 5, 3, 4, 5, 5, 5, 5, 5, 5, 4, 5, 4, 2, 2, 5, 3, 6, 4, 9, 3, 4, 2, 3, 4, 4, 2, 5, 5, 2, 2, 3,
+        2, 3, 6, 4, 3, 4, 5, 4, 4, 5, 4, 2, 7, 5, 5, 2, 7, 2, 4, 4, 2, 4, 9, 4, 5, 2, 3, 2, 2, 2, 5, 1,
+        1, 2, 2, 4, 3, 3, 1, 1, 2, 6, 2, 5, 5, 5, 5, 5, 4, 5, 3, 2, 2, 2, 5, 5, 5, 2, 4, 2, 2, 5, 7, 5,
+        2, 5, 4, 5, 3, 3, 2, 2, 2, 5, 5, 4, 8, 5, 5, 6, 10, 4, 2, 6, 4, 2, 4, 3, 2, 2, 2, 2, 2, 2, 3, 2,
+        2, 3, 6, 2, 3, 6, 5, 4, 2, 8, 6, 4, 7, 4, 4, 5, 5, 5, 2, 6, 2, 3, 6, 5, 2, 5, 2, 6, 2, 2, 2, 5,
+        2, 2, 3, 6, 2, 2, 3, 2, 2, 2, 2, 2, 3, 6, 5, 3, 5, 5, 5, 5, 5, 3, 6, 4, 2, 8, 5, 2, 5, 5, 3, 9,
+        9, 3, 2, 5, 3, 5, 5, 4, 2, 7, 5, 5, 2, 5, 5, 3, 5, 5, 5, 2, 5, 2, 5, 5, 2, 5, 5, 2, 5, 5, 5, 5,
+        5, 2, 2, 5, 2, 5, 5, 5, 5, 2, 7, 5, 2, 4, 2, 5, 2, 5, 5, 5, 2, 6, 3, 8, 5, 2, 5, 5, 5, 5, 5, 5,
+        2, 2, 2, 2, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 5, 2, 5, 5, 8, 3, 4, 5, 5, 2, 3, 3, 2, 5, 3, 4, 4, 2,
+        5, 4, 3, 3, 2, 4, 3, 4, 6, 5, 5, 5, 5, 5, 5, 5, 5, 4, 2, 2, 2, 2, 2, 5, 2, 2, 2, 6, 5, 2, 4, 5,
+        5, 2, 2, 3, 5, 2, 2, 6, 5, 5, 2, 5, 3, 5, 3, 2, 3, 4, 5, 2, 5, 4, 3, 3, 5, 5, 4, 3, 2, 5, 5, 3,
+        4, 2, 4, 2, 8, 3, 5, 3, 2, 5, 2, 2, 2, 6, 3, 5, 5, 5, 2, 2, 5, 3, 2, 3, 2, 5, 5, 3, 2, 6, 5, 6,
+        2, 2, 2, 2, 2, 2, 6, 4, 5, 3, 3, 5, 2, 4, 2, 4, 2, 3, 3, 5, 6, 2, 5, 4, 3, 4, 2, 5, 3, 2, 2, 2,
+        6, 6, 3, 5, 5, 3, 2, 4, 8, 5, 5, 5, 7, 4, 4, 5, 5, 2, 5, 2, 2, 2, 2, 5, 7, 2, 2, 2, 2, 2, 6, 2,
+        5, 2, 5, 2, 2, 5, 3, 5, 4, 4, 5, 3, 7, 8, 4, 2, 2, 3, 2, 2, 2, 2, 5, 5, 2, 2, 2, 3, 2, 2, 6, 5,
+        3, 4, 5, 4, 4, 4, 4, 2, 3, 2, 8, 3, 6, 6, 2, 4, 1, 1, 2, 5, 4, 2, 4, 5, 2, 2, 2, 3, 2, 6, 5, 5,
+        5, 8, 7, 5, 2, 5, 2, 2, 2, 2, 5, 5, 5, 5, 5, 7, 4, 4, 2, 3, 2, 2, 2, 3, 2, 2, 4, 2, 6, 2, 1, 2,
+        5, 5, 2, 2, 2, 2, 3, 3, 2, 2, 2, 5, 5, 5, 2, 4, 2, 4, 3, 2, 5, 7, 5, 5, 2, 2, 5, 2, 2, 5, 5, 5,
+        5, 4, 4, 4, 2, 2, 5, 2, 3, 3, 2, 2, 2, 5, 4, 5, 5, 5, 4, 5, 3, 2, 5, 4, 7, 2, 5, 2, 5, 2, 4, 2,
+        3, 2, 5, 5, 5, 2, 3, 2, 2, 2, 4, 5, 8, 2, 5, 5, 2, 2, 3, 2, 2, 2, 5, 2, 2, 2, 2, 5, 5, 5, 5, 2,
+        2, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 4, 5, 2, 5, 2, 5, 2, 2, 2, 5, 5, 5, 2, 5, 4, 2, 5, 8, 2, 2, 2,
+        5, 3, 6, 5, 6, 4, 2, 2, 6, 2, 2, 2, 2, 3, 2, 5, 5, 5, 4, 5, 2, 2, 5, 2, 2, 5, 7, 5, 5, 5, 5, 2,
+        3, 2, 5, 2, 6, 5, 2, 5, 5, 5, 2, 2, 6, 2, 5, 5, 4, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 12, 5, 6, 5,
+        3, 2, 5, 2, 8, 3, 4, 5, 3, 2, 5, 5, 2, 2, 8, 5, 5, 5, 5, 2, 3, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3,
+        5, 2, 5, 5, 5, 5, 5, 2, 2, 5, 2, 2, 2, 5, 5, 5, 5, 5, 7, 7, 2, 2, 5, 2, 3, 3, 2, 4, 3, 3, 2, 2,
+        2, 2, 5, 3, 6, 6, 2, 5, 6, 3, 6, 5, 2, 3, 2, 2, 3, 3, 5, 8, 2, 3, 3, 2, 7, 7, 2, 2, 4, 4, 3, 6,
+        5, 2, 5, 2, 3, 2, 4, 2, 3, 2, 2, 2, 2, 5, 5, 5, 5, 6, 2, 2, 3, 2, 4, 2, 2, 2, 4, 2, 2, 6, 2, 2,
+        5, 5, 5, 5, 5, 5, 2, 2, 5, 2, 2, 5, 2, 4, 2, 5, 5, 5, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 5, 2, 5,
+        2, 5, 5, 2, 5, 2, 5, 2, 5, 7, 4, 5, 2, 2, 4, 5, 2, 5, 2, 3, 2, 6, 2, 5, 2, 7, 6, 2, 3, 5, 5, 6,
+        5, 5, 2, 5, 5, 2, 2, 5, 5, 5, 2, 6, 6, 4, 2, 2, 2, 2, 2, 2, 5, 6, 2, 5, 5, 5, 2, 5, 5, 6, 2, 5,
+        5, 5, 2, 5, 5, 2, 5, 5, 2, 5, 5, 5, 2, 2, 5, 7, 4, 2, 2, 2, 5, 2, 5, 2, 5, 5, 2, 5, 5, 5, 6, 2,
+        2, 5, 2, 2, 5, 5, 2, 5, 5, 2, 5, 5, 2, 3, 5, 5, 5, 5, 5, 5, 5, 5, 7, 2, 2, 2, 3, 4, 2, 4, 6, 6,
+        4, 5, 2, 3, 2, 2, 2, 2, 5, 5, 2, 5, 4, 2, 2, 3, 4, 5, 5, 3, 6, 2, 3, 2, 2, 3, 4, 2, 3, 2, 2, 2,
+        3, 2, 4, 3, 2, 5, 5, 2, 5, 6, 2, 2, 2, 2, 2, 2, 11, 2, 2, 2, 2, 4, 5, 2, 2, 4, 6, 5, 2, 5, 2, 2,
+        6, 5, 8, 5, 7, 3, 5, 5, 2, 3, 3, 5, 7, 2, 2, 5, 2, 3, 2, 2, 5, 2, 2, 5, 2, 5, 2, 3, 3, 5, 7, 5,
+        5, 5, 6, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 5, 5, 5, 10, 3, 2, 2, 4, 2, 2, 2, 2, 4, 2, 2, 2,
+        2, 3, 2, 3, 2, 2, 2, 2, 4, 5, 2, 4, 2, 5, 5, 4, 5, 5, 2, 2, 5, 4, 5, 5, 3, 5, 2, 8, 4, 7, 8, 5,
+        5, 4, 8, 5, 2, 5, 5, 2, 5, 2, 5, 4, 2, 8, 5, 3, 5, 5, 6, 4, 2, 2, 3, 6, 2, 2, 6, 5, 2, 2, 2, 2,
+        5, 5, 3, 3, 4, 10, 3, 4, 2, 4, 2, 2, 3, 3, 3, 5, 10, 2, 2, 2, 5, 4, 2, 5, 5, 5, 3, 2, 2, 2, 5, 5,
+        4, 2, 4, 2, 4, 2, 5, 3, 5, 5, 2, 4, 8, 2, 2, 2, 4, 10, 6, 3, 6, 5, 2, 3, 5, 5, 2, 2, 2, 5, 5, 2,
+        7, 2, 2, 2, 2, 6, 2, 2, 2, 6, 3, 2, 2, 3, 5, 5, 2, 2, 6, 5, 2, 2, 7, 5, 5, 4, 4, 3, 3, 5, 3, 7,
+        2, 5, 5, 5, 5, 2, 3, 4, 4, 2, 5, 5, 5, 7, 2, 4, 7, 5, 6, 2, 6, 5, 3, 2, 3, 6, 6, 6, 9, 5, 5, 5,
+        8, 6, 3, 8, 2, 5, 5, 2, 3, 4, 8, 2, 2, 6, 6, 4, 5, 3, 4, 2, 5, 2, 2, 8, 2, 2, 4, 2, 2, 2, 3, 2,
+        3, 3, 3, 2, 5, 4, 5, 2, 2, 7, 2, 5, 5, 6, 2, 3, 8, 2, 2, 2, 5, 5, 2, 5, 5, 2, 2, 2, 2, 2, 4, 2,
+        2, 3, 3, 2, 4, 4, 4, 5, 4, 5, 5, 5, 2, 3, 6, 2, 3, 2, 2, 3, 3, 3, 3, 3, 4, 2, 2, 3, 2, 2, 2, 2,
+        5, 2, 5, 5, 4, 5, 2, 5, 7, 7, 5, 5, 2, 2, 5, 7, 5, 2, 6, 2, 2, 2, 5, 5, 7, 2, 2, 5, 5, 5, 5, 2,
+        2, 2, 2, 2, 2, 5, 2, 2, 2, 6, 5, 4, 2, 2, 3, 3, 2, 2, 4, 2, 2, 2, 4, 2, 10, 2, 2, 2, 2, 5, 7, 2,
+        2, 4, 8, 5, 5, 2, 5, 2, 5, 2, 5, 3, 4, 2, 2, 2, 2, 2, 5, 2, 2, 3, 2, 4, 4, 3, 3, 2, 3, 2, 2, 4,
+        5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 5, 5, 7, 2, 2, 4, 2, 5, 2, 2, 2, 2, 4, 8, 2, 4, 2, 2, 2, 2, 2, 3,
+        2, 2, 2, 2, 2, 2, 6, 2, 6, 2, 5, 2, 5, 6, 2, 2, 5, 3, 2, 4, 3, 2, 4, 2, 5, 7, 2, 2, 5, 4, 3, 2,
+        3, 2, 2, 3, 2, 2, 2, 2, 2, 4, 2, 2, 2, 3, 2, 3, 2, 3, 7, 5, 4, 6, 4, 2, 5, 3, 2, 3, 5, 5, 2, 2,
+        2, 2, 2, 2, 6, 2, 2, 5, 6, 5, 2, 2, 3, 2, 2, 4, 4, 3, 6, 10, 3, 6, 4, 3, 5, 6, 10, 3, 3, 2, 3, 2,
+        5, 3, 2, 5, 10, 5, 4, 5, 5, 3, 5, 2, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 3, 3, 2, 5, 4, 2, 2, 3, 2,
+        5, 2, 2, 5, 2, 5, 4, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 4, 4, 2, 4, 2, 2, 5, 2, 2, 4, 2,
+        2, 5, 2, 2, 5, 3, 5, 2, 2, 2, 2, 2, 5, 6, 2, 2, 2, 5, 5, 2, 4, 2, 2, 2, 2, 3, 2, 4, 2, 3, 2, 4,
+        2, 2, 2, 2, 2, 2, 2, 2, 7, 3, 4, 2, 2, 5, 1, 2, 5, 4, 6, 2, 6, 2, 2, 2, 2, 2, 2, 3, 2, 5, 2, 10,
+        8, 4, 4, 4, 4, 6, 2, 3, 2, 4, 8, 4, 2, 3, 4, 5, 2, 2, 2, 2, 8, 8, 8, 2, 4, 4, 3, 2, 4, 5, 2, 2,
+        2, 6, 5, 8, 3, 3, 3, 3, 2, 2, 2, 2, 2, 4, 4, 8, 6, 2, 2, 2, 5, 2, 2, 7, 7, 2, 4, 2, 5, 2, 5, 2,
+        3, 2, 2, 2, 2, 2, 4, 8, 4, 4, 6, 2, 3, 3, 3, 2, 7, 3, 2, 3, 3, 6, 2, 2, 8, 10, 2, 2, 5, 2, 6, 3,
+        4, 2, 2, 2, 4, 2, 4, 3, 5, 2, 2, 2, 3, 2, 3, 2, 3, 7, 2, 2, 2, 5, 2, 2, 5, 6, 5, 9, 7, 7, 2, 5,
+        2, 5, 2, 5, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 6, 7, 2, 2, 7, 3, 2, 2, 2, 5, 3, 2, 6, 7, 2, 2, 2,
+        3, 3, 11, 2, 2, 2, 2, 3, 2, 2, 5, 2, 2, 3, 5, 2, 2, 2, 2, 2, 2, 3, 8, 2, 2, 2, 5, 2, 3, 2, 2, 5,
+        6, 2, 2, 2, 2, 2, 2, 2, 7, 2, 5, 2, 3, 4, 4, 3, 3, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 5, 2, 2, 2, 2,
+        5, 5, 5, 2, 2, 5, 5, 8, 2, 8, 2, 3, 5, 5, 2, 5, 5, 4, 2, 2, 2, 2, 5, 5, 2, 3, 2, 2, 2, 2, 2, 5,
+        2, 2, 5, 9, 2, 5, 1, 2, 5, 5, 3, 2, 3, 5, 2, 4, 8, 2, 2, 7, 2, 2, 2, 2, 2, 5, 2, 2, 5, 5, 2, 2,
+        2, 2, 2, 2, 2, 2, 6, 8, 2, 2, 2, 4, 2, 3, 3, 3, 2, 2, 2, 1, 2, 2, 2, 2, 5, 2, 2, 2, 2, 7, 2, 2,
+        2, 2, 3, 3, 2, 4, 5, 2, 2, 5, 4, 2, 4, 2, 3, 2, 5, 5, 4, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 5, 2, 2,
+        5, 2, 2, 2, 5, 2, 3, 5, 3, 2, 5, 2, 3, 2, 2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 2,
+        5, 6, 6, 6, 5, 6, 2, 2, 2, 2, 2, 2, 3, 7, 4, 7, 6, 4, 4, 2, 3, 2, 2, 3, 2, 2, 2, 2, 3, 2, 2, 3,
+        3, 2, 5, 3, 3, 2, 3, 2, 2, 2, 2, 2, 2, 1, 2, 7, 2, 4, 5, 2, 2, 2, 2, 3, 2, 2, 2, 4, 2, 2, 2, 2,
+        2, 2, 8, 5, 4, 9, 5, 5, 7, 4, 5, 8, 5, 5, 8, 2, 4, 5, 8, 4, 2, 2, 2, 2, 7, 5, 5, 7, 2, 2, 2, 2,
+        5, 2, 3, 7, 4, 3, 2, 2, 2, 5, 8, 2, 6, 3, 4, 3, 2, 2, 2, 2, 4, 2, 2, 4, 2, 7, 8, 2, 2, 2, 4, 2,
+        2, 5, 6, 2, 8, 6, 3, 5, 5, 2, 3, 2, 4, 2, 5, 2, 2, 5, 5, 2, 2, 4, 3, 3, 5, 2, 2, 2, 3, 3, 3, 5,
+        6, 2, 2, 3, 2, 2, 2, 9, 4, 2, 12, 5, 2, 2, 3, 4, 2, 8, 2, 5, 2, 5, 3, 2, 2, 3, 3, 2, 2, 2, 2, 5,
+        5, 2, 2, 3, 2, 2, 4, 2, 3, 2, 3, 2, 3, 2, 5, 4, 5, 5, 3, 3, 2, 4, 2, 2, 2, 2, 3, 4, 2, 4, 4, 4,
+        5, 3, 4, 9, 2, 4, 5, 3, 2, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2,
+        2, 2, 2, 2, 4, 8, 8, 5, 5, 5, 5, 5, 5, 7, 5, 5, 2, 5, 5, 4, 2, 2, 5, 10, 3, 2, 2, 2, 2, 2, 2, 2,
+        5, 2, 4, 2, 5, 4, 2, 2, 2, 7, 4, 5, 2, 5, 5, 2, 2, 2, 5, 5, 5, 2, 2, 2, 2, 5, 4, 2, 2, 6, 5, 2,
+        2, 3, 2, 2, 2, 6, 8, 2, 4, 5, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 12, 5, 7, 4, 5, 3, 3, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 4, 2, 3, 2, 2, 3, 2, 3, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 4, 2, 4, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 4, 5, 2, 3, 2, 3, 5, 2,
+        2, 2, 2, 2, 2, 1, 4, 2, 2, 4, 3, 2, 5, 5, 2, 3, 5, 6, 5, 3, 2, 2, 6, 2, 4, 5, 4, 6, 3, 2, 5, 3,
+        2, 2, 5, 5, 4, 2, 2, 2, 2, 8, 2, 5, 2, 2, 5, 5, 5, 2, 2, 5, 6, 5, 5, 5, 5, 5, 4, 2, 2, 4, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 1, 2, 4, 2, 4, 4, 2, 5, 2, 6, 3, 5,
+        2, 2, 5, 4, 4, 5, 2, 3, 5, 5, 2, 2, 2, 3, 2, 2, 2, 5, 5, 3, 3, 7, 4, 4, 5, 2, 2, 7, 8, 7, 8, 2,
+        2, 6, 6, 2, 6, 6, 4, 8, 5, 2, 2, 2, 2, 6, 2, 5, 2, 2, 2, 2, 2, 2, 2, 7, 6, 3, 6, 2, 2, 7, 7, 4,
+        2, 7, 2, 2, 2, 6, 2, 2, 6, 2, 2, 2, 5, 5, 2, 2, 2, 3, 2, 3, 2, 4, 3, 2, 2, 6, 3, 2, 2, 2, 5, 2,
+        2, 2, 2, 2, 2, 2, 5, 2, 3, 2, 3, 3, 2, 6, 2, 5, 3, 5, 2, 2, 5, 2, 6, 4, 5, 5, 5, 5, 7, 7, 3, 6,
+        7, 3, 2, 4, 5, 4, 4, 5, 6, 5, 5, 2, 2, 4, 4, 2, 2, 2, 2, 2, 2, 3, 2, 3, 4, 4, 6, 2, 2, 2, 2, 2,
+        3, 2, 5, 5, 2, 5, 4, 2, 2, 5, 5, 2, 2, 5, 3, 2, 2, 2, 2, 2, 8, 6, 6, 2, 4, 7, 2, 2, 6, 3, 5, 2,
+        2, 2, 2, 2, 4, 2, 2, 4, 3, 2, 5, 4, 7, 4, 2, 2, 5, 4, 2, 3, 2, 2, 2, 2, 5, 4, 4, 2, 2, 2, 5, 2,
+        2, 2, 2, 3, 2, 2, 2, 2, 5, 2, 5, 3, 2, 2, 3, 6, 2, 3, 6, 5, 2, 5, 2, 5, 5, 4, 4, 2, 5, 4, 6, 10,
+        2, 5, 5, 2, 5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 5, 2, 2, 3, 10, 4, 2, 6, 2, 2, 2, 2, 2,
+        2, 5, 7, 7, 5, 3, 2, 2, 2, 3, 4, 3, 6, 3, 2, 6, 4, 2, 2, 2, 4, 2, 2, 2, 2, 2, 6, 2, 4, 6, 5, 6,
+        2, 7, 7, 7, 3, 2, 2, 6, 3, 7, 2, 2, 7, 6, 3, 6, 10, 4, 3, 8, 4, 5, 4, 5, 5, 5, 10, 2, 6, 3, 2, 4,
+        8, 5, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 5, 2, 9, 3, 6, 2, 2, 7, 2, 2, 2, 5, 10, 4, 4, 10,
+        3, 2, 4, 5, 6, 2, 2, 3, 5, 2, 2, 7, 7, 6, 2, 2, 2, 2, 2, 2, 5, 2, 4, 2, 7, 5, 2, 8, 2, 2, 2, 2,
+        4, 2, 2, 2, 8, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 9, 2, 7, 7, 2, 4, 7, 2, 4, 2, 6, 3,
+        2, 2, 3, 6, 3, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 3, 5, 2, 2, 2, 2, 3, 4, 2, 10, 4, 2, 2, 2,
+        2, 4, 4, 7, 8, 4, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 4, 2, 5, 2, 2, 2, 2, 2, 2, 2, 5, 7, 4, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 8, 3, 5, 5, 4, 6, 2, 2, 6, 5, 2, 2, 8, 2, 2, 3, 3, 6, 2, 4, 7, 2, 3, 2, 2, 2,
+        2, 3, 6, 2, 2, 5, 5, 2, 6, 5, 4, 6, 2, 2, 2, 2, 2, 2, 2, 5, 5, 2, 2, 6, 2, 2, 3, 2, 2, 2, 3, 2,
+        3, 2, 7, 5, 5, 2, 2, 6, 2, 5, 6, 10, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 11, 2,
+        4, 4, 2, 2, 2, 2, 6, 2, 2, 2, 7, 7, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 4, 6, 4, 4, 6, 2, 2, 2, 2, 5, 5, 2, 2, 3, 3,
+        2, 2, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 4, 5, 12, 2, 3, 2, 2, 3, 2, 2, 4, 4, 3, 6, 2, 5, 4, 7, 5,
+        7, 2, 6, 2, 2, 2, 2, 2, 6, 2, 2, 6, 5, 5, 3, 2, 4, 5, 7, 2, 2, 2, 2, 4, 4, 2, 2, 5, 5, 2, 2, 2,
+        2, 6, 2, 2, 3, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 6, 10, 2, 2, 2, 2, 2,
+        7, 2, 2, 6, 2, 8, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 4, 12, 5, 5, 2, 5, 5, 2, 2, 6,
+        2, 7, 2, 4, 3, 2, 2, 2, 2, 2, 2, 2, 7, 2, 2, 2, 2, 2, 2, 5, 8, 2, 3, 3, 2, 5, 2, 2, 2, 5, 2, 2,
+        3, 2, 2, 2, 8, 9, 2, 4, 6, 5, 9, 2, 3, 6, 2, 8, 6, 5, 2, 2, 6, 3, 5, 5, 5, 2, 6, 3, 2, 6, 2, 4,
+        3, 2, 6, 3, 5, 2, 5, 3, 4, 2, 2, 2, 2, 5, 8, 2, 8, 8, 2, 6, 2, 8, 9, 7, 9, 2, 13, 9, 7, 9, 5, 8,
+        2, 3, 8, 2, 5, 2, 8, 5, 5, 4, 2, 6, 5, 7, 5, 2, 2, 7, 2, 2, 2, 2, 4, 5, 4, 4, 2, 2, 2, 3, 2, 5,
+        5, 5, 2, 2, 2, 2, 2, 2, 2, 12, 9, 7, 2, 3, 3, 3, 3, 4, 3, 3, 5, 2, 2, 7, 3, 2, 3, 2, 2, 4, 2, 5,
+        7, 4, 3, 5, 2, 3, 2, 5, 5, 2, 5, 3, 2, 6, 8, 2, 2, 6, 7, 7, 5, 5, 2, 5, 7, 7, 6, 2, 2, 7, 7, 7,
+        5, 6, 6, 5, 2, 3, 2, 7, 5, 2, 2, 8, 2, 7, 3, 6, 6, 6, 6, 5, 3, 11, 8, 6, 5, 5, 5, 7, 5, 8, 9, 5,
+        5, 5, 5, 5, 7, 6, 5, 2, 9, 6, 7, 7, 7, 2, 7, 7, 2, 7, 5, 5, 3, 6, 2, 5, 3, 7, 3, 2, 2, 2, 6, 5,
+        5, 2, 5, 2, 5, 7, 2, 5, 2, 5, 2, 3, 4, 7, 2, 2, 2, 2, 2, 2, 2, 3, 2, 5, 5, 5, 5, 7, 2, 5, 3, 2,
+        2, 3, 2, 2, 2, 9, 5, 2, 5, 2, 2, 5, 5, 5, 2, 5, 5, 5, 5, 2, 2, 3, 3, 2, 2, 2, 5, 5, 5, 2, 2, 2,
+        2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 3, 3, 2, 5, 2, 2, 3, 6, 9,
+        2, 5, 6, 2, 2, 2, 6, 2, 2, 2, 2, 5, 2, 5, 3, 2, 2, 4, 2, 2, 5, 5, 5, 5, 2, 5, 5, 4, 8, 4, 2, 6,
+        6, 2, 2, 4, 3, 2, 8, 5, 5, 2, 2, 2, 2, 2, 2, 2, 3, 2, 5, 3, 3, 2, 2, 6, 4, 5, 2, 2, 2, 3, 2, 5,
+        5, 2, 6, 5, 7, 2, 5, 5, 3, 3, 3, 2, 5, 5, 5, 6, 6, 2, 2, 5, 6, 2, 2, 5, 5, 5, 5, 2, 5, 5, 2, 5,
+        5, 5, 5, 2, 5, 2, 2, 5, 2, 5, 5, 2, 2, 2, 2, 8, 4, 5, 6, 2, 4, 3, 4, 3, 2, 4, 3, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 9, 7, 7, 2, 2, 7, 6, 5, 7, 8, 4, 5, 3, 5, 6, 9, 4, 4, 4, 4, 2, 2, 2, 2, 5, 2, 2,
+        2, 5, 6, 5, 5, 3, 5, 6, 2, 7, 3, 5, 2, 3, 2, 8, 5, 5, 8, 8, 5, 4, 5, 6, 5, 2, 6, 2, 4, 2, 2, 2,
+        4, 2, 5, 4, 2, 3, 2, 2, 2, 4, 2, 2, 6, 5, 5, 3, 2, 6, 5, 4, 5, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 3, 2, 3, 2, 3, 5, 3, 4, 6, 2, 7, 2, 4, 2, 2, 6, 4, 2, 2, 2, 2, 2, 6, 2, 2, 2, 6, 2, 4,
+        2, 2, 2, 2, 2, 3, 3, 2, 2, 6, 4, 2, 5, 5, 6, 7, 3, 5, 2, 2, 5, 2, 5, 2, 2, 2, 4, 4, 5, 5, 2, 4,
+        2, 4, 2, 2, 2, 2, 3, 2, 3, 2, 3, 2, 5, 7, 2, 2, 5, 2, 2, 2, 5, 2, 2, 4, 3, 2, 2, 2, 2, 2, 2, 5,
+        2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 5, 4, 2, 2, 2, 2, 3, 2, 2, 3, 5, 5, 5, 2, 2, 2, 2, 2, 5, 2,
+        3, 5, 2, 4, 7, 4, 5, 2, 2, 2, 2, 2, 3, 2, 2, 3, 3, 5, 2, 4, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 1,
+        1, 2, 2, 2, 2, 2, 6, 3, 2, 4, 2, 4, 7, 7, 4, 5, 8, 2, 3, 2, 8, 9, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 5, 4, 2, 3, 3, 4, 3, 4, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 10, 2, 2,
+        4, 5, 5, 5, 5, 5, 5, 4, 1, 3, 5, 5, 7, 7, 5, 2, 2, 3, 6, 5, 2, 2, 2, 2, 5, 6, 7, 6, 7, 2, 7, 2,
+        2, 2, 2, 3, 2, 2, 4, 4, 5, 2, 2, 4, 5, 5, 5, 4, 2, 5, 5, 6, 6, 5, 5, 6, 7, 7, 5, 2, 7, 5, 3, 5,
+        10, 6, 6, 2, 5, 4, 3, 4, 6, 5, 5, 5, 5, 5, 3, 4, 2, 4, 2, 2, 2, 2, 6, 2, 2, 2, 4, 3, 5, 2, 5, 5,
+        5, 5, 5, 5, 3, 4, 5, 5, 5, 5, 5, 5, 2, 2, 6, 2, 2, 2, 2, 10, 2, 4, 2, 2, 2, 2, 3, 5, 3, 5, 5, 5,
+        2, 2, 2, 2, 5, 2, 8, 5, 5, 5, 5, 2, 3, 2, 3, 4, 2, 2, 2, 2, 5, 2, 5, 2, 2, 2, 7, 2, 2, 2, 6, 2,
+        5, 4, 3, 2, 3, 2, 2, 9, 9, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2, 2, 2, 5, 2, 2, 2, 3, 4, 2,
+        2, 2, 5, 3, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 2, 6, 2, 6, 2, 2, 2, 2, 5, 5, 4, 2, 2, 2, 3,
+        2, 3, 2, 3, 5, 5, 5, 2, 2, 2, 2, 4, 2, 3, 4, 2, 2, 3, 2, 3, 3, 5, 5, 10, 2, 2, 2, 2, 2, 2, 2, 8,
+        4, 2, 4, 5, 7, 2, 5, 7, 5, 4, 2, 9, 2, 2, 5, 5, 5, 2, 3, 2, 6, 7, 2, 3, 3, 6, 3, 4, 5, 5, 5, 4,
+        3, 4, 4, 3, 7, 8, 2, 2, 2, 2, 2, 6, 5, 5, 2, 2, 2, 6, 3, 6, 3, 2, 2, 5, 2, 2, 7, 8, 2, 2, 5, 7,
+        2, 2, 5, 2, 2, 2, 5, 5, 5, 6, 6, 2, 5, 6, 6, 2, 5, 5, 6, 6, 6, 7, 6, 6, 2, 5, 5, 5, 3, 5, 4, 8,
+        5, 3, 2, 3, 4, 2, 2, 5, 7, 2, 2, 5, 2, 5, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 4, 5, 2, 7, 5, 2,
+        2, 5, 3, 4, 7, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 4, 2, 5, 5, 4, 2, 2, 6, 2, 5,
+        4, 2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 6, 5, 3, 2, 4, 2, 5, 4, 5, 2, 5, 2, 2, 2, 6, 2, 5,
+        2, 3, 5, 2, 2, 5, 2, 5, 5, 5, 5, 3, 3, 2, 6, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 2, 3, 5, 2, 2,
+        9, 2, 2, 5, 4, 2, 9, 3, 2, 5, 5, 2, 2, 2, 2, 4, 2, 2, 2, 2, 4, 5, 2, 5, 5, 2, 5, 2, 5, 9, 8, 7,
+        5, 5, 5, 5, 2, 2, 2, 5, 5, 2, 2, 5, 5, 5, 5, 5, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 8, 2, 5, 2,
+        2, 5, 5, 2, 2, 6, 5, 5, 5, 2, 5, 5, 5, 5, 4, 8, 3, 3, 2, 2, 2, 5, 3, 5, 5, 5, 5, 2, 5, 2, 10, 2,
+        5, 5, 2, 6, 2, 5, 2, 4, 3, 3, 5, 4, 5, 5, 5, 3, 4, 4, 2, 8, 9, 2, 3, 2, 2, 4, 4, 2, 2, 5, 2, 3,
+        2, 3, 2, 2, 5, 2, 3, 2, 4, 5, 5, 2, 3, 2, 2, 2, 2, 3, 4, 7, 2, 7, 4, 7, 2, 3, 2, 2, 2, 3, 5, 2,
+        5, 2, 2, 4, 2, 2, 2, 3, 2, 5, 2, 2, 2, 2, 3, 6, 3, 2, 7, 3, 6, 6, 3, 2, 4, 4, 2, 5, 4, 3, 4, 2,
+        5, 3, 2, 3, 4, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 2, 3, 2, 2, 4, 6, 4, 3, 2, 8, 6, 5, 2, 7, 2, 3,
+        2, 2, 3, 5, 5, 2, 2, 2, 3, 2, 2, 7, 3, 3, 3, 5, 2, 8, 7, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 3,
+        2, 3, 3, 5, 2, 5, 2, 2, 2, 2, 2, 5, 5, 2, 3, 3, 4, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 3, 2, 7, 7, 7,
+        2, 2, 2, 2, 2, 6, 7, 7, 2, 3, 2, 2, 2, 5, 10, 7, 10, 5, 5, 7, 9, 6, 6, 6, 6, 9, 12, 9, 9, 3, 8, 3,
+        6, 8, 4, 8, 3, 9, 8, 7, 5, 2, 4, 5, 4, 2, 8, 6, 8, 3, 2, 6, 7, 7, 2, 5, 5, 2, 7, 7, 3, 2, 2, 2,
+        2, 3, 6, 2, 9, 3, 3, 2, 2, 7, 7, 8, 8, 2, 4, 5, 8, 7, 3, 4, 2, 5, 7, 3, 2, 2, 4, 3, 3, 3, 3, 7,
+        8, 4, 2, 3, 6, 5, 7, 7, 2, 3, 3, 9, 9, 5, 2, 6, 8, 3, 5, 7, 4, 4, 5, 4, 2, 3, 5, 2, 7, 5, 7, 2,
+        2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 3, 7, 2, 4,
+        2, 2, 8, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 4, 5, 3, 2, 2, 3, 2, 3, 3, 4, 3, 3, 2, 3, 3, 2, 2, 2,
+        4, 2, 2, 5, 5, 5, 8, 11, 8, 4, 7, 3, 4, 2, 3, 7, 5, 8, 3, 3, 4, 2, 5, 3, 5, 5, 9, 5, 2, 2, 2, 5,
+        5, 6, 4, 5, 5, 5, 5, 2, 2, 2, 5, 2, 8, 5, 2, 2, 2, 2, 5, 2, 2, 2, 6, 5, 5, 4, 2, 5, 2, 6, 6, 2,
+        2, 5, 2, 5, 5, 5, 5, 5, 5, 2, 5, 5, 2, 5, 2, 5, 2, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 4, 7, 2,
+        2, 2, 3, 5, 3, 7, 7, 7, 5, 2, 5, 2, 5, 2, 2, 2, 2, 3, 5, 5, 2, 2, 2, 6, 5, 2, 2, 2, 4, 5, 2, 5,
+        5, 3, 4, 5, 4, 5, 5, 2, 2, 2, 2, 5, 2, 2, 2, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 2, 3, 5, 5, 5, 5,
+        2, 8, 5, 2, 5, 5, 2, 5, 5, 7, 6, 3, 6, 5, 2, 6, 9, 5, 5, 5, 5, 5, 5, 5, 2, 5, 2, 2, 2, 6, 2, 2,
+        2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 5, 2, 2, 2, 5, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 6, 5, 5,
+        2, 2, 3, 2, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 6, 6, 2, 2, 5, 4, 2, 2, 4, 5, 2, 5,
+        5, 2, 5, 5, 5, 5, 5, 5, 3, 3, 5, 5, 5, 5, 2, 5, 2, 5, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 2, 5, 2, 5, 5, 5, 5, 5, 5, 5, 2, 5, 5, 4, 4, 4, 5, 2, 2, 5, 2, 2, 2, 4, 2, 3,
+        2, 2, 7, 2, 2, 3, 3, 3, 2, 2, 3, 3, 3, 7, 3, 3, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 5, 3,
+        5, 3, 4, 2, 2, 4, 5, 2, 3, 2, 5, 5, 2, 5, 6, 4, 2, 2, 6, 2, 2, 3, 5, 5, 4, 2, 3, 2, 2, 2, 2, 4,
+        2, 2, 8, 2, 2, 5, 2, 2, 4, 3, 2, 2, 4, 5, 2, 9, 9, 5, 6, 2, 2, 6, 2, 2, 4, 8, 2, 9, 5, 4, 4, 2,
+        5, 5, 5, 2, 2, 3, 3, 2, 2, 2, 5, 7, 5, 7, 4, 9, 4, 2, 8, 9, 8, 2, 2, 2, 8, 6, 2, 2, 6, 5, 2, 6,
+        2, 2, 2, 5, 5, 5, 5, 8, 2, 3, 3, 5, 2, 3, 4, 5, 5, 2, 6, 4, 4, 4, 7, 2, 9, 2, 2, 5, 5, 3, 2, 2,
+        9, 7, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 2, 3, 3, 2, 2, 2, 3, 4, 2, 2, 2, 2, 5, 5,
+        2, 2, 2, 7, 2, 2, 5, 3, 2, 7, 3, 3, 3, 2, 2, 2, 2, 2, 5, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 6, 5,
+        5, 4, 2, 7, 2, 8, 4, 4, 5, 8, 2, 2, 3, 8, 8, 8, 7, 8, 11, 2, 5, 8, 5, 8, 7, 12, 7, 7, 5, 5, 7, 5,
+        7, 2, 5, 8, 5, 2, 5, 6, 5, 5, 9, 5, 5, 2, 2, 5, 2, 3, 5, 6, 2, 2, 5, 5, 6, 7, 10, 5, 7, 3, 3, 2,
+        2, 2, 2, 2, 8, 5, 2, 5, 2, 2, 5, 5, 2, 5, 2, 5, 5, 8, 2, 7, 5, 2, 3, 6, 5, 2, 4, 2, 2, 2, 5, 2,
+        2, 8, 4, 7, 3, 8, 8, 5, 7, 5, 5, 8, 4, 7, 2, 3, 2, 2, 7, 2, 2, 5, 2, 2, 5, 2, 4, 4, 5, 5, 3, 5,
+        5, 2, 8, 2, 2, 2, 8, 2, 8, 2, 7, 8, 8, 5, 5, 2, 5, 2, 5, 5, 2, 2, 2, 2, 4, 2, 4, 5, 9, 2, 4, 2,
+        4, 2, 2, 2, 2, 2, 2, 3, 3, 7, 8, 2, 5, 6, 2, 6, 5, 11, 5, 5, 5, 5, 8, 6, 2, 2, 4, 2, 5, 2, 2, 2,
+        2, 3, 2, 11, 8, 2, 11, 5, 5, 5, 6, 4, 7, 2, 9, 2, 6, 8, 8, 6, 2, 5, 4, 5, 5, 4, 4, 2, 4, 5, 4, 4,
+        4, 8, 5, 4, 4, 5, 5, 5, 5, 2, 6, 4, 4, 4, 6, 2, 4, 2, 4, 6, 5, 7, 4, 4, 4, 6, 5, 6, 2, 4, 6, 4,
+        3, 4, 2, 6, 4, 5, 2, 4, 5, 6, 10, 8, 4, 5, 8, 2, 8, 8, 5, 4, 5, 5, 2, 2, 2, 5, 2, 2, 4, 6, 6, 4,
+        6, 4, 4, 4, 4, 7, 2, 2, 5, 8, 5, 5, 5, 5, 4, 4, 4, 5, 4, 4, 4, 4, 4, 5, 5, 2, 4, 4, 3, 5, 4, 2,
+        5, 5, 4, 4, 5, 8, 4, 5, 5, 5, 4, 4, 4, 6, 2, 4, 5, 2, 5, 5, 2, 2, 4, 5, 2, 6, 2, 2, 2, 2, 6, 6,
+        2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 5, 4, 5, 4, 5, 4, 4, 5, 4, 4, 5, 5, 5, 5, 2, 6, 2,
+        4, 4, 5, 6, 5, 2, 2, 6, 2, 2, 7, 4, 5, 4, 5, 2, 8, 5, 6, 4, 4, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 6, 4, 4, 5, 8, 6, 7, 6, 7, 6, 7, 8, 8, 6, 7, 8, 7, 6, 9, 2, 8, 9, 2, 2, 8, 6, 7,
+        6, 2, 6, 7, 10, 6, 7, 10, 2, 10, 10, 9, 2, 5, 2, 8, 6, 6, 5, 6, 2, 2, 2, 2, 2, 6, 2, 6, 8, 7, 11, 8,
+        2, 2, 2, 10, 6, 7, 6, 6, 6, 6, 7, 6, 7, 5, 6, 6, 7, 7, 5, 5, 7, 6, 5, 2, 5, 3, 2, 7, 2, 7, 2, 2,
+        2, 2, 8, 2, 2, 2, 2, 2, 7, 6, 6, 7, 6, 6, 6, 4, 7, 7, 6, 7, 8, 6, 6, 6, 9, 2, 6, 7, 4, 2, 8, 2,
+        2, 2, 4, 6, 7, 7, 2, 6, 8, 9, 2, 2, 6, 7, 7, 2, 3, 4, 7, 7, 7, 6, 6, 6, 7, 6, 7, 5, 6, 5, 2, 6,
+        7, 2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 6, 5, 6, 2, 4, 5, 2, 2, 4, 4, 6, 8, 2, 1, 7, 2, 2, 5, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 6, 4, 5, 3, 3, 3, 5, 2, 3, 5, 5, 3, 4, 4, 3, 3, 5, 2, 2, 4, 6,
+        4, 1, 8, 10, 9, 9, 6, 3, 3, 3, 4, 3, 2, 3, 1, 2, 2, 3, 5, 8, 2, 4, 4, 5, 4, 6, 4, 5, 2, 5, 6, 4,
+        2, 3, 7, 4, 4, 8, 5, 6, 11, 9, 9, 5, 4, 2, 2, 6, 3, 3, 4, 2, 3, 2, 3, 2, 2, 2, 2, 2, 4, 3, 3, 4,
+        3, 4, 3, 3, 4, 3, 5, 6, 5, 4, 4, 4, 5, 6, 6, 7, 6, 5, 6, 6, 4, 5, 4, 4, 3, 2, 4, 5, 6, 6, 3, 9,
+        10, 5, 6, 5, 5, 5, 6, 5, 5, 9, 5, 6, 6, 5, 4, 5, 4, 6, 7, 10, 7, 7, 7, 6, 6, 6, 7, 7,
+    };
+
+    // Followed by 15 bytes of padding, the decoder may read that far past the last instruction
+    constexpr std::uint8_t LongModeCode[] = {
+        0x50, 0xE8, 0x19, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x7C, 0x24, 0x10, 0xE8, 0xD0, 0xFF, 0xFF, 0xFF, 0xE8, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0x05, 0x00,
+        0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x53, 0x48, 0x8D, 0x1D, 0xC8, 0xEA, 0x1A, 0x00, 0x48, 0x81, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x64,
+        0x48, 0x8B, 0x04, 0x25, 0x28, 0x00, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x98, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x48, 0x39, 0x2D, 0xA6, 0xEA, 0x1A,
+        0x00, 0x74, 0x1E, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xB1, 0x15, 0x8F, 0xEA, 0x1A, 0x00, 0x74, 0x08, 0x48, 0x89, 0xDF, 0xE8, 0xC5, 0xFC,
+        0x05, 0x00, 0x48, 0x89, 0x2D, 0x86, 0xEA, 0x1A, 0x00, 0xFF, 0x05, 0x7C, 0xEA, 0x1A, 0x00, 0x83, 0x3D, 0x81, 0xEA, 0x1A, 0x00, 0x00, 0x75, 0x29,
+        0x41, 0xBA, 0x08, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x65, 0xEA, 0x1A, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8,
+        0x0E, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x04, 0x24, 0x20, 0x00, 0x00, 0x00, 0x0F, 0x05, 0x8B, 0x05, 0x50, 0xEA, 0x1A, 0x00, 0x83, 0xF8, 0x01, 0x75,
+        0x77, 0x31, 0xC9, 0x89, 0x0D, 0x3D, 0xEA, 0x1A, 0x00, 0xFF, 0xC8, 0x89, 0x05, 0x29, 0xEA, 0x1A, 0x00, 0x75, 0x1B, 0x87, 0x05, 0x14, 0xEA, 0x1A,
+        0x00, 0x7E, 0x08, 0xE8, 0xF8, 0xFC, 0x05, 0x00, 0xBF, 0x06, 0x00, 0x00, 0x00, 0xE8, 0x2E, 0x5B, 0x01, 0x00, 0x74, 0x20, 0xE8, 0x13, 0xFC, 0x05,
+        0x00, 0xEB, 0x05, 0x75, 0x2E, 0xB9, 0x26, 0x00, 0x00, 0x00, 0xF3, 0xAB, 0x48, 0xC7, 0x44, 0x24, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x31, 0x5B,
+        0x01, 0x00, 0x75, 0x14, 0xE8, 0xA4, 0x5A, 0x01, 0x00, 0x75, 0x0B, 0xF4, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0xE8, 0xB3, 0xDE, 0x0A, 0x00, 0xEB, 0xFD,
+        0xE8, 0x6A, 0xFE, 0xFF, 0xFF, 0xE8, 0x65, 0xFE, 0xFF, 0xFF, 0xE8, 0x60, 0xFE, 0xFF, 0xFF, 0xE8, 0x5B, 0xFE, 0xFF, 0xFF, 0xE8, 0x56, 0xFE, 0xFF,
+        0xFF, 0xE8, 0x51, 0xFE, 0xFF, 0xFF, 0xE8, 0x4B, 0xFE, 0xFF, 0xFF, 0xE8, 0x46, 0xFE, 0xFF, 0xFF, 0xE8, 0x40, 0xFE, 0xFF, 0xFF, 0xE8, 0x3B, 0xFE,
+        0xFF, 0xFF, 0xE8, 0x35, 0xFE, 0xFF, 0xFF, 0xE8, 0x30, 0xFE, 0xFF, 0xFF, 0xE8, 0x2B, 0xFE, 0xFF, 0xFF, 0xE8, 0x26, 0xFE, 0xFF, 0xFF, 0xE8, 0x20,
+        0xFE, 0xFF, 0xFF, 0xE8, 0x1B, 0xFE, 0xFF, 0xFF, 0xE8, 0x16, 0xFE, 0xFF, 0xFF, 0xE8, 0x11, 0xFE, 0xFF, 0xFF, 0xF7, 0x03, 0x00, 0x80, 0x00, 0x00,
+        0x75, 0x24, 0x48, 0x8B, 0xBB, 0x88, 0x00, 0x00, 0x00, 0x8B, 0x47, 0x04, 0x83, 0xE8, 0x01, 0x89, 0x47, 0x04, 0x75, 0x12, 0x48, 0x89, 0x57, 0x08,
+        0x87, 0x07, 0x7E, 0x05, 0xE8, 0xA6, 0xFB, 0x05, 0x00, 0xE8, 0x6E, 0x0F, 0x00, 0x00, 0xE8, 0x72, 0xFB, 0x05, 0x00, 0xE8, 0x3A, 0x0F, 0x00, 0x00,
+        0xE8, 0x3E, 0xFB, 0x05, 0x00, 0xE8, 0x06, 0x0F, 0x00, 0x00, 0xF7, 0x45, 0x00, 0x00, 0x80, 0x00, 0x00, 0xE8, 0x09, 0xFB, 0x05, 0x00, 0xE8, 0xD1,
+        0x0E, 0x00, 0x00, 0xE8, 0xD5, 0xFA, 0x05, 0x00, 0xE8, 0x9D, 0x0E, 0x00, 0x00, 0xE8, 0xA1, 0xFA, 0x05, 0x00, 0xE8, 0x69, 0x0E, 0x00, 0x00, 0xE8,
+        0x6D, 0xFA, 0x05, 0x00, 0xE8, 0x39, 0xFA, 0x05, 0x00, 0xE8, 0x01, 0x0E, 0x00, 0x00, 0xE8, 0xCD, 0x0D, 0x00, 0x00, 0xE8, 0x99, 0x0D, 0x00, 0x00,
+        0xE8, 0x9C, 0xF9, 0x05, 0x00, 0xE8, 0x64, 0x0D, 0x00, 0x00, 0xE8, 0x67, 0xF9, 0x05, 0x00, 0xE8, 0x2F, 0x0D, 0x00, 0x00, 0xE8, 0xF6, 0x0C, 0x00,
+        0x00, 0xE8, 0xFA, 0xF8, 0x05, 0x00, 0xE8, 0xC2, 0x0C, 0x00, 0x00, 0xE8, 0xC6, 0xF8, 0x05, 0x00, 0xE8, 0x8E, 0x0C, 0x00, 0x00, 0xE8, 0x92, 0xF8,
+        0x05, 0x00, 0xE8, 0x5A, 0x0C, 0x00, 0x00, 0xE8, 0x5E, 0xF8, 0x05, 0x00, 0xE8, 0x2A, 0xF8, 0x05, 0x00, 0xE8, 0xF2, 0x0B, 0x00, 0x00, 0xE8, 0xBE,
+        0x0B, 0x00, 0x00, 0xE8, 0x8A, 0x0B, 0x00, 0x00, 0xE8, 0x8D, 0xF7, 0x05, 0x00, 0xE8, 0x55, 0x0B, 0x00, 0x00, 0xE8, 0x59, 0xF7, 0x05, 0x00, 0xE8,
+        0x21, 0x0B, 0x00, 0x00, 0xE8, 0x25, 0xF7, 0x05, 0x00, 0xE8, 0xED, 0x0A, 0x00, 0x00, 0xE8, 0xF1, 0xF6, 0x05, 0x00, 0xE8, 0xB9, 0x0A, 0x00, 0x00,
+        0xE8, 0xBD, 0xF6, 0x05, 0x00, 0xE8, 0x85, 0x0A, 0x00, 0x00, 0xE8, 0x89, 0xF6, 0x05, 0x00, 0x41, 0xF7, 0x07, 0x00, 0x80, 0x00, 0x00, 0x49, 0x8B,
+        0xBF, 0x88, 0x00, 0x00, 0x00, 0x31, 0xF6, 0xE8, 0x54, 0xF6, 0x05, 0x00, 0xE8, 0x1C, 0x0A, 0x00, 0x00, 0xE8, 0xE8, 0x09, 0x00, 0x00, 0xE8, 0xEC,
+        0xF5, 0x05, 0x00, 0xE8, 0xB4, 0x09, 0x00, 0x00, 0xE8, 0xB8, 0xF5, 0x05, 0x00, 0xE8, 0x80, 0x09, 0x00, 0x00, 0xE8, 0x84, 0xF5, 0x05, 0x00, 0xE8,
+        0x4C, 0x09, 0x00, 0x00, 0xE8, 0x50, 0xF5, 0x05, 0x00, 0xE8, 0x18, 0x09, 0x00, 0x00, 0xE8, 0xE4, 0x08, 0x00, 0x00, 0xE8, 0xB0, 0x08, 0x00, 0x00,
+        0xE8, 0x7C, 0x08, 0x00, 0x00, 0xE8, 0x48, 0x08, 0x00, 0x00, 0xE8, 0x14, 0x08, 0x00, 0x00, 0xE8, 0xE0, 0x07, 0x00, 0x00, 0xE8, 0xAC, 0x07, 0x00,
+        0x00, 0x41, 0xF7, 0x04, 0x24, 0x00, 0x80, 0x00, 0x00, 0x75, 0x25, 0x49, 0x8B, 0xBC, 0x24, 0x88, 0x00, 0x00, 0x00, 0xE8, 0xAD, 0xF3, 0x05, 0x00,
+        0xE8, 0x75, 0x07, 0x00, 0x00, 0xE8, 0xDF, 0xF5, 0xFF, 0xFF, 0x89, 0x54, 0x24, 0x0C, 0xE8, 0xD6, 0xF5, 0xFF, 0xFF, 0x0F, 0x0B, 0x83, 0x7C, 0x24,
+        0x10, 0x00, 0x74, 0x18, 0xFF, 0x14, 0x24, 0x4C, 0x89, 0xE7, 0x89, 0x44, 0x24, 0x10, 0xE8, 0x83, 0xEB, 0x05, 0x00, 0xE8, 0x95, 0xF5, 0xFF, 0xFF,
+        0xE8, 0x8F, 0xF5, 0xFF, 0xFF, 0xE8, 0x7F, 0xF5, 0xFF, 0xFF, 0xE8, 0x79, 0xF5, 0xFF, 0xFF, 0xE8, 0x74, 0xF5, 0xFF, 0xFF, 0xE8, 0x62, 0x96, 0x0A,
+        0x00, 0xE8, 0xEA, 0x06, 0x00, 0x00, 0xE8, 0x4F, 0xF5, 0xFF, 0xFF, 0x0F, 0xB6, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xDB, 0xE8, 0xC1,
+        0x06, 0x00, 0x00, 0xE8, 0xDC, 0xF4, 0xFF, 0xFF, 0x7E, 0x0C, 0xE8, 0xC3, 0xF2, 0x05, 0x00, 0xE8, 0x8B, 0x06, 0x00, 0x00, 0xEB, 0xC8, 0x45, 0x31,
+        0xE4, 0x4C, 0x89, 0xA5, 0x08, 0xFB, 0xFF, 0xFF, 0xEB, 0xBC, 0xEB, 0xB0, 0xEB, 0xA4, 0xEB, 0x98, 0xEB, 0x8F, 0xEB, 0x86, 0xE9, 0x78, 0xFF, 0xFF,
+        0xFF, 0xE9, 0x69, 0xFF, 0xFF, 0xFF, 0xE9, 0x5A, 0xFF, 0xFF, 0xFF, 0xE9, 0x4B, 0xFF, 0xFF, 0xFF, 0xE9, 0x3F, 0xFF, 0xFF, 0xFF, 0xE8, 0x0E, 0xF2,
+        0x05, 0x00, 0xE8, 0xB5, 0x05, 0x00, 0x00, 0xE8, 0x17, 0xF1, 0x05, 0x00, 0x8B, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x1A, 0xF3, 0xFF, 0xFF,
+        0xF3, 0x0F, 0x6F, 0x06, 0x0F, 0x29, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x6F, 0x46, 0x0C, 0x0F, 0x11, 0x04, 0x25, 0x0C, 0x00, 0x00,
+        0x00, 0xE8, 0xE6, 0xF2, 0xFF, 0xFF, 0xE8, 0xE1, 0xF2, 0xFF, 0xFF, 0x49, 0x8D, 0xBF, 0x30, 0x0A, 0x00, 0x00, 0xE8, 0x7B, 0x6C, 0x06, 0x00, 0xE8,
+        0x53, 0x04, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x89, 0xFB, 0x48, 0x83, 0xEC, 0x10, 0x80, 0x3D, 0x60, 0xAE, 0x1B, 0x00, 0x00, 0x74, 0x17, 0x0F, 0xB7,
+        0x38, 0x66, 0x39, 0x78, 0x58, 0x75, 0x23, 0x89, 0x1D, 0xF4, 0xD8, 0x1A, 0x00, 0x89, 0xDF, 0x48, 0x83, 0xC4, 0x10, 0x5B, 0xE9, 0x06, 0x19, 0x0E,
+        0x00, 0x48, 0x89, 0x54, 0x24, 0x08, 0xE8, 0x68, 0x4B, 0x01, 0x00, 0x48, 0x8B, 0x34, 0x24, 0xEB, 0xC4, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x74, 0x1C, 0x64, 0x48, 0x33, 0x04, 0x25, 0x30, 0x00, 0x00, 0x00, 0x48, 0xC1, 0xC0, 0x11, 0xC3, 0x75, 0xD4, 0x75, 0xC4, 0x0F,
+        0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x44, 0x00, 0x00, 0x48, 0x8D, 0x7C, 0x24, 0x20, 0x89, 0x74, 0x24, 0x14, 0x85, 0xC0, 0x75,
+        0x4B, 0x8B, 0x7C, 0x24, 0x14, 0x48, 0x8B, 0x10, 0xFF, 0xD0, 0x89, 0xC7, 0xE8, 0xDA, 0xF1, 0x05, 0x00, 0xF0, 0xFF, 0x0D, 0x2B, 0xC0, 0x1A, 0x00,
+        0x0F, 0x94, 0xC0, 0x84, 0xC0, 0xBA, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x89, 0xD0, 0xEB, 0xF8, 0xEB,
+        0xCE, 0x0F, 0x1F, 0x40, 0x00, 0x41, 0x57, 0x49, 0x89, 0xCF, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x89, 0xF5, 0x4D, 0x85, 0xC9, 0x74, 0x0C, 0x8B,
+        0x00, 0x41, 0x89, 0xC4, 0x41, 0x83, 0xE4, 0x02, 0x0F, 0x85, 0xDE, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x28, 0x74, 0x31, 0x89, 0xEF, 0x41, 0xFF, 0xD7,
+        0x4C, 0x8B, 0x3D, 0x92, 0xBC, 0x1A, 0x00, 0x49, 0x8B, 0x3F, 0xE8, 0x52, 0xF0, 0xFF, 0xFF, 0x45, 0x85, 0xE4, 0x89, 0xEE, 0xE8, 0xCB, 0xFE, 0xFF,
+        0xFF, 0x4D, 0x8B, 0x37, 0x74, 0x11, 0x49, 0x03, 0x0E, 0xFF, 0xD1, 0x74, 0xAE, 0x48, 0x03, 0x4F, 0x08, 0x48, 0xC1, 0xEE, 0x03, 0x85, 0xF6, 0x74,
+        0x94, 0x83, 0xEE, 0x01, 0x4C, 0x8D, 0x71, 0x08, 0x49, 0x8D, 0x04, 0xF6, 0xEB, 0x08, 0x49, 0x83, 0xC6, 0x08, 0xFF, 0x11, 0x4C, 0x39, 0x74, 0x24,
+        0x08, 0x75, 0xE8, 0xE9, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x18, 0x03, 0x00, 0x00, 0xE9, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x18, 0x03, 0x00,
+        0x00, 0xE9, 0x04, 0xFF, 0xFF, 0xFF, 0xBA, 0xC1, 0x01, 0x00, 0x00, 0xE9, 0x4A, 0x0F, 0x0D, 0x00, 0xE8, 0xAF, 0xCF, 0x0A, 0x00, 0xBE, 0x01, 0x00,
+        0x00, 0x00, 0x74, 0x10, 0x48, 0x81, 0xC4, 0x90, 0x00, 0x00, 0x00, 0x5D, 0x41, 0x5C, 0x64, 0x83, 0x38, 0x09, 0x75, 0xE3, 0x81, 0xFD, 0x00, 0x00,
+        0x02, 0x00, 0x41, 0x0F, 0x95, 0xC4, 0x48, 0x0F, 0x44, 0xF8, 0x4E, 0x8D, 0x24, 0xA5, 0x03, 0x01, 0x00, 0x00, 0x39, 0xC3, 0x75, 0x15, 0xE8, 0x33,
+        0x03, 0x0D, 0x00, 0x74, 0x0A, 0x8B, 0x44, 0x24, 0x18, 0x25, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x20, 0x00, 0x00, 0x75, 0xED, 0x75, 0xE6, 0xE9,
+        0x79, 0xFF, 0xFF, 0xFF, 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0x00, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE9,
+        0x1E, 0xFF, 0xFF, 0xFF, 0xE8, 0xC7, 0x11, 0x0E, 0x00, 0x48, 0xC1, 0xC8, 0x11, 0xFF, 0xE0, 0x66, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x4D, 0x89, 0xC6, 0xE8, 0x76, 0x11, 0x0E, 0x00, 0x74, 0x28, 0x41, 0x5D, 0x41, 0x5E, 0xE8, 0x7D, 0x7E, 0x05, 0x00, 0x66, 0x90, 0xE8,
+        0x1E, 0x11, 0x0E, 0x00, 0xE8, 0x2D, 0x7E, 0x05, 0x00, 0xE8, 0xD7, 0x10, 0x0E, 0x00, 0xE8, 0xEF, 0x7D, 0x05, 0x00, 0x64, 0x48, 0x03, 0x04, 0x25,
+        0x00, 0x00, 0x00, 0x00, 0x48, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x22, 0xE8, 0x3C, 0x02, 0x00, 0x00, 0x89, 0xC5, 0x85, 0xED, 0x75, 0x1E,
+        0x64, 0x48, 0x2B, 0x14, 0x25, 0x28, 0x00, 0x00, 0x00, 0x75, 0x31, 0x83, 0xED, 0x01, 0x83, 0xFD, 0x01, 0x76, 0x10, 0xEB, 0xD6, 0x64, 0xC7, 0x00,
+        0x16, 0x00, 0x00, 0x00, 0xEB, 0xE0, 0x0F, 0x84, 0x9D, 0x00, 0x00, 0x00, 0x49, 0x8B, 0x14, 0x24, 0x4D, 0x03, 0x45, 0x00, 0x4C, 0x01, 0xFA, 0x4C,
+        0x2B, 0x3B, 0x4D, 0x01, 0x3C, 0x24, 0x4C, 0x2B, 0x75, 0x00, 0x0F, 0x87, 0xD6, 0x00, 0x00, 0x00, 0x89, 0xC0, 0x48, 0x63, 0x04, 0x82, 0x48, 0x01,
+        0xD0, 0x41, 0x5F, 0x74, 0x6B, 0x74, 0x63, 0x4C, 0x8B, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x54, 0x00, 0x00, 0x00, 0x64, 0x89, 0x02, 0xEB,
+        0x9C, 0xB8, 0x09, 0x00, 0x00, 0x00, 0xEB, 0xDE, 0x74, 0x1B, 0x4D, 0x8B, 0x45, 0x00, 0x4D, 0x01, 0xF0, 0xE9, 0x33, 0xFF, 0xFF, 0xFF, 0x0F, 0x86,
+        0x2A, 0xFF, 0xFF, 0xFF, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0xE8, 0xE7, 0xD5, 0x00, 0x00, 0xB8, 0x16, 0x00, 0x00, 0x00, 0xE9, 0x6B, 0xFF, 0xFF, 0xFF,
+        0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00, 0xB8, 0x07, 0x00, 0x00, 0x00, 0xE9, 0x5B, 0xFF, 0xFF, 0xFF, 0x90, 0x48, 0x83, 0xFF, 0xFF, 0x74, 0x1A, 0xE8,
+        0x71, 0x05, 0x00, 0x00, 0xF7, 0xD8, 0x19, 0xC0, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x8B, 0x6F, 0x08, 0x0F, 0xB6, 0x5F, 0x11, 0x41, 0x80, 0x7D,
+        0x00, 0x2F, 0x88, 0x45, 0xA7, 0x41, 0x80, 0x3E, 0x2F, 0x75, 0x07, 0x74, 0x60, 0x48, 0x8D, 0x4D, 0xC0, 0x45, 0x89, 0xF8, 0xE8, 0xD2, 0x12, 0x00,
+        0x00, 0x89, 0x45, 0xA0, 0x8B, 0x45, 0xA0, 0x75, 0x99, 0x64, 0x48, 0x8B, 0x00, 0x48, 0x83, 0xE0, 0xF0, 0x48, 0x29, 0xC4, 0x4C, 0x8D, 0x74, 0x24,
+        0x0F, 0x49, 0x83, 0xE6, 0xF0, 0xE8, 0x5D, 0xE6, 0xFF, 0xFF, 0xBA, 0x2F, 0x2F, 0x00, 0x00, 0x66, 0x89, 0x10, 0xC6, 0x40, 0x02, 0x00, 0xE9, 0x44,
+        0xFF, 0xFF, 0xFF, 0xE8, 0xCC, 0xE6, 0xFF, 0xFF, 0xE8, 0xF9, 0xE5, 0xFF, 0xFF, 0xB9, 0x2F, 0x2F, 0x00, 0x00, 0xE9, 0xD3, 0xFE, 0xFF, 0xFF, 0x4B,
+        0x8D, 0x54, 0x6D, 0x00, 0x48, 0xC1, 0xE2, 0x04, 0xE8, 0xCF, 0xE8, 0xFF, 0xFF, 0x4D, 0x8D, 0x77, 0x38, 0x01, 0xDB, 0xEB, 0x62, 0x49, 0x8D, 0x44,
+        0x24, 0xFF, 0x49, 0x39, 0xC7, 0x0F, 0x83, 0x8D, 0x00, 0x00, 0x00, 0x41, 0x89, 0x5E, 0xE8, 0x42, 0x69, 0x74, 0x28, 0x54, 0xE0, 0x1F, 0x00, 0x00,
+        0x48, 0x63, 0xF6, 0x49, 0x89, 0x46, 0xD8, 0x74, 0x7C, 0x4D, 0x39, 0xE7, 0x80, 0x7D, 0xA7, 0x00, 0x4D, 0x89, 0x76, 0xF8, 0x74, 0x9B, 0x4A, 0x8B,
+        0x7C, 0x28, 0x18, 0xE8, 0xBF, 0xE5, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xD8, 0x83, 0xC8, 0x08, 0x85, 0xD2, 0x0F, 0x44, 0xD8, 0x0F, 0x82, 0x73, 0xFF,
+        0xFF, 0xFF, 0x4B, 0x8D, 0x04, 0x7F, 0x83, 0xCB, 0x01, 0x89, 0x5C, 0x01, 0x20, 0xE9, 0xEA, 0xFD, 0xFF, 0xFF, 0x64, 0x44, 0x8B, 0x33, 0x49, 0x83,
+        0xEC, 0x01, 0xE8, 0x93, 0xE7, 0xFF, 0xFF, 0x49, 0x83, 0xFC, 0xFF, 0x75, 0xE9, 0xC7, 0x45, 0xA0, 0x03, 0x00, 0x00, 0x00, 0xE9, 0x80, 0xFD, 0xFF,
+        0xFF, 0xE8, 0xCA, 0x05, 0x0F, 0x00, 0xEB, 0xCD, 0x49, 0xC7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x74, 0x03, 0x4C, 0x89, 0x40, 0x18, 0x48, 0x83, 0x38,
+        0x00, 0x74, 0x0D, 0x49, 0xC1, 0xCF, 0x11, 0x64, 0x4C, 0x33, 0x3C, 0x25, 0x30, 0x00, 0x00, 0x00, 0x49, 0x83, 0x3B, 0x00, 0x4C, 0x89, 0x54, 0x24,
+        0x10, 0xEB, 0x24, 0x4C, 0x39, 0xE2, 0x74, 0x3E, 0x72, 0x2E, 0x6A, 0x00, 0x4C, 0x8B, 0x4C, 0x24, 0x10, 0x5A, 0x59, 0x74, 0xBA, 0x74, 0x14, 0x49,
+        0xC1, 0xE4, 0x04, 0x48, 0xF7, 0xD8, 0x83, 0xC0, 0x02, 0x5E, 0x5F, 0x75, 0x1F, 0xC7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x73, 0xED, 0xB8, 0x08, 0x00,
+        0x00, 0x00, 0xBA, 0x2A, 0x00, 0x00, 0x00, 0xE8, 0x63, 0xD0, 0x00, 0x00, 0xBA, 0x48, 0x00, 0x00, 0x00, 0xE8, 0x44, 0xD0, 0x00, 0x00, 0xF6, 0x43,
+        0x10, 0x01, 0xE9, 0x3D, 0x10, 0x00, 0x00, 0x8B, 0x43, 0x10, 0xA8, 0x01, 0x74, 0xC0, 0xEB, 0xB2, 0xE9, 0x45, 0xE4, 0xFF, 0xFF, 0xE8, 0x29, 0xE4,
+        0xFF, 0xFF, 0xE9, 0x12, 0xE4, 0xFF, 0xFF, 0x74, 0x3F, 0x83, 0x6B, 0x10, 0x01, 0x75, 0x32, 0xFF, 0xD5, 0xE8, 0x9E, 0x9C, 0x00, 0x00, 0x48, 0xC7,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0x7B, 0x40, 0x00, 0x74, 0xF2, 0xBA, 0xE1, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x45, 0xFE, 0xE8, 0x32, 0xAE,
+        0x0D, 0x00, 0x8D, 0x50, 0x01, 0x89, 0x53, 0x10, 0x75, 0x72, 0x74, 0x69, 0x74, 0x0F, 0xE9, 0x7B, 0x08, 0x00, 0x00, 0xE8, 0xC9, 0xDF, 0xFF, 0xFF,
+        0x66, 0x0F, 0xEF, 0xC0, 0x49, 0xC7, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0F, 0x11, 0x42, 0x18, 0xE8, 0x97, 0xDF, 0xFF, 0xFF, 0x41, 0xBC,
+        0xFF, 0xFF, 0xFF, 0x7F, 0xC7, 0x85, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x44, 0x89, 0x65, 0x98, 0xEB, 0x27, 0x8B, 0x85, 0x78, 0xFF,
+        0xFF, 0xFF, 0x41, 0x39, 0x47, 0x10, 0x7C, 0x1B, 0x45, 0x8B, 0x77, 0x14, 0x41, 0x39, 0xC6, 0x7F, 0xE7, 0x74, 0xD9, 0xEB, 0x11, 0x74, 0xC3, 0x79,
+        0xE5, 0xEB, 0xE3, 0x44, 0x89, 0xF0, 0xEB, 0x52, 0x74, 0x13, 0x39, 0x5D, 0x98, 0x0F, 0x8F, 0x00, 0x01, 0x00, 0x00, 0x75, 0x16, 0x8B, 0x4D, 0x90,
+        0x39, 0x8D, 0x78, 0xFF, 0xFF, 0xFF, 0x4D, 0x8B, 0x64, 0x24, 0x28, 0x41, 0x8B, 0x47, 0x14, 0x75, 0x0D, 0x4C, 0x0F, 0x44, 0xB5, 0x58, 0xFF, 0xFF,
+        0xFF, 0x66, 0x41, 0x0F, 0x6E, 0x57, 0x10, 0x66, 0x0F, 0x6E, 0xC0, 0xF3, 0x41, 0x0F, 0x7E, 0x4C, 0x24, 0x10, 0x66, 0x0F, 0x62, 0xC2, 0x66, 0x0F,
+        0xFE, 0xC1, 0x66, 0x0F, 0x70, 0xD8, 0xE1, 0x66, 0x0F, 0x7E, 0x65, 0x90, 0x66, 0x0F, 0xD6, 0x5D, 0x88, 0xEB, 0x16, 0x8B, 0x8D, 0x78, 0xFF, 0xFF,
+        0xFF, 0x39, 0xC1, 0x0F, 0x4E, 0xC1, 0x89, 0x85, 0x78, 0xFF, 0xFF, 0xFF, 0xE9, 0x1B, 0xFF, 0xFF, 0xFF, 0xEB, 0x14, 0xE8, 0x5F, 0xDF, 0xFF, 0xFF,
+        0x7F, 0x15, 0x0F, 0x8E, 0xD2, 0xFE, 0xFF, 0xFF, 0xEB, 0x10, 0x74, 0x48, 0x74, 0xEE, 0xF3, 0x0F, 0x7E, 0x40, 0x10, 0x75, 0xEA, 0x75, 0xB8, 0x8B,
+        0x7D, 0x98, 0x8B, 0xB5, 0x78, 0xFF, 0xFF, 0xFF, 0x75, 0x05, 0x39, 0xCE, 0x0F, 0x4F, 0xF1, 0x39, 0xD7, 0x7E, 0xBF, 0x89, 0xCE, 0x89, 0xD7, 0x75,
+        0xC2, 0x89, 0x7D, 0x98, 0x89, 0xB5, 0x78, 0xFF, 0xFF, 0xFF, 0xE9, 0xEC, 0xFD, 0xFF, 0xFF, 0x89, 0x5D, 0x98, 0xE9, 0xD7, 0xFD, 0xFF, 0xFF, 0xE9,
+        0x68, 0xFE, 0xFF, 0xFF, 0xE8, 0x0D, 0xDC, 0xFF, 0xFF, 0xE9, 0x1F, 0xFE, 0xFF, 0xFF, 0xE8, 0xC8, 0xDB, 0xFF, 0xFF, 0x39, 0x48, 0x14, 0x0F, 0x8C,
+        0xB7, 0x04, 0x00, 0x00, 0x4C, 0x0F, 0x4C, 0xC0, 0x75, 0xF0, 0x4C, 0x8D, 0x2C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x8D, 0x7C, 0x2B, 0x98, 0xEB,
+        0x2B, 0xE8, 0x08, 0x18, 0x00, 0x00, 0x49, 0x89, 0x44, 0x24, 0x18, 0x4C, 0x3B, 0x28, 0x41, 0xC7, 0x44, 0x24, 0x10, 0x01, 0x00, 0x00, 0x00, 0x49,
+        0xC7, 0x44, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x2F, 0x75, 0x88, 0x66, 0x48, 0x0F, 0x6E, 0xC0, 0x0F, 0x16, 0x00, 0x49, 0x8B, 0x7C,
+        0x24, 0x30, 0xE9, 0x03, 0xFF, 0xFF, 0xFF, 0x4D, 0x3B, 0x3C, 0x24, 0x72, 0xEA, 0x44, 0x89, 0xB5, 0x78, 0xFF, 0xFF, 0xFF, 0xE8, 0x87, 0xDB, 0xFF,
+        0xFF, 0xE8, 0x7E, 0xDB, 0xFF, 0xFF, 0x85, 0xC9, 0xE9, 0x2E, 0xFF, 0xFF, 0xFF, 0xE9, 0xB2, 0xF8, 0xFF, 0xFF, 0x89, 0x4D, 0x98, 0xE8, 0xF0, 0xD7,
+        0xFF, 0xFF, 0xE8, 0xDD, 0xD7, 0xFF, 0xFF, 0xE8, 0x27, 0xDA, 0xFF, 0xFF, 0x74, 0x56, 0xE8, 0xFE, 0xD6, 0xFF, 0xFF, 0x89, 0xC8, 0xB9, 0x01, 0x00,
+        0x00, 0x00, 0xE9, 0x21, 0xFF, 0xFF, 0xFF, 0x89, 0xC1, 0xE8, 0x38, 0xD9, 0xFF, 0xFF, 0xE9, 0xAF, 0xFE, 0xFF, 0xFF, 0x75, 0x36, 0xB9, 0x03, 0x00,
+        0x00, 0x00, 0xE9, 0x63, 0xFE, 0xFF, 0xFF, 0xE8, 0xAE, 0xD8, 0xFF, 0xFF, 0xE9, 0xE8, 0xFE, 0xFF, 0xFF, 0xE9, 0x31, 0xFE, 0xFF, 0xFF, 0x73, 0x21,
+        0x72, 0xEB, 0xE9, 0x9A, 0xFE, 0xFF, 0xFF, 0xEB, 0xBB, 0xE8, 0x47, 0xD8, 0xFF, 0xFF, 0xE9, 0x96, 0xFE, 0xFF, 0xFF, 0xE8, 0x82, 0xF6, 0x0E, 0x00,
+        0xE8, 0x77, 0x88, 0x00, 0x00, 0x75, 0x2B, 0x4C, 0x8D, 0x3D, 0xEC, 0xF2, 0xFF, 0xFF, 0xE8, 0xA2, 0xA2, 0x0D, 0x00, 0x74, 0x45, 0x4C, 0x0F, 0x44,
+        0xE5, 0x74, 0x27, 0xE9, 0x6D, 0xFF, 0xFF, 0xFF, 0xEB, 0xE2, 0xE8, 0x96, 0xF5, 0x0E, 0x00, 0xE8, 0xCE, 0x11, 0x00, 0x00, 0xE8, 0xF5, 0x87, 0x00,
+        0x00, 0x74, 0x38, 0x87, 0x15, 0x68, 0xBD, 0x1A, 0x00, 0x83, 0xFA, 0x01, 0x48, 0x83, 0x3D, 0x38, 0xBD, 0x1A, 0x00, 0x00, 0xE8, 0x7A, 0xA1, 0x0D,
+        0x00, 0x74, 0x07, 0x49, 0x83, 0x3C, 0x24, 0x00, 0xE9, 0x22, 0xFF, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xA0, 0xD3, 0x05, 0x00, 0xE8,
+        0xD4, 0xD2, 0x05, 0x00, 0xE9, 0xA6, 0xFE, 0xFF, 0xFF, 0x74, 0x61, 0x74, 0x43, 0x74, 0x26, 0x7F, 0x44, 0xE8, 0xD8, 0xD2, 0x05, 0x00, 0xE9, 0xE7,
+        0xFE, 0xFF, 0xFF, 0xE8, 0xBC, 0xD2, 0x05, 0x00, 0xE9, 0xF8, 0xFE, 0xFF, 0xFF, 0xE8, 0x22, 0xF3, 0x0E, 0x00, 0xEB, 0xAE, 0xEB, 0x47, 0x75, 0x33,
+        0x75, 0xB1, 0x74, 0xE3, 0xE8, 0x0B, 0xBF, 0x00, 0x00, 0x7F, 0x10, 0xE8, 0xF4, 0xD0, 0x05, 0x00, 0xE8, 0xF7, 0xD0, 0xFF, 0xFF, 0x66, 0x0F, 0x6F,
+        0x05, 0x54, 0x21, 0x17, 0x00, 0xC6, 0x00, 0x3A, 0x0F, 0x11, 0x40, 0x01, 0xE8, 0x94, 0xD0, 0xFF, 0xFF, 0xBE, 0x3A, 0x00, 0x00, 0x00, 0xEB, 0x06,
+        0x0F, 0x95, 0xC0, 0x41, 0x01, 0xC4, 0x75, 0xD8, 0x41, 0x8D, 0x54, 0x24, 0xFF, 0x4D, 0x63, 0xFC, 0x48, 0x0F, 0xAF, 0xD0, 0x4E, 0x8D, 0x34, 0x38,
+        0x74, 0x1F, 0xE8, 0x3D, 0xCF, 0xFF, 0xFF, 0x80, 0x78, 0xFF, 0x2F, 0x48, 0x2B, 0x13, 0x48, 0x39, 0x11, 0x73, 0x03, 0x41, 0x83, 0xC4, 0x01, 0x0F,
+        0x29, 0x10, 0x0F, 0x29, 0x58, 0x10, 0x41, 0xBF, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x00, 0xE9, 0x5D, 0xFE, 0xFF, 0xFF, 0xE9, 0xD9,
+        0xFD, 0xFF, 0xFF, 0xBA, 0xAE, 0x01, 0x00, 0x00, 0xBA, 0x6A, 0x01, 0x00, 0x00, 0xBA, 0xA8, 0x01, 0x00, 0x00, 0xE8, 0x6B, 0xBB, 0x00, 0x00, 0xE9,
+        0xDE, 0xFE, 0xFF, 0xFF, 0x4C, 0x0F, 0x49, 0xF3, 0x74, 0x5A, 0x75, 0xDB, 0x74, 0x23, 0x74, 0xD4, 0x75, 0xE4, 0x41, 0x39, 0x44, 0x24, 0x10, 0x7C,
+        0x16, 0x74, 0xDA, 0x7D, 0xEC, 0x41, 0x0F, 0x11, 0x44, 0x24, 0x20, 0xE9, 0x2B, 0xCF, 0xFF, 0xFF, 0xEB, 0x92, 0x48, 0x0F, 0xBE, 0x17, 0xF6, 0x44,
+        0x50, 0x01, 0x20, 0x49, 0x0F, 0xBE, 0x57, 0x01, 0x84, 0xC9, 0xEB, 0x1A, 0x8B, 0x14, 0x96, 0x41, 0x88, 0x54, 0x24, 0xFF, 0x84, 0xD2, 0x74, 0xE0,
+        0x49, 0x0F, 0xBE, 0x54, 0x24, 0x01, 0x4D, 0x8D, 0x74, 0x24, 0x01, 0x41, 0xC6, 0x04, 0x24, 0x00, 0x74, 0x16, 0x48, 0x0F, 0xBE, 0x53, 0x01, 0x40,
+        0x84, 0xFF, 0xE9, 0x70, 0x01, 0x00, 0x00, 0x88, 0x51, 0xFF, 0x74, 0xDF, 0xC6, 0x01, 0x00, 0x0F, 0xB7, 0x34, 0x70, 0x66, 0xF7, 0xC6, 0x00, 0x20,
+        0x75, 0x2C, 0xE9, 0x41, 0x01, 0x00, 0x00, 0x41, 0x88, 0x50, 0xFF, 0x0F, 0xB6, 0x13, 0xC6, 0x07, 0x00, 0xBA, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0x58,
+        0xF6, 0x01, 0x00, 0x48, 0x39, 0x5D, 0xB0, 0x89, 0x55, 0x94, 0x3C, 0x2F, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x03, 0x00, 0x00, 0x00, 0x4C, 0x29,
+        0xF8, 0xC6, 0x04, 0x17, 0x00, 0x74, 0x5D, 0x41, 0xC6, 0x03, 0x00, 0x31, 0xDB, 0x41, 0x81, 0x78, 0xFC, 0x2E, 0x73, 0x6F, 0x00, 0x8D, 0x1C, 0x5B,
+        0xE9, 0x3C, 0xFF, 0xFF, 0xFF, 0x4D, 0x29, 0xF8, 0x74, 0x8E, 0xE8, 0x37, 0xC9, 0xFF, 0xFF, 0x75, 0x41, 0x85, 0xDB, 0x74, 0x09, 0x8B, 0x15, 0xAE,
+        0xD3, 0x16, 0x00, 0x89, 0x50, 0xFF, 0xE8, 0xB7, 0xFB, 0xFF, 0xFF, 0xE9, 0x02, 0xFF, 0xFF, 0xFF, 0xE9, 0x13, 0xFD, 0xFF, 0xFF, 0xEB, 0xA6, 0x74,
+        0x54, 0xE8, 0xAA, 0xCA, 0xFF, 0xFF, 0x49, 0x29, 0xEC, 0x74, 0x05, 0x48, 0x3B, 0x18, 0x74, 0x15, 0xE9, 0x3B, 0xCB, 0xFF, 0xFF, 0xE8, 0x5C, 0xCA,
+        0x04, 0x00, 0x80, 0xCE, 0x80, 0xA8, 0x10, 0x0F, 0x88, 0x9B, 0x00, 0x00, 0x00, 0xBE, 0x23, 0x00, 0x00, 0x00, 0x41, 0xF6, 0x44, 0x56, 0x01, 0x20,
+        0x75, 0xEF, 0x74, 0x4A, 0xEB, 0x3D, 0x74, 0xEB, 0x74, 0x7F, 0x75, 0x11, 0x81, 0x3B, 0x6D, 0x6F, 0x64, 0x75, 0xF6, 0x45, 0x00, 0x10, 0x4A, 0x8D,
+        0x54, 0x3B, 0xFF, 0x80, 0x3A, 0x0A, 0xC6, 0x02, 0x00, 0xE9, 0x2F, 0xFF, 0xFF, 0xFF, 0x75, 0x90, 0x80, 0x7B, 0x04, 0x73, 0x75, 0x8A, 0x49, 0x0F,
+        0xBE, 0x17, 0xEB, 0x1C, 0x8B, 0x04, 0x96, 0x88, 0x41, 0xFF, 0x4C, 0x0F, 0xBE, 0x49, 0x01, 0x43, 0xF6, 0x44, 0x4E, 0x01, 0x20, 0x75, 0xEC, 0xE9,
+        0xE6, 0xFE, 0xFF, 0xFF, 0x42, 0x8B, 0x14, 0x8E, 0x88, 0x53, 0xFF, 0x4C, 0x0F, 0xBE, 0xCA, 0x74, 0xDE, 0x48, 0x39, 0x5C, 0x24, 0x18, 0xC6, 0x03,
+        0x00, 0x78, 0x1F, 0x75, 0xDA, 0xEB, 0xB9, 0x66, 0x81, 0x7B, 0x04, 0x6C, 0x65, 0x8B, 0x0D, 0x30, 0xAF, 0x1A, 0x00, 0x8D, 0x41, 0x01, 0xE9, 0x30,
+        0xFE, 0xFF, 0xFF, 0xE9, 0x38, 0xFE, 0xFF, 0xFF, 0x64, 0x8B, 0x00, 0x75, 0x37, 0x8B, 0x4C, 0x24, 0x1C, 0x48, 0x8B, 0x84, 0x24, 0xC8, 0x00, 0x00,
+        0x00, 0xBD, 0x10, 0x00, 0x00, 0x00, 0xE8, 0x49, 0xC4, 0xFF, 0xFF, 0xE8, 0x03, 0xFC, 0xFF, 0xFF, 0x0F, 0xB7, 0x05, 0x9C, 0x74, 0x17, 0x00, 0xC6,
+        0x43, 0x0F, 0x00, 0x66, 0x89, 0x43, 0x0D, 0xE8, 0x10, 0x64, 0x0A, 0x00, 0x41, 0xF6, 0x46, 0x12, 0xF7, 0x75, 0xE5, 0xE8, 0x81, 0xC4, 0xFF, 0xFF,
+        0x76, 0xD3, 0x75, 0xBE, 0x78, 0xA3, 0x74, 0x19, 0xE8, 0xA8, 0x61, 0x0A, 0x00, 0x4D, 0x8D, 0xAF, 0xA0, 0x02, 0x00, 0x00, 0xEB, 0x09, 0x74, 0x2E,
+        0x75, 0xDC, 0x75, 0xD2, 0x78, 0x41, 0x41, 0x80, 0x7C, 0x24, 0x01, 0x00, 0x75, 0xA2, 0xE9, 0x76, 0xFD, 0xFF, 0xFF, 0xEB, 0xA3, 0xE9, 0xCD, 0x42,
+        0x06, 0x00, 0x74, 0x30, 0x75, 0xE2, 0xBA, 0x45, 0x00, 0x00, 0x00, 0x49, 0x01, 0xDD, 0x41, 0x0F, 0xBE, 0x45, 0x18, 0x66, 0x0F, 0x6C, 0xC1, 0x40,
+        0x0F, 0xB6, 0xC6, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x48, 0xC2, 0x8B, 0xAC, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x44, 0x8B, 0x8C, 0x24, 0xA8, 0x00,
+        0x00, 0x00, 0xF6, 0x46, 0x10, 0x01, 0x8B, 0x3E, 0x89, 0xF9, 0x83, 0xE1, 0x07, 0x77, 0x4B, 0x72, 0x11, 0xEB, 0x2A, 0x77, 0x35, 0x44, 0x0F, 0xB6,
+        0x52, 0xFF, 0x44, 0x88, 0x54, 0x0E, 0x03, 0x72, 0xDF, 0x77, 0x14, 0x89, 0xF8, 0x83, 0xE0, 0xF8, 0x09, 0xC8, 0x89, 0x06, 0x41, 0xBD, 0x07, 0x00,
+        0x00, 0x00, 0xE9, 0x8E, 0x01, 0x00, 0x00, 0x83, 0x26, 0xF8, 0x89, 0x6C, 0x24, 0x4C, 0x44, 0x89, 0x4C, 0x24, 0x48, 0x49, 0x0F, 0x4F, 0xC6, 0x48,
+        0x0F, 0x49, 0xC8, 0x48, 0xC1, 0xF9, 0x02, 0x8B, 0x54, 0x85, 0x00, 0x0F, 0xCA, 0x89, 0x14, 0x83, 0x75, 0xEE, 0x48, 0x8D, 0x04, 0x8D, 0x00, 0x00,
+        0x00, 0x00, 0x45, 0x19, 0xED, 0x48, 0x83, 0x7C, 0x24, 0x28, 0x00, 0x41, 0x83, 0x44, 0x24, 0x14, 0x01, 0x73, 0x7F, 0x8B, 0x74, 0x24, 0x48, 0x56,
+        0x58, 0x74, 0x2B, 0xE9, 0xD8, 0xFE, 0xFF, 0xFF, 0x41, 0x83, 0xFD, 0x05, 0x74, 0xEA, 0x8B, 0x6C, 0x24, 0x4C, 0x44, 0x8B, 0x4C, 0x24, 0x48, 0xEB,
+        0xBF, 0xEB, 0x9B, 0x0F, 0xC9, 0x89, 0x0C, 0x83, 0x73, 0x2F, 0x41, 0x83, 0x6C, 0x24, 0x14, 0x01, 0xE9, 0xE1, 0xFE, 0xFF, 0xFF, 0xE9, 0xCF, 0xFE,
+        0xFF, 0xFF, 0xBA, 0xEA, 0x02, 0x00, 0x00, 0x44, 0x89, 0x8C, 0x24, 0xA8, 0x00, 0x00, 0x00, 0x89, 0xAC, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xE9, 0x37,
+        0xFC, 0xFF, 0xFF, 0x77, 0x70, 0x40, 0x88, 0x7C, 0x01, 0x04, 0x89, 0xD5, 0x8B, 0x01, 0x09, 0xE8, 0x89, 0x01, 0xE9, 0xAE, 0xFE, 0xFF, 0xFF, 0xBA,
+        0xE9, 0x02, 0x00, 0x00, 0xBA, 0x1E, 0x03, 0x00, 0x00, 0xBA, 0xA3, 0x01, 0x00, 0x00, 0xBA, 0x33, 0x02, 0x00, 0x00, 0x8B, 0x84, 0x24, 0xC0, 0x00,
+        0x00, 0x00, 0x44, 0x8B, 0x46, 0x10, 0x41, 0xF6, 0xC0, 0x01, 0x85, 0xFF, 0x4C, 0x03, 0x10, 0xEB, 0x1F, 0x72, 0x41, 0x72, 0x38, 0x8B, 0x42, 0xFC,
+        0x0F, 0xC8, 0x79, 0xDC, 0x48, 0x83, 0x00, 0x01, 0x73, 0xC6, 0x41, 0xBB, 0x04, 0x00, 0x00, 0x00, 0x74, 0x12, 0x51, 0x74, 0x62, 0x45, 0x8B, 0x44,
+        0x24, 0x10, 0xE9, 0xA0, 0xFE, 0xFF, 0xFF, 0xEB, 0x22, 0x74, 0xB3, 0x75, 0x0C, 0x89, 0xFA, 0x83, 0xE2, 0x07, 0x4C, 0x63, 0xD2, 0x73, 0x30, 0xEB,
+        0x28, 0x72, 0xDC, 0xE9, 0x25, 0xFF, 0xFF, 0xFF, 0xE9, 0x0B, 0xFE, 0xFF, 0xFF, 0x48, 0x03, 0x44, 0x24, 0x68, 0x79, 0xD4, 0x49, 0x83, 0x01, 0x01,
+        0xEB, 0xC0, 0x80, 0x7E, 0x04, 0x80, 0x83, 0xE7, 0xF8, 0x89, 0x3E, 0xE9, 0x85, 0xFC, 0xFF, 0xFF, 0x89, 0xBC, 0x24, 0xC8, 0x00, 0x00, 0x00, 0xE9,
+        0x9C, 0xFB, 0xFF, 0xFF, 0xE9, 0x46, 0xFD, 0xFF, 0xFF, 0x74, 0x33, 0x73, 0x9D, 0xE9, 0xA2, 0xFC, 0xFF, 0xFF, 0x75, 0xD6, 0x09, 0xF8, 0xE9, 0x8D,
+        0xFC, 0xFF, 0xFF, 0xE9, 0x6F, 0xFC, 0xFF, 0xFF, 0xE9, 0x7D, 0xFF, 0xFF, 0xFF, 0xE8, 0xE9, 0xD6, 0x0E, 0x00, 0x48, 0x0F, 0x4F, 0xC1, 0x49, 0x3B,
+        0x4D, 0x00, 0x83, 0x43, 0x14, 0x01, 0x73, 0x70, 0x74, 0x24, 0xE9, 0xFB, 0xFE, 0xFF, 0xFF, 0x74, 0xED, 0x41, 0x8B, 0x2B, 0x83, 0xE6, 0x07, 0x76,
+        0x14, 0xEB, 0x2D, 0x76, 0xDC, 0x41, 0x0F, 0xB6, 0x4B, 0x04, 0x41, 0x83, 0x23, 0xF8, 0xE9, 0x32, 0xFF, 0xFF, 0xFF, 0xE9, 0x10, 0xFF, 0xFF, 0xFF,
+        0xE9, 0x55, 0xFE, 0xFF, 0xFF, 0x49, 0x29, 0x4D, 0x00, 0xE9, 0x43, 0xFE, 0xFF, 0xFF, 0x83, 0xE5, 0xF8, 0x09, 0xF5, 0xE8, 0xA9, 0x4A, 0x12, 0x00,
+        0x8B, 0x5C, 0x24, 0x48, 0x89, 0x9C, 0x24, 0xA8, 0x00, 0x00, 0x00, 0x75, 0x2A, 0xE8, 0x2C, 0x9F, 0x00, 0x00, 0x74, 0xD6, 0xE8, 0x02, 0x9F, 0x00,
+        0x00, 0x77, 0x4D, 0x88, 0x54, 0x07, 0x04, 0x8B, 0x07, 0x44, 0x09, 0xF0, 0x89, 0x07, 0xE9, 0xB6, 0xFE, 0xFF, 0xFF, 0xE9, 0xFC, 0xFC, 0xFF, 0xFF,
+        0xE8, 0x45, 0x9E, 0x00, 0x00, 0xEB, 0x25, 0x8B, 0x48, 0xFC, 0x79, 0xDA, 0x74, 0x46, 0x73, 0xC8, 0x8D, 0x44, 0x40, 0x04, 0xE9, 0x1A, 0x01, 0x00,
+        0x00, 0xC7, 0x44, 0x24, 0x24, 0x06, 0x00, 0x00, 0x00, 0x75, 0xD5, 0xE8, 0x41, 0x47, 0x12, 0x00, 0xE9, 0x29, 0xFF, 0xFF, 0xFF, 0x74, 0xA9, 0x74,
+        0x0B, 0x44, 0x8B, 0x16, 0x73, 0x32, 0xEB, 0x0F, 0x72, 0xD9, 0xE9, 0x1C, 0xFE, 0xFF, 0xFF, 0xEB, 0x26, 0x89, 0x39, 0x79, 0xD6, 0xEB, 0xC2, 0xE9,
+        0x64, 0xFC, 0xFF, 0xFF, 0xE9, 0xC5, 0xFD, 0xFF, 0xFF, 0xE9, 0x0C, 0xFD, 0xFF, 0xFF, 0xE9, 0x58, 0xFB, 0xFF, 0xFF, 0x74, 0xB9, 0x75, 0x70, 0xE9,
+        0xBE, 0xFC, 0xFF, 0xFF, 0xE9, 0xF7, 0xFE, 0xFF, 0xFF, 0xBA, 0x93, 0x02, 0x00, 0x00, 0xE8, 0xB1, 0x97, 0x00, 0x00, 0xE8, 0xFC, 0xCA, 0x0E, 0x00,
+        0x75, 0x28, 0xEB, 0x21, 0x74, 0x4D, 0x79, 0xD5, 0x75, 0xB7, 0x83, 0x45, 0x14, 0x01, 0xE9, 0xC9, 0xFE, 0xFF, 0xFF, 0xEB, 0x1E, 0xE9, 0x20, 0xFF,
+        0xFF, 0xFF, 0x74, 0xAB, 0xE9, 0xDD, 0xFE, 0xFF, 0xFF, 0xEB, 0xAD, 0xEB, 0x23, 0x89, 0x0E, 0xE8, 0xFD, 0x93, 0x00, 0x00, 0xE9, 0xE0, 0xFD, 0xFF,
+        0xFF, 0xE9, 0x86, 0xFC, 0xFF, 0xFF, 0xEB, 0x4B, 0xE9, 0xAC, 0xFE, 0xFF, 0xFF, 0x83, 0x6D, 0x14, 0x01, 0x74, 0xCA, 0xE9, 0x95, 0xFD, 0xFF, 0xFF,
+        0x4C, 0x89, 0xA4, 0x24, 0x80, 0x00, 0x00, 0x00, 0x8B, 0x10, 0x88, 0x11, 0x75, 0xB0, 0xE9, 0xBF, 0xFE, 0xFF, 0xFF, 0xC1, 0xEA, 0x07, 0x81, 0xFA,
+        0x00, 0x1C, 0x00, 0x00, 0xE9, 0x0E, 0xFF, 0xFF, 0xFF, 0x42, 0x0F, 0xB6, 0x44, 0x3A, 0x04, 0x42, 0x88, 0x04, 0x39, 0x8B, 0x02, 0x72, 0xE8, 0x41,
+        0xB9, 0x05, 0x00, 0x00, 0x00, 0x77, 0x05, 0x72, 0xD7, 0x8B, 0x12, 0x89, 0xD1, 0x48, 0x03, 0x06, 0x89, 0x10, 0xE9, 0x82, 0xFC, 0xFF, 0xFF, 0xE9,
+        0xD5, 0xFC, 0xFF, 0xFF, 0xE9, 0x51, 0xFD, 0xFF, 0xFF, 0xFF, 0x74, 0x24, 0x50, 0xE8, 0x07, 0x4A, 0x00, 0x00, 0x41, 0x58, 0x41, 0x59, 0xE9, 0xB5,
+        0xFB, 0xFF, 0xFF, 0x88, 0x02, 0x75, 0xAD, 0xE8, 0xAB, 0x36, 0x12, 0x00, 0x89, 0x84, 0x24, 0xE8, 0x00, 0x00, 0x00, 0xE9, 0x7E, 0xF9, 0xFF, 0xFF,
+        0xE9, 0x35, 0xFA, 0xFF, 0xFF, 0x48, 0x3B, 0x54, 0x24, 0x78, 0xE8, 0x04, 0x8B, 0x00, 0x00, 0x75, 0xCB, 0xC1, 0xE8, 0x07, 0x74, 0x89, 0xE9, 0x52,
+        0xFE, 0xFF, 0xFF, 0x73, 0x20, 0x41, 0x0F, 0xB6, 0x54, 0x24, 0xFF, 0x42, 0x88, 0x54, 0x39, 0x04, 0x75, 0xE0, 0xE9, 0x53, 0xFB, 0xFF, 0xFF, 0xE8,
+        0x4E, 0x46, 0x00, 0x00, 0xE9, 0xE2, 0xFC, 0xFF, 0xFF, 0x41, 0x5A, 0x41, 0x5B, 0x0F, 0x8D, 0xC8, 0x00, 0x00, 0x00, 0x75, 0xE7, 0xE9, 0x14, 0xFE,
+        0xFF, 0xFF, 0xB8, 0x04, 0x00, 0x00, 0x00, 0x41, 0x80, 0xE3, 0x02, 0x75, 0xB2, 0xEB, 0xC5, 0xE9, 0x97, 0xFC, 0xFF, 0xFF, 0xBA, 0xF3, 0x01, 0x00,
+        0x00, 0xE8, 0x9B, 0x87, 0x00, 0x00, 0xBA, 0xF2, 0x01, 0x00, 0x00, 0xBA, 0xE8, 0x01, 0x00, 0x00, 0xBA, 0xA7, 0x01, 0x00, 0x00, 0xBA, 0x8A, 0x01,
+        0x00, 0x00, 0xE8, 0x1F, 0x87, 0x00, 0x00, 0xBA, 0xD6, 0x01, 0x00, 0x00, 0x48, 0xC7, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xE8, 0xBA, 0x2F, 0x12, 0x00, 0x8D, 0x90, 0x00, 0x28, 0xFF, 0xFF, 0x3D, 0xFF, 0x07, 0x00, 0x00, 0x0F, 0x97, 0xC1, 0x72, 0x96, 0xBA, 0x00, 0xFF,
+        0xFF, 0xFF, 0xD3, 0xFA, 0x48, 0x01, 0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x83, 0xCA, 0x80, 0x41, 0x0A, 0x04, 0x24, 0xE9, 0x2C, 0xFE, 0xFF, 0xFF,
+        0x41, 0x88, 0x06, 0x8B, 0x16, 0xE9, 0x2D, 0xFD, 0xFF, 0xFF, 0xE9, 0xDA, 0xFC, 0xFF, 0xFF, 0x88, 0x06, 0x75, 0xAE, 0x48, 0x39, 0xB4, 0x24, 0x88,
+        0x00, 0x00, 0x00, 0xE8, 0x12, 0x2B, 0x12, 0x00, 0xE9, 0xAA, 0xF9, 0xFF, 0xFF, 0xE9, 0xD0, 0xFA, 0xFF, 0xFF, 0xB9, 0x02, 0x00, 0x00, 0x00, 0x88,
+        0x16, 0x88, 0x14, 0x0E, 0x0A, 0x06, 0xE9, 0xBA, 0xFD, 0xFF, 0xFF, 0xE9, 0x07, 0xFB, 0xFF, 0xFF, 0xB9, 0x04, 0x00, 0x00, 0x00, 0xE9, 0xFD, 0xFA,
+        0xFF, 0xFF, 0xE9, 0xCB, 0xFC, 0xFF, 0xFF, 0xE8, 0x24, 0x3B, 0x00, 0x00, 0xE9, 0x08, 0xF9, 0xFF, 0xFF, 0xE9, 0xD2, 0xF9, 0xFF, 0xFF, 0xE9, 0xF6,
+        0xFB, 0xFF, 0xFF, 0x41, 0x0A, 0x06, 0xE9, 0xB4, 0xFA, 0xFF, 0xFF, 0x75, 0x6E, 0xE9, 0xB1, 0xF7, 0xFF, 0xFF, 0xE9, 0x0A, 0xFD, 0xFF, 0xFF, 0xE9,
+        0xB9, 0xFD, 0xFF, 0xFF, 0xE9, 0xA5, 0xFD, 0xFF, 0xFF, 0xE8, 0x28, 0x39, 0x00, 0x00, 0x74, 0x37, 0x75, 0x3C, 0xE9, 0x83, 0xF7, 0xFF, 0xFF, 0x41,
+        0x52, 0x7E, 0x6A, 0x77, 0x45, 0xE9, 0x6A, 0xFD, 0xFF, 0xFF, 0xE9, 0x60, 0xFD, 0xFF, 0xFF, 0xE9, 0x5F, 0xFE, 0xFF, 0xFF, 0xE9, 0xC8, 0xFC, 0xFF,
+        0xFF, 0xE8, 0xFB, 0x79, 0x00, 0x00, 0x8B, 0xB4, 0x24, 0xD8, 0x00, 0x00, 0x00, 0x8B, 0x9C, 0x24, 0xD0, 0x00, 0x00, 0x00, 0x75, 0x26, 0x89, 0x03,
+        0x2D, 0xC2, 0x00, 0x00, 0x00, 0xEB, 0x1B, 0xC1, 0xE0, 0x06, 0x83, 0xC7, 0x01, 0x09, 0xD0, 0x41, 0x0F, 0xB6, 0x10, 0x80, 0xF9, 0x80, 0x44, 0x39,
+        0xFF, 0x3C, 0x80, 0x72, 0xE9, 0xEB, 0x0E, 0x75, 0x84, 0x43, 0x8D, 0x4C, 0xBF, 0xFC, 0x41, 0xD3, 0xEF, 0x8D, 0x88, 0x00, 0x28, 0xFF, 0xFF, 0x81,
+        0xF9, 0xFF, 0x07, 0x00, 0x00, 0x3C, 0xE0, 0xE9, 0xDF, 0xFD, 0xFF, 0xFF, 0x8D, 0x8A, 0x40, 0xFF, 0xFF, 0xFF, 0x83, 0xF9, 0x01, 0x81, 0xEA, 0xC2,
+        0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0x00, 0x00, 0x73, 0x1F, 0x8D, 0x0C, 0x76, 0x01, 0xC9, 0xD3, 0xE0, 0x8B, 0x4F, 0x04, 0xC1, 0xFA, 0x08, 0x0F,
+        0xB6, 0x74, 0x16, 0xFE, 0x40, 0x88, 0xB4, 0x24, 0x82, 0x00, 0x00, 0x00, 0x73, 0x10, 0x83, 0xCE, 0x80, 0xC1, 0xE9, 0x06, 0x77, 0xDE, 0x0A, 0x8C,
+        0x24, 0x82, 0x00, 0x00, 0x00, 0x88, 0x8C, 0x24, 0x82, 0x00, 0x00, 0x00, 0xEB, 0x0B, 0x73, 0x15, 0x40, 0x88, 0x34, 0x01, 0x89, 0x4C, 0x24, 0x08,
+        0x49, 0x63, 0xD7, 0xC7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x41, 0x8B, 0x5C, 0x24, 0x10, 0x73, 0x6F, 0xE9, 0x73, 0xFD, 0xFF, 0xFF, 0x89, 0x13, 0xC1,
+        0xE2, 0x06, 0x09, 0xCA, 0x41, 0x80, 0xF9, 0x80, 0x74, 0xD7, 0x80, 0xFA, 0x80, 0x74, 0xB8, 0xEB, 0xA1, 0x3C, 0xF0, 0x75, 0x8D, 0xE9, 0x67, 0xFE,
+        0xFF, 0xFF, 0xE9, 0xBD, 0xFA, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0xE9, 0x34, 0xFE, 0xFF, 0xFF, 0x8D, 0x91, 0x3E, 0xFF, 0xFF, 0xFF, 0x89,
+        0xCA, 0xEB, 0x15, 0x83, 0xC6, 0x01, 0x09, 0xC2, 0x39, 0x74, 0x24, 0x10, 0x39, 0xC6, 0x73, 0x2A, 0x74, 0x0E, 0x8D, 0x4C, 0x80, 0xFC, 0xD3, 0xE8,
+        0x74, 0xBF, 0x8D, 0x86, 0x00, 0x28, 0xFF, 0xFF, 0x76, 0xAE, 0x3C, 0xF8, 0xE9, 0xF9, 0xF7, 0xFF, 0xFF, 0xBE, 0x02, 0x00, 0x00, 0x00, 0xE9, 0xD4,
+        0xFC, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0xE9, 0x28, 0xFC, 0xFF, 0xFF, 0x83, 0x44, 0x24, 0x48, 0x01, 0x73, 0x0A, 0x74, 0xDB, 0x2D, 0xC0,
+        0x00, 0x00, 0x00, 0x77, 0x7F, 0x89, 0xF0, 0xB9, 0x00, 0x02, 0x00, 0x00, 0x73, 0x25, 0x44, 0x0F, 0xB6, 0x0E, 0x89, 0x0F, 0xE9, 0x27, 0xF7, 0xFF,
+        0xFF, 0xBA, 0x02, 0x00, 0x00, 0x00, 0xBA, 0xEE, 0x01, 0x00, 0x00, 0x75, 0x6A, 0xBA, 0x03, 0x00, 0x00, 0x00, 0xE9, 0xEB, 0xF7, 0xFF, 0xFF, 0xBA,
+        0x04, 0x00, 0x00, 0x00, 0xE9, 0xC0, 0xFE, 0xFF, 0xFF, 0xE9, 0x5E, 0xFC, 0xFF, 0xFF, 0xBA, 0x19, 0x03, 0x00, 0x00, 0xE8, 0x78, 0xA0, 0x0E, 0x00,
+        0xBE, 0x03, 0x00, 0x00, 0x00, 0xBA, 0x05, 0x00, 0x00, 0x00, 0x75, 0x79, 0xBE, 0x04, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0xE9, 0xA7, 0xF4, 0xFF, 0xFF,
+        0x75, 0x27, 0xBF, 0x05, 0x00, 0x00, 0x00, 0xBE, 0x05, 0x00, 0x00, 0x00, 0x75, 0x7A, 0xE9, 0xE9, 0xF8, 0xFF, 0xFF, 0x75, 0xD7, 0xE9, 0x72, 0xFA,
+        0xFF, 0xFF, 0x75, 0xD0, 0xE9, 0xA8, 0xFA, 0xFF, 0xFF, 0x8B, 0xBC, 0x24, 0xB0, 0x00, 0x00, 0x00, 0x89, 0x7C, 0x24, 0x4C, 0x66, 0x81, 0xF9, 0xFF,
+        0x07, 0x72, 0x19, 0xEB, 0xC1, 0x40, 0xF6, 0xC7, 0x02, 0xE9, 0xF2, 0xFE, 0xFF, 0xFF, 0x75, 0xB9, 0xE9, 0x48, 0xFE, 0xFF, 0xFF, 0x8B, 0x38, 0x8A,
+        0x70, 0x05, 0x88, 0xCE, 0x8D, 0xB2, 0x00, 0x28, 0x00, 0x00, 0x89, 0x38, 0xE9, 0xA4, 0xFE, 0xFF, 0xFF, 0x74, 0x74, 0x44, 0x8D, 0x8E, 0x00, 0x28,
+        0x00, 0x00, 0x66, 0x41, 0x81, 0xF9, 0xFF, 0x07, 0xEB, 0xB7, 0x48, 0xD1, 0xFA, 0xE9, 0x88, 0xFE, 0xFF, 0xFF, 0xE9, 0xF5, 0xFB, 0xFF, 0xFF, 0x41,
+        0xB8, 0x05, 0x00, 0x00, 0x00, 0xE9, 0xDB, 0xFE, 0xFF, 0xFF, 0xE9, 0xFE, 0xFB, 0xFF, 0xFF, 0x73, 0x13, 0xE9, 0x3A, 0xFC, 0xFF, 0xFF, 0xE9, 0x17,
+        0xFF, 0xFF, 0xFF, 0x74, 0xB6, 0x74, 0x9E, 0xE9, 0xE4, 0xFE, 0xFF, 0xFF, 0xE8, 0xB6, 0x63, 0x00, 0x00, 0xE9, 0x36, 0xFB, 0xFF, 0xFF, 0x8B, 0x08,
+        0x8D, 0xB9, 0x00, 0x28, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x66, 0x41, 0x89, 0x0E, 0x75, 0xA7, 0x74, 0x5B, 0x75, 0xAB, 0x74, 0x79,
+        0x74, 0x40, 0x74, 0x3A, 0xE9, 0x93, 0xFE, 0xFF, 0xFF, 0x43, 0x0F, 0xB6, 0x44, 0x3B, 0x04, 0x72, 0xE7, 0x66, 0x41, 0x89, 0x45, 0x00, 0xE9, 0x4E,
+        0xFC, 0xFF, 0xFF, 0xE9, 0xB3, 0xFC, 0xFF, 0xFF, 0x09, 0xD8, 0xE9, 0x0D, 0xFD, 0xFF, 0xFF, 0xE9, 0x8B, 0xFB, 0xFF, 0xFF, 0x8D, 0xBA, 0x00, 0x28,
+        0xFF, 0xFF, 0x75, 0xA5, 0xE8, 0x90, 0x5C, 0x00, 0x00, 0xE9, 0x8F, 0xFB, 0xFF, 0xFF, 0xE9, 0x62, 0xFD, 0xFF, 0xFF, 0x74, 0x88, 0x43, 0x88, 0x54,
+        0x3B, 0x04, 0xE9, 0xFA, 0xF8, 0xFF, 0xFF, 0x74, 0x55, 0xE9, 0x6E, 0xFB, 0xFF, 0xFF, 0xE9, 0x84, 0xF8, 0xFF, 0xFF, 0x74, 0xE7, 0xE8, 0xEB, 0x15,
+        0x00, 0x00, 0xE9, 0x7F, 0xFE, 0xFF, 0xFF, 0xE8, 0x3F, 0x58, 0x00, 0x00, 0x7E, 0x51, 0x77, 0x2C, 0xE8, 0x70, 0x57, 0x00, 0x00, 0x8B, 0x8C, 0x24,
+        0xB0, 0x00, 0x00, 0x00, 0x66, 0xC1, 0xC0, 0x08, 0x76, 0x34, 0xEB, 0xB6, 0xEB, 0x36, 0xE9, 0x18, 0xFF, 0xFF, 0xFF, 0x74, 0xA0, 0xE9, 0xCA, 0xFD,
+        0xFF, 0xFF, 0x74, 0x7B, 0xE9, 0x56, 0xFE, 0xFF, 0xFF, 0xE9, 0x5C, 0xFB, 0xFF, 0xFF, 0x75, 0xBF, 0xE9, 0xD1, 0xFD, 0xFF, 0xFF, 0xE9, 0xC1, 0xFE,
+        0xFF, 0xFF, 0xE8, 0x9A, 0x4F, 0x00, 0x00, 0x8D, 0xB8, 0x00, 0x28, 0xFF, 0xFF, 0x75, 0xA4, 0x74, 0x59, 0xE8, 0x34, 0xF8, 0x11, 0x00, 0x74, 0x6A,
+        0x74, 0x32, 0xE9, 0x4C, 0xFF, 0xFF, 0xFF, 0xE9, 0xA3, 0xFE, 0xFF, 0xFF, 0x72, 0xDA, 0xBE, 0x06, 0x00, 0x00, 0x00, 0xE9, 0xC6, 0xFC, 0xFF, 0xFF,
+        0x09, 0xF0, 0xE9, 0x1D, 0xFD, 0xFF, 0xFF, 0xE8, 0xA7, 0x06, 0x00, 0x00, 0x89, 0xC6, 0x83, 0xFE, 0x05, 0xE9, 0x9D, 0xFB, 0xFF, 0xFF, 0xE9, 0x6C,
+        0xFA, 0xFF, 0xFF, 0xE9, 0x8A, 0xFA, 0xFF, 0xFF, 0xE9, 0x90, 0xF8, 0xFF, 0xFF, 0xE9, 0xAD, 0xFC, 0xFF, 0xFF, 0xE8, 0x43, 0x44, 0x00, 0x00, 0xE8,
+        0x6F, 0x77, 0x0E, 0x00, 0xE9, 0xC2, 0xF4, 0xFF, 0xFF, 0x44, 0x8B, 0x87, 0x20, 0x02, 0x00, 0x00, 0x01, 0xF8, 0xD1, 0xE8, 0xEB, 0x29, 0x83, 0xC3,
+        0x01, 0x42, 0x8D, 0x14, 0x2B, 0x39, 0x10, 0x39, 0x7C, 0x24, 0x24, 0x8B, 0x97, 0x58, 0x02, 0x00, 0x00, 0x8B, 0x9F, 0x48, 0x02, 0x00, 0x00, 0x8D,
+        0x54, 0x52, 0x04, 0xBA, 0x07, 0x00, 0x00, 0x00, 0x8B, 0x06, 0x8D, 0x45, 0x01, 0x75, 0x6C, 0x7E, 0x0F, 0x8B, 0x11, 0x73, 0x69, 0xBA, 0x06, 0x00,
+        0x00, 0x00, 0xE9, 0x99, 0xFE, 0xFF, 0xFF, 0x74, 0x67, 0xE9, 0xF0, 0xFE, 0xFF, 0xFF, 0x44, 0x39, 0x41, 0x04, 0x72, 0x12, 0x29, 0xD0, 0xF7, 0x71,
+        0x08, 0x48, 0x01, 0x45, 0x00, 0x48, 0x83, 0x45, 0x00, 0x04, 0xE9, 0x09, 0xFF, 0xFF, 0xFF, 0x45, 0x8B, 0x03, 0x41, 0x0F, 0xB7, 0x44, 0x24, 0x04,
+        0xF7, 0xF1, 0x8D, 0x79, 0xFE, 0x89, 0xD3, 0xF7, 0xF7, 0x41, 0x29, 0xC6, 0x44, 0x8D, 0x6A, 0x01, 0xEB, 0x3F, 0x44, 0x01, 0xEB, 0x89, 0xDE, 0x29,
+        0xCE, 0x39, 0xCB, 0x0F, 0x43, 0xC6, 0x89, 0xC3, 0x41, 0x0F, 0xB7, 0x37, 0x66, 0x85, 0xF6, 0x75, 0xB4, 0x41, 0x0F, 0xB7, 0x57, 0x02, 0xE8, 0xD3,
+        0x08, 0x00, 0x00, 0x74, 0x25, 0xE8, 0xA3, 0xBB, 0x0C, 0x00, 0x81, 0x3F, 0x24, 0x03, 0x01, 0x20, 0x75, 0x64, 0x73, 0x54, 0x73, 0x4B, 0x74, 0x42,
+        0x72, 0x39, 0x72, 0x25, 0x48, 0xC7, 0x05, 0x1F, 0x37, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xB3, 0xEB, 0xD5, 0x74, 0x51, 0x73, 0x41, 0x4A,
+        0x8D, 0x34, 0x20, 0xE8, 0xBB, 0xFB, 0xFF, 0xFF, 0x74, 0x2F, 0x75, 0xC0, 0x2B, 0x44, 0x24, 0x10, 0x45, 0x0F, 0xB7, 0x74, 0x24, 0x04, 0xE8, 0x0C,
+        0xFB, 0xFF, 0xFF, 0x73, 0x2E, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x72, 0x9F, 0x75, 0x0A, 0x66, 0x41, 0x83, 0x7D, 0x04, 0x00, 0xBF, 0xD0, 0x00, 0x00,
+        0x00, 0x41, 0xC7, 0x40, 0x10, 0x01, 0x00, 0x00, 0x00, 0xBB, 0x02, 0x00, 0x00, 0x00, 0xC7, 0x42, 0x10, 0x01, 0x00, 0x00, 0x00, 0x80, 0x38, 0x00,
+        0xE9, 0xED, 0xFD, 0xFF, 0xFF, 0xE9, 0xB7, 0xFD, 0xFF, 0xFF, 0xEB, 0x8E, 0x89, 0x04, 0x24, 0x8B, 0x1C, 0x24, 0xE9, 0x59, 0xFD, 0xFF, 0xFF, 0x48,
+        0x03, 0x15, 0x90, 0x32, 0x1A, 0x00, 0x75, 0x1D, 0x48, 0x98, 0x0F, 0xB7, 0x44, 0x42, 0x02, 0x75, 0x6B, 0x83, 0xC5, 0x01, 0x39, 0xE8, 0x7E, 0x4B,
+        0x45, 0x0F, 0xB7, 0x14, 0x84, 0x75, 0x9C, 0xEB, 0x9E, 0xE9, 0xC7, 0xFB, 0xFF, 0xFF, 0x74, 0x06, 0xE9, 0x65, 0x49, 0xFF, 0xFF, 0x77, 0xED, 0x89,
+        0x43, 0x08, 0x89, 0x42, 0x08, 0xBA, 0xA4, 0x00, 0x00, 0x00, 0xC7, 0x43, 0x08, 0x01, 0x00, 0x00, 0x00, 0xE9, 0x7C, 0xFF, 0xFF, 0xFF, 0xBA, 0x71,
+        0x00, 0x00, 0x00, 0xE9, 0x7A, 0x18, 0x0D, 0x00, 0x66, 0xC7, 0x47, 0x08, 0x00, 0x00, 0x64, 0x4D, 0x8B, 0x04, 0x24, 0xEB, 0x2E, 0x75, 0x10, 0x08,
+        0xD1, 0x75, 0xD3, 0x74, 0xE2, 0xEB, 0x20, 0x75, 0x06, 0x3C, 0x2C, 0x7E, 0xA3, 0xE8, 0x0F, 0x44, 0xFF, 0xFF, 0x75, 0x35, 0x74, 0xB5, 0xE8, 0xC4,
+        0xCB, 0x06, 0x00, 0xE8, 0x42, 0xFE, 0xFF, 0xFF, 0xE8, 0x66, 0x45, 0xFF, 0xFF, 0x49, 0xBB, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x88,
+        0x43, 0xFF, 0x74, 0x44, 0x77, 0xCE, 0x4D, 0x0F, 0xA3, 0xC3, 0x73, 0xCD, 0x75, 0xC8, 0x75, 0xCF, 0x74, 0x4E, 0x41, 0x8D, 0x46, 0x01, 0x7F, 0x2B,
+        0x29, 0xC2, 0x39, 0xF8, 0x72, 0xF3, 0x83, 0xFB, 0x02, 0x75, 0xC1, 0x8D, 0x43, 0x01, 0x75, 0x21, 0xEB, 0xAF, 0xEB, 0xAB, 0xEB, 0x99, 0x4A, 0x8B,
+        0x2C, 0xF0, 0x42, 0x0F, 0xB6, 0x04, 0x30, 0x74, 0x1D, 0x41, 0x0F, 0x94, 0xC5, 0x75, 0x8B, 0xE9, 0x4D, 0xFF, 0xFF, 0xFF, 0xE9, 0x3E, 0xFF, 0xFF,
+        0xFF, 0x4E, 0x8B, 0x24, 0xE8, 0x43, 0x0F, 0xB6, 0x34, 0x2F, 0xE8, 0xDE, 0x3E, 0xFF, 0xFF, 0xEB, 0xB8, 0xEB, 0xA9, 0xE9, 0xCE, 0xFE, 0xFF, 0xFF,
+        0x4B, 0x8B, 0x34, 0xFE, 0xBE, 0x3B, 0x00, 0x00, 0x00, 0xBD, 0x0D, 0x00, 0x00, 0x00, 0x8D, 0x5D, 0xFF, 0xBD, 0x05, 0x00, 0x00, 0x00, 0x89, 0xEA,
+        0x4A, 0x89, 0x84, 0xEC, 0xA0, 0x00, 0x00, 0x00, 0x83, 0x78, 0x28, 0xFF, 0xC7, 0x40, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x8B, 0x94, 0xEE, 0x80,
+        0x00, 0x00, 0x00, 0x4A, 0x89, 0x54, 0xEC, 0x30, 0xE8, 0x98, 0xCC, 0x05, 0x00, 0x4F, 0x8B, 0x2C, 0xFE, 0x4E, 0x8B, 0xAC, 0xE8, 0x80, 0x00, 0x00,
+        0x00, 0xBE, 0x3D, 0x00, 0x00, 0x00, 0x31, 0xED, 0xE9, 0x16, 0xFF, 0xFF, 0xFF, 0xB9, 0x3A, 0x00, 0x00, 0x00, 0x74, 0x3B, 0x49, 0x3B, 0x7C, 0xDD,
+        0x00, 0x75, 0xDD, 0xE8, 0x23, 0xFA, 0xFF, 0xFF, 0x4B, 0x89, 0x14, 0xEE, 0x74, 0x02, 0x4B, 0x89, 0xAC, 0xEE, 0x80, 0x00, 0x00, 0x00, 0xE8, 0xC0,
+        0x3C, 0xFF, 0xFF, 0x83, 0x00, 0x01, 0xE8, 0x61, 0xF9, 0xFF, 0xFF, 0xE9, 0xEF, 0xFD, 0xFF, 0xFF, 0x41, 0xBE, 0x07, 0x00, 0x00, 0x00, 0x49, 0x39,
+        0x1C, 0xC7, 0x75, 0xDF, 0x89, 0xEB, 0x80, 0x3B, 0x00, 0x48, 0x3D, 0xFF, 0x00, 0x00, 0x00, 0x74, 0x7D, 0x76, 0x15, 0x42, 0x80, 0x7C, 0x3B, 0xFD,
+        0x2F, 0xBE, 0x2F, 0x00, 0x00, 0x00, 0x75, 0x95, 0x74, 0x91, 0x74, 0x4B, 0x75, 0x8F, 0xE8, 0x73, 0x36, 0xFF, 0xFF, 0x46, 0x0F, 0xB6, 0x14, 0x20,
+        0xFF, 0x75, 0xA8, 0x8B, 0x4B, 0x08, 0x4A, 0x63, 0x04, 0xA0, 0x49, 0xB9, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x8D, 0x78, 0xD4, 0x40,
+        0x80, 0xFF, 0x33, 0x77, 0xC9, 0x49, 0x0F, 0xA3, 0xF9, 0x75, 0xC3, 0x75, 0xCA, 0x88, 0x50, 0xFF, 0x8B, 0x50, 0x28, 0x83, 0xC2, 0x01, 0xE9, 0x19,
+        0xFD, 0xFF, 0xFF, 0x49, 0xBA, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x77, 0xCA, 0x73, 0xC9, 0xEB, 0xB4, 0xE9, 0x11, 0xFC, 0xFF, 0xFF,
+        0x80, 0x7F, 0xFF, 0x2F, 0x75, 0xF6, 0xE9, 0x0F, 0xFE, 0xFF, 0xFF, 0xE9, 0xAB, 0xFA, 0xFF, 0xFF, 0xE8, 0x1D, 0x05, 0x00, 0x00, 0x8B, 0x57, 0x08,
+        0x75, 0xDE, 0xEB, 0xD4, 0x6A, 0x01, 0xE9, 0x92, 0xFD, 0xFF, 0xFF, 0xBA, 0x1A, 0x01, 0x00, 0x00, 0x83, 0x6E, 0x28, 0x01, 0x75, 0x3A, 0x83, 0x7E,
+        0x18, 0x02, 0x74, 0x2D, 0x48, 0x3B, 0x70, 0x10, 0x89, 0xFD, 0xB8, 0x17, 0x10, 0x05, 0x20, 0x83, 0xFF, 0x03, 0xB9, 0x20, 0x07, 0x09, 0x20, 0x35,
+        0x15, 0x11, 0x03, 0x20, 0x39, 0xC2, 0x4E, 0x3B, 0x34, 0xF8, 0x4A, 0x8D, 0x04, 0xB5, 0x08, 0x00, 0x00, 0x00, 0x72, 0x28, 0xFF, 0xE1, 0x76, 0x4A,
+        0x83, 0x3C, 0x81, 0x05, 0x48, 0xB8, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0x41, 0x89, 0x44, 0x24, 0x11, 0x0F, 0xBE, 0x17, 0x41,
+        0xC6, 0x44, 0x24, 0x08, 0x01, 0x41, 0x3A, 0x44, 0x24, 0x13, 0x75, 0xBA, 0x0F, 0x11, 0x01, 0xE9, 0x74, 0xFE, 0xFF, 0xFF, 0xE9, 0x71, 0xFE, 0xFF,
+        0xFF, 0x75, 0x59, 0x76, 0x72, 0x73, 0xD7, 0xBD, 0x01, 0x00, 0x00, 0x00, 0xBA, 0xCE, 0x00, 0x00, 0x00, 0x75, 0x81, 0xC7, 0x47, 0x08, 0x01, 0x00,
+        0x00, 0x00, 0x75, 0x7B, 0x7F, 0x17, 0x7F, 0xDE, 0x75, 0x0F, 0xC7, 0x00, 0x2F, 0x53, 0x59, 0x53, 0x73, 0x53, 0xA8, 0x04, 0xA8, 0x02, 0x0F, 0x89,
+        0xF3, 0xFD, 0xFF, 0xFF, 0xF3, 0x48, 0xA5, 0xEB, 0x95, 0x8B, 0x31, 0x89, 0x77, 0x05, 0xE9, 0x2A, 0xFF, 0xFF, 0xFF, 0x66, 0x89, 0x4C, 0x02, 0xFE,
+        0x75, 0x08, 0xEB, 0xC3, 0x89, 0xBD, 0xD8, 0xFE, 0xFF, 0xFF, 0xBF, 0x1E, 0x00, 0x00, 0x00, 0xEB, 0x65, 0x74, 0x49, 0x4C, 0x63, 0xA5, 0xD8, 0xFE,
+        0xFF, 0xFF, 0x4B, 0x8B, 0x44, 0xE6, 0x10, 0xBE, 0x2E, 0x00, 0x00, 0x00, 0xF6, 0x40, 0x01, 0xBF, 0x41, 0xC1, 0xC1, 0x09, 0x49, 0xF7, 0xF2, 0x48,
+        0xF7, 0xF6, 0x4F, 0x8D, 0x5C, 0x6D, 0x00, 0x45, 0x39, 0x0F, 0x48, 0x3B, 0x05, 0xAA, 0x11, 0x1A, 0x00, 0x75, 0xC6, 0xBF, 0x78, 0x00, 0x00, 0x00,
+        0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x43, 0x80, 0x3C, 0x3C, 0x00, 0x74, 0x64, 0x8B, 0x40, 0x10, 0x48, 0x0F, 0x4C, 0xC2,
+        0x41, 0x03, 0x56, 0x14, 0x72, 0x1B, 0xE9, 0x26, 0xFC, 0xFF, 0xFF, 0xE9, 0x9F, 0xFB, 0xFF, 0xFF, 0xBA, 0x36, 0x01, 0x00, 0x00, 0x0F, 0x29, 0x1D,
+        0xEA, 0x0E, 0x1A, 0x00, 0x3C, 0x7F, 0x0F, 0x16, 0x40, 0x38, 0x0F, 0x11, 0x05, 0xA6, 0x0E, 0x1A, 0x00, 0xBA, 0x7F, 0x00, 0x00, 0x00, 0x88, 0x0D,
+        0xAA, 0x0E, 0x1A, 0x00, 0x3C, 0xFF, 0x88, 0x05, 0x9D, 0x0D, 0x1A, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xF8, 0x10, 0x77, 0x29, 0x3B, 0x7A,
+        0x30, 0x8B, 0x80, 0xA0, 0x00, 0x00, 0x00, 0xF7, 0xC7, 0x40, 0xE0, 0xFF, 0xFF, 0xF3, 0x41, 0x0F, 0x6F, 0x4D, 0x00, 0xF3, 0x41, 0x0F, 0x6F, 0x95,
+        0x80, 0x00, 0x00, 0x00, 0xBF, 0xE8, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x4D, 0xA0, 0x66, 0x0F, 0xC6, 0xC1, 0x02, 0x66, 0x0F, 0xD4, 0x05, 0x89,
+        0xCA, 0x16, 0x00, 0x48, 0x05, 0x00, 0x02, 0x00, 0x00, 0x80, 0x3E, 0x43, 0xF3, 0x0F, 0x6F, 0x15, 0x5B, 0xE7, 0x19, 0x00, 0x74, 0x70, 0xE8, 0x86,
+        0x6D, 0x06, 0x00, 0xE8, 0xDB, 0x6A, 0x06, 0x00, 0xF7, 0xD0, 0x44, 0x85, 0xF0, 0x45, 0x0F, 0xA3, 0xFE, 0x4A, 0x8B, 0xBC, 0xFB, 0x80, 0x00, 0x00,
+        0x00, 0x75, 0xA8, 0xEB, 0x91, 0x09, 0x85, 0x40, 0xFE, 0xFF, 0xFF, 0x8B, 0x95, 0x50, 0xFE, 0xFF, 0xFF, 0x4A, 0x89, 0x04, 0xFB, 0xE9, 0x91, 0xFD,
+        0xFF, 0xFF, 0x8D, 0x42, 0xFF, 0x41, 0x0F, 0xA3, 0xC6, 0x73, 0x0F, 0xB8, 0x0C, 0x00, 0x00, 0x00, 0x77, 0x06, 0x74, 0x4F, 0x4D, 0x89, 0xBC, 0xDE,
+        0x80, 0x00, 0x00, 0x00, 0x74, 0x5C, 0x74, 0x39, 0x64, 0x48, 0x39, 0x3E, 0x8B, 0x0F, 0x89, 0xF2, 0xD3, 0xEA, 0x3B, 0x50, 0x04, 0x73, 0x24, 0x23,
+        0x48, 0x0C, 0x23, 0x70, 0x10, 0x8B, 0x3C, 0x10, 0xEB, 0xE8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x83, 0xC8, 0xFF, 0xB9, 0x22, 0x00, 0x00, 0x00,
+        0x01, 0xC6, 0x21, 0xC6, 0x48, 0x87, 0x3D, 0x29, 0x00, 0x1A, 0x00, 0x8B, 0x37, 0xBA, 0x12, 0x00, 0x00, 0x00, 0xE9, 0xF1, 0xFE, 0xFF, 0xFF, 0x8D,
+        0x97, 0x80, 0x00, 0x00, 0x00, 0x77, 0x18, 0x0F, 0x96, 0xC0, 0x0F, 0xB7, 0x84, 0x78, 0x00, 0x01, 0x00, 0x00, 0x21, 0xF0, 0x74, 0x57, 0x74, 0xD8,
+        0xE8, 0xB2, 0x0B, 0xFF, 0xFF, 0xE8, 0x15, 0x0D, 0xFF, 0xFF, 0x79, 0x19, 0xE9, 0xF4, 0x00, 0x00, 0x00, 0xE8, 0xE3, 0x92, 0x06, 0x00, 0x74, 0x47,
+        0x74, 0x2A, 0x8B, 0x03, 0x74, 0x65, 0x7F, 0x35, 0x48, 0x83, 0xD0, 0x00, 0x75, 0x9B, 0x74, 0x6E, 0x8B, 0x53, 0x04, 0x83, 0xEA, 0x03, 0x77, 0x27,
+        0x45, 0x0F, 0xB6, 0xE4, 0x4C, 0x0F, 0xAF, 0xE5, 0x41, 0x0F, 0x93, 0xC4, 0xE9, 0xC4, 0xFE, 0xFF, 0xFF, 0x41, 0x0F, 0x92, 0xC4, 0xE9, 0x94, 0xFE,
+        0xFF, 0xFF, 0xE9, 0x8C, 0xFE, 0xFF, 0xFF, 0xBF, 0x08, 0x00, 0x00, 0x00, 0x75, 0x17, 0x2B, 0x43, 0x08, 0x89, 0x8D, 0x50, 0xFF, 0xFF, 0xFF, 0xF7,
+        0xF6, 0x41, 0xF7, 0xF0, 0x39, 0xC8, 0x72, 0x4E, 0x8B, 0x55, 0x80, 0x0F, 0x42, 0xC6, 0x0F, 0x45, 0xD8, 0x83, 0xEB, 0x01, 0x44, 0x29, 0xF0, 0x49,
+        0x03, 0x47, 0x48, 0x73, 0xB2, 0x73, 0x3F, 0x48, 0xD1, 0xEB, 0x74, 0x04, 0x78, 0x5B, 0x72, 0xC1, 0x73, 0x4D, 0xE9, 0x39, 0xFF, 0xFF, 0xFF, 0x74,
+        0xC4, 0xE8, 0x57, 0x93, 0x05, 0x00, 0xE8, 0x8C, 0x00, 0xFF, 0xFF, 0xC6, 0x45, 0xC0, 0x01, 0x49, 0x83, 0x47, 0x78, 0x01, 0xEB, 0x6C, 0xBF, 0xF0,
+        0x0F, 0x00, 0x00, 0x41, 0x69, 0xD4, 0xF0, 0x0F, 0x00, 0x00, 0x49, 0xC7, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x24, 0xFF, 0xFF, 0xFF, 0xBE, 0x08,
+        0x00, 0x00, 0x00, 0x8B, 0x0A, 0x75, 0x1C, 0xE9, 0x47, 0x03, 0x00, 0x00, 0x48, 0x63, 0x85, 0x50, 0xFF, 0xFF, 0xFF, 0xE8, 0x4D, 0xF9, 0xFE, 0xFF,
+        0x3C, 0x3A, 0x8B, 0x9D, 0x34, 0xFF, 0xFF, 0xFF, 0x75, 0xCC, 0x75, 0x34, 0xEB, 0xCA, 0xE8, 0xA5, 0xF8, 0xFE, 0xFF, 0xE9, 0x81, 0xFC, 0xFF, 0xFF,
+        0x49, 0x3B, 0x85, 0xC0, 0x00, 0x00, 0x00, 0x73, 0x93, 0x72, 0xE6, 0xE9, 0xF3, 0xFB, 0xFF, 0xFF, 0x4F, 0x8B, 0x74, 0xDE, 0x20, 0xE9, 0xE5, 0xFF,
+        0xFF, 0xFF, 0xE8, 0xE2, 0x81, 0x05, 0x00, 0x7E, 0x71, 0x74, 0xCD, 0xEB, 0x18, 0x75, 0xBC, 0x74, 0xAF, 0x7F, 0xE2, 0xE8, 0x88, 0x01, 0x00, 0x00,
+        0xEB, 0x80, 0x7E, 0x7C, 0x74, 0xA4, 0x89, 0x15, 0x7B, 0xDC, 0x19, 0x00, 0xBF, 0xC8, 0x00, 0x00, 0x00, 0x88, 0x4C, 0x24, 0x10, 0x89, 0xCF, 0x0F,
+        0xCE, 0x89, 0x75, 0x28, 0x41, 0x0F, 0xC9, 0x89, 0xF6, 0xEB, 0x33, 0x80, 0x3C, 0x30, 0x00, 0x75, 0x92, 0x75, 0x9F, 0x74, 0x21, 0x45, 0x8D, 0x71,
+        0xA8, 0x77, 0x81, 0x49, 0xBE, 0x01, 0x00, 0x80, 0x20, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x7F, 0x4A, 0xEB, 0xA8, 0xEB, 0xD2, 0xE9, 0xCC, 0xFA,
+        0xFF, 0xFF, 0x41, 0x81, 0xFD, 0xDE, 0x12, 0x04, 0x95, 0x0F, 0xCB, 0x89, 0xDB, 0x83, 0x7B, 0x08, 0xFF, 0x48, 0x03, 0x8C, 0x24, 0xB0, 0x00, 0x00,
+        0x00, 0xE8, 0x91, 0xEA, 0xFE, 0xFF, 0xE9, 0xB0, 0xFC, 0xFF, 0xFF, 0x89, 0xD2, 0xE8, 0xEE, 0xE7, 0xFE, 0xFF, 0x89, 0xC9, 0xE9, 0xA1, 0xFE, 0xFF,
+        0xFF, 0x8B, 0x1F, 0xE9, 0xBB, 0xFE, 0xFF, 0xFF, 0x8D, 0x3C, 0x00, 0x43, 0x8B, 0x34, 0x3B, 0x75, 0x50, 0x74, 0xB0, 0xEB, 0x34, 0x89, 0xD9, 0x74,
+        0xB7, 0x4C, 0x01, 0x7C, 0x24, 0x18, 0xEB, 0x9A, 0xEB, 0x13, 0x8B, 0x46, 0x04, 0xEB, 0xAC, 0x39, 0x4C, 0x24, 0x20, 0x83, 0x7D, 0x58, 0x00, 0x8B,
+        0x0C, 0x96, 0x3B, 0x45, 0x58, 0x72, 0xE4, 0x8D, 0x34, 0x11, 0x8B, 0x30, 0x75, 0x87, 0x48, 0x2B, 0x46, 0x08, 0xE9, 0xEE, 0xFC, 0xFF, 0xFF, 0xE9,
+        0x49, 0xF3, 0xFF, 0xFF, 0xE9, 0xD6, 0xF2, 0xFF, 0xFF, 0xE9, 0x9E, 0xF1, 0xFF, 0xFF, 0x75, 0x7F, 0xE9, 0x77, 0xF0, 0xFF, 0xFF, 0xE9, 0x23, 0xF0,
+        0xFF, 0xFF, 0xE9, 0xFF, 0xEF, 0xFF, 0xFF, 0xE9, 0xA9, 0xEE, 0xFF, 0xFF, 0xE9, 0x01, 0xEE, 0xFF, 0xFF, 0xBE, 0x90, 0x01, 0x00, 0x00, 0xBE, 0x0A,
+        0x00, 0x00, 0x00, 0x0F, 0xB6, 0x95, 0x30, 0xFE, 0xFF, 0xFF, 0x3C, 0x23, 0x74, 0x77, 0x41, 0xF6, 0x07, 0x10, 0x74, 0x8F, 0xBA, 0x10, 0x00, 0x00,
+        0x00, 0x75, 0x89, 0x75, 0xD9, 0x74, 0xE9, 0x3C, 0x0A, 0x48, 0x0F, 0x42, 0xF7, 0x48, 0x83, 0x85, 0x28, 0xFE, 0xFF, 0xFF, 0x01, 0xEB, 0xBD, 0x66,
+        0x0F, 0xD4, 0xC1, 0x75, 0xEB, 0x74, 0x5E, 0x75, 0x1A, 0x74, 0xF1, 0x74, 0x4C, 0x49, 0xD1, 0xEC, 0x79, 0xCA, 0xEB, 0xCC, 0x29, 0xFE, 0x74, 0x53,
+        0x75, 0x45, 0x74, 0xAC, 0x42, 0xC6, 0x44, 0x2D, 0xFF, 0x2F, 0x78, 0x0C, 0x81, 0xE1, 0x55, 0x55, 0x00, 0x00, 0xD1, 0xF8, 0x25, 0x55, 0xD5, 0xFF,
+        0xFF, 0x01, 0xC8, 0x25, 0x33, 0x33, 0x00, 0x00, 0x81, 0xE2, 0x33, 0xF3, 0xFF, 0xFF, 0x01, 0xC2, 0x01, 0xD0, 0x25, 0x0F, 0x0F, 0x00, 0x00, 0xC1,
+        0xF9, 0x08, 0x01, 0xC1, 0x49, 0x0F, 0xAF, 0xCC, 0x41, 0xF7, 0xD4, 0x79, 0x0A, 0x41, 0x83, 0xEE, 0x01, 0x75, 0xF7, 0xE8, 0xFF, 0xD0, 0xFE, 0xFF,
+        0xFF, 0xB4, 0x24, 0xA8, 0x00, 0x00, 0x00, 0x73, 0x19, 0x72, 0x94, 0xBF, 0x28, 0x00, 0x00, 0x00, 0x41, 0x0F, 0x43, 0xF0, 0x88, 0x4E, 0xFF, 0x74,
+        0x29, 0x83, 0xEF, 0x30, 0x77, 0xDD, 0x88, 0x0E, 0xC6, 0x06, 0x00, 0xEB, 0xBA, 0x3C, 0x5F, 0x3C, 0x2E, 0x74, 0x78, 0x3C, 0x40, 0x80, 0x7A, 0x01,
+        0x00, 0xEB, 0x0A, 0x75, 0x04, 0xA8, 0xBF, 0x83, 0xCD, 0x02, 0x74, 0x6D, 0xF6, 0x03, 0xBF, 0x75, 0xF4, 0x44, 0x88, 0x33, 0x49, 0x81, 0xFF, 0x0F,
+        0x27, 0x00, 0x00, 0xB8, 0x10, 0x27, 0x00, 0x00, 0x4C, 0x0F, 0x4F, 0xF8, 0x43, 0x0F, 0xBE, 0x44, 0x05, 0x00, 0x0F, 0xBE, 0x14, 0x11, 0x39, 0xD1,
+        0x44, 0x0F, 0xBE, 0x34, 0x30, 0x41, 0xF7, 0xD8, 0x7E, 0x40, 0x83, 0xD0, 0xFF, 0x46, 0x0F, 0xBE, 0x04, 0x02, 0x4A, 0x0F, 0xBE, 0x34, 0x30, 0x29,
+        0xF0, 0xFF, 0xE6, 0x75, 0xAC, 0x75, 0x58, 0x75, 0x48, 0x74, 0x93, 0x41, 0x0F, 0xBE, 0x44, 0x05, 0x00, 0x77, 0xDB, 0x7E, 0xC9, 0xE9, 0x89, 0x00,
+        0x00, 0x00, 0x48, 0x0F, 0xBE, 0x54, 0x24, 0x30, 0x42, 0x0F, 0xBE, 0x04, 0x30, 0x01, 0xF2, 0x77, 0x13, 0x3A, 0x0C, 0x16, 0x74, 0xB1, 0x74, 0xE8,
+        0x44, 0x0F, 0xBE, 0xD9, 0x4F, 0x63, 0x0C, 0x8B, 0x41, 0xFF, 0xE1, 0xF3, 0x0F, 0x7E, 0x44, 0x24, 0x18, 0x48, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x0F,
+        0x00, 0x00, 0x00, 0x89, 0x78, 0x04, 0x66, 0x0F, 0xD6, 0x4C, 0x24, 0x48, 0x40, 0x0F, 0x94, 0xC7, 0x40, 0x08, 0xF8, 0x0F, 0x29, 0x4C, 0x24, 0x60,
+        0x66, 0x0F, 0x6F, 0x44, 0x24, 0x50, 0x48, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xE9, 0x30, 0x8D, 0x7E, 0xD0, 0x77, 0x1F,
+        0x8D, 0x4E, 0xD0, 0x76, 0xE1, 0xBA, 0x0B, 0x00, 0x00, 0x00, 0x38, 0x4F, 0x01, 0x75, 0x8C, 0x48, 0x63, 0x54, 0x24, 0x10, 0x48, 0xB9, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x23, 0x4C, 0x24, 0x28, 0x48, 0x83, 0xC9, 0x08, 0xBA, 0x08, 0x00, 0x00, 0x00, 0xB9, 0x05, 0x00, 0x00,
+        0x00, 0x48, 0x09, 0xCE, 0xB9, 0x09, 0x00, 0x00, 0x00, 0x75, 0x09, 0xB9, 0x0B, 0x00, 0x00, 0x00, 0xE9, 0x50, 0xF7, 0xFF, 0xFF, 0xBA, 0x0C, 0x00,
+        0x00, 0x00, 0xB9, 0x07, 0x00, 0x00, 0x00, 0xBA, 0x09, 0x00, 0x00, 0x00, 0xB9, 0x06, 0x00, 0x00, 0x00, 0xBA, 0x0D, 0x00, 0x00, 0x00, 0xB9, 0x0A,
+        0x00, 0x00, 0x00, 0x3C, 0x09, 0x77, 0x43, 0xEB, 0x17, 0x48, 0x21, 0xC8, 0x48, 0x31, 0xD0, 0x89, 0xF3, 0xBF, 0x38, 0x00, 0x00, 0x00, 0x4C, 0x0F,
+        0x45, 0xE8, 0x7E, 0x63, 0x78, 0x5F, 0x0F, 0xAF, 0xC2, 0x73, 0x1B, 0x45, 0x39, 0x54, 0x90, 0x04, 0xEB, 0xDF, 0x78, 0x2D, 0xBD, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x89, 0xE8, 0x3D, 0xDE, 0x08, 0x04, 0x96, 0x4F, 0x8D, 0x1C, 0x00, 0x76, 0x23, 0x72, 0xEC, 0x80, 0xFB, 0x3A, 0x84, 0xDB, 0x75, 0xCE, 0x3C,
+        0x63, 0x7F, 0x43, 0x3C, 0x4C, 0x3C, 0x4E, 0xEB, 0x96, 0x3C, 0x6C, 0x3C, 0x74, 0xE9, 0x57, 0xFF, 0xFF, 0xFF, 0x3C, 0x25, 0x43, 0x88, 0x04, 0x3E,
+        0x40, 0x0F, 0x95, 0xC6, 0x72, 0xD2, 0x49, 0x0F, 0x43, 0xC5, 0xEB, 0xAA, 0xEB, 0x19, 0x80, 0x7C, 0x1D, 0x02, 0x00, 0x72, 0xE0, 0x72, 0xD6, 0x49,
+        0x0F, 0x42, 0xC5, 0x76, 0x26, 0xEB, 0xA7, 0x3D, 0x96, 0x04, 0x08, 0xDE, 0x76, 0x3F, 0x74, 0xAD, 0xE9, 0x98, 0xFC, 0xFF, 0xFF, 0x0F, 0xBF, 0xD2,
+        0x05, 0x00, 0x00, 0x00, 0x80, 0xF7, 0xD1, 0x09, 0xC1, 0x29, 0xD1, 0x21, 0xC8, 0x01, 0xC0, 0x25, 0xFE, 0xFF, 0x00, 0x00, 0x81, 0xE6, 0xFF, 0xFF,
+        0xFF, 0x7F, 0x09, 0xD6, 0xF7, 0xDA, 0x09, 0xF2, 0xB9, 0xFE, 0xFF, 0x00, 0x00, 0x0D, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0xDB, 0x6C, 0x24, 0x18,
+        0xD9, 0xE5, 0xDF, 0xE0, 0xDD, 0xD8, 0xD9, 0xE1, 0xF6, 0xC4, 0x02, 0xD9, 0xE0, 0x49, 0xC1, 0xE8, 0x20, 0x7F, 0x3C, 0x44, 0x21, 0xC1, 0x09, 0xF1,
+        0x66, 0x25, 0x00, 0x80, 0xDB, 0x3F, 0x85, 0xF2, 0xF7, 0xD2, 0x21, 0xF2, 0xD9, 0xC0, 0xDE, 0xE1, 0xD9, 0xE8, 0xDE, 0xC9, 0x41, 0x81, 0xE0, 0xFF,
+        0xFF, 0xFF, 0x7F, 0x41, 0x09, 0xF0, 0xDB, 0x44, 0x24, 0xFC, 0xD9, 0xFD, 0xDD, 0xD9, 0x66, 0x81, 0xE6, 0xFF, 0x7F, 0x98, 0x01, 0xD1, 0x0D, 0xFE,
+        0x3F, 0x00, 0x00, 0xDB, 0x7C, 0x24, 0xE8, 0xD8, 0x0D, 0xAA, 0x68, 0x16, 0x00, 0xD8, 0xC0, 0xDB, 0x2D, 0x0E, 0x5D, 0x16, 0x00, 0xDF, 0xE9, 0x72,
+        0x0C, 0xD9, 0xEE, 0xD9, 0xC9, 0xDB, 0xE9, 0x7A, 0x0E, 0xDB, 0x3C, 0x24, 0x7A, 0xCE, 0x48, 0x0F, 0xBA, 0xF1, 0x3F, 0x21, 0xD0, 0x48, 0xBA, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xF3, 0x0F, 0x7E, 0x15, 0x48, 0x5C, 0x16, 0x00, 0x66, 0x0F, 0x28, 0xD8, 0x66, 0x0F, 0x54, 0xD1, 0x66,
+        0x0F, 0x55, 0xC3, 0x66, 0x0F, 0x56, 0xC2, 0x81, 0xE9, 0xFF, 0x03, 0x00, 0x00, 0x7F, 0x40, 0x48, 0xD3, 0xE8, 0x75, 0x76, 0xF2, 0x0F, 0x11, 0x0A,
+        0xF2, 0x0F, 0x10, 0x0D, 0x08, 0x60, 0x16, 0x00, 0xF2, 0x0F, 0x59, 0xC8, 0x74, 0xD1, 0x48, 0xF7, 0xD0, 0xF2, 0x0F, 0x5C, 0xD1, 0x25, 0xFF, 0x07,
+        0x00, 0x00, 0x7C, 0x5F, 0x7F, 0x31, 0x7F, 0x23, 0x7E, 0x3E, 0x66, 0x0F, 0x54, 0x0D, 0xD0, 0x5A, 0x16, 0x00, 0x66, 0x0F, 0x56, 0x0D, 0xE8, 0x5A,
+        0x16, 0x00, 0xF2, 0x0F, 0x59, 0x0D, 0xE0, 0x5A, 0x16, 0x00, 0x7D, 0x5A, 0xF2, 0x0F, 0x58, 0xC8, 0x66, 0x0F, 0x2E, 0xC1, 0x0F, 0x9A, 0xC1, 0x74,
+        0x35, 0x66, 0x0F, 0xD7, 0xC0, 0x25, 0x80, 0x00, 0x00, 0x00, 0x7A, 0x08, 0x73, 0x1D, 0x7A, 0xE7, 0x81, 0xF1, 0x00, 0x00, 0x80, 0x7F, 0x2D, 0x00,
+        0x00, 0x80, 0x7F, 0xF3, 0x0F, 0x10, 0x15, 0xB8, 0x58, 0x16, 0x00, 0x0F, 0x28, 0xD8, 0x0F, 0x54, 0xD1, 0x0F, 0x55, 0xC3, 0x0F, 0x56, 0xC2, 0x89,
+        0xD6, 0x7F, 0x5A, 0x78, 0x3E, 0xD3, 0xF8, 0x85, 0xC2, 0xF3, 0x0F, 0x5C, 0xC8, 0xF3, 0x0F, 0x11, 0x07, 0xF3, 0x0F, 0x59, 0x05, 0x20, 0x63, 0x16,
+        0x00, 0xF7, 0xC2, 0xFF, 0xFF, 0x7F, 0x00, 0x75, 0xAA, 0x7C, 0x4F, 0x7F, 0x22, 0x3D, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x19, 0x7E, 0x35, 0x0F, 0x54,
+        0x0D, 0xA9, 0x57, 0x16, 0x00, 0x0F, 0x56, 0x0D, 0xC2, 0x57, 0x16, 0x00, 0x7D, 0x43, 0xF3, 0x0F, 0x58, 0xC8, 0x7F, 0x4C, 0xA9, 0x00, 0x00, 0x80,
+        0x7F, 0x89, 0x17, 0xB9, 0xE7, 0xFF, 0xFF, 0xFF, 0xEB, 0xC6, 0x0F, 0x2E, 0xDA, 0x72, 0x0B, 0x7A, 0x0C, 0x73, 0x17, 0x7A, 0xEE, 0xEB, 0xEA, 0x66,
+        0x0F, 0x6F, 0xD0, 0x66, 0x0F, 0xDB, 0x0D, 0xAC, 0x55, 0x16, 0x00, 0x66, 0x0F, 0xDF, 0xC2, 0x66, 0x0F, 0xEB, 0xC1, 0x81, 0xE3, 0xFF, 0x7F, 0x00,
+        0x00, 0x7F, 0x5C, 0x48, 0xD3, 0xF8, 0x4C, 0x09, 0xEA, 0x49, 0x21, 0xC4, 0x7E, 0x3A, 0x48, 0x81, 0xFB, 0x00, 0x40, 0x00, 0x00, 0x4C, 0x21, 0xE0,
+        0x75, 0xBB, 0x8D, 0x4B, 0xD0, 0x49, 0x85, 0xC5, 0x81, 0xFB, 0xB0, 0x3C, 0xFF, 0xFF, 0x7C, 0x5E, 0x75, 0x83, 0x66, 0x0F, 0xEB, 0x05, 0x33, 0x53,
+        0x16, 0x00, 0x48, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x72, 0x7F, 0x74, 0x76, 0xB9, 0x90, 0xBF, 0xFF, 0xFF, 0x89, 0x0B, 0xC7,
+        0x03, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x50, 0xC0, 0x66, 0x0F, 0xDB, 0xC3, 0x7F, 0x13, 0x75, 0x38, 0x7F, 0x1B, 0xD9, 0x7C, 0x24, 0x06, 0x09, 0xC7,
+        0xD9, 0x6C, 0x24, 0x06, 0x89, 0x73, 0x40, 0xE9, 0x66, 0xFF, 0xFF, 0xFF, 0xEB, 0xDA, 0x75, 0x19, 0xFF, 0xE2, 0x8D, 0x4F, 0xFF, 0x77, 0x76, 0x8D,
+        0x47, 0xE0, 0x76, 0x68, 0x48, 0xD3, 0xE0, 0x48, 0x23, 0x05, 0xAD, 0x8E, 0x19, 0x00, 0x78, 0x30, 0xEB, 0xC7, 0xF7, 0xDF, 0xE9, 0x75, 0x02, 0x00,
+        0x00, 0x77, 0x10, 0x76, 0x08, 0x0F, 0x11, 0x44, 0x24, 0x18, 0x48, 0x0D, 0x00, 0x00, 0x00, 0x04, 0xB8, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x6F,
+        0x84, 0x24, 0xB8, 0x00, 0x00, 0x00, 0x41, 0x89, 0x80, 0x88, 0x00, 0x00, 0x00, 0x49, 0x89, 0x80, 0x90, 0x00, 0x00, 0x00, 0xEB, 0xE4, 0xB8, 0x3E,
+        0x00, 0x00, 0x00, 0x73, 0x01, 0xB8, 0x7F, 0x00, 0x00, 0x00, 0x77, 0x04, 0xB8, 0x82, 0x00, 0x00, 0x00, 0x77, 0x2F, 0xEB, 0xBE, 0x78, 0xE0, 0xB9,
+        0x0F, 0x00, 0x00, 0x00, 0x78, 0x22, 0x75, 0x46, 0x78, 0x0E, 0x79, 0xB7, 0x78, 0x37, 0x78, 0x29, 0xEB, 0xD8, 0x81, 0xCF, 0x00, 0x00, 0x00, 0x10,
+        0x89, 0x94, 0x24, 0x28, 0x01, 0x00, 0x00, 0x78, 0x60, 0x74, 0x3D, 0x8B, 0x94, 0x24, 0x88, 0x00, 0x00, 0x00, 0x83, 0xC9, 0x01, 0xEB, 0xDD, 0x75,
+        0xA0, 0x75, 0x0E, 0xB8, 0x83, 0x00, 0x00, 0x00, 0x0F, 0x49, 0xC1, 0x75, 0x4C, 0x81, 0xCE, 0x00, 0x00, 0x00, 0x10, 0x89, 0xB4, 0x24, 0x88, 0x00,
+        0x00, 0x00, 0xEB, 0xB5, 0x77, 0x20, 0x76, 0x13, 0x48, 0xD3, 0xC0, 0x48, 0x23, 0x07, 0xC7, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xE0, 0x79, 0xA7, 0x8B, 0x17, 0x08, 0xC8, 0x75, 0x18, 0x48, 0x0B, 0x02, 0x39, 0xD0, 0x74, 0x36, 0xB8, 0x80, 0x00, 0x00, 0x00, 0x77, 0x3B, 0xEB,
+        0x89, 0x89, 0x34, 0x24, 0xB8, 0x81, 0x00, 0x00, 0x00, 0xEB, 0xDC, 0x78, 0x31, 0xEB, 0xD7, 0x89, 0xFE, 0x78, 0x6C, 0x78, 0x53, 0xC1, 0xFB, 0x06,
+        0x48, 0x23, 0x84, 0xDC, 0x80, 0x00, 0x00, 0x00, 0x79, 0x3A, 0x75, 0x5D, 0xEB, 0x90, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x77, 0x1A, 0x83, 0xC1, 0x06,
+        0x77, 0x23, 0xEB, 0xD1, 0x64, 0x41, 0x89, 0x04, 0x24, 0x64, 0x41, 0x83, 0x3C, 0x24, 0x26, 0x76, 0xD0, 0x78, 0x7B, 0x78, 0x6F, 0xEB, 0x0C, 0x74,
+        0xE1, 0x7E, 0x2B, 0x74, 0xE4, 0xC7, 0x04, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xED, 0xE8, 0x9F, 0xAE, 0x0D, 0x00, 0x76, 0x58, 0x48, 0x19, 0xF6,
+        0x23, 0x44, 0x24, 0x04, 0x41, 0x0F, 0xBD, 0xC5, 0x8D, 0x48, 0x01, 0x49, 0xD3, 0xE4, 0x29, 0xCA, 0x21, 0xC3, 0x72, 0x2B, 0x75, 0xD1, 0xEB, 0x12,
+        0x73, 0x2D, 0x4D, 0x0F, 0xAF, 0xFD, 0x79, 0xD0, 0x72, 0xD3, 0xEB, 0x41, 0xC6, 0x44, 0x24, 0x60, 0x2F, 0x74, 0xF4, 0xEB, 0x83, 0x73, 0x6A, 0x75,
+        0xC9, 0xE8, 0xE5, 0x8A, 0xFE, 0xFF, 0xE8, 0xF3, 0x87, 0xFE, 0xFF, 0xBA, 0x16, 0x00, 0x00, 0x00, 0x79, 0x57, 0x74, 0xF0, 0xB8, 0x28, 0x00, 0x00,
+        0x00, 0xBA, 0x28, 0x00, 0x00, 0x00, 0x48, 0x3B, 0xB4, 0x24, 0x68, 0x04, 0x00, 0x00, 0x72, 0x6E, 0x4C, 0x3B, 0xA4, 0x24, 0x68, 0x04, 0x00, 0x00,
+        0x73, 0xDE, 0x80, 0x39, 0x2F, 0xBF, 0x9C, 0xFF, 0xFF, 0xFF, 0xBF, 0xAD, 0x00, 0x00, 0x00, 0x74, 0x5F, 0xBE, 0x10, 0x04, 0x00, 0x00, 0xBA, 0x70,
+        0x00, 0x00, 0x00, 0xF0, 0x0F, 0xB1, 0x13, 0x75, 0x60, 0x87, 0x03, 0xEB, 0x8C, 0x7F, 0x24, 0xBA, 0x29, 0x00, 0x00, 0x00, 0xF0, 0x41, 0x0F, 0xB1,
+        0x0E, 0x72, 0x79, 0x41, 0x87, 0x06, 0x73, 0x8C, 0xEB, 0x2C, 0x72, 0x15, 0x73, 0xEB, 0x7F, 0x49, 0xBE, 0x20, 0x00, 0x00, 0x00, 0x74, 0x6C, 0x75,
+        0x47, 0x64, 0x49, 0x8B, 0x04, 0x24, 0xF0, 0x48, 0x83, 0x80, 0x88, 0x04, 0x00, 0x00, 0x01, 0xEB, 0xE7, 0x64, 0x48, 0x8B, 0x5D, 0x00, 0x99, 0xF7,
+        0xFE, 0xF2, 0x0F, 0x10, 0x04, 0x24, 0x66, 0x83, 0x7E, 0x0E, 0x00, 0xC1, 0xE1, 0x10, 0x89, 0x02, 0x89, 0x46, 0x0C, 0xBE, 0x0B, 0x00, 0x00, 0x00,
+        0x78, 0x48, 0x66, 0xC1, 0xEA, 0x0C, 0xF2, 0x0F, 0x5C, 0x05, 0x30, 0x2D, 0x16, 0x00, 0xEB, 0xF2, 0x89, 0xDA, 0xC6, 0x05, 0x21, 0x72, 0x19, 0x00,
+        0x01, 0x73, 0x0C, 0xFF, 0x13, 0x72, 0xF5, 0x7F, 0x55, 0xEB, 0x97, 0xE9, 0x05, 0xFF, 0xFF, 0xFF, 0x74, 0x34, 0x39, 0x1F, 0xBF, 0x18, 0x00, 0x00,
+        0x00, 0x66, 0x49, 0x0F, 0x6E, 0xCC, 0x89, 0x18, 0xEB, 0x9D, 0x72, 0xF1, 0x73, 0x9C, 0x74, 0x97, 0x7E, 0x83, 0x75, 0x55, 0xD3, 0xE2, 0x09, 0x15,
+        0xDD, 0x6D, 0x19, 0x00, 0x48, 0xF7, 0x04, 0x24, 0x00, 0x01, 0x00, 0x00, 0x21, 0xC2, 0xD1, 0xE9, 0x21, 0xCF, 0x41, 0xC1, 0xE8, 0x03, 0x21, 0xCE,
+        0x41, 0x21, 0xC8, 0x45, 0x84, 0xC0, 0x44, 0x08, 0xC0, 0x41, 0x53, 0x75, 0x75, 0x75, 0x71, 0x52, 0xEB, 0x4F, 0x74, 0xC9, 0xEB, 0xA5, 0x75, 0x7E,
+        0xE9, 0x4F, 0xFC, 0xFF, 0xFF, 0x7E, 0x7B, 0x7F, 0x2F, 0xD9, 0x31, 0xD9, 0x21, 0x0F, 0xAE, 0x9F, 0xC0, 0x01, 0x00, 0x00, 0x77, 0x67, 0x77, 0x2E,
+        0x78, 0x11, 0x74, 0xC1, 0x80, 0xCC, 0x3D, 0x66, 0x3B, 0x03, 0x75, 0x13, 0x66, 0x44, 0x3B, 0x23, 0x42, 0x80, 0x3C, 0x33, 0x3D, 0x77, 0x58, 0x77,
+        0x31, 0xBE, 0x2C, 0x00, 0x00, 0x00, 0x49, 0x0F, 0x44, 0xC5, 0x74, 0x3C, 0x48, 0x0F, 0x48, 0xC7, 0x48, 0x99, 0x48, 0xF7, 0xFE, 0x7E, 0x0E, 0xB8,
+        0x06, 0x00, 0x00, 0x00, 0xBE, 0x18, 0x00, 0x00, 0x00, 0x41, 0x0F, 0x4D, 0xC3, 0x7E, 0x54, 0x77, 0x47, 0x75, 0x03, 0xE9, 0x40, 0xFA, 0xFF, 0xFF,
+        0x77, 0x33, 0x75, 0x30, 0x7F, 0xC7, 0x73, 0x12, 0x48, 0xA5, 0x75, 0xA9, 0x48, 0x29, 0x6C, 0x24, 0x28, 0x7F, 0xCF, 0x7F, 0xC8, 0xE8, 0x36, 0x64,
+        0xFE, 0xFF, 0x7F, 0xC1, 0xA8, 0x03, 0x76, 0x0D, 0xBF, 0x55, 0x00, 0x00, 0x00, 0xA8, 0x07, 0x66, 0xD1, 0xEA, 0xF0, 0x0F, 0xB1, 0x55, 0x00, 0x87,
+        0x45, 0x00, 0x7F, 0x0E, 0xBA, 0x1F, 0x00, 0x00, 0x00, 0x76, 0x04, 0x49, 0xF7, 0xDD, 0xFF, 0xD3, 0xEB, 0x07, 0x78, 0xEE, 0x72, 0x20, 0x48, 0x0F,
+        0x46, 0xF0, 0x72, 0x5C, 0x4D, 0x0F, 0x48, 0xE5, 0x73, 0xE7, 0x78, 0xE1, 0x75, 0x39, 0x73, 0x92, 0x72, 0xBF, 0x72, 0x40, 0x45, 0x88, 0x19, 0x73,
+        0xC3, 0x75, 0xE1, 0x88, 0x4A, 0xFF, 0x73, 0xB3, 0xEB, 0xE9, 0xE8, 0x6C, 0xDC, 0xFF, 0xFF, 0x69, 0x17, 0x6D, 0x4E, 0xC6, 0x41, 0x81, 0xC2, 0x39,
+        0x30, 0x00, 0x00, 0x69, 0xC2, 0x6D, 0x4E, 0xC6, 0x41, 0x05, 0x39, 0x30, 0x00, 0x00, 0x69, 0xC0, 0x6D, 0x4E, 0xC6, 0x41, 0x31, 0xD0, 0x7F, 0x21,
+        0x75, 0x3F, 0x7F, 0x41, 0x75, 0x3E, 0x75, 0x3D, 0x8B, 0x56, 0x18, 0x48, 0x69, 0xD2, 0x5F, 0x0B, 0x4E, 0x83, 0x41, 0xC1, 0xFA, 0x1F, 0x44, 0x69,
+        0xD2, 0x1D, 0xF3, 0x01, 0x00, 0x69, 0xD2, 0xEC, 0xF4, 0xFF, 0xFF, 0x43, 0x8D, 0x04, 0x89, 0x8D, 0x74, 0x00, 0xFF, 0xEB, 0x1D, 0x8B, 0x41, 0x18,
+        0x73, 0x1A, 0x78, 0xCC, 0x8B, 0x71, 0x18, 0x77, 0x49, 0x19, 0xF6, 0x19, 0xC9, 0x19, 0xED, 0x8D, 0x04, 0x80, 0x01, 0xE8, 0x01, 0xF1, 0x89, 0x4A,
+        0xFC, 0xC1, 0xFE, 0x1F, 0x29, 0xF2, 0x4A, 0x63, 0x74, 0x88, 0x14, 0x89, 0x41, 0x20, 0xC1, 0xFF, 0x1F, 0x29, 0xFA, 0x8D, 0x14, 0x92, 0x03, 0x02,
+        0x73, 0x0B, 0x72, 0x18, 0x89, 0xF7, 0x89, 0xCB, 0x75, 0x2D, 0x57, 0x73, 0x5B, 0x0F, 0xAE, 0x92, 0xC0, 0x01, 0x00, 0x00, 0x74, 0x6F, 0x41, 0x0F,
+        0x11, 0x06, 0xE9, 0xBC, 0xFE, 0xFF, 0xFF, 0x7F, 0x0A, 0x75, 0x5E, 0xEB, 0xD0, 0xEB, 0x94, 0x89, 0x7E, 0x02, 0x88, 0x03, 0x3C, 0x3D, 0x7F, 0x51,
+        0x88, 0x44, 0x24, 0x08, 0x7E, 0xB9, 0x3C, 0x5E, 0x76, 0xE6, 0x3C, 0x69, 0x3C, 0x6E, 0xEB, 0x3A, 0xC6, 0x84, 0x24, 0x87, 0x00, 0x00, 0x00, 0x20,
+        0x3D, 0xAF, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x2F, 0xC8, 0xF2, 0x0F, 0x11, 0x84, 0x24, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x13, 0x00, 0x00, 0x00, 0x40,
+        0x22, 0x7C, 0x24, 0x60, 0x88, 0x84, 0x24, 0x87, 0x00, 0x00, 0x00, 0x44, 0x0F, 0x44, 0xE8, 0xE9, 0xE3, 0xFB, 0xFF, 0xFF, 0x66, 0x0F, 0x57, 0x05,
+        0x9D, 0xF0, 0x15, 0x00, 0xB8, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x94, 0x44, 0x24, 0x60, 0x80, 0xBC, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x39, 0xCA,
+        0x44, 0x0F, 0x45, 0xF0, 0x0F, 0xBE, 0x44, 0x24, 0x08, 0x66, 0x89, 0x84, 0x24, 0xEC, 0x00, 0x00, 0x00, 0x0A, 0x44, 0x24, 0x60, 0x08, 0xC2, 0x7E,
+        0x41, 0xDB, 0x28, 0xDF, 0xF1, 0xDB, 0xBC, 0x24, 0xD0, 0x00, 0x00, 0x00, 0xE9, 0xC3, 0xFA, 0xFF, 0xFF, 0xE9, 0x9B, 0xFB, 0xFF, 0xFF, 0x41, 0xF7,
+        0xC7, 0xFD, 0xFF, 0xFF, 0xFF, 0x88, 0x0A, 0x7D, 0x55, 0x75, 0x73, 0x7D, 0xDA, 0xB8, 0x0A, 0x00, 0x00, 0x00, 0x20, 0xC1, 0x89, 0x4F, 0x04, 0x89,
+        0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x49, 0x83, 0xCC, 0xFF, 0x40, 0x88, 0x38, 0x76, 0x0F, 0x76, 0xDE, 0x20, 0xD1, 0xE9, 0xB8, 0xEF, 0xFF, 0xFF,
+        0x66, 0x0F, 0xEF, 0x05, 0xD2, 0xDF, 0x15, 0x00, 0x74, 0xA1, 0xF2, 0x0F, 0x11, 0x44, 0x24, 0x10, 0x8D, 0x53, 0xBF, 0x48, 0x0F, 0xA3, 0xD1, 0x83,
+        0xE3, 0xDF, 0xEB, 0x35, 0x01, 0xF6, 0x29, 0xD7, 0x39, 0xFE, 0x41, 0x0F, 0x4F, 0xD2, 0x78, 0xE2, 0x7E, 0xC3, 0xF3, 0x0F, 0x5A, 0xC0, 0xEB, 0xB1,
+        0xDB, 0xAC, 0x24, 0xD0, 0x01, 0x00, 0x00, 0x4C, 0x39, 0xB4, 0x24, 0x88, 0x00, 0x00, 0x00, 0x75, 0x20, 0x75, 0x2F, 0x09, 0xD1, 0x66, 0x3D, 0x00,
+        0x08, 0x89, 0xF1, 0x29, 0xD9, 0x49, 0x0F, 0xBA, 0xE7, 0x35, 0x48, 0x0F, 0xBA, 0x6D, 0x00, 0x34, 0xEB, 0x70, 0xF2, 0x0F, 0x58, 0x05, 0xC8, 0xD6,
+        0x15, 0x00, 0x81, 0xEE, 0xFF, 0x03, 0x00, 0x00, 0x0F, 0x92, 0xC2, 0xB9, 0x34, 0x00, 0x00, 0x00, 0x48, 0x0F, 0xBA, 0xE0, 0x35, 0x76, 0x16, 0x41,
+        0x3A, 0x06, 0x74, 0x8D, 0x38, 0x4C, 0x05, 0x00, 0x7E, 0x3D, 0x48, 0x0F, 0xAF, 0x1C, 0xC8, 0x74, 0xB4, 0x7F, 0x11, 0xBA, 0xC4, 0x01, 0x00, 0x00,
+        0xBA, 0x8C, 0x01, 0x00, 0x00, 0x3C, 0x2D, 0x3C, 0x2B, 0x41, 0x38, 0x0C, 0x14, 0x38, 0x04, 0x16, 0x40, 0x20, 0xC7, 0xB8, 0x35, 0x01, 0x00, 0x00,
+        0xEB, 0x3C, 0x74, 0xBC, 0x74, 0xF6, 0x40, 0x38, 0x33, 0x38, 0x14, 0x03, 0x48, 0xF7, 0xE2, 0x3D, 0x34, 0x04, 0x00, 0x00, 0x8D, 0x81, 0x34, 0x04,
+        0x00, 0x00, 0x7E, 0x0B, 0xEB, 0x2F, 0x45, 0x01, 0xFF, 0x74, 0xEF, 0x74, 0xC5, 0x75, 0xA1, 0x48, 0x0F, 0xBD, 0x84, 0xC4, 0x70, 0x02, 0x00, 0x00,
+        0x48, 0x83, 0xF0, 0x3F, 0x78, 0x18, 0x4A, 0xC7, 0x84, 0xD4, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x35, 0x00, 0x00, 0x00, 0x7E,
+        0x34, 0x7E, 0x1C, 0x49, 0xF7, 0xE5, 0x48, 0x83, 0xDA, 0x00, 0x72, 0x17, 0x4A, 0x39, 0x84, 0xE4, 0x80, 0x00, 0x00, 0x00, 0x73, 0xD1, 0xE9, 0xDC,
+        0xFE, 0xFF, 0xFF, 0x77, 0x51, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x8B, 0x34, 0x97, 0x7E, 0xD1, 0x76, 0xF1, 0x8D, 0x57, 0xFF, 0x8D, 0x4A, 0xD0, 0x75,
+        0x22, 0x74, 0xEC, 0x3C, 0x30, 0x74, 0xF3, 0xB9, 0x35, 0x00, 0x00, 0x00, 0xBF, 0x34, 0x00, 0x00, 0x00, 0x29, 0xC1, 0x29, 0xC7, 0x49, 0x09, 0xC1,
+        0x76, 0x0A, 0x7F, 0xA2, 0x4D, 0x0F, 0x44, 0xCB, 0x29, 0xF9, 0x41, 0x20, 0xC7, 0x74, 0xBD, 0x83, 0xF2, 0x01, 0xEB, 0x03, 0x38, 0x0C, 0x16, 0x75,
+        0xBD, 0xE9, 0x42, 0xF9, 0xFF, 0xFF, 0x49, 0x0F, 0xBD, 0xD5, 0xB9, 0x40, 0x00, 0x00, 0x00, 0x48, 0x09, 0x44, 0x24, 0x78, 0x4C, 0x85, 0xED, 0x4D,
+        0x31, 0xE9, 0x7F, 0x58, 0x41, 0xC1, 0xE3, 0x06, 0x7E, 0x09, 0x72, 0x0A, 0x73, 0xE1, 0xEB, 0x85, 0x45, 0x29, 0xE8, 0x48, 0x0F, 0xBD, 0xC0, 0x89,
+        0xE9, 0x4C, 0x39, 0x24, 0x24, 0x4D, 0x0F, 0xBD, 0xC4, 0x49, 0x83, 0xF0, 0x3F, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x8D, 0x56, 0xD0, 0x49, 0x83, 0xD4,
+        0x00, 0x48, 0x83, 0xBC, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x72, 0x0D, 0x41, 0x0F, 0x9C, 0xC1, 0xB8, 0x36, 0x00, 0x00, 0x00, 0x49, 0xD3, 0xE9,
+        0x7E, 0x1B, 0x49, 0x0F, 0x45, 0xC6, 0xE9, 0x15, 0xF2, 0xFF, 0xFF, 0xBA, 0x5F, 0x05, 0x00, 0x00, 0xBA, 0x4D, 0x05, 0x00, 0x00, 0xBA, 0xD5, 0x06,
+        0x00, 0x00, 0xBA, 0x90, 0x03, 0x00, 0x00, 0xBA, 0x5E, 0x04, 0x00, 0x00, 0xBA, 0xB0, 0x03, 0x00, 0x00, 0xBA, 0x30, 0x04, 0x00, 0x00, 0xBA, 0x2D,
+        0x04, 0x00, 0x00, 0xBA, 0xFC, 0x03, 0x00, 0x00, 0xBA, 0x74, 0x05, 0x00, 0x00, 0xBA, 0x88, 0x03, 0x00, 0x00, 0xBA, 0x59, 0x05, 0x00, 0x00, 0xBA,
+        0xBC, 0x03, 0x00, 0x00, 0xBA, 0x9C, 0x03, 0x00, 0x00, 0xBA, 0xD8, 0x05, 0x00, 0x00, 0xBA, 0x7B, 0x01, 0x00, 0x00, 0xBA, 0x4B, 0x04, 0x00, 0x00,
+        0xBA, 0xAB, 0x06, 0x00, 0x00, 0xBA, 0x55, 0x02, 0x00, 0x00, 0x3C, 0x19, 0x76, 0xED, 0x38, 0xD1, 0x75, 0x5C, 0x74, 0x92, 0xEB, 0x8B, 0xF3, 0x0F,
+        0x59, 0xC0, 0xF3, 0x0F, 0x58, 0x05, 0x60, 0xB3, 0x15, 0x00, 0x48, 0x81, 0x4D, 0x00, 0x00, 0x00, 0x80, 0x00, 0xB9, 0x17, 0x00, 0x00, 0x00, 0xE9,
+        0x87, 0xFD, 0xFF, 0xFF, 0xB8, 0x27, 0x00, 0x00, 0x00, 0x3D, 0x97, 0x00, 0x00, 0x00, 0xBD, 0x18, 0x00, 0x00, 0x00, 0xB8, 0x20, 0x00, 0x00, 0x00,
+        0x0F, 0x57, 0x05, 0x40, 0x97, 0x15, 0x00, 0xB9, 0x18, 0x00, 0x00, 0x00, 0xBF, 0x17, 0x00, 0x00, 0x00, 0x74, 0x71, 0xB8, 0x18, 0x00, 0x00, 0x00,
+        0xB8, 0x19, 0x00, 0x00, 0x00, 0x64, 0x4C, 0x8B, 0x00, 0x74, 0x52, 0xEB, 0x4A, 0xBF, 0x0A, 0x00, 0x00, 0x00, 0x49, 0xB8, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x19, 0x41, 0x38, 0xC6, 0x73, 0x05, 0x75, 0x7C, 0x74, 0x2C, 0x39, 0xFA, 0x7D, 0x1E, 0x73, 0xB1, 0xEB, 0x67, 0x41, 0x83, 0x3C,
+        0x82, 0x58, 0x7E, 0x16, 0x45, 0x38, 0x1C, 0x04, 0x73, 0xC7, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x80, 0x79, 0xFE, 0x30, 0xD8, 0xC8, 0xDE, 0xC1, 0x75,
+        0x96, 0x41, 0x81, 0xEF, 0xFF, 0x3F, 0x00, 0x00, 0x41, 0x0F, 0x44, 0xC7, 0xB9, 0x3F, 0x00, 0x00, 0x00, 0x74, 0xE5, 0x45, 0x0F, 0xB6, 0x14, 0x10,
+        0x44, 0x38, 0x54, 0x15, 0x00, 0xEB, 0x37, 0x74, 0xBB, 0x73, 0x2C, 0x48, 0x01, 0x44, 0x24, 0x08, 0xB8, 0x45, 0x13, 0x00, 0x00, 0x3D, 0x3F, 0x40,
+        0x00, 0x00, 0x74, 0xC6, 0x75, 0xA3, 0x78, 0x1B, 0x7E, 0x14, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0x48, 0xF0, 0x7E, 0xD0, 0x76, 0xF0, 0xD9,
+        0x05, 0x55, 0x73, 0x15, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xA4, 0xEB, 0x43, 0x83, 0xF0, 0x01, 0xEB, 0xA0, 0x75, 0x6F, 0x78, 0x27, 0x48,
+        0x83, 0x6C, 0x24, 0x78, 0x40, 0x48, 0x09, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x01, 0xED, 0x49, 0x83, 0xDE, 0x00, 0xB8, 0x41, 0x00, 0x00, 0x00,
+        0x7E, 0x5F, 0x74, 0x7A, 0x77, 0x75, 0xEB, 0x30, 0x38, 0x44, 0x24, 0x0A, 0x72, 0x45, 0x7D, 0x20, 0x74, 0xA3, 0x73, 0x82, 0x73, 0xCF, 0x7E, 0xC1,
+        0x73, 0x5E, 0x48, 0x81, 0x8C, 0x24, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBE, 0x0C, 0x00, 0x00, 0x00, 0x83, 0x2D, 0x46, 0x96, 0x18,
+        0x00, 0x01, 0x39, 0x44, 0x24, 0x0C, 0xBE, 0x09, 0x00, 0x00, 0x00, 0x8B, 0x7F, 0x10, 0x8B, 0x7B, 0x10, 0x7F, 0x60, 0x75, 0x49, 0x72, 0x13, 0x73,
+        0x3C, 0x75, 0xF1, 0xEB, 0x53, 0xEB, 0x32, 0xEB, 0x60, 0xEB, 0x46, 0x4D, 0x11, 0xDA, 0x11, 0xC0, 0xE3, 0xA9, 0x48, 0x8D, 0x1A, 0x0F, 0xBA, 0xE3,
+        0x00, 0x72, 0x24, 0x4C, 0x8D, 0x18, 0xEB, 0x4C, 0xEB, 0x49, 0x49, 0x11, 0xE8, 0x78, 0xB9, 0x48, 0x11, 0xE8, 0x79, 0x10, 0x72, 0x1A, 0x73, 0x36,
+        0x78, 0x1A, 0x72, 0x3F, 0xEB, 0x54, 0x4B, 0x39, 0x04, 0x27, 0x73, 0xD5, 0x78, 0x26, 0x78, 0x23, 0x72, 0x6B, 0x7E, 0xC4, 0x74, 0xC2, 0x73, 0x95,
+        0x72, 0x09, 0x7E, 0x1A, 0x75, 0x43, 0x40, 0x0F, 0x92, 0xC6, 0x75, 0x44, 0x4C, 0x0F, 0xA5, 0xD0, 0x73, 0x28, 0xEB, 0x71, 0x72, 0x0E, 0xEB, 0x3B,
+        0x4D, 0x0F, 0xA5, 0xC8, 0x73, 0xC4, 0x78, 0x0D, 0x73, 0xF3, 0x7F, 0x7B, 0x76, 0xD9, 0xEB, 0xCF, 0x7F, 0xDC, 0x7E, 0x17, 0x7F, 0x42, 0x49, 0xFF,
+        0xCB, 0xEB, 0x66, 0xEB, 0x5D, 0xEB, 0x5B, 0x4E, 0x89, 0x14, 0xDF, 0x4E, 0x89, 0x4C, 0xDF, 0x08, 0x78, 0x9E, 0x4C, 0x11, 0xC2, 0x7E, 0xB3, 0x49,
+        0xD1, 0xFF, 0x83, 0x74, 0x24, 0x28, 0x01, 0x7E, 0x19, 0x7E, 0x5E, 0xEB, 0x45, 0x74, 0x41, 0x76, 0xDD, 0x7E, 0xBC, 0xC9, 0x4C, 0x0F, 0xAD, 0xD0,
+        0xEB, 0x77, 0xEB, 0x42, 0x4D, 0x0F, 0xAD, 0xC8, 0x4D, 0x19, 0xDA, 0x89, 0x11, 0xA9, 0xF0, 0x7F, 0x00, 0x00, 0x48, 0x0F, 0xBA, 0xEA, 0x34, 0x29,
+        0xC8, 0xC0, 0xE8, 0x07, 0x2D, 0xFF, 0x3F, 0x00, 0x00, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x66, 0x81, 0xC6, 0xFF, 0x03, 0xC1, 0xE6, 0x14, 0x09,
+        0xCE, 0x09, 0xC6, 0xF7, 0xC1, 0xFF, 0x7F, 0x00, 0x00, 0x75, 0x51, 0x4C, 0x0F, 0xBD, 0xC0, 0xB8, 0xD1, 0xBF, 0xFF, 0xFF, 0x48, 0x0B, 0x55, 0x00,
+        0x81, 0xEB, 0xFF, 0x3F, 0x00, 0x00, 0x8D, 0x46, 0xD0, 0x73, 0x34, 0x3D, 0x70, 0x40, 0x00, 0x00, 0x41, 0x31, 0xEE, 0x7E, 0x3B, 0x7E, 0x1E, 0xB9,
+        0x31, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x49, 0x0F, 0x49, 0xD2, 0x7F, 0x9E, 0xEB, 0x40, 0x20, 0xC3, 0x75, 0x78, 0x0F, 0x16, 0x84,
+        0x24, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x53, 0xB9, 0x71, 0x00, 0x00, 0x00, 0xEB, 0x87, 0x7F, 0x0C, 0xB8, 0x72, 0x00, 0x00, 0x00, 0xBD, 0x45, 0x13,
+        0x00, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x00, 0x29, 0xD5, 0x7E, 0x23, 0xBD, 0x03, 0x40, 0x00, 0x00, 0x48, 0x0F, 0x45, 0x44, 0x24, 0x10, 0xB8, 0x71,
+        0x00, 0x00, 0x00, 0xBB, 0x71, 0x00, 0x00, 0x00, 0xB9, 0x30, 0x00, 0x00, 0x00, 0xE8, 0x4A, 0x3B, 0xFE, 0xFF, 0xBA, 0x23, 0x05, 0x00, 0x00, 0x40,
+        0x38, 0x7A, 0x01, 0x38, 0x0E, 0x72, 0x32, 0x48, 0x0F, 0x4E, 0xDA, 0x72, 0xB4, 0x38, 0x02, 0xEB, 0xC9, 0x73, 0x8D, 0x72, 0xEE, 0x39, 0x32, 0x75,
+        0xF3, 0x72, 0xE5, 0x73, 0xAE, 0x72, 0x67, 0x39, 0x30, 0x49, 0xC1, 0xF8, 0x02, 0x72, 0x58, 0x75, 0xAF, 0x76, 0xAF, 0x73, 0xC2, 0x4C, 0x0F, 0x42,
+        0xCF, 0x73, 0xE2, 0x88, 0x10, 0x77, 0xE2, 0x88, 0x01, 0x77, 0xD2, 0xA4, 0x75, 0xFA, 0xC6, 0x47, 0x08, 0x00, 0x75, 0x4E, 0x83, 0x47, 0x04, 0x01,
+        0x83, 0x42, 0x04, 0x01, 0x7F, 0x07, 0xBA, 0x80, 0x01, 0x00, 0x00, 0x74, 0x58, 0x8B, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x83, 0x08, 0x20, 0xBE, 0x25,
+        0x00, 0x00, 0x00, 0x73, 0x07, 0x73, 0xAB, 0x4C, 0x63, 0x44, 0x24, 0x18, 0x42, 0xFF, 0x14, 0xC0, 0x83, 0x7F, 0x04, 0x66, 0xBD, 0x30, 0x00, 0x00,
+        0x00, 0x74, 0x66, 0x89, 0x57, 0x08, 0xBF, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0x2C, 0x00, 0x00, 0x00, 0x72, 0x7E, 0x77, 0xDA, 0x74, 0xBE, 0x88, 0x04,
+        0x13, 0x73, 0xF2, 0x88, 0x13, 0x72, 0xEF, 0xB8, 0x2C, 0x00, 0x00, 0x00, 0xBA, 0x2E, 0x00, 0x00, 0x00, 0xC0, 0xE9, 0x02, 0x8B, 0x79, 0x50, 0x0F,
+        0x28, 0x9D, 0x30, 0xFF, 0xFF, 0xFF, 0x44, 0x0F, 0x50, 0xE3, 0x41, 0x0F, 0x9F, 0xC0, 0x45, 0x8D, 0x74, 0x24, 0x03, 0x73, 0x38, 0x89, 0x32, 0x44,
+        0x88, 0x85, 0x30, 0xFF, 0xFF, 0xFF, 0x44, 0x0F, 0xB6, 0x85, 0x30, 0xFF, 0xFF, 0xFF, 0x40, 0x88, 0xBD, 0x30, 0xFF, 0xFF, 0xFF, 0x48, 0x0F, 0x45,
+        0x8D, 0x18, 0xFF, 0xFF, 0xFF, 0xDB, 0x2A, 0xDB, 0xE8, 0x0F, 0x8A, 0x87, 0x21, 0x00, 0x00, 0x8B, 0xB9, 0x90, 0x01, 0x00, 0x00, 0x78, 0x32, 0x8B,
+        0xBD, 0xF8, 0xFE, 0xFF, 0xFF, 0x8B, 0xB1, 0x98, 0x01, 0x00, 0x00, 0x47, 0x8D, 0x34, 0x3C, 0x66, 0x0F, 0x2E, 0x0D, 0xD6, 0xDF, 0x14, 0x00, 0x66,
+        0x44, 0x0F, 0x50, 0xE0, 0xA8, 0x3F, 0xEB, 0x61, 0x01, 0xD8, 0x7E, 0x87, 0x48, 0x0F, 0xBD, 0x44, 0xD0, 0xF8, 0x29, 0xC3, 0x4B, 0x83, 0x3C, 0x29,
+        0x00, 0x74, 0xDD, 0x74, 0x75, 0x7E, 0x22, 0x7F, 0xE8, 0x7E, 0x28, 0x7F, 0xE5, 0x8B, 0x36, 0x80, 0xBD, 0xBC, 0xFE, 0xFF, 0xFF, 0x66, 0x89, 0x95,
+        0xD0, 0xFE, 0xFF, 0xFF, 0x8D, 0x77, 0xFF, 0x88, 0x85, 0x30, 0xFF, 0xFF, 0xFF, 0x3C, 0x7D, 0x72, 0xD5, 0x83, 0x85, 0x68, 0xFF, 0xFF, 0xFF, 0x40,
+        0x83, 0xBD, 0x64, 0xFF, 0xFF, 0xFF, 0x66, 0xF6, 0x47, 0x0C, 0x08, 0x89, 0x30, 0x44, 0x39, 0xB5, 0x20, 0xFF, 0xFF, 0xFF, 0x7E, 0x49, 0x7F, 0xCE,
+        0x7F, 0xB7, 0xD9, 0xBD, 0x5A, 0xFF, 0xFF, 0xFF, 0x7F, 0x18, 0x7E, 0x07, 0x39, 0x95, 0x00, 0xFF, 0xFF, 0xFF, 0x77, 0x0F, 0x3C, 0x7E, 0x72, 0xA6,
+        0xBF, 0x2B, 0x00, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xD6, 0x07, 0x7E, 0xF7, 0xF7, 0xF9, 0x7F, 0xDF, 0x8B, 0x70, 0x10, 0x7F, 0x09, 0x8B, 0x78, 0xFC,
+        0x39, 0xD6, 0x40, 0x0F, 0x9F, 0xC6, 0x83, 0xD2, 0xFF, 0x39, 0xF7, 0x01, 0xD6, 0x39, 0xBD, 0x40, 0xFF, 0xFF, 0xFF, 0xF6, 0xC2, 0x50, 0x75, 0x4F,
+        0x75, 0x42, 0x7E, 0x38, 0xBE, 0x30, 0x00, 0x00, 0x00, 0x88, 0x17, 0x73, 0x23, 0x72, 0xDD, 0x75, 0xCD, 0x01, 0xC7, 0xEB, 0x88, 0xEB, 0x51, 0xBE,
+        0x2D, 0x00, 0x00, 0x00, 0x73, 0x3B, 0x8B, 0x73, 0xFC, 0xA8, 0x40, 0x39, 0x78, 0xFC, 0x83, 0x38, 0x39, 0x73, 0xE8, 0x01, 0x85, 0x68, 0xFF, 0xFF,
+        0xFF, 0x29, 0xF8, 0xBF, 0x2D, 0x00, 0x00, 0x00, 0x8D, 0x70, 0x01, 0xB8, 0x66, 0x00, 0x00, 0x00, 0x74, 0x7E, 0x7F, 0xD9, 0xB9, 0x3C, 0x00, 0x00,
+        0x00, 0x7E, 0x11, 0x09, 0x95, 0x30, 0xFF, 0xFF, 0xFF, 0x45, 0x0F, 0x48, 0xF1, 0xB8, 0x3F, 0x00, 0x00, 0x00, 0xF3, 0x48, 0x0F, 0xBC, 0xC9, 0xF3,
+        0x4C, 0x0F, 0xBC, 0x06, 0xB8, 0x40, 0x00, 0x00, 0x00, 0x83, 0x8D, 0x30, 0xFF, 0xFF, 0xFF, 0x01, 0x48, 0x01, 0x85, 0xE0, 0xFE, 0xFF, 0xFF, 0x40,
+        0xF6, 0xDF, 0x49, 0x83, 0x7C, 0xC2, 0xF8, 0x00, 0x83, 0xAD, 0x04, 0xFF, 0xFF, 0xFF, 0x01, 0xC1, 0xEE, 0x1A, 0x29, 0xF1, 0x41, 0x0F, 0x49, 0xD5,
+        0xF3, 0x4D, 0x0F, 0xBC, 0xC1, 0x44, 0x0F, 0x4F, 0xC0, 0x4C, 0x29, 0x7D, 0x88, 0x47, 0x8D, 0x4C, 0x3E, 0x01, 0xF3, 0x4F, 0x0F, 0xBC, 0x04, 0x29,
+        0xBE, 0x2B, 0x00, 0x00, 0x00, 0x4A, 0x39, 0x44, 0x17, 0xF0, 0x7E, 0x2D, 0x7E, 0xD5, 0x4D, 0x0F, 0x45, 0xD8, 0x66, 0x83, 0xF8, 0x01, 0x73, 0x09,
+        0x76, 0x19, 0x29, 0xCF, 0x77, 0x0B, 0x39, 0xF9, 0x72, 0xE3, 0x8B, 0x59, 0x50, 0x8B, 0x1E, 0x8B, 0x6E, 0x04, 0x4C, 0x63, 0x66, 0x08, 0x0F, 0x28,
+        0x1C, 0x24, 0x42, 0xF6, 0x44, 0x60, 0x01, 0x01, 0x01, 0xD3, 0x7E, 0x2C, 0x01, 0xEB, 0xDB, 0x29, 0xDF, 0xE8, 0xDB, 0x2C, 0x24, 0x77, 0xE0, 0x3D,
+        0x01, 0x40, 0x00, 0x00, 0x2D, 0x02, 0x40, 0x00, 0x00, 0x75, 0xC7, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x0F, 0x50, 0xD8, 0x77, 0xE3, 0x73, 0x67,
+        0x25, 0xF0, 0x7F, 0x00, 0x00, 0xB8, 0x30, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x3C, 0x01, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x83, 0xD8, 0xFF, 0x01, 0xF0,
+        0x29, 0xFD, 0x29, 0xC5, 0x73, 0x6C, 0x73, 0x5F, 0x83, 0xBC, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x30, 0x41, 0x83, 0x7C, 0x24, 0xFC, 0x30, 0x42, 0x0F,
+        0xBE, 0x4C, 0x19, 0xFF, 0x09, 0xF7, 0x64, 0x4D, 0x8B, 0x00, 0xC7, 0x46, 0x04, 0x30, 0x00, 0x00, 0x00, 0x75, 0x54, 0x7E, 0x45, 0xC7, 0x06, 0x20,
+        0x00, 0x00, 0x00, 0x8D, 0x51, 0x01, 0xB8, 0xFE, 0x3F, 0x00, 0x00, 0x01, 0xC3, 0x88, 0x08, 0x89, 0x31, 0xEB, 0x5F, 0x72, 0x33, 0x8D, 0x5C, 0x13,
+        0x01, 0x29, 0xEB, 0x77, 0x3E, 0x40, 0x0F, 0x9C, 0xC6, 0x83, 0x06, 0x01, 0x89, 0xDD, 0xBA, 0x6B, 0x00, 0x00, 0x00, 0x49, 0x63, 0x57, 0x08, 0x41,
+        0x81, 0xC6, 0xE8, 0x03, 0x00, 0x00, 0x41, 0xC0, 0xED, 0x02, 0x79, 0x41, 0xEB, 0x5C, 0xF3, 0x41, 0x0F, 0x6F, 0x1F, 0x44, 0x0F, 0x48, 0xE0, 0xDB,
+        0x2E, 0xDB, 0x04, 0x24, 0xDB, 0xF1, 0xDD, 0xDA, 0xD8, 0xF1, 0xD9, 0xCA, 0xF2, 0x41, 0x0F, 0x2A, 0xCE, 0xF2, 0x0F, 0x5E, 0xC1, 0x44, 0x0F, 0x4C,
+        0xE0, 0x73, 0x37, 0x75, 0x68, 0x74, 0x98, 0xE8, 0xD9, 0x02, 0x0C, 0x00, 0x77, 0x7B, 0x7C, 0x12, 0xEB, 0xCB, 0x72, 0x63, 0x2B, 0x45, 0x00, 0x77,
+        0x6A, 0x76, 0x96, 0x78, 0x3C, 0x76, 0xEE, 0x41, 0x89, 0x44, 0x24, 0x08, 0x7F, 0x3B, 0xB8, 0x1C, 0x00, 0x00, 0x00, 0x8B, 0x77, 0x0C, 0xEB, 0x5E,
+        0x39, 0xF0, 0x8B, 0x6F, 0x08, 0x66, 0x41, 0x09, 0x6C, 0x24, 0x0E, 0x39, 0xF1, 0x8B, 0x4A, 0x04, 0x8B, 0x1D, 0xD2, 0xA8, 0x17, 0x00, 0xBF, 0xF8,
+        0x00, 0x00, 0x00, 0x75, 0x9D, 0xB8, 0x52, 0x00, 0x00, 0x00, 0x77, 0x01, 0xB8, 0x3C, 0x01, 0x00, 0x00, 0xBE, 0xC0, 0x01, 0x00, 0x00, 0x40, 0x80,
+        0xE6, 0x3C, 0x40, 0x80, 0xCE, 0xC2, 0x77, 0xEB, 0xB8, 0x05, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0x47, 0xE0, 0x44, 0x0F, 0xB6, 0x4C, 0x24, 0x03, 0x49,
+        0xBC, 0x09, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x75, 0x4D, 0x4C, 0x33, 0x7C, 0x24, 0x68, 0xB8, 0x2D, 0xF3, 0x04, 0xB5, 0x79, 0x1F, 0x83,
+        0x6C, 0x24, 0x38, 0x01, 0x78, 0x13, 0xBE, 0x14, 0x00, 0x00, 0x00, 0xEB, 0xE1, 0x77, 0x54, 0x29, 0xC6, 0x78, 0xEA, 0x7E, 0xCE, 0xEB, 0xDB, 0x7D,
+        0x5E, 0x7F, 0xEB, 0x77, 0x38, 0x73, 0x55, 0x41, 0xFF, 0x55, 0x38, 0x77, 0x6E, 0x0F, 0x9F, 0x44, 0x24, 0x27, 0x73, 0x29, 0xEB, 0x7A, 0xFF, 0x50,
+        0x38, 0x48, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x49, 0x0F, 0x46, 0xD6, 0x78, 0x2A, 0x0F, 0x81, 0x41, 0xFE, 0xFF, 0xFF, 0x74,
+        0xC7, 0x73, 0xB8, 0x7E, 0xB0, 0x75, 0x91, 0x78, 0x90, 0x71, 0x89, 0xBB, 0x0E, 0x00, 0x00, 0x00, 0x4C, 0x39, 0xAD, 0x68, 0xF7, 0xFF, 0xFF, 0x48,
+        0xF7, 0xA5, 0x98, 0xF7, 0xFF, 0xFF, 0xBA, 0x18, 0x00, 0x00, 0x00, 0x8B, 0x75, 0x40, 0xF7, 0xDE, 0x74, 0xC8, 0x7C, 0x42, 0xF6, 0xC5, 0x08, 0x40,
+        0xC0, 0xEF, 0x03, 0xC0, 0xEA, 0x05, 0x88, 0x9D, 0xF8, 0xF6, 0xFF, 0xFF, 0x41, 0xD0, 0xEC, 0xD0, 0xEB, 0x88, 0x95, 0x1D, 0xF7, 0xFF, 0xFF, 0x45,
+        0x89, 0x77, 0x04, 0x3C, 0x5A, 0xA8, 0x08, 0xA8, 0x20, 0x41, 0x83, 0x3F, 0xFF, 0x72, 0xCB, 0x75, 0xC5, 0x77, 0x60, 0x8B, 0x0E, 0x89, 0x08, 0x81,
+        0xFE, 0xAF, 0x00, 0x00, 0x00, 0xDB, 0x38, 0x41, 0x0F, 0xBE, 0xC5, 0x0F, 0x80, 0x39, 0x15, 0x00, 0x00, 0x41, 0xFF, 0x54, 0x24, 0x38, 0x89, 0x9D,
+        0x5C, 0xF7, 0xFF, 0xFF, 0x78, 0x58, 0x44, 0x03, 0xA5, 0x5C, 0xF7, 0xFF, 0xFF, 0xC6, 0x85, 0x1E, 0xF7, 0xFF, 0xFF, 0x78, 0x44, 0x22, 0xA5, 0x1D,
+        0xF7, 0xFF, 0xFF, 0x0F, 0x9E, 0xC0, 0x20, 0xC8, 0x29, 0xD8, 0x0B, 0x85, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x53, 0x38, 0xC6, 0x80, 0xE7, 0x03, 0x00,
+        0x00, 0x30, 0x09, 0xC3, 0x88, 0x18, 0xF6, 0x85, 0xFC, 0xF6, 0xFF, 0xFF, 0x01, 0x88, 0x8D, 0x48, 0xF7, 0xFF, 0xFF, 0xFF, 0x51, 0x38, 0x22, 0x8D,
+        0xFC, 0xF6, 0xFF, 0xFF, 0x81, 0xBD, 0x5C, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x44, 0x0F, 0xB7, 0xE8, 0x0F, 0x4D, 0xC3, 0x42, 0x81, 0x24,
+        0xB3, 0xFF, 0xFE, 0xFF, 0xFF, 0x4E, 0x63, 0x0C, 0xB3, 0x42, 0xFF, 0x54, 0xC9, 0xC0, 0x48, 0x0F, 0xBF, 0xC0, 0x41, 0x80, 0x67, 0x0C, 0xFE, 0xBE,
+        0x49, 0x00, 0x00, 0x00, 0xBE, 0x27, 0x00, 0x00, 0x00, 0xC7, 0x87, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x2B, 0x81, 0xE5, 0x00,
+        0x80, 0x00, 0x00, 0xFF, 0x55, 0x38, 0x7E, 0xA5, 0x45, 0x0F, 0xBE, 0xC9, 0x80, 0x8C, 0x24, 0xAD, 0x00, 0x00, 0x00, 0x10, 0x49, 0x03, 0x44, 0x24,
+        0x10, 0x8B, 0x32, 0x7E, 0x13, 0x74, 0x50, 0x78, 0x0B, 0x79, 0x0F, 0xEB, 0x4D, 0x0B, 0x44, 0x24, 0x30, 0x79, 0x13, 0x77, 0x64, 0x77, 0xC4, 0x01,
+        0xC5, 0x39, 0xC5, 0x89, 0x28, 0x89, 0x2B, 0x48, 0x2B, 0x44, 0x24, 0x40, 0x7E, 0x6E, 0x64, 0x4C, 0x8B, 0x2C, 0x25, 0x10, 0x00, 0x00, 0x00, 0xF6,
+        0x00, 0x04, 0x81, 0xE7, 0x00, 0x80, 0x00, 0x00, 0x3C, 0x27, 0x3C, 0x49, 0x41, 0x81, 0xCB, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x2A, 0xEB, 0x38, 0x0C,
+        0x80, 0xB8, 0x1E, 0x00, 0x00, 0x00, 0x81, 0x8D, 0xD4, 0xF9, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x49, 0x0F, 0x4E, 0xC2, 0x44, 0x88, 0x7D, 0xB0,
+        0xF7, 0x85, 0xD4, 0xF9, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0xDB, 0x39, 0x49, 0x0F, 0x4C, 0xF5, 0xBF, 0x90, 0x01, 0x00, 0x00,
+        0x81, 0xC1, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x5D, 0x74, 0xD0, 0x40, 0x3A, 0x31, 0x0D, 0x01, 0x10, 0x00, 0x00, 0xEB, 0x56, 0x75, 0x9E, 0x48, 0x2B,
+        0x85, 0xA0, 0xFB, 0xFF, 0xFF, 0x4C, 0x2B, 0xAD, 0xA0, 0xFB, 0xFF, 0xFF, 0x8B, 0xBA, 0xD0, 0x00, 0x00, 0x00, 0x72, 0xBC, 0x72, 0xBD, 0xEB, 0x59,
+        0x75, 0x97, 0x73, 0x45, 0x73, 0x42, 0xBF, 0x64, 0x00, 0x00, 0x00, 0x7E, 0x0A, 0x44, 0x38, 0x24, 0x02, 0x78, 0x0A, 0x48, 0xD1, 0xA5, 0x58, 0xF9,
+        0xFF, 0xFF, 0xBA, 0x77, 0x0A, 0x00, 0x00, 0x7E, 0x0D, 0x48, 0x83, 0xAD, 0x98, 0xF9, 0xFF, 0xFF, 0x01, 0x76, 0xE9, 0xEB, 0xE5, 0x73, 0x44, 0x73,
+        0x7C, 0x66, 0x44, 0x89, 0x28, 0xEB, 0xEB, 0xEB, 0x68, 0x76, 0x8F, 0x4C, 0x0F, 0xBE, 0xA5, 0x98, 0xF9, 0xFF, 0xFF, 0x40, 0x3A, 0x3C, 0x8E, 0x4C,
+        0x0F, 0x4E, 0xE0, 0x77, 0x21, 0x24, 0x7F, 0x77, 0x39, 0x74, 0xD2, 0x7D, 0x0F, 0x38, 0x16, 0x72, 0xB9, 0x75, 0xB6, 0x8D, 0x7B, 0x30, 0x7E, 0x20,
+        0x76, 0xEC, 0x77, 0x17, 0x77, 0x1C, 0x41, 0x83, 0xBC, 0x24, 0xFC, 0x03, 0x00, 0x00, 0x6C, 0x77, 0x6B, 0x0F, 0x44, 0x85, 0xE4, 0xF9, 0xFF, 0xFF,
+        0x83, 0xBA, 0xFC, 0x03, 0x00, 0x00, 0x6C, 0x77, 0x1D, 0x40, 0x0F, 0xBE, 0xF7, 0x0F, 0x94, 0x85, 0xF0, 0xF9, 0xFF, 0xFF, 0x75, 0x65, 0x48, 0x6B,
+        0xC3, 0x11, 0xF3, 0xA4, 0x08, 0x85, 0xF0, 0xF9, 0xFF, 0xFF, 0x38, 0x42, 0xFF, 0x72, 0xC0, 0xEB, 0x0D, 0x83, 0xF1, 0x01, 0x84, 0x8D, 0x60, 0xF9,
+        0xFF, 0xFF, 0x3A, 0x04, 0xB7, 0x73, 0x6D, 0x46, 0x89, 0x54, 0x20, 0xFC, 0x77, 0x5C, 0x78, 0xED, 0x76, 0xE0, 0x73, 0x79, 0x89, 0x2A, 0x72, 0x34,
+        0xEB, 0x7C, 0x73, 0xBB, 0x45, 0x89, 0x74, 0x24, 0xF8, 0x72, 0xE2, 0x73, 0xDB, 0x49, 0xF7, 0xD6, 0x0F, 0x45, 0x44, 0x24, 0x0C, 0xEB, 0x8D, 0xD0,
+        0xEA, 0x77, 0xD1, 0x73, 0x40, 0x8B, 0x58, 0x58, 0x41, 0x83, 0xF5, 0x01, 0x75, 0x5B, 0xC7, 0x80, 0xE4, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+        0x4D, 0x0F, 0xBE, 0xED, 0xF7, 0xDB, 0x29, 0xD3, 0x29, 0xCB, 0x01, 0xCA, 0x4C, 0x0F, 0xA3, 0xC8, 0x45, 0x0F, 0xB7, 0xED, 0x41, 0xC7, 0x00, 0x30,
+        0x00, 0x00, 0x00, 0x43, 0x81, 0x24, 0xB9, 0xFF, 0xFE, 0xFF, 0xFF, 0x4D, 0x0F, 0xBF, 0xED, 0x7E, 0xA7, 0x7E, 0x42, 0x79, 0x16, 0x77, 0xE4, 0x44,
+        0x22, 0x54, 0x24, 0x40, 0x77, 0x30, 0x7C, 0x08, 0x7E, 0x52, 0x78, 0x0F, 0x08, 0xD0, 0x4C, 0x0F, 0xBF, 0x12, 0x7E, 0x6D, 0xF0, 0x44, 0x0F, 0xB1,
+        0x27, 0xEB, 0x48, 0x8B, 0x1A, 0x8B, 0x18, 0xEB, 0xD9, 0x75, 0x40, 0xDB, 0x3E, 0x75, 0x62, 0x25, 0x08, 0x20, 0x00, 0x00, 0x41, 0x8B, 0x81, 0x28,
+        0x01, 0x00, 0x00, 0x4C, 0x0F, 0x4D, 0xCE, 0x7C, 0x34, 0x7D, 0xD3, 0x76, 0xEA, 0xEB, 0xE6, 0x72, 0x1D, 0x39, 0xCF, 0x7D, 0x17, 0x73, 0x31, 0x72,
+        0x1C, 0x48, 0x0F, 0xBE, 0x85, 0xF0, 0xF9, 0xFF, 0xFF, 0x39, 0x41, 0xFC, 0x42, 0xC6, 0x04, 0x28, 0x00, 0xBA, 0x3F, 0x0B, 0x00, 0x00, 0x42, 0x89,
+        0x04, 0xAF, 0x23, 0x85, 0x08, 0xFA, 0xFF, 0xFF, 0x74, 0xA2, 0x73, 0x76, 0x84, 0x85, 0xE8, 0xF9, 0xFF, 0xFF, 0xBA, 0x46, 0x04, 0x00, 0x00, 0x78,
+        0x17, 0x77, 0x28, 0x41, 0x8B, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x8B, 0x87, 0x17, 0x8B, 0x6B, 0x74, 0x89, 0x6B, 0x74, 0x66, 0x81, 0x62,
+        0x0C, 0x07, 0xE2, 0x3C, 0x29, 0x80, 0x4B, 0x0D, 0x08, 0x81, 0x63, 0x0C, 0xF8, 0xFD, 0x00, 0x00, 0x77, 0x26, 0x89, 0x4B, 0x30, 0xEB, 0x81, 0x77,
+        0x0E, 0xEB, 0xA2, 0x75, 0x61, 0x83, 0x3A, 0x24, 0xFF, 0x95, 0x90, 0x00, 0x00, 0x00, 0x78, 0x6D, 0x77, 0x4C, 0xBD, 0x00, 0x20, 0x00, 0x00, 0x2D,
+        0x88, 0x00, 0x00, 0x00, 0x77, 0x11, 0x81, 0x0B, 0x00, 0x02, 0x00, 0x00, 0x64, 0x44, 0x8B, 0x65, 0x00, 0x83, 0x6F, 0x04, 0x01, 0x8B, 0x8B, 0xC0,
+        0x00, 0x00, 0x00, 0x7F, 0x75, 0x8B, 0x13, 0x3C, 0x72, 0x3C, 0x77, 0x3C, 0x61, 0x3C, 0x6D, 0x74, 0x83, 0xBF, 0xD8, 0x01, 0x00, 0x00, 0x25, 0xB3,
+        0xEF, 0xFF, 0xFF, 0x73, 0x46, 0x7F, 0x2D, 0x8B, 0xBB, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x76, 0x7F, 0xC2, 0x80, 0xE6, 0x80, 0x7F, 0x5E, 0x7F, 0x67,
+        0x75, 0xA6, 0xF6, 0x07, 0x08, 0x7E, 0x03, 0x83, 0x0B, 0x20, 0xEB, 0xF1, 0x81, 0x4B, 0x74, 0x80, 0x00, 0x00, 0x00, 0x25, 0xF3, 0xEF, 0xFF, 0xFF,
+        0xBD, 0x04, 0x10, 0x00, 0x00, 0x74, 0x68, 0x3C, 0x62, 0xF3, 0x0F, 0x6F, 0x44, 0x24, 0x40, 0x75, 0x98, 0xBD, 0x08, 0x00, 0x00, 0x00, 0x8B, 0x83,
+        0xC0, 0x00, 0x00, 0x00, 0xC7, 0x83, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x74, 0x7E, 0xB8, 0x7F, 0x28, 0x7F, 0x34, 0x79, 0xBC,
+        0x8B, 0xB3, 0xC0, 0x00, 0x00, 0x00, 0x75, 0x3B, 0x87, 0x0F, 0x7E, 0xD3, 0x7F, 0x5F, 0x73, 0x35, 0x48, 0x0F, 0x43, 0xF0, 0x4C, 0x01, 0x7B, 0x08,
+        0x49, 0x0F, 0x47, 0xDD, 0x49, 0x01, 0x5F, 0x08, 0x7F, 0xB6, 0x74, 0x85, 0x7E, 0x1D, 0x41, 0xC7, 0x87, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x7F, 0x6E, 0x66, 0x0F, 0x60, 0xC0, 0x66, 0x0F, 0x61, 0xC0, 0x7E, 0x5C, 0x7E, 0x27, 0x72, 0xCD, 0x73, 0x33, 0x87, 0x0D, 0x97, 0xE5, 0x15,
+        0x00, 0x7E, 0xBA, 0x3C, 0x65, 0x78, 0x9C, 0x83, 0x05, 0xF5, 0xE2, 0x15, 0x00, 0x01, 0x4D, 0x8B, 0xB6, 0xE8, 0x00, 0x00, 0x00, 0xEB, 0x78, 0x73,
+        0x75, 0x7F, 0x46, 0x78, 0x6B, 0x73, 0x3D, 0xF7, 0x07, 0x00, 0x01, 0x00, 0x00, 0x7E, 0x53, 0x7F, 0x0B, 0x73, 0x6B, 0x7F, 0x1C, 0x75, 0x8E, 0x75,
+        0x80, 0x75, 0xB5, 0x78, 0x5D, 0x89, 0x29, 0x78, 0x34, 0x74, 0xD5, 0x73, 0xCC, 0x7E, 0xA8, 0x73, 0x11, 0x7F, 0x77, 0xEB, 0x82, 0x7F, 0x4B, 0xEB,
+        0x57, 0x7F, 0x9A, 0x7E, 0x61, 0x7E, 0x2F, 0x73, 0x3E, 0x73, 0xBF, 0x7E, 0x9C, 0x73, 0x0E, 0x72, 0x2F, 0x7E, 0xAA, 0x73, 0x18, 0x72, 0x52, 0x29,
+        0x50, 0x10, 0x75, 0xF5, 0x4C, 0x03, 0x69, 0x40, 0x81, 0x27, 0xFF, 0xFE, 0xFF, 0xFF, 0x66, 0x0F, 0x6D, 0xCA, 0x0F, 0x17, 0x40, 0x10, 0x81, 0x0F,
+        0x00, 0x01, 0x00, 0x00, 0x89, 0xCD, 0x73, 0x26, 0xEB, 0x31, 0x7F, 0x37, 0x4C, 0x29, 0x74, 0x24, 0x18, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x0B,
+        0x73, 0x04, 0x80, 0xE5, 0xF7, 0xF6, 0xC6, 0x01, 0x7E, 0xD4, 0x7E, 0xBB, 0x39, 0x72, 0xFC, 0x83, 0x23, 0xEF, 0x83, 0x39, 0x0A, 0x72, 0xF2, 0x78,
+        0x15, 0x80, 0xCD, 0x01, 0x73, 0x02, 0x89, 0x37, 0x73, 0x72, 0x89, 0x1A, 0xEB, 0x84, 0x66, 0x0F, 0xFB, 0xC8, 0xBA, 0xE4, 0x00, 0x00, 0x00, 0x49,
+        0xC7, 0x84, 0x24, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xA3, 0x0F, 0x12, 0xC8, 0xEB, 0x39, 0x72, 0x05, 0x80, 0xE4, 0xF7, 0x72,
+        0xB5, 0x7E, 0x59, 0x41, 0xFF, 0x70, 0x38, 0x48, 0x0F, 0x47, 0xD0, 0xFF, 0x70, 0x38, 0x81, 0x23, 0xFF, 0xFE, 0xFF, 0xFF, 0x73, 0x5C, 0xBA, 0x20,
+        0x01, 0x00, 0x00, 0x49, 0x2B, 0x77, 0x10, 0x41, 0xFF, 0x96, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x16, 0x4C, 0x24, 0x08, 0x41, 0x81, 0x27, 0xFF, 0xFE,
+        0xFF, 0xFF, 0x73, 0x57, 0xFF, 0x93, 0x80, 0x00, 0x00, 0x00, 0x72, 0x1E, 0x75, 0x6D, 0xEB, 0xD3, 0x89, 0x33, 0x7E, 0x56, 0x8B, 0x93, 0xC0, 0x00,
+        0x00, 0x00, 0x72, 0x70, 0x77, 0x44, 0x89, 0x83, 0xC0, 0x00, 0x00, 0x00, 0xBA, 0x51, 0x00, 0x00, 0x00, 0xBA, 0x50, 0x00, 0x00, 0x00, 0x39, 0x50,
+        0x48, 0x78, 0x63, 0x83, 0x40, 0x04, 0x01, 0x48, 0x83, 0x68, 0x20, 0x04, 0x0F, 0x16, 0x05, 0x8C, 0x58, 0x15, 0x00, 0x7E, 0x18, 0x75, 0x67, 0x75,
+        0x57, 0x78, 0x01, 0x83, 0x4B, 0x74, 0x20, 0x83, 0x63, 0x74, 0xDF, 0x7F, 0x78, 0xEB, 0x8A, 0xBA, 0x64, 0x00, 0x00, 0x00, 0x83, 0x64, 0x24, 0x10,
+        0xFE, 0x72, 0x49, 0x75, 0x69, 0x73, 0x58, 0x73, 0x78, 0xF3, 0x41, 0x0F, 0x7E, 0x45, 0x10, 0x72, 0x3D, 0x01, 0xEA, 0x2B, 0x4B, 0x10, 0xBA, 0xA0,
+        0x00, 0x00, 0x00, 0xBA, 0x9E, 0x00, 0x00, 0x00, 0xBA, 0x97, 0x00, 0x00, 0x00, 0xA9, 0x04, 0x08, 0x00, 0x00, 0x25, 0x04, 0x08, 0x00, 0x00, 0xEB,
+        0xEC, 0x78, 0x2C, 0x72, 0x26, 0x73, 0x4F, 0x72, 0x4B, 0x78, 0x40, 0x72, 0x3A, 0x73, 0x14, 0x73, 0x62, 0x73, 0x0D, 0x74, 0x73, 0x83, 0x27, 0xCF,
+        0x73, 0x16, 0x75, 0x7D, 0x7F, 0x26, 0x8B, 0x81, 0xC0, 0x00, 0x00, 0x00, 0xC7, 0x81, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x5D,
+        0x75, 0x56, 0x73, 0x60, 0x7E, 0x65, 0x74, 0x80, 0x66, 0x89, 0x83, 0x80, 0x00, 0x00, 0x00, 0x74, 0x9C, 0x7D, 0x06, 0xFF, 0x90, 0x90, 0x00, 0x00,
+        0x00, 0xEB, 0x72, 0x41, 0xFF, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0x41, 0x83, 0x4D, 0x00, 0x20, 0x73, 0x2B, 0x73, 0x4E, 0x7E, 0x36, 0x73, 0x06,
+        0x73, 0x4C, 0x73, 0xAF, 0x75, 0xF2, 0x76, 0x2F, 0x7E, 0x26, 0x73, 0x5A, 0xEB, 0x9F, 0x3C, 0x78, 0x3C, 0x16, 0x77, 0x2A, 0xB9, 0xB6, 0x01, 0x00,
+        0x00, 0x41, 0x80, 0xCA, 0x80, 0x41, 0xC7, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBA, 0x42, 0x01, 0x00, 0x00, 0xBA, 0x41,
+        0x01, 0x00, 0x00, 0x73, 0x4A, 0x64, 0x83, 0x7D, 0x00, 0x1D, 0xA9, 0x02, 0x02, 0x00, 0x00, 0x7E, 0x4D, 0x7E, 0x46, 0xF7, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x7E, 0xAF, 0x4C, 0x3B, 0x2D, 0x35, 0x34, 0x15, 0x00, 0x8B, 0x33, 0x4C, 0x3B, 0x6F, 0x08, 0x80, 0xCA, 0x80, 0x72, 0x51, 0x78, 0x7F, 0x73,
+        0x66, 0xEB, 0x93, 0xEB, 0x44, 0x76, 0xA6, 0x76, 0xC6, 0x81, 0x48, 0x74, 0x80, 0x00, 0x00, 0x00, 0x78, 0x49, 0x7E, 0x7D, 0x7F, 0x83, 0x72, 0x8A,
+        0x7E, 0x9E, 0x7F, 0x6F, 0x41, 0x0F, 0x16, 0x47, 0x38, 0x41, 0x0F, 0x11, 0x87, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0x76, 0x2B, 0x46, 0x10, 0x2B, 0x50,
+        0x18, 0x78, 0x1E, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x73, 0xAC, 0x7C, 0x6C, 0x7D, 0x94, 0xBD, 0x02, 0x00, 0x00, 0x00, 0x78, 0x65, 0x78, 0x55, 0xFF,
+        0x60, 0x28, 0x79, 0x72, 0x78, 0x8E, 0x3C, 0x02, 0x64, 0x48, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x64, 0x48, 0xC7, 0x45, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x76, 0x69, 0x0F, 0x95, 0x43, 0x04, 0xF7, 0xC6, 0x00, 0x01, 0x00, 0x00, 0xBF, 0x16, 0x00, 0x00, 0x00, 0x64, 0x4C, 0x2B, 0x04, 0x25, 0x28,
+        0x00, 0x00, 0x00, 0x75, 0x74, 0x0F, 0x93, 0xC0, 0x8B, 0x91, 0x08, 0x03, 0x00, 0x00, 0xEB, 0xF0, 0xF0, 0x83, 0x88, 0x08, 0x03, 0x00, 0x00, 0x10,
+        0x8B, 0x90, 0x08, 0x03, 0x00, 0x00, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x77, 0x0D, 0xEB, 0xF3, 0x8B, 0x82, 0x08, 0x03, 0x00, 0x00, 0x83, 0x3F, 0x01,
+        0xBF, 0x0D, 0x00, 0x00, 0x00, 0xBF, 0x1A, 0x00, 0x00, 0x00, 0xBF, 0x07, 0x00, 0x00, 0x00, 0x7F, 0x12, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xC6,
+        0xF8, 0xFF, 0x7F, 0x14, 0xF0, 0x41, 0x0F, 0xB1, 0x55, 0x00, 0x74, 0xD3, 0x41, 0x87, 0x45, 0x00, 0x0F, 0x01, 0xD5, 0x7E, 0xF0, 0x81, 0xF6, 0x00,
+        0x01, 0x00, 0x00, 0x44, 0x31, 0xC6, 0xB8, 0xCA, 0x00, 0x00, 0x00, 0x7C, 0x21, 0xB8, 0x6E, 0x00, 0x00, 0x00, 0x80, 0xF1, 0x86, 0x40, 0x80, 0xF6,
+        0x8D, 0x74, 0xDC, 0x74, 0x01, 0x74, 0xCF, 0x76, 0xD7, 0xBE, 0x81, 0x00, 0x00, 0x00, 0x4D, 0x8D, 0xAC, 0x24, 0xC8, 0x10, 0x00, 0x00, 0x7F, 0xEA,
+        0x49, 0x89, 0x9C, 0x24, 0xE0, 0x10, 0x00, 0x00, 0x4D, 0x3B, 0xB4, 0x24, 0xD8, 0x10, 0x00, 0x00, 0x72, 0x57, 0x87, 0x83, 0xE8, 0x10, 0x00, 0x00,
+        0x7F, 0x32, 0x64, 0x8A, 0x04, 0x25, 0x10, 0x06, 0x00, 0x00, 0x64, 0xC6, 0x04, 0x25, 0x10, 0x06, 0x00, 0x00, 0x00, 0x49, 0x81, 0xC5, 0x00, 0x02,
+        0x00, 0x00, 0x64, 0x4A, 0x8B, 0x04, 0xE5, 0x10, 0x05, 0x00, 0x00, 0xFF, 0xD2, 0x64, 0x48, 0xC7, 0x04, 0xDD, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xF0, 0x0F, 0xBA, 0xAF, 0x08, 0x03, 0x00, 0x00, 0x05, 0x83, 0xBF, 0x1C, 0x06, 0x00, 0x00, 0xFF, 0xF0, 0x41, 0x0F, 0xB1, 0x90, 0x08,
+        0x03, 0x00, 0x00, 0xBA, 0xFE, 0xFF, 0xFF, 0xFF, 0x41, 0x83, 0xB8, 0x1C, 0x06, 0x00, 0x00, 0xFE, 0xEB, 0x3E, 0x0F, 0x46, 0xD0, 0x64, 0x8B, 0x14,
+        0x25, 0x08, 0x03, 0x00, 0x00, 0x77, 0x59, 0xF0, 0x83, 0x68, 0x20, 0x01, 0x76, 0x1D, 0x49, 0x8D, 0xBC, 0x24, 0x40, 0xFD, 0xFF, 0xFF, 0xBA, 0x21,
+        0x00, 0x00, 0x00, 0xB8, 0xEA, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x43, 0x20, 0x77, 0x5F, 0x87, 0x85, 0xE8, 0x10, 0x00, 0x00, 0xF0, 0x48, 0x0F, 0xB1,
+        0x3B, 0x80, 0xBE, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x98, 0x00, 0x00, 0x00, 0x73, 0x47, 0x73, 0xDC, 0x80, 0xB8, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0x77, 0x15, 0x7C, 0x1F, 0x7F, 0x1A, 0x76, 0x06, 0x83, 0x4F, 0x08, 0x40, 0xB8, 0x5F, 0x00, 0x00, 0x00, 0x83, 0x67, 0x08, 0xFB, 0x48, 0x21, 0x4A,
+        0x10, 0x74, 0x72, 0x74, 0xE6, 0x77, 0x02, 0xF7, 0x77, 0x08, 0x76, 0xE3, 0x3D, 0xFD, 0xFF, 0xFF, 0x7F, 0xBD, 0xCA, 0x00, 0x00, 0x00, 0xF0, 0x45,
+        0x0F, 0xC1, 0x08, 0x76, 0xDB, 0x8B, 0x2F, 0x76, 0xDF, 0x72, 0xD1, 0x75, 0x4A, 0x39, 0xF2, 0x74, 0xAA, 0x64, 0xC7, 0x04, 0x25, 0x18, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x48, 0x39, 0x1C, 0x25, 0x10, 0x00, 0x00, 0x00, 0x4C, 0x03, 0xA0, 0x90, 0x06, 0x00, 0x00, 0x72, 0xCA, 0x8B,
+        0x5F, 0x24, 0xC1, 0xE3, 0x07, 0xF0, 0x01, 0x07, 0xC1, 0xED, 0x02, 0x44, 0x03, 0x6F, 0x18, 0x80, 0xF3, 0x81, 0x41, 0xD1, 0xEB, 0xF0, 0x4D, 0x0F,
+        0xB1, 0x18, 0x01, 0xCD, 0x29, 0xE9, 0x8D, 0x34, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x45, 0x87, 0x19, 0x75, 0x63, 0x03, 0x4F, 0x18, 0x76, 0xC2, 0xF7,
+        0xD6, 0xF0, 0x83, 0x07, 0x02, 0x29, 0xEE, 0xF0, 0x49, 0x0F, 0xB1, 0x38, 0x8D, 0x3C, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x41, 0x01, 0x77, 0x18, 0x83,
+        0xCF, 0x02, 0xB8, 0xF8, 0xFF, 0xFF, 0xFF, 0x76, 0xDA, 0x80, 0xF2, 0x81, 0x76, 0xD5, 0x42, 0x8B, 0x44, 0x83, 0x08, 0x42, 0x89, 0x44, 0x83, 0x08,
+        0x77, 0x08, 0xF0, 0x4C, 0x0F, 0xC1, 0x37, 0xC1, 0xE5, 0x07, 0x72, 0x42, 0xF0, 0x83, 0x44, 0x03, 0x10, 0x02, 0x48, 0x81, 0x7A, 0x08, 0xFF, 0xC9,
+        0x9A, 0x3B, 0xD1, 0xEA, 0x75, 0x52, 0xF0, 0x44, 0x0F, 0xC1, 0x67, 0x24, 0xF0, 0x42, 0x83, 0x44, 0x2B, 0x10, 0x02, 0xC6, 0x83, 0x13, 0x06, 0x00,
+        0x00, 0x01, 0xB8, 0xCB, 0x00, 0x00, 0x00, 0xB8, 0x90, 0x00, 0x00, 0x00, 0x76, 0xB2, 0xBA, 0x35, 0x01, 0x00, 0x00, 0x80, 0xBF, 0x13, 0x06, 0x00,
+        0x00, 0x00, 0x83, 0xB8, 0x14, 0x06, 0x00, 0x00, 0x01, 0x87, 0x81, 0x18, 0x06, 0x00, 0x00, 0xA8, 0x80, 0x75, 0x53, 0x80, 0xBB, 0xF8, 0x08, 0x00,
+        0x00, 0x00, 0xC6, 0x81, 0xF9, 0x08, 0x00, 0x00, 0x01, 0xF6, 0x80, 0x08, 0x03, 0x00, 0x00, 0x40, 0xB8, 0x4E, 0x01, 0x00, 0x00, 0x0B, 0x81, 0x48,
+        0x06, 0x00, 0x00, 0x89, 0x90, 0x1C, 0x06, 0x00, 0x00, 0xBA, 0xC0, 0x00, 0x00, 0x00, 0x76, 0x24, 0x8D, 0x68, 0xFF, 0x21, 0xDD, 0x45, 0x8B, 0xB7,
+        0x60, 0x10, 0x00, 0x00, 0xBD, 0x16, 0x00, 0x00, 0x00, 0x72, 0xA9, 0x72, 0x91, 0x42, 0x8D, 0x34, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x41,
+        0x87, 0x87, 0xE8, 0x10, 0x00, 0x00, 0x80, 0xC9, 0x80, 0x8B, 0x8A, 0x34, 0x06, 0x00, 0x00, 0x8B, 0x92, 0x30, 0x06, 0x00, 0x00, 0x89, 0x8B, 0x34,
+        0x06, 0x00, 0x00, 0x89, 0x93, 0x30, 0x06, 0x00, 0x00, 0xBF, 0x21, 0x00, 0x00, 0x00, 0x4D, 0x21, 0xEB, 0x49, 0xC7, 0x85, 0x38, 0x09, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x41, 0xC6, 0x85, 0x12, 0x06, 0x00, 0x00, 0x01, 0x0B, 0x83, 0x48, 0x06, 0x00, 0x00, 0xBD, 0x0B, 0x00, 0x00, 0x00, 0xB8,
+        0x91, 0x00, 0x00, 0x00, 0xB8, 0x8F, 0x00, 0x00, 0x00, 0x83, 0x8B, 0x0C, 0x03, 0x00, 0x00, 0x20, 0x0F, 0x44, 0x54, 0x24, 0x54, 0x41, 0xF6, 0x87,
+        0x60, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x4C, 0x0F, 0xB1, 0x2D, 0xF1, 0xBB, 0x14, 0x00, 0xBA, 0x34, 0x01, 0x00, 0x00, 0xBA, 0xDF, 0x00, 0x00, 0x00,
+        0xBA, 0x76, 0x01, 0x00, 0x00, 0xBA, 0xAA, 0x01, 0x00, 0x00, 0xBA, 0x4E, 0x03, 0x00, 0x00, 0xF6, 0x87, 0x08, 0x03, 0x00, 0x00, 0x10, 0x8B, 0xBF,
+        0xD0, 0x02, 0x00, 0x00, 0xB8, 0xCC, 0x00, 0x00, 0x00, 0x76, 0x09, 0x66, 0x41, 0x0F, 0x6E, 0x86, 0x34, 0x06, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xD6,
+        0x47, 0x04, 0x4D, 0x39, 0xB6, 0x20, 0x06, 0x00, 0x00, 0x49, 0x2B, 0xB6, 0xA0, 0x06, 0x00, 0x00, 0x45, 0x87, 0xA6, 0x18, 0x06, 0x00, 0x00, 0x7F,
+        0xA6, 0x8D, 0x04, 0xC5, 0x06, 0x00, 0x00, 0x00, 0xF6, 0x83, 0x0C, 0x03, 0x00, 0x00, 0x40, 0x89, 0xFF, 0xF0, 0x48, 0x0F, 0xB1, 0x54, 0x24, 0xF8,
+        0xB8, 0x23, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0xF6, 0xC1, 0x01, 0x8B, 0xAB, 0xD0, 0x02, 0x00, 0x00, 0xF7, 0xDD, 0xB8, 0xBA, 0x00,
+        0x00, 0x00, 0x0F, 0x47, 0xC5, 0x81, 0x7B, 0x08, 0xFE, 0xFF, 0xFF, 0x7F, 0x3B, 0x4F, 0x08, 0x75, 0x82, 0x76, 0xB1, 0x74, 0xA7, 0x81, 0xC9, 0x00,
+        0x00, 0x00, 0x80, 0xB9, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x80, 0x00, 0x00, 0x00, 0x77, 0x65, 0xBA, 0xBD, 0x01, 0x00, 0x00, 0x74, 0x96, 0xBA, 0xCC,
+        0x01, 0x00, 0x00, 0xF0, 0x81, 0x23, 0xFF, 0xFF, 0xFF, 0xBF, 0x87, 0x13, 0xBE, 0x07, 0x00, 0x00, 0x00, 0x76, 0x9D, 0xBA, 0xC2, 0x01, 0x00, 0x00,
+        0x74, 0xCE, 0x39, 0x47, 0x08, 0x0F, 0xBF, 0x47, 0x14, 0x0F, 0xBF, 0x15, 0x84, 0x7A, 0x14, 0x00, 0x0F, 0x31, 0x39, 0xE9, 0x7E, 0x66, 0xF3, 0x90,
+        0x7F, 0xF7, 0x7F, 0x02, 0x01, 0xD2, 0x39, 0x57, 0x08, 0x74, 0xB2, 0xBA, 0x82, 0x00, 0x00, 0x00, 0xBA, 0xAC, 0x00, 0x00, 0x00, 0xBA, 0x8B, 0x02,
+        0x00, 0x00, 0xBF, 0x12, 0x00, 0x00, 0x00, 0x81, 0x7F, 0x08, 0xFF, 0xFF, 0xFF, 0x7F, 0xEB, 0x6B, 0xBE, 0x87, 0x00, 0x00, 0x00, 0x80, 0xE2, 0x01,
+        0x74, 0x90, 0x39, 0xD9, 0x39, 0x53, 0x08, 0x76, 0xC0, 0xEB, 0x64, 0x09, 0xC5, 0x64, 0x44, 0x8B, 0x2C, 0x25, 0xD0, 0x02, 0x00, 0x00, 0x25, 0x7F,
+        0x01, 0x00, 0x00, 0x77, 0x73, 0xB9, 0x4B, 0x00, 0x00, 0x00, 0x74, 0xCC, 0x76, 0x81, 0xB9, 0x16, 0x00, 0x00, 0x00, 0xB9, 0x6E, 0x00, 0x00, 0x00,
+        0xB9, 0x23, 0x00, 0x00, 0x00, 0x78, 0x12, 0xBA, 0x86, 0x01, 0x00, 0x00, 0xB9, 0x83, 0x00, 0x00, 0x00, 0xBA, 0x72, 0x01, 0x00, 0x00, 0xB9, 0x82,
+        0x00, 0x00, 0x00, 0xF7, 0xFF, 0x77, 0x48, 0x39, 0x6B, 0x08, 0x3B, 0x6F, 0x08, 0x7E, 0xAD, 0x39, 0xD5, 0x09, 0xEE, 0xBA, 0xB2, 0x01, 0x00, 0x00,
+        0xBA, 0x1C, 0x01, 0x00, 0x00, 0xA9, 0xFE, 0xFF, 0x07, 0x00, 0x72, 0x93, 0x74, 0x82, 0xA8, 0x7C, 0x7E, 0xE7, 0xBA, 0x62, 0x00, 0x00, 0x00, 0x7E,
+        0xDF, 0x39, 0xD8, 0x7F, 0x3A, 0x77, 0x32, 0x77, 0x1B, 0x76, 0xA5, 0x75, 0x66, 0x74, 0xF5, 0x79, 0x83, 0xA9, 0xFD, 0xFF, 0xFF, 0xFF, 0x74, 0xF9,
+        0xF7, 0xD5, 0x79, 0x8B, 0x74, 0xF7, 0x78, 0x72, 0x87, 0x01, 0x76, 0x85, 0x31, 0xC2, 0x75, 0x94, 0x75, 0x5F, 0xF0, 0x45, 0x0F, 0xB1, 0x2C, 0x24,
+        0x87, 0x55, 0x00, 0x87, 0x4D, 0x00, 0x76, 0x2E, 0xBB, 0x16, 0x00, 0x00, 0x00, 0x76, 0xB3, 0x77, 0x53, 0x41, 0xD1, 0xF8, 0x89, 0x3D, 0x36, 0xA1,
+        0x14, 0x00, 0x64, 0x4C, 0x39, 0x24, 0x25, 0x10, 0x00, 0x00, 0x00, 0x78, 0x35, 0xBF, 0x0F, 0x00, 0x00, 0x00, 0x8B, 0x8F, 0xD0, 0x02, 0x00, 0x00,
+        0x7F, 0x62, 0x7E, 0x86, 0x7E, 0x7A, 0x89, 0xAB, 0x30, 0x06, 0x00, 0x00, 0x7F, 0x57, 0x7E, 0x8E, 0x77, 0x55, 0x74, 0x9A, 0xB9, 0x0C, 0x00, 0x00,
+        0x00, 0x76, 0x6B, 0xB8, 0x29, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x7F, 0xE9, 0xEB, 0xF7, 0xF0, 0x48, 0x01, 0x07, 0x77, 0x2B, 0x78, 0x1C, 0x25,
+        0xC0, 0x00, 0x00, 0x00, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x64, 0x41, 0x83, 0x3F, 0x02, 0xBB, 0x32, 0x00, 0x00, 0x00, 0xEB, 0x5A, 0xBE, 0xC2, 0x00,
+        0x00, 0x00, 0xB8, 0x58, 0x58, 0x00, 0x00, 0x64, 0x41, 0x8B, 0x2F, 0x64, 0x41, 0xC7, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x96, 0xC5, 0x21,
+        0xC5, 0x42, 0x0F, 0xB7, 0x54, 0x1D, 0xFE, 0x66, 0x42, 0x89, 0x54, 0x18, 0xFE, 0x7F, 0x6D, 0x77, 0x4E, 0x44, 0x0F, 0x4D, 0xED, 0x0F, 0x4C, 0xEA,
+        0x78, 0x44, 0x41, 0x83, 0x8F, 0x0C, 0x03, 0x00, 0x00, 0x40, 0xBA, 0x56, 0x00, 0x00, 0x00, 0xBA, 0x53, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x73, 0xDF,
+        0x73, 0x88, 0x7F, 0x16, 0x7F, 0x2A, 0x7F, 0x2E, 0x78, 0x25, 0x83, 0x3B, 0x03, 0x76, 0xC3, 0xBA, 0x8D, 0x00, 0x00, 0x00, 0x8B, 0x5B, 0x70, 0x39,
+        0x4A, 0x68, 0x7D, 0x1D, 0x7C, 0x0C, 0x39, 0x05, 0x15, 0x12, 0x14, 0x00, 0x3B, 0x44, 0x24, 0x08, 0xBA, 0x63, 0x02, 0x00, 0x00, 0x39, 0x0A, 0x7C,
+        0xEF, 0x39, 0x3A, 0x8D, 0x71, 0xFF, 0x76, 0x05, 0xBA, 0xDE, 0x00, 0x00, 0x00, 0x45, 0x2B, 0x7C, 0x24, 0x08, 0x7C, 0xE5, 0x66, 0x0F, 0x6E, 0x4C,
+        0x24, 0x20, 0x66, 0x41, 0x0F, 0x6E, 0xC7, 0x66, 0x41, 0x0F, 0xD6, 0x44, 0x24, 0x68, 0x39, 0x08, 0xBD, 0x20, 0x00, 0x00, 0x00, 0xBE, 0x38, 0x00,
+        0x00, 0x00, 0x8D, 0x55, 0xFF, 0x83, 0x2F, 0x01, 0x89, 0x1C, 0x24, 0x7E, 0x7F, 0xBA, 0x4A, 0x00, 0x00, 0x00, 0xBB, 0x0B, 0x00, 0x00, 0x00, 0xBA,
+        0x66, 0x00, 0x00, 0x00, 0x39, 0x9D, 0x50, 0xFF, 0xFF, 0xFF, 0x48, 0x2D, 0x00, 0xCA, 0x9A, 0x3B, 0x74, 0xA5, 0x75, 0x9A, 0xBA, 0xCB, 0x00, 0x00,
+        0x00, 0x8B, 0x3D, 0x92, 0xF9, 0x13, 0x00, 0x7E, 0xE2, 0x74, 0xCB, 0xB8, 0xF4, 0x00, 0x00, 0x00, 0xB8, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0xF5, 0x00,
+        0x00, 0x00, 0xB8, 0xF3, 0x00, 0x00, 0x00, 0x77, 0x6D, 0xB8, 0xF2, 0x00, 0x00, 0x00, 0xB8, 0xF1, 0x00, 0x00, 0x00, 0x77, 0x07, 0xBB, 0xFA, 0xFF,
+        0xFF, 0xFF, 0xB8, 0xDE, 0x00, 0x00, 0x00, 0xBF, 0x58, 0x00, 0x00, 0x00, 0x49, 0x0F, 0xBA, 0xED, 0x3F, 0x79, 0x06, 0xB8, 0xE2, 0x00, 0x00, 0x00,
+        0x77, 0x77, 0x79, 0x05, 0xB8, 0xE1, 0x00, 0x00, 0x00, 0x77, 0x03, 0xB8, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0xDF, 0x00, 0x00, 0x00, 0x78, 0xF1, 0xA8,
+        0x0F, 0x75, 0xB3, 0x34, 0xFF, 0xF0, 0x48, 0x01, 0x05, 0x80, 0xE9, 0x13, 0x00, 0x41, 0x0F, 0x29, 0x08, 0x41, 0x0F, 0x29, 0x40, 0x10, 0xFF, 0x35,
+        0x8B, 0xE3, 0x13, 0x00, 0x76, 0x28, 0x49, 0x87, 0x1C, 0x24, 0xF6, 0xC3, 0x0F, 0x33, 0x6C, 0x24, 0x08, 0xC1, 0xC8, 0x08, 0x31, 0xC5, 0x33, 0x44,
+        0x24, 0x08, 0xC1, 0xCA, 0x08, 0xBF, 0x0E, 0x00, 0x00, 0x00, 0xBF, 0x1C, 0x00, 0x00, 0x00, 0xBF, 0x15, 0x00, 0x00, 0x00, 0xBF, 0x1B, 0x00, 0x00,
+        0x00, 0xBF, 0x1F, 0x00, 0x00, 0x00, 0xBF, 0x23, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0x00, 0x00, 0x00, 0xBF, 0x09, 0x00, 0x00, 0x00, 0xBA, 0x0E, 0x00,
+        0x00, 0x00, 0x64, 0x4C, 0x8B, 0x6D, 0x00, 0x64, 0x83, 0x3C, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x05, 0x46, 0xDE, 0x13, 0x00, 0x02, 0x83,
+        0x0D, 0xEA, 0xDD, 0x13, 0x00, 0x02, 0x73, 0xD3, 0x72, 0x14, 0x4C, 0x29, 0x25, 0xE2, 0xE3, 0x13, 0x00, 0x8B, 0x35, 0x9D, 0x41, 0x14, 0x00, 0x49,
+        0x83, 0x66, 0x08, 0xFE, 0x48, 0x29, 0x85, 0x88, 0x08, 0x00, 0x00, 0x48, 0x33, 0x94, 0xC8, 0x80, 0x00, 0x00, 0x00, 0x44, 0x87, 0x6D, 0x00, 0x4D,
+        0x89, 0x6C, 0x24, 0x10, 0x4C, 0x31, 0xDF, 0xB9, 0x32, 0x00, 0x00, 0x00, 0x43, 0x0F, 0x11, 0x44, 0x25, 0x08, 0x4B, 0xC7, 0x44, 0x25, 0x08, 0x11,
+        0x00, 0x00, 0x00, 0x48, 0x33, 0x42, 0x10, 0x64, 0x49, 0x8B, 0x06, 0x4B, 0x33, 0x3C, 0xD9, 0x4F, 0x89, 0x14, 0xD9, 0x75, 0x93, 0x76, 0x57, 0x76,
+        0x43, 0x76, 0x1B, 0x64, 0x49, 0x83, 0x3E, 0x00, 0x76, 0x3E, 0x76, 0x2C, 0x76, 0x1A, 0xBB, 0x20, 0x00, 0x00, 0x00, 0x48, 0x83, 0x4C, 0x19, 0x08,
+        0x01, 0x48, 0x83, 0x49, 0x08, 0x04, 0x47, 0x0F, 0xB7, 0x2C, 0x4A, 0x49, 0x31, 0xC1, 0x46, 0x0F, 0xB7, 0x0C, 0x68, 0x48, 0x83, 0x44, 0x24, 0x08,
+        0x01, 0xD3, 0xE6, 0x09, 0xB4, 0x85, 0x60, 0x08, 0x00, 0x00, 0x48, 0x33, 0x11, 0x66, 0x83, 0x2C, 0x58, 0x01, 0x76, 0x20, 0xC1, 0xEF, 0x05, 0x85,
+        0xF0, 0x4E, 0x33, 0x8C, 0xE8, 0x80, 0x00, 0x00, 0x00, 0x66, 0x42, 0x89, 0x34, 0x68, 0xB9, 0x10, 0x00, 0x00, 0x00, 0x4B, 0x33, 0xBC, 0xCA, 0x80,
+        0x00, 0x00, 0x00, 0x4F, 0x89, 0xB4, 0xCA, 0x80, 0x00, 0x00, 0x00, 0x66, 0x47, 0x89, 0x2C, 0x4A, 0x4D, 0x39, 0x41, 0x10, 0x4B, 0x89, 0x4C, 0x35,
+        0x00, 0x4B, 0x83, 0x4C, 0x35, 0x08, 0x01, 0x49, 0x83, 0x4D, 0x08, 0x04, 0xEB, 0x04, 0x8D, 0x8B, 0x80, 0x02, 0x00, 0x00, 0x7F, 0x38, 0x4C, 0x0F,
+        0x46, 0xF8, 0x77, 0x09, 0x7F, 0x25, 0x76, 0x0C, 0x64, 0x80, 0x38, 0x00, 0x72, 0xF8, 0x64, 0x48, 0x83, 0x3A, 0x00, 0x64, 0xC6, 0x02, 0x01, 0x7F,
+        0x05, 0x0F, 0x90, 0xC0, 0x76, 0x25, 0x39, 0xEE, 0x73, 0xEA, 0x09, 0x4C, 0x24, 0x14, 0x87, 0x02, 0x7F, 0x6B, 0x0F, 0xC6, 0x44, 0x24, 0x30, 0x88,
+        0x44, 0x01, 0x6C, 0x24, 0x08, 0xBA, 0x14, 0x00, 0x00, 0x00, 0x89, 0x48, 0x74, 0x77, 0x62, 0x89, 0x2D, 0xDA, 0x91, 0x13, 0x00, 0xBA, 0xE0, 0x0F,
+        0x00, 0x00, 0x80, 0x63, 0x50, 0xFE, 0xB8, 0x0F, 0x00, 0x00, 0x00, 0x7D, 0x18, 0x70, 0x05, 0x72, 0x27, 0xBE, 0xC8, 0x00, 0x00, 0x00, 0x77, 0x4F,
+        0x77, 0xAB, 0x74, 0xA8, 0x73, 0x52, 0x70, 0x79, 0x84, 0xC2, 0x72, 0x16, 0x72, 0x2C, 0x73, 0x3A, 0x73, 0x73, 0x49, 0x2B, 0x1F, 0x73, 0x61, 0x83,
+        0x03, 0x01, 0x77, 0xD9, 0x44, 0x38, 0xC9, 0x43, 0xC6, 0x04, 0x3E, 0x3D, 0x0F, 0xBC, 0xC7, 0x48, 0x0F, 0xBC, 0xC7, 0x8B, 0x89, 0xA4, 0x01, 0x00,
+        0x00, 0x78, 0x21, 0xF6, 0x81, 0x9D, 0x00, 0x00, 0x00, 0x02, 0x79, 0xE9, 0x80, 0x72, 0xFF, 0x2A, 0x72, 0xD0, 0x72, 0x06, 0x46, 0x0F, 0xB6, 0x54,
+        0x18, 0x01, 0x4D, 0x0F, 0x42, 0xC6, 0x72, 0xB1, 0x72, 0x0F, 0x72, 0x6D, 0x73, 0xDD, 0x73, 0x96, 0x8B, 0x88, 0xB8, 0x00, 0x00, 0x00, 0x78, 0x28,
+        0x79, 0xEC, 0x78, 0x3F, 0x8B, 0xB0, 0xA4, 0x01, 0x00, 0x00, 0x73, 0x39, 0x46, 0x38, 0x14, 0x9E, 0x72, 0xC7, 0x72, 0xCF, 0x72, 0xC9, 0x72, 0x10,
+        0x73, 0x27, 0x39, 0x14, 0xB3, 0x39, 0x34, 0xBB, 0x72, 0x65, 0x76, 0x63, 0x45, 0x0F, 0xB6, 0x44, 0x11, 0xFF, 0x42, 0x39, 0x3C, 0x83, 0x72, 0xDE,
+        0x25, 0x20, 0x01, 0x00, 0x00, 0x3D, 0x20, 0x01, 0x00, 0x00, 0x8B, 0xB2, 0xB8, 0x00, 0x00, 0x00, 0xF6, 0x82, 0x9E, 0x00, 0x00, 0x00, 0x10, 0x8D,
+        0x7A, 0x01, 0x0F, 0x95, 0x44, 0x24, 0x14, 0x19, 0xD2, 0x78, 0x68, 0x45, 0x38, 0x5C, 0x31, 0x05, 0x79, 0x98, 0x42, 0x38, 0x54, 0x1E, 0x05, 0x79,
+        0xA0, 0x29, 0xEF, 0x72, 0xE1, 0x45, 0x0F, 0xAF, 0xC5, 0xF6, 0x04, 0x13, 0x02, 0xBA, 0x22, 0x01, 0x00, 0x00, 0x64, 0x45, 0x8B, 0x2C, 0x24, 0x76,
+        0x52, 0x33, 0x7C, 0x24, 0x08, 0x31, 0xC7, 0xC6, 0x41, 0xFF, 0x00, 0x38, 0xCA, 0xEB, 0xEF, 0x38, 0xC1, 0x38, 0xC2, 0x45, 0x08, 0xC8, 0xEB, 0xF4,
+        0x41, 0x84, 0xF9, 0xFF, 0xE7, 0x88, 0x48, 0x02, 0x7D, 0x48, 0x41, 0x38, 0x74, 0x01, 0x01, 0x48, 0x81, 0xCE, 0x00, 0x02, 0x00, 0x00, 0x76, 0x2A,
+        0x73, 0xDA, 0x48, 0x0F, 0x42, 0x04, 0x24, 0xEB, 0x7F, 0x3C, 0x03, 0x76, 0x78, 0xBA, 0xF0, 0xFF, 0xFF, 0xFF, 0x78, 0x5E, 0x79, 0xA2, 0x43, 0x89,
+        0x3C, 0xA7, 0x38, 0x4A, 0x01, 0x78, 0x5C, 0x79, 0xA4, 0x01, 0xDA, 0x78, 0x5A, 0x79, 0xA6, 0x39, 0xDA, 0x46, 0x38, 0x64, 0x0E, 0x05, 0x79, 0xA5,
+        0x79, 0xA1, 0x39, 0xFB, 0x0F, 0x92, 0x04, 0x07, 0x7E, 0x1F, 0x78, 0x66, 0x79, 0x9A, 0x78, 0x77, 0x79, 0x89, 0x39, 0xDF, 0x7E, 0x15, 0x39, 0xDE,
+        0x40, 0x38, 0x7C, 0x31, 0x05, 0x45, 0x88, 0x0C, 0x33, 0x78, 0x67, 0x79, 0x99, 0xEB, 0x73, 0x01, 0xF9, 0x8D, 0x72, 0x01, 0x01, 0xDE, 0x73, 0xD6,
+        0x8B, 0x5D, 0xB8, 0x45, 0x88, 0x54, 0x06, 0xFF, 0x42, 0x8D, 0x44, 0x0F, 0x02, 0x43, 0x0F, 0x92, 0x04, 0x26, 0x73, 0xAD, 0xEB, 0x4E, 0x7F, 0x7A,
+        0x75, 0x86, 0x73, 0x83, 0xBA, 0xC3, 0x02, 0x00, 0x00, 0x88, 0xC8, 0x8A, 0x24, 0x17, 0xB8, 0x22, 0x00, 0x00, 0x00, 0x77, 0x3C, 0x66, 0x0F, 0x74,
+        0xC1, 0x48, 0xF7, 0xC7, 0x3F, 0x00, 0x00, 0x00, 0x66, 0x0F, 0xDE, 0xD8, 0x66, 0x0F, 0x74, 0x4F, 0x30, 0x7E, 0x5B, 0x76, 0x38, 0x76, 0x18, 0x72,
+        0x6C, 0x8B, 0x3F, 0x48, 0x0F, 0xC9, 0xFF, 0xCA, 0x7E, 0xDC, 0x8A, 0x0C, 0x16, 0x0F, 0x10, 0x06, 0x0F, 0x10, 0x44, 0x16, 0x10, 0x75, 0x01, 0x0F,
+        0x10, 0x46, 0x10, 0x76, 0x62, 0x76, 0x2B, 0x31, 0xC8, 0x77, 0xBB, 0x77, 0x7A, 0x2B, 0x07, 0x2B, 0x74, 0x17, 0xFC, 0x76, 0xEB, 0x76, 0x66, 0x76,
+        0x30, 0x72, 0x03, 0xFD, 0xFC, 0x7C, 0x10, 0x8A, 0x0E, 0x88, 0x0F, 0x77, 0x4A, 0x76, 0xC1, 0x44, 0x0F, 0x10, 0x44, 0x16, 0xC0, 0x48, 0xFF, 0xC7,
+        0x77, 0xD5, 0x44, 0x0F, 0x11, 0x02, 0x73, 0x08, 0x0F, 0x18, 0x4E, 0x40, 0x0F, 0x18, 0x8E, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x10, 0xA6, 0x00, 0x10,
+        0x00, 0x00, 0x66, 0x0F, 0xE7, 0x07, 0x66, 0x0F, 0xE7, 0x4F, 0x10, 0x66, 0x0F, 0xE7, 0xA7, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xC9, 0x0F, 0xAE, 0xF8,
+        0x76, 0x36, 0x44, 0x0F, 0x10, 0x86, 0x00, 0x20, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xE7, 0x87, 0x00, 0x20, 0x00, 0x00, 0x0F, 0xBD, 0xC0, 0x7C, 0x11,
+        0x48, 0xFF, 0xC9, 0x76, 0xB7, 0x7C, 0xB5, 0xF7, 0xD9, 0x77, 0x8C, 0x7C, 0x04, 0x7E, 0x21, 0x76, 0x50, 0x7C, 0x31, 0xF3, 0xAA, 0x7D, 0x16, 0x7D,
+        0x1A, 0x7C, 0x03, 0x8A, 0x06, 0x4D, 0x09, 0xC1, 0x49, 0xFF, 0xC1, 0x88, 0x22, 0x84, 0xE4, 0x0F, 0x28, 0x54, 0x0E, 0x10, 0x66, 0x0F, 0xDA, 0xD5,
+        0x88, 0x37, 0x66, 0x8B, 0x16, 0x88, 0x77, 0x02, 0x66, 0x8B, 0x56, 0x04, 0x8B, 0x4E, 0x0F, 0x4B, 0x63, 0x0C, 0x83, 0x72, 0x9D, 0x72, 0x80, 0x8A,
+        0x16, 0x8A, 0x56, 0x02, 0x88, 0x57, 0x02, 0x8A, 0x4E, 0x10, 0x88, 0x4F, 0x10, 0x73, 0xE3, 0x7C, 0x2C, 0x7C, 0x38, 0x7C, 0x19, 0xF7, 0x80, 0x70,
+        0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x74, 0x77, 0x6F, 0x66, 0x0F, 0x12, 0x0F, 0x66, 0x0F, 0x16, 0x4F, 0x08, 0x66, 0x44, 0x0F, 0x6F,
+        0xC5, 0x66, 0x44, 0x0F, 0xFC, 0xC1, 0x66, 0x44, 0x0F, 0x64, 0xC6, 0x66, 0x44, 0x0F, 0xDF, 0xC7, 0x66, 0x41, 0x0F, 0xFC, 0xC8, 0x66, 0x0F, 0xF8,
+        0xC8, 0x91, 0x48, 0x87, 0xF7, 0x66, 0x44, 0x0F, 0xD7, 0xC9, 0x66, 0x0F, 0x73, 0xFA, 0x0F, 0x49, 0x81, 0xE2, 0xFF, 0x0F, 0x00, 0x00, 0x49, 0x81,
+        0xEA, 0x00, 0x10, 0x00, 0x00, 0x66, 0x0F, 0x73, 0xDB, 0x01, 0x7F, 0x7E, 0x84, 0xED, 0x41, 0xD3, 0xE2, 0x48, 0xA9, 0x3F, 0x00, 0x00, 0x00, 0x66,
+        0x0F, 0xDA, 0x60, 0x10, 0x28, 0xD1, 0x77, 0x3F, 0x77, 0x3A, 0x7F, 0x50, 0x66, 0x45, 0x0F, 0xEF, 0xC9, 0x66, 0x42, 0x0F, 0x6F, 0x04, 0x12, 0x66,
+        0x42, 0x0F, 0x6F, 0x4C, 0x12, 0x10, 0xF3, 0x42, 0x0F, 0x6F, 0x14, 0x10, 0xF3, 0x42, 0x0F, 0x6F, 0x5C, 0x10, 0x10, 0x38, 0xC8, 0x48, 0x81, 0xE1,
+        0xFF, 0x0F, 0x00, 0x00, 0x77, 0x7E, 0x77, 0x79, 0x30, 0xED, 0x88, 0x2F, 0x88, 0x6F, 0x01, 0x7F, 0x56, 0x76, 0x0B, 0x48, 0x0F, 0xAB, 0xF2, 0x4C,
+        0x0F, 0xAB, 0xDA, 0x3D, 0xF0, 0x0F, 0x00, 0x00, 0x31, 0xD1, 0x75, 0x85, 0x44, 0x0F, 0x28, 0xCC, 0x66, 0x44, 0x0F, 0x74, 0xC5, 0x66, 0x41, 0x0F,
+        0xD7, 0xC8, 0x66, 0x41, 0x0F, 0x74, 0xF1, 0x67, 0x8D, 0x51, 0xFF, 0x38, 0x10, 0xC4, 0xE2, 0xA0, 0xF5, 0xDA, 0xC4, 0xE1, 0xFB, 0x92, 0xCB, 0x62,
+        0xF1, 0x7F, 0xC9, 0x6F, 0x0F, 0x62, 0xF2, 0x76, 0x49, 0x26, 0xE1, 0xC4, 0xE2, 0xA0, 0xF3, 0xD2, 0xC4, 0xC1, 0xFB, 0x92, 0xD3, 0x62, 0xF2, 0x7D,
+        0x48, 0x78, 0x18, 0x62, 0xF2, 0x7D, 0x48, 0x78, 0x14, 0x0F, 0x62, 0xF3, 0x7D, 0x48, 0x3F, 0xC2, 0x00, 0xF3, 0x49, 0x0F, 0xBC, 0xD3, 0x77, 0x7D,
+        0x62, 0xF3, 0x5D, 0x4A, 0x3F, 0xC1, 0x04, 0xC4, 0xE1, 0xF8, 0x98, 0xC0, 0xC5, 0xF8, 0x77, 0xC4, 0xC2, 0xA0, 0xF3, 0xCB, 0x62, 0xD1, 0xFD, 0x48,
+        0x6F, 0xB3, 0x01, 0x00, 0x00, 0x00, 0x62, 0xD1, 0x65, 0x49, 0x74, 0x33, 0x62, 0xF1, 0xFE, 0x48, 0x6F, 0x01, 0x38, 0x0A, 0xC4, 0xE1, 0xEC, 0x46,
+        0xD2, 0x49, 0x0F, 0xBC, 0xC0, 0x3A, 0x50, 0x02, 0x3A, 0x4C, 0x10, 0x02, 0x66, 0x44, 0x0F, 0x6F, 0x57, 0x50, 0x66, 0x41, 0x0F, 0xDA, 0xC2, 0x66,
+        0x44, 0x0F, 0xEF, 0xD2, 0x66, 0x41, 0x0F, 0xEB, 0xDA, 0x66, 0x41, 0x0F, 0x6F, 0xD8, 0x66, 0x44, 0x0F, 0xEB, 0xC3, 0x3A, 0x51, 0x01, 0x3A, 0x54,
+        0x01, 0x01, 0xF3, 0xC3, 0x42, 0x2B, 0x04, 0x81, 0xEB, 0x02, 0x3A, 0x07, 0x3A, 0x02, 0x74, 0xF8, 0x81, 0xEF, 0xB9, 0x00, 0x00, 0x00, 0xEB, 0xF5,
+        0x74, 0x87, 0x77, 0x24, 0x88, 0x5C, 0x24, 0x57, 0x8D, 0x40, 0xFC, 0xA9, 0xFB, 0xFF, 0xFF, 0xFF, 0x76, 0x33, 0xBA, 0x5C, 0x00, 0x00, 0x00, 0xBA,
+        0x68, 0x00, 0x00, 0x00, 0xBA, 0x60, 0x00, 0x00, 0x00, 0xBA, 0x7A, 0x00, 0x00, 0x00, 0xBA, 0x79, 0x00, 0x00, 0x00, 0xBA, 0x5D, 0x00, 0x00, 0x00,
+        0x8B, 0x49, 0xFC, 0x83, 0x79, 0xFC, 0x01, 0xBA, 0x78, 0x00, 0x00, 0x00, 0xBA, 0x75, 0x00, 0x00, 0x00, 0xBA, 0x85, 0x00, 0x00, 0x00, 0xBA, 0x7D,
+        0x00, 0x00, 0x00, 0xBA, 0x7C, 0x00, 0x00, 0x00, 0xBD, 0x0A, 0x00, 0x00, 0x00, 0x39, 0xC7, 0x7D, 0x2E, 0xF7, 0xC5, 0xEF, 0xFF, 0xFF, 0xFF, 0x77,
+        0xCC, 0x7D, 0x30, 0x39, 0xEB, 0x7F, 0x0D, 0x49, 0xBD, 0x00, 0x00, 0xE8, 0x89, 0x04, 0x23, 0xC7, 0x8A, 0x74, 0x9D, 0x39, 0x5C, 0x24, 0x18, 0x8B,
+        0x3B, 0x76, 0x9E, 0x7E, 0xD7, 0x29, 0xE8, 0x41, 0x85, 0xEC, 0xBF, 0x35, 0x01, 0x00, 0x00, 0x0F, 0x9C, 0xC0, 0xBE, 0x1E, 0x00, 0x00, 0x00, 0xBE,
+        0x66, 0x00, 0x00, 0x00, 0x44, 0x39, 0x74, 0x24, 0x10, 0x20, 0xCA, 0x76, 0x9B, 0x7E, 0xD6, 0x75, 0xF8, 0xBF, 0x45, 0x13, 0x00, 0x00, 0x7E, 0x39,
+        0x4E, 0x89, 0xAC, 0xF4, 0x90, 0x00, 0x00, 0x00, 0xBE, 0xED, 0x01, 0x00, 0x00, 0xBF, 0x27, 0x00, 0x00, 0x00, 0xBE, 0x0D, 0x00, 0x00, 0x00, 0xBF,
+        0x83, 0x00, 0x00, 0x00, 0x76, 0xE5, 0x23, 0x78, 0x10, 0xD3, 0xEB, 0x23, 0x50, 0x10, 0x44, 0x3B, 0x40, 0x04, 0x72, 0xA0, 0x74, 0xA6, 0x78, 0x57,
+        0x79, 0xA9, 0x43, 0x8B, 0x54, 0x10, 0xFC, 0x7F, 0x65, 0x41, 0x3B, 0x44, 0x38, 0xFC, 0x8B, 0x3A, 0x78, 0x52, 0x79, 0xAE, 0x88, 0x9C, 0x24, 0xD3,
+        0x00, 0x00, 0x00, 0xEB, 0x6F, 0x7E, 0x68, 0x7E, 0x64, 0x43, 0xC6, 0x44, 0x2C, 0x01, 0x00, 0xEB, 0x76, 0x46, 0x8B, 0x54, 0x9B, 0x04, 0x41, 0x0F,
+        0xAF, 0xF2, 0x89, 0x70, 0x04, 0x73, 0x7D, 0x39, 0x4D, 0x8C, 0x73, 0xBE, 0x72, 0x60, 0x42, 0xC7, 0x44, 0x98, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x41,
+        0xC6, 0x84, 0x24, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x47, 0x8B, 0x4C, 0x82, 0xFC, 0x8B, 0x39, 0x7F, 0x9D, 0x7F, 0x96, 0x7F, 0x9F, 0x7F, 0x98, 0x78,
+        0x56, 0x79, 0xAA, 0x79, 0xA8, 0x72, 0x73, 0x79, 0xAB, 0x7F, 0x97, 0x4C, 0x01, 0xA5, 0x70, 0xFF, 0xFF, 0xFF, 0x79, 0xAD, 0x78, 0x59, 0x7F, 0x6A,
+        0x43, 0x3B, 0x44, 0x01, 0xFC, 0x7F, 0x63, 0x7F, 0x66, 0x77, 0x22, 0x88, 0x42, 0xFF, 0xC6, 0x42, 0x01, 0x2F, 0x7E, 0xE1, 0x77, 0x68, 0x76, 0xA4,
+        0xBA, 0x95, 0x00, 0x00, 0x00, 0x88, 0x4B, 0x05, 0x80, 0x6B, 0x07, 0x01, 0x78, 0x3D, 0x89, 0x0A, 0x79, 0xF2, 0x77, 0xD0, 0x3C, 0x9F, 0x77, 0xBC,
+        0x3C, 0x8F, 0x77, 0xA8, 0x7F, 0x73, 0x66, 0x81, 0xE9, 0x40, 0x28, 0xBA, 0x6F, 0x00, 0x00, 0x00, 0xBA, 0x81, 0x00, 0x00, 0x00, 0x78, 0x24, 0x8D,
+        0xB1, 0x00, 0x28, 0xFF, 0xFF, 0x77, 0x40, 0x81, 0xC6, 0x00, 0x00, 0x01, 0x00, 0x39, 0x38, 0x7E, 0x33, 0x7F, 0xA5, 0x7E, 0x72, 0xBB, 0x40, 0x00,
+        0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x76, 0xD0, 0xEB, 0x6A, 0x88, 0xC5, 0x88, 0xD1, 0x80, 0xE1, 0x0F, 0x39, 0x0F, 0x39, 0x4F,
+        0x04, 0x3B, 0x06, 0x3B, 0x46, 0x04, 0x66, 0x0F, 0x76, 0x57, 0x10, 0x66, 0x41, 0x0F, 0x76, 0xE8, 0x66, 0x44, 0x0F, 0x76, 0xC4, 0xEB, 0x79, 0x76,
+        0x73, 0x76, 0x53, 0x7E, 0x31, 0xF3, 0x0F, 0x7E, 0x06, 0x3B, 0x0E, 0x3B, 0x0C, 0x06, 0x3B, 0x4C, 0x06, 0xF0, 0x76, 0x64, 0x75, 0x5A, 0x48, 0xF7,
+        0xEF, 0x78, 0xF3, 0x89, 0x7B, 0x04, 0x49, 0xF7, 0xEA, 0xB9, 0xB2, 0x07, 0x00, 0x00, 0xB8, 0x6D, 0x01, 0x00, 0x00, 0x49, 0xBF, 0x5C, 0x8F, 0xC2,
+        0xF5, 0x28, 0x5C, 0x8F, 0x02, 0x72, 0x2A, 0x7F, 0xEC, 0x7F, 0x20, 0x7E, 0x8A, 0x77, 0x12, 0x76, 0x35, 0x78, 0x2F, 0x48, 0x69, 0x34, 0x24, 0x40,
+        0x42, 0x0F, 0x00, 0xDF, 0x6C, 0x24, 0xF0, 0xDE, 0xE9, 0xDD, 0x5C, 0x24, 0xF0, 0x1D, 0x25, 0xFE, 0xFF, 0xFF, 0x41, 0x81, 0xD9, 0x25, 0xFE, 0xFF,
+        0xFF, 0x29, 0xEA, 0x46, 0x8D, 0x64, 0x0D, 0x00, 0xF3, 0x41, 0x0F, 0x6F, 0x54, 0x24, 0x10, 0xBB, 0x06, 0x00, 0x00, 0x00, 0x44, 0x0F, 0x4E, 0xC0,
+        0x70, 0x6B, 0x66, 0x0F, 0x6F, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x71, 0x23, 0x70, 0xDD, 0xB8, 0xC9, 0x00, 0x00, 0x00, 0xB8, 0x60, 0x00, 0x00,
+        0x00, 0xB8, 0xA4, 0x00, 0x00, 0x00, 0x78, 0x36, 0x39, 0x77, 0x28, 0x7E, 0x3C, 0x8D, 0x96, 0x4E, 0xF8, 0xFF, 0xFF, 0x8D, 0x94, 0x3A, 0x14, 0xFE,
+        0xFF, 0xFF, 0x29, 0xDA, 0x8B, 0x51, 0x08, 0x89, 0x71, 0x28, 0x69, 0xD6, 0x29, 0x5C, 0x8F, 0xC2, 0xC1, 0xCF, 0x02, 0x41, 0x0F, 0x96, 0xC0, 0x44,
+        0x0F, 0xB7, 0x51, 0x0C, 0xBD, 0xAB, 0xAA, 0xAA, 0xAA, 0x66, 0x41, 0x83, 0xFA, 0x03, 0x41, 0x83, 0xDD, 0x00, 0x6B, 0xC0, 0x1A, 0x44, 0x6B, 0xF5,
+        0x64, 0x41, 0x0F, 0x48, 0xED, 0xC1, 0xFD, 0x02, 0x8D, 0x1C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8D, 0x0C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x7C,
+        0xF0, 0x76, 0x4D, 0x73, 0xD8, 0x76, 0xE2, 0x76, 0xB4, 0x66, 0x44, 0x89, 0x5C, 0x24, 0x10, 0xBA, 0x3B, 0x00, 0x00, 0x00, 0x05, 0x10, 0x0E, 0x00,
+        0x00, 0x77, 0x50, 0x3C, 0x4A, 0x3C, 0x4D, 0x66, 0x45, 0x89, 0x44, 0x04, 0x10, 0x6B, 0xFF, 0x3C, 0x8D, 0xB0, 0x6C, 0x07, 0x00, 0x00, 0x0F, 0x9D,
+        0xC2, 0x21, 0xF8, 0x09, 0xFA, 0x49, 0x63, 0x44, 0x05, 0x18, 0x21, 0xC7, 0x01, 0x03, 0x41, 0x81, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x81, 0x7C, 0x24,
+        0x50, 0x54, 0x5A, 0x69, 0x66, 0x73, 0xEE, 0x72, 0xDB, 0x4A, 0x83, 0x3C, 0xF3, 0x00, 0x66, 0x41, 0xC7, 0x40, 0x04, 0x00, 0x00, 0x7E, 0xCA, 0x76,
+        0x11, 0x4E, 0x39, 0x6C, 0x06, 0xB0, 0x7F, 0xF2, 0x73, 0x7A, 0x7E, 0xF1, 0xBA, 0xEF, 0x02, 0x00, 0x00, 0xB8, 0x24, 0x00, 0x00, 0x00, 0xB8, 0x26,
+        0x00, 0x00, 0x00, 0x69, 0xFF, 0x29, 0x5C, 0x8F, 0xC2, 0x81, 0xC7, 0x50, 0xB8, 0x1E, 0x05, 0x76, 0x07, 0x05, 0x6D, 0x01, 0x00, 0x00, 0x81, 0x08,
+        0x00, 0x80, 0x00, 0x00, 0x4A, 0x0F, 0xBE, 0x54, 0x2B, 0xFF, 0xEB, 0x74, 0xA9, 0xD5, 0x0A, 0x00, 0x00, 0xA9, 0x28, 0x05, 0x00, 0x00, 0x2B, 0x8D,
+        0xC0, 0xFE, 0xFF, 0xFF, 0x03, 0x8D, 0xC4, 0xFE, 0xFF, 0xFF, 0x2B, 0x9D, 0x08, 0xFF, 0xFF, 0xFF, 0x8D, 0x0C, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x2B,
+        0x85, 0xB8, 0xFE, 0xFF, 0xFF, 0x03, 0x85, 0xBC, 0xFE, 0xFF, 0xFF, 0x29, 0xF7, 0xB9, 0x1C, 0x00, 0x00, 0x00, 0xB9, 0x1D, 0x00, 0x00, 0x00, 0x05,
+        0x50, 0xB8, 0x1E, 0x05, 0xC1, 0xCE, 0x02, 0x3D, 0x0B, 0xD7, 0xA3, 0x00, 0x44, 0x0F, 0x49, 0xD7, 0x41, 0x8D, 0x84, 0x01, 0x27, 0xFE, 0xFF, 0xFF,
+        0x42, 0x0F, 0xB7, 0x14, 0x42, 0x03, 0x41, 0x0C, 0x29, 0xD6, 0x6B, 0xD2, 0x64, 0x0F, 0xAF, 0x50, 0x40, 0x77, 0x3D, 0x3C, 0x55, 0x80, 0x4C, 0x24,
+        0x68, 0x02, 0x66, 0x81, 0x4C, 0x24, 0x68, 0x08, 0x04, 0x76, 0xBA, 0x77, 0xAF, 0x2D, 0x6C, 0x07, 0x00, 0x00, 0x77, 0x16, 0x80, 0x64, 0x24, 0x68,
+        0xFE, 0x3C, 0x10, 0x3C, 0x08, 0x76, 0xCB, 0x3C, 0x37, 0x3C, 0x43, 0x3C, 0x21, 0x8D, 0x73, 0xD0, 0x2B, 0x42, 0x04, 0x7D, 0x35, 0x77, 0x9C, 0x77,
+        0x90, 0x72, 0x47, 0x66, 0x0D, 0x08, 0x04, 0x41, 0x83, 0x46, 0x08, 0x0C, 0x3C, 0x18, 0x41, 0x8D, 0x80, 0x6C, 0x07, 0x00, 0x00, 0x3D, 0x0A, 0xD7,
+        0xA3, 0x00, 0x7F, 0x27, 0x7D, 0xEE, 0x05, 0x6C, 0x07, 0x00, 0x00, 0x83, 0xF7, 0x01, 0x41, 0x2B, 0x43, 0x18, 0x4D, 0x69, 0xC0, 0x1F, 0x85, 0xEB,
+        0x51, 0x41, 0x6B, 0xF0, 0x64, 0xA8, 0xFD, 0x77, 0x9B, 0x77, 0x8F, 0x77, 0x9D, 0x77, 0x91, 0x77, 0xA6, 0x77, 0x9A, 0x77, 0x9F, 0x77, 0x98, 0x77,
+        0xAC, 0x77, 0xA0, 0x8B, 0x98, 0xC8, 0x01, 0x00, 0x00, 0x78, 0x19, 0x7D, 0x13, 0x76, 0x3A, 0x77, 0x1E, 0x8D, 0x6C, 0x4A, 0xD0, 0x7E, 0xD2, 0xBA,
+        0x6D, 0x01, 0x00, 0x00, 0xBA, 0x6E, 0x01, 0x00, 0x00, 0x41, 0xC1, 0xC9, 0x04, 0x7E, 0x48, 0x77, 0x2D, 0x8D, 0x82, 0x0E, 0x00, 0x02, 0x00, 0x7E,
+        0x43, 0xB9, 0x89, 0x88, 0x88, 0x88, 0x45, 0x0F, 0x44, 0xCB, 0x7E, 0x47, 0x77, 0x0A, 0x79, 0x08, 0x77, 0xD7, 0x7E, 0x78, 0x7E, 0x50, 0x7E, 0x2A,
+        0x2B, 0x47, 0x18, 0x6B, 0xCA, 0x64, 0x7E, 0x30, 0x39, 0xCD, 0x01, 0xD7, 0x29, 0xCD, 0x73, 0xEC, 0x69, 0xC7, 0x29, 0x5C, 0x8F, 0xC2, 0x3D, 0x28,
+        0x5C, 0x8F, 0x02, 0x41, 0xF7, 0xF9, 0x7E, 0x4A, 0x41, 0x0F, 0x45, 0xC7, 0x41, 0x50, 0xBF, 0x4F, 0x00, 0x00, 0x00, 0x45, 0x0F, 0x49, 0xFC, 0x44,
+        0x8D, 0x64, 0x50, 0xD0, 0x7F, 0xEE, 0xB8, 0x4F, 0x00, 0x00, 0x00, 0x7E, 0x4E, 0x7E, 0x24, 0x01, 0xFF, 0xFF, 0xB5, 0x18, 0xFF, 0xFF, 0xFF, 0x7E,
+        0x57, 0xBE, 0x89, 0x88, 0x88, 0x88, 0x7E, 0x44, 0x8B, 0x76, 0x1C, 0xB9, 0x4F, 0x00, 0x00, 0x00, 0x77, 0x8D, 0xF7, 0xD7, 0xB8, 0xE5, 0x00, 0x00,
+        0x00, 0x76, 0x17, 0xB8, 0xE4, 0x00, 0x00, 0x00, 0xB8, 0xE3, 0x00, 0x00, 0x00, 0xB8, 0xFA, 0xFF, 0xFF, 0xFF, 0xB8, 0xE6, 0x00, 0x00, 0x00, 0x89,
+        0x3C, 0x24, 0x39, 0x43, 0x08, 0x7C, 0xE4, 0x8B, 0x86, 0xC8, 0x01, 0x00, 0x00, 0x7E, 0x5D, 0x3B, 0x58, 0x10, 0x7C, 0x3E, 0x7C, 0xE7, 0x7C, 0xE1,
+        0x7C, 0xD6, 0x7F, 0xD1, 0x7F, 0xB4, 0x7C, 0x8D, 0x7C, 0xAD, 0x77, 0x57, 0x48, 0x63, 0x94, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x78, 0x4D, 0x87, 0x43,
+        0x04, 0xB8, 0xD9, 0x00, 0x00, 0x00, 0x78, 0x69, 0x72, 0xED, 0x64, 0x41, 0xC7, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x99, 0x78, 0x09, 0xBE,
+        0x50, 0x00, 0x00, 0x00, 0x41, 0x3B, 0x14, 0x84, 0x7E, 0x62, 0x48, 0x0F, 0x4F, 0x8C, 0x24, 0xC0, 0x04, 0x00, 0x00, 0x39, 0x0C, 0x82, 0x7F, 0xC9,
+        0xBA, 0x44, 0x00, 0x00, 0x00, 0xB8, 0x74, 0x00, 0x00, 0x00, 0x7F, 0x29, 0x7F, 0x64, 0x79, 0xD3, 0x7F, 0x3E, 0xFF, 0x54, 0x24, 0x48, 0x73, 0xC0,
+        0x72, 0xA4, 0x72, 0x89, 0x73, 0xB6, 0x64, 0x45, 0x8B, 0x3E, 0xBF, 0x46, 0x00, 0x00, 0x00, 0xEB, 0x58, 0xB8, 0x64, 0x00, 0x00, 0x00, 0xB8, 0x3D,
+        0x00, 0x00, 0x00, 0x77, 0x5D, 0xB8, 0xF7, 0x00, 0x00, 0x00, 0x77, 0x37, 0xB8, 0x25, 0x00, 0x00, 0x00, 0x41, 0x0F, 0x11, 0x84, 0x24, 0x18, 0x0A,
+        0x00, 0x00, 0x49, 0x01, 0x84, 0x24, 0xD8, 0x10, 0x00, 0x00, 0xC6, 0x86, 0x50, 0x03, 0x00, 0x00, 0x00, 0xBF, 0x11, 0x00, 0x20, 0x01, 0xB8, 0x38,
+        0x00, 0x00, 0x00, 0xB8, 0x3A, 0x00, 0x00, 0x00, 0xBE, 0xE7, 0x00, 0x00, 0x00, 0x76, 0xE7, 0x72, 0x5E, 0xFF, 0x12, 0xB8, 0x3B, 0x00, 0x00, 0x00,
+        0xB8, 0x42, 0x01, 0x00, 0x00, 0x77, 0x25, 0x72, 0x59, 0xB8, 0x6B, 0x00, 0x00, 0x00, 0xB8, 0x68, 0x00, 0x00, 0x00, 0xB8, 0x6C, 0x00, 0x00, 0x00,
+        0xB8, 0x73, 0x00, 0x00, 0x00, 0xB8, 0x69, 0x00, 0x00, 0x00, 0x77, 0x34, 0xB8, 0x6A, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x01, 0x00, 0xB8, 0x79,
+        0x00, 0x00, 0x00, 0xB8, 0x6F, 0x00, 0x00, 0x00, 0xB8, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x70, 0x00, 0x00, 0x00, 0xB8, 0x76, 0x00, 0x00, 0x00, 0xB8,
+        0x78, 0x00, 0x00, 0x00, 0xB8, 0x75, 0x00, 0x00, 0x00, 0xB8, 0x77, 0x00, 0x00, 0x00, 0x45, 0x30, 0xC0, 0x41, 0x81, 0x0C, 0x24, 0x00, 0x80, 0x00,
+        0x00, 0x78, 0x91, 0xBB, 0xE8, 0xFD, 0x00, 0x00, 0x7F, 0x36, 0x75, 0x02, 0xB8, 0xE8, 0xFD, 0x00, 0x00, 0xB9, 0x3E, 0x68, 0x23, 0x91, 0x79, 0x6C,
+        0x78, 0x07, 0x8D, 0x83, 0x47, 0xFF, 0xFF, 0xFF, 0xBA, 0x57, 0x00, 0x00, 0x00, 0xA9, 0x98, 0xBF, 0x1F, 0x00, 0xA9, 0x67, 0x00, 0x60, 0x00, 0x7F,
+        0xD3, 0xA9, 0x1D, 0x00, 0x00, 0x50, 0xB8, 0x63, 0x00, 0x00, 0x00, 0xB8, 0x14, 0x00, 0x00, 0x00, 0xB8, 0xBC, 0x02, 0x00, 0x00, 0x64, 0x8B, 0x45,
+        0x00, 0x64, 0xC7, 0x45, 0x00, 0x16, 0x00, 0x00, 0x00, 0x83, 0xF6, 0x01, 0xFF, 0x52, 0x40, 0x3C, 0x5C, 0x3C, 0x5B, 0x3C, 0x3F, 0xA9, 0x10, 0x08,
+        0x00, 0x00, 0x41, 0x08, 0xC5, 0xBA, 0xD3, 0x05, 0x00, 0x00, 0xBA, 0xED, 0x05, 0x00, 0x00, 0xBE, 0x7B, 0x00, 0x00, 0x00, 0x25, 0xCF, 0xF7, 0xFF,
+        0xFF, 0x3C, 0x7B, 0xBE, 0x5C, 0x00, 0x00, 0x00, 0x72, 0x84, 0x81, 0xA5, 0x48, 0xFB, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x73, 0x22, 0xBA, 0xD7,
+        0x01, 0x00, 0x00, 0xBA, 0xF7, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x48, 0x0F, 0x46, 0x7C, 0x24, 0x08, 0x79, 0x04, 0x44, 0x0F, 0x44, 0x04, 0x24, 0x3C,
+        0x3B, 0x20, 0x44, 0x24, 0x72, 0x45, 0x38, 0xF2, 0x44, 0x20, 0xC0, 0x47, 0x0F, 0xB6, 0x24, 0x27, 0x44, 0x0F, 0x42, 0xE2, 0xB8, 0x5C, 0x00, 0x00,
+        0x00, 0xBA, 0x3A, 0x00, 0x00, 0x00, 0xBF, 0x2A, 0x00, 0x00, 0x00, 0x3A, 0x45, 0x00, 0x4D, 0x0F, 0x46, 0xE6, 0x42, 0x38, 0x04, 0x21, 0x3C, 0x1F,
+        0x44, 0x88, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x44, 0x0F, 0xB6, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x76, 0x0E, 0x8B, 0x7E, 0x38, 0x3B, 0x30,
+        0x09, 0xF9, 0x40, 0x0F, 0x97, 0xC7, 0x41, 0x0F, 0x42, 0xD1, 0x72, 0x22, 0x79, 0x36, 0x0F, 0x92, 0x44, 0x24, 0x28, 0x7E, 0x4C, 0x3B, 0x4E, 0x04,
+        0x79, 0xE2, 0x39, 0x4E, 0x48, 0x7E, 0x75, 0x7E, 0x10, 0x43, 0x83, 0x3C, 0x82, 0xFF, 0x7D, 0xE5, 0x89, 0x4E, 0x38, 0xEB, 0xEE, 0x45, 0x39, 0x2C,
+        0x24, 0x49, 0x23, 0x44, 0x24, 0x10, 0x49, 0x21, 0x44, 0x24, 0x10, 0xD1, 0xFA, 0x39, 0x70, 0x04, 0x7C, 0x2F, 0x7F, 0xE0, 0x7E, 0x29, 0x39, 0x13,
+        0x89, 0x2C, 0x97, 0x80, 0x61, 0x3A, 0xF3, 0xC7, 0x41, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xD4, 0x45, 0x39, 0xA7, 0xB0, 0x00, 0x00, 0x00, 0x66,
+        0x0F, 0xD6, 0x00, 0x45, 0x89, 0xA7, 0xB0, 0x00, 0x00, 0x00, 0x7D, 0x71, 0x8D, 0x7D, 0x01, 0x39, 0xEF, 0x7C, 0x91, 0x01, 0xE9, 0x88, 0x0C, 0x06,
+        0x4D, 0x63, 0x74, 0x24, 0x28, 0x76, 0x1F, 0x41, 0x01, 0x44, 0x24, 0x48, 0x79, 0x49, 0x78, 0x45, 0x46, 0x8B, 0x04, 0x9F, 0x79, 0xB9, 0x7D, 0xCC,
+        0x7F, 0x39, 0x8B, 0x7A, 0x04, 0x7F, 0xF0, 0x41, 0x03, 0x54, 0x24, 0x04, 0x7E, 0xA0, 0x78, 0x96, 0x7E, 0x67, 0x3C, 0x05, 0x8B, 0x5E, 0x08, 0xF7,
+        0xC3, 0x00, 0xFF, 0x03, 0x00, 0xC1, 0xEB, 0x08, 0x3C, 0x07, 0x83, 0xBB, 0xA4, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xE7, 0x08, 0x66, 0x43, 0x0B, 0x5C,
+        0x28, 0x09, 0x81, 0xCB, 0x00, 0x00, 0x04, 0x00, 0x89, 0x59, 0x08, 0x7F, 0xDB, 0x48, 0x09, 0x34, 0xC3, 0x4C, 0x09, 0x14, 0x33, 0x79, 0x11, 0xB8,
+        0xD0, 0xFF, 0xFF, 0xFF, 0x80, 0x48, 0x38, 0x01, 0x8B, 0x68, 0x38, 0xF6, 0x41, 0x30, 0x01, 0x73, 0x1C, 0x80, 0x44, 0x24, 0x34, 0x01, 0x88, 0x56,
+        0xFF, 0x79, 0xE7, 0x8D, 0x75, 0xFF, 0x66, 0x0F, 0xFA, 0xC3, 0x29, 0x6B, 0x48, 0x7D, 0x3B, 0x39, 0xEA, 0x7F, 0xEF, 0x39, 0x68, 0xFC, 0x7D, 0x2A,
+        0x7F, 0xAE, 0x79, 0xEB, 0x88, 0x47, 0x0A, 0x7E, 0x5A, 0x76, 0x6D, 0x77, 0x63, 0x39, 0x46, 0x40, 0x7E, 0xE4, 0x3C, 0x56, 0x80, 0x4D, 0x0A, 0x40,
+        0x42, 0x83, 0x7C, 0x06, 0x04, 0xFF, 0x43, 0x03, 0x34, 0x81, 0x01, 0x45, 0x38, 0x77, 0xEA, 0x45, 0x39, 0xAC, 0x24, 0x84, 0x00, 0x00, 0x00, 0x66,
+        0x41, 0x81, 0xE0, 0xFF, 0x03, 0xBF, 0x48, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0x80, 0x8D, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x95, 0x3B, 0x68, 0x0C,
+        0x7E, 0x37, 0x7C, 0x37, 0x89, 0x56, 0x38, 0x42, 0x83, 0x3C, 0x91, 0xFF, 0x42, 0x03, 0x4C, 0x95, 0x00, 0x3C, 0x1C, 0x3C, 0x1E, 0x3C, 0x1A, 0x03,
+        0x46, 0x28, 0x89, 0x16, 0xEB, 0x50, 0x41, 0x23, 0xAE, 0x84, 0x00, 0x00, 0x00, 0x39, 0x55, 0x04, 0x8B, 0x6A, 0x04, 0x44, 0x03, 0x20, 0xBD, 0x0C,
+        0x00, 0x00, 0x00, 0x74, 0x8C, 0x41, 0x23, 0x84, 0x24, 0x84, 0x00, 0x00, 0x00, 0xF7, 0x40, 0x08, 0x00, 0xFF, 0x03, 0x00, 0x7E, 0x6B, 0x7F, 0x85,
+        0x7E, 0x98, 0x7E, 0x77, 0x78, 0xD6, 0x7D, 0xCF, 0x7D, 0xC5, 0x7F, 0xA8, 0x41, 0x0F, 0x9E, 0xC6, 0x76, 0xE8, 0x7E, 0x60, 0x7E, 0x32, 0x3B, 0x34,
+        0x01, 0x39, 0xDD, 0x3B, 0x14, 0x06, 0x8B, 0x2C, 0x24, 0xBB, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x87, 0xBB, 0x05, 0x00, 0x00, 0x00, 0x3C, 0x83, 0x7D,
+        0xD7, 0x3B, 0x18, 0x7F, 0x87, 0x74, 0x81, 0x41, 0x2B, 0x5C, 0x24, 0x08, 0xBB, 0x0C, 0x00, 0x00, 0x00, 0x7E, 0x69, 0x4D, 0x03, 0x2E, 0x39, 0x51,
+        0x0C, 0x45, 0x3B, 0x4F, 0x10, 0x7F, 0xBB, 0x78, 0x42, 0x7D, 0x37, 0x7D, 0x29, 0x44, 0x3B, 0x28, 0x7F, 0xE3, 0x3B, 0x47, 0x40, 0x7D, 0x24, 0x7C,
+        0x30, 0x7F, 0xE4, 0x3B, 0x43, 0x40, 0x7D, 0xDF, 0x4D, 0x89, 0xB7, 0x88, 0x00, 0x00, 0x00, 0x41, 0x39, 0x87, 0xA8, 0x00, 0x00, 0x00, 0x4D, 0x03,
+        0xA7, 0x88, 0x00, 0x00, 0x00, 0x78, 0x7E, 0x6A, 0x08, 0x7D, 0x7D, 0x7D, 0x07, 0x01, 0xEE, 0xD1, 0xA3, 0x98, 0x00, 0x00, 0x00, 0x49, 0x03, 0x86,
+        0xA0, 0x00, 0x00, 0x00, 0x45, 0x3B, 0x96, 0x94, 0x00, 0x00, 0x00, 0x01, 0xCB, 0x39, 0x58, 0x0C, 0x6A, 0x09, 0x7D, 0x49, 0x7F, 0xA1, 0x4B, 0x63,
+        0x44, 0x77, 0x04, 0x66, 0x42, 0x0F, 0xEB, 0x84, 0xB4, 0x90, 0x28, 0x00, 0x00, 0x49, 0xF7, 0x01, 0x00, 0x04, 0x00, 0x00, 0xF3, 0x41, 0x0F, 0x6F,
+        0xBC, 0x30, 0xA8, 0x00, 0x00, 0x00, 0x66, 0x0F, 0xDB, 0x04, 0x31, 0x66, 0x0F, 0xDF, 0x0C, 0x01, 0x66, 0x41, 0x0F, 0x6F, 0x44, 0x24, 0x10, 0x66,
+        0x0F, 0xDB, 0x84, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xDB, 0x0C, 0x24, 0x66, 0x41, 0x0F, 0xDF, 0x04, 0x04, 0x66, 0x41, 0x0F, 0x6F,
+        0x04, 0x04, 0x41, 0x0F, 0x29, 0x74, 0x24, 0x10, 0x66, 0x0F, 0xEB, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x81, 0xA4, 0x24, 0x90, 0x00, 0x00,
+        0x00, 0xFF, 0xFB, 0xFF, 0xFF, 0x48, 0x83, 0xA4, 0x24, 0x90, 0x00, 0x00, 0x00, 0xFE, 0x66, 0x0F, 0xDF, 0x8C, 0x24, 0x90, 0x00, 0x00, 0x00, 0x4C,
+        0x23, 0x02, 0x4C, 0x23, 0x84, 0x2B, 0xA8, 0x00, 0x00, 0x00, 0x49, 0x23, 0x00, 0x8B, 0x96, 0x80, 0x00, 0x00, 0x00, 0x41, 0x89, 0xB4, 0x24, 0x80,
+        0x00, 0x00, 0x00, 0x80, 0x62, 0x3A, 0xF3, 0x48, 0x29, 0x84, 0x24, 0xC0, 0x02, 0x00, 0x00, 0x8B, 0x52, 0x0C, 0x66, 0x0F, 0xD6, 0x94, 0x24, 0xEC,
+        0x01, 0x00, 0x00, 0x0F, 0x95, 0x84, 0x24, 0x10, 0x02, 0x00, 0x00, 0x88, 0x94, 0x24, 0x11, 0x02, 0x00, 0x00, 0x0F, 0x4E, 0x44, 0x24, 0x70, 0x7E,
+        0x55, 0x40, 0x0F, 0x9E, 0xC6, 0x48, 0x0B, 0x44, 0x24, 0x58, 0x39, 0x6C, 0x24, 0x50, 0x79, 0x42, 0x44, 0x3B, 0x94, 0x24, 0xF8, 0x01, 0x00, 0x00,
+        0x44, 0x0F, 0x44, 0x44, 0x24, 0x08, 0x44, 0x39, 0x94, 0x24, 0xF8, 0x01, 0x00, 0x00, 0x44, 0x84, 0xE0, 0x7D, 0xE3, 0x8B, 0xB8, 0x8C, 0x00, 0x00,
+        0x00, 0x3B, 0x84, 0x24, 0xDC, 0x01, 0x00, 0x00, 0x2B, 0x84, 0x24, 0xD8, 0x01, 0x00, 0x00, 0x72, 0xAE, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x4D, 0x03,
+        0x7C, 0x24, 0x28, 0x3C, 0x04, 0x3B, 0x8C, 0x24, 0x2C, 0x02, 0x00, 0x00, 0x39, 0x84, 0x24, 0xC0, 0x02, 0x00, 0x00, 0x3B, 0x55, 0x04, 0x39, 0x1A,
+        0x01, 0xD9, 0x7F, 0xD5, 0x01, 0xFA, 0x89, 0x5A, 0x04, 0x8B, 0xB7, 0x8C, 0x00, 0x00, 0x00, 0x29, 0xDE, 0x48, 0xF7, 0x44, 0x24, 0x18, 0x00, 0x00,
+        0x00, 0x01, 0x01, 0x43, 0x38, 0x89, 0x58, 0x38, 0x8B, 0x09, 0x7F, 0x7D, 0x49, 0x23, 0x96, 0x98, 0x00, 0x00, 0x00, 0x49, 0x09, 0x86, 0x90, 0x00,
+        0x00, 0x00, 0x41, 0x83, 0x86, 0x8C, 0x00, 0x00, 0x00, 0x01, 0x41, 0x80, 0x8E, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x3C, 0x15, 0x4D, 0x63, 0x65, 0x38,
+        0xA9, 0x0F, 0x03, 0x00, 0x00, 0x41, 0x0F, 0xB6, 0x96, 0xA0, 0x00, 0x00, 0x00, 0x41, 0x88, 0x96, 0xA0, 0x00, 0x00, 0x00, 0x3B, 0x72, 0x28, 0x80,
+        0x4A, 0x32, 0x08, 0x74, 0x84, 0x41, 0x80, 0x4F, 0x30, 0x01, 0x48, 0x81, 0x08, 0x00, 0x04, 0x00, 0x00, 0x01, 0x48, 0x38, 0x79, 0x6B, 0x79, 0xD7,
+        0x45, 0x3A, 0x3C, 0x04, 0x01, 0x46, 0x38, 0x38, 0x1C, 0x16, 0x38, 0x4B, 0x01, 0x29, 0x48, 0x38, 0x4C, 0x09, 0x92, 0xA8, 0x00, 0x00, 0x00, 0x49,
+        0x09, 0x84, 0x24, 0x98, 0x00, 0x00, 0x00, 0x80, 0x67, 0x38, 0x90, 0x73, 0xF4, 0x8D, 0x6E, 0xFF, 0x88, 0x83, 0xA0, 0x00, 0x00, 0x00, 0xB9, 0x0D,
+        0x00, 0x00, 0x00, 0x03, 0x84, 0x24, 0x8C, 0x00, 0x00, 0x00, 0x01, 0x84, 0x24, 0x98, 0x00, 0x00, 0x00, 0x08, 0xCA, 0x39, 0x04, 0x87, 0x8B, 0x69,
+        0x38, 0x41, 0x80, 0x8C, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x41, 0xF6, 0x84, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x42, 0x39, 0x6C, 0x38, 0x04,
+        0x20, 0xD0, 0x89, 0xB3, 0x88, 0x00, 0x00, 0x00, 0x49, 0x21, 0x94, 0x24, 0x90, 0x00, 0x00, 0x00, 0x89, 0x68, 0x04, 0xBE, 0xE0, 0x00, 0x00, 0x00,
+        0x80, 0xA3, 0xA0, 0x00, 0x00, 0x00, 0xFB, 0xC6, 0x46, 0x08, 0x07, 0x80, 0x66, 0x0A, 0xDF, 0x49, 0x39, 0x74, 0x24, 0x48, 0x46, 0x8D, 0x2C, 0x01,
+        0x79, 0x09, 0xC0, 0xEB, 0x05, 0xBB, 0xFE, 0xFF, 0xFF, 0xFF, 0xD0, 0xE8, 0x49, 0x81, 0xCD, 0x00, 0x01, 0x00, 0x00, 0xBB, 0x08, 0x00, 0x00, 0x00,
+        0x80, 0x0D, 0x65, 0xF7, 0x0E, 0x00, 0x80, 0x7F, 0x68, 0x41, 0x51, 0x79, 0x34, 0x73, 0x9F, 0xBF, 0xED, 0x00, 0x00, 0x00, 0xBF, 0xEE, 0x00, 0x00,
+        0x00, 0xB8, 0x2A, 0x00, 0x00, 0x00, 0xBE, 0x29, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xB1, 0x00, 0x00, 0x00, 0xBF, 0x7D, 0x00,
+        0x00, 0x00, 0xBF, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x21, 0x00, 0x00, 0x00, 0xB9, 0x12, 0x00, 0x00, 0x00, 0xB8, 0x12, 0x00, 0x00, 0x00, 0xB8, 0x33,
+        0x00, 0x00, 0x00, 0xBE, 0x32, 0x00, 0x00, 0x00, 0xBE, 0x3E, 0x00, 0x00, 0x00, 0xB9, 0x2B, 0x00, 0x00, 0x00, 0xBE, 0x13, 0x00, 0x00, 0x00, 0xBE,
+        0x0F, 0x00, 0x00, 0x00, 0xB8, 0x21, 0x00, 0x00, 0x00, 0xB9, 0x11, 0x00, 0x00, 0x00, 0xBE, 0x28, 0x00, 0x00, 0x00, 0xB9, 0x15, 0x00, 0x00, 0x00,
+        0x8B, 0x2E, 0x7D, 0x65, 0x7D, 0x58, 0x7C, 0xAF, 0x88, 0x55, 0x94, 0x81, 0x7D, 0x94, 0x00, 0x10, 0x00, 0x00, 0x7E, 0x74, 0x41, 0x83, 0x01, 0x01,
+        0x7E, 0x04, 0x7D, 0x04, 0x66, 0x0F, 0xD6, 0x05, 0x4E, 0xD4, 0x0E, 0x00, 0xB8, 0x8E, 0x00, 0x00, 0x00, 0xB8, 0x92, 0x00, 0x00, 0x00, 0xB8, 0x93,
+        0x00, 0x00, 0x00, 0xB8, 0x94, 0x00, 0x00, 0x00, 0x72, 0x08, 0x72, 0x07, 0x76, 0x48, 0x77, 0xCB, 0x32, 0x10, 0x85, 0xD0, 0x76, 0x5D, 0x41, 0x08,
+        0x45, 0x00, 0x41, 0x0F, 0x94, 0x46, 0x19, 0x89, 0x69, 0xFC, 0x21, 0xF1, 0x3B, 0x0A, 0x3B, 0x48, 0xF4, 0xEB, 0x6E, 0x3B, 0x42, 0x04, 0x89, 0x79,
+        0x2C, 0x39, 0x54, 0x81, 0x08, 0x33, 0x78, 0x04, 0x2A, 0x4D, 0x27, 0x0F, 0xCF, 0x33, 0x75, 0x0C, 0x2A, 0x4B, 0x27, 0x85, 0xF8, 0x85, 0xD7, 0x85,
+        0xCE, 0x33, 0x74, 0x93, 0x10, 0x85, 0xF1, 0x79, 0xB5, 0xBA, 0x65, 0x06, 0x00, 0x00, 0xBA, 0x84, 0x06, 0x00, 0x00, 0xBA, 0x83, 0x06, 0x00, 0x00,
+        0x44, 0x0B, 0xBC, 0x24, 0x84, 0x00, 0x00, 0x00, 0x81, 0xBC, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x44, 0x23, 0xBC, 0x24, 0x8C,
+        0x00, 0x00, 0x00, 0x08, 0x54, 0x24, 0x27, 0x23, 0x84, 0x24, 0x8C, 0x00, 0x00, 0x00, 0x89, 0x6A, 0x08, 0x08, 0x44, 0x24, 0x27, 0x3B, 0x16, 0x89,
+        0x72, 0x08, 0xF7, 0x43, 0x04, 0xFD, 0xFF, 0xFF, 0xFF, 0x66, 0x44, 0x89, 0x78, 0x30, 0x66, 0x0F, 0x6E, 0x9D, 0x10, 0xF9, 0xFF, 0xFF, 0x39, 0x42,
+        0x10, 0x41, 0x3B, 0x0F, 0x41, 0x83, 0xD5, 0x00, 0xEB, 0x7E, 0xB8, 0xFD, 0xFF, 0xFF, 0xFF, 0x8B, 0x72, 0x14, 0xBA, 0x69, 0x03, 0x00, 0x00, 0xBA,
+        0xFB, 0x09, 0x00, 0x00, 0x64, 0x4C, 0x03, 0x0C, 0x25, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x64, 0x00, 0x00, 0x00, 0x3C, 0x28, 0x77, 0xE6, 0xEB, 0x63,
+        0xB9, 0x7E, 0x00, 0x00, 0x00, 0xB9, 0x24, 0x00, 0x00, 0x00, 0x48, 0x0F, 0x44, 0x44, 0x24, 0x18, 0x47, 0x88, 0x34, 0x3C, 0x83, 0x54, 0x24, 0x38,
+        0x00, 0xBA, 0xB1, 0x05, 0x00, 0x00, 0xBF, 0x65, 0x00, 0x00, 0x00, 0xB9, 0x5C, 0x00, 0x00, 0x00, 0x3C, 0x22, 0x7E, 0x92, 0x72, 0xD8, 0xB9, 0x29,
+        0x00, 0x00, 0x00, 0x77, 0x19, 0xF6, 0x84, 0x24, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x2D, 0x00, 0x00, 0x00, 0x7E, 0xE6, 0x3C, 0x60, 0x3C, 0x24,
+        0xEB, 0x55, 0xBA, 0x7E, 0x01, 0x00, 0x00, 0x3B, 0x13, 0x3B, 0x0B, 0x3B, 0x17, 0x4B, 0x83, 0x7C, 0xF7, 0xF8, 0x00, 0xB9, 0x2A, 0x00, 0x00, 0x00,
+        0xB9, 0x13, 0x00, 0x00, 0x00, 0x48, 0x23, 0x4B, 0x08, 0x77, 0x7C, 0xB8, 0xB4, 0x01, 0x00, 0x00, 0x78, 0xA2, 0x89, 0xB7, 0x0C, 0x01, 0x00, 0x00,
+        0x89, 0x87, 0x08, 0x01, 0x00, 0x00, 0x01, 0xCF, 0x77, 0xD3, 0xB9, 0x1F, 0x00, 0x00, 0x00, 0x30, 0xC0, 0xB8, 0x4C, 0x01, 0x00, 0x00, 0xB8, 0x89,
+        0x00, 0x00, 0x00, 0xB8, 0x8A, 0x00, 0x00, 0x00, 0xB8, 0x5A, 0x00, 0x00, 0x00, 0xB8, 0x5B, 0x00, 0x00, 0x00, 0xB8, 0x53, 0x00, 0x00, 0x00, 0x77,
+        0x5B, 0xB8, 0x15, 0x00, 0x00, 0x00, 0xB8, 0xB7, 0x01, 0x00, 0x00, 0x0B, 0x02, 0xB8, 0x48, 0x00, 0x00, 0x00, 0x76, 0xCC, 0xB8, 0x49, 0x00, 0x00,
+        0x00, 0x77, 0x36, 0xB8, 0x55, 0x00, 0x00, 0x00, 0xB8, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x51, 0x00, 0x00, 0x00, 0x4C, 0x0F, 0x43, 0xC5, 0xBB, 0x22,
+        0x00, 0x00, 0x00, 0xB8, 0x5D, 0x00, 0x00, 0x00, 0xB8, 0x5E, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x56, 0x00, 0x00, 0x00, 0xB8,
+        0x59, 0x00, 0x00, 0x00, 0xB8, 0x57, 0x00, 0x00, 0x00, 0xBA, 0x32, 0x02, 0x00, 0x00, 0x44, 0x0F, 0x46, 0xF0, 0x8D, 0xB4, 0x30, 0x00, 0x01, 0x00,
+        0x00, 0x7C, 0x7A, 0x09, 0xD7, 0x79, 0x18, 0x8D, 0x58, 0x01, 0x66, 0x03, 0x44, 0x24, 0x08, 0x39, 0x45, 0x2C, 0x66, 0x41, 0x83, 0x7C, 0x24, 0x60,
+        0x00, 0x81, 0x4D, 0x40, 0x00, 0x02, 0x00, 0x00, 0x66, 0x41, 0x83, 0x4C, 0x24, 0x64, 0x01, 0xBB, 0x07, 0x00, 0x00, 0x00, 0x79, 0xE4, 0x66, 0x83,
+        0x4B, 0x64, 0x01, 0x78, 0xD7, 0xB8, 0xDD, 0x00, 0x00, 0x00, 0x78, 0x76, 0x78, 0x62, 0x78, 0x7D, 0x7C, 0x4C, 0x49, 0xF7, 0xFE, 0xB8, 0x1D, 0x01,
+        0x00, 0x00, 0xB8, 0x46, 0x01, 0x00, 0x00, 0x77, 0x42, 0x78, 0x08, 0x39, 0x18, 0x81, 0xCA, 0x00, 0x00, 0x00, 0x80, 0xA9, 0x80, 0x01, 0x00, 0x00,
+        0xA8, 0x30, 0x74, 0x95, 0x77, 0x72, 0x66, 0x0F, 0x6A, 0xC0, 0x25, 0x14, 0xFA, 0xFF, 0xFF, 0x79, 0x6D, 0xB8, 0x2E, 0x01, 0x00, 0x00, 0xB8, 0x62,
+        0x00, 0x00, 0x00, 0x8D, 0x5F, 0xFF, 0x6B, 0x04, 0x24, 0x3C, 0x6B, 0x44, 0x24, 0x10, 0x3C, 0x03, 0x44, 0x24, 0x30, 0xB8, 0x8C, 0x00, 0x00, 0x00,
+        0xB8, 0x8D, 0x00, 0x00, 0x00, 0x78, 0x46, 0x7E, 0x25, 0x78, 0xD8, 0x77, 0x5A, 0xB8, 0x47, 0x01, 0x00, 0x00, 0x79, 0x4A, 0x78, 0x03, 0x72, 0x64,
+        0xB8, 0xAA, 0x00, 0x00, 0x00, 0xB8, 0xAB, 0x00, 0x00, 0x00, 0x69, 0xFA, 0xE8, 0x03, 0x00, 0x00, 0xB8, 0xA3, 0x00, 0x00, 0x00, 0xB8, 0xA1, 0x00,
+        0x00, 0x00, 0xB8, 0x4A, 0x00, 0x00, 0x00, 0xB8, 0xA2, 0x00, 0x00, 0x00, 0xB8, 0x4B, 0x00, 0x00, 0x00, 0xB8, 0x32, 0x01, 0x00, 0x00, 0xBE, 0x69,
+        0x19, 0x12, 0x28, 0xB8, 0xA9, 0x00, 0x00, 0x00, 0x72, 0xF0, 0xC1, 0xC0, 0x10, 0xBE, 0x41, 0x02, 0x00, 0x00, 0xB8, 0x99, 0x00, 0x00, 0x00, 0xB8,
+        0xA7, 0x00, 0x00, 0x00, 0xB8, 0xA8, 0x00, 0x00, 0x00, 0x79, 0x03, 0x69, 0x44, 0x24, 0x30, 0x40, 0x42, 0x0F, 0x00, 0xB8, 0x65, 0x00, 0x00, 0x00,
+        0x78, 0x06, 0xBF, 0xC0, 0x1F, 0x00, 0x00, 0xB9, 0xC0, 0x1F, 0x00, 0x00, 0x72, 0xC4, 0xB8, 0x4D, 0x00, 0x00, 0x00, 0xBE, 0x64, 0x00, 0x00, 0x00,
+        0x83, 0x25, 0x24, 0xB0, 0x0D, 0x00, 0xFE, 0x89, 0x35, 0x5E, 0xA8, 0x0D, 0x00, 0x0F, 0xA3, 0xC1, 0x0B, 0x1D, 0x23, 0x26, 0x0D, 0x00, 0xBE, 0x11,
+        0x00, 0x00, 0x00, 0x7F, 0x33, 0x8B, 0x2D, 0x61, 0x1C, 0x0D, 0x00, 0x48, 0x81, 0x7C, 0x24, 0x28, 0x03, 0x01, 0x00, 0x00, 0xB8, 0x1A, 0x00, 0x00,
+        0x00, 0xB8, 0x1B, 0x00, 0x00, 0x00, 0xB8, 0xD8, 0x00, 0x00, 0x00, 0xB8, 0x95, 0x00, 0x00, 0x00, 0xB8, 0x96, 0x00, 0x00, 0x00, 0xB8, 0x97, 0x00,
+        0x00, 0x00, 0xB8, 0x98, 0x00, 0x00, 0x00, 0x21, 0xFE, 0xBD, 0xCD, 0xFE, 0xFF, 0xFF, 0x89, 0x3A, 0x01, 0x2B, 0x7E, 0xB6, 0xDD, 0x05, 0x8A, 0xED,
+        0x09, 0x00, 0xDD, 0xDB, 0xD9, 0xC2, 0xD8, 0xCA, 0xDE, 0xF9, 0xBD, 0xBD, 0xEC, 0xFF, 0xFF, 0xD9, 0xC1, 0xDF, 0xF2, 0xDB, 0xF2, 0xD9, 0xCB, 0xDB,
+        0xF3, 0xD8, 0xC9, 0x73, 0xEF, 0xD9, 0xC3, 0x77, 0xEF, 0x72, 0x72, 0x69, 0xC6, 0xAB, 0xAA, 0xAA, 0xAA, 0x3D, 0x55, 0x55, 0x55, 0x55, 0x76, 0x4B,
+        0x72, 0x04, 0x76, 0x54, 0x48, 0x83, 0x61, 0x08, 0xFE, 0x78, 0x1D, 0x79, 0x97, 0x77, 0x97, 0x76, 0x6F, 0xF6, 0x42, 0x08, 0x01, 0x76, 0xD2, 0x76,
+        0x7D, 0x76, 0x71, 0x78, 0x33, 0x7E, 0xB2, 0x39, 0x0D, 0xE8, 0x78, 0x0D, 0x00, 0xB8, 0x88, 0x00, 0x00, 0x00, 0xBA, 0x67, 0x00, 0x00, 0x00, 0x29,
+        0xDD, 0x73, 0xAA, 0x83, 0xD3, 0x00, 0xD1, 0xEB, 0x77, 0xF0, 0x7E, 0x2E, 0x78, 0x3B, 0xF2, 0x48, 0x0F, 0x2A, 0xC2, 0xB8, 0xC1, 0x00, 0x00, 0x00,
+        0xB8, 0xC4, 0x00, 0x00, 0x00, 0xB8, 0xC7, 0x00, 0x00, 0x00, 0xB8, 0xBE, 0x00, 0x00, 0x00, 0xB8, 0xBF, 0x00, 0x00, 0x00, 0xB8, 0xC2, 0x00, 0x00,
+        0x00, 0xB8, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0xC3, 0x00, 0x00, 0x00, 0xB8, 0xC6, 0x00, 0x00, 0x00, 0xB8, 0xBD, 0x00, 0x00, 0x00, 0xB8, 0xC5, 0x00,
+        0x00, 0x00, 0x0F, 0x94, 0x43, 0x40, 0x88, 0x93, 0xA0, 0x00, 0x00, 0x00, 0x88, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x79, 0x12, 0x79, 0x14, 0x25, 0x28,
+        0x09, 0x00, 0x00, 0x80, 0x60, 0x10, 0x01, 0xFF, 0xD6, 0x78, 0x3A, 0x49, 0xC1, 0xC5, 0x11, 0xBA, 0x4F, 0x00, 0x00, 0x00, 0x7F, 0x08, 0xB8, 0xAD,
+        0x00, 0x00, 0x00, 0xB8, 0xAC, 0x00, 0x00, 0x00, 0x7C, 0x13, 0xB8, 0xA6, 0x00, 0x00, 0x00, 0xB8, 0xBB, 0x00, 0x00, 0x00, 0xB8, 0x7A, 0x00, 0x00,
+        0x00, 0xB8, 0x7B, 0x00, 0x00, 0x00, 0xB8, 0xB9, 0x01, 0x00, 0x00, 0xB8, 0x87, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xEE, 0x0F, 0x01, 0xEF, 0xB8, 0x1F,
+        0x01, 0x00, 0x00, 0xB8, 0x9D, 0x00, 0x00, 0x00, 0xB8, 0x37, 0x01, 0x00, 0x00, 0xB8, 0x31, 0x01, 0x00, 0x00, 0x39, 0xFD, 0xB8, 0xB3, 0x01, 0x00,
+        0x00, 0x7C, 0x18, 0xBE, 0x58, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x16, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0xB8, 0x9A, 0x00, 0x00, 0x00, 0xB8, 0x7D, 0x00,
+        0x00, 0x00, 0xB8, 0x7E, 0x00, 0x00, 0x00, 0xB8, 0xAE, 0x00, 0x00, 0x00, 0xB8, 0xB0, 0x00, 0x00, 0x00, 0xB8, 0xD5, 0x00, 0x00, 0x00, 0xB8, 0xE9,
+        0x00, 0x00, 0x00, 0xB8, 0xAF, 0x01, 0x00, 0x00, 0xB8, 0xB1, 0x01, 0x00, 0x00, 0xB8, 0x67, 0x00, 0x00, 0x00, 0xB8, 0xA5, 0x00, 0x00, 0x00, 0xB8,
+        0xB2, 0x01, 0x00, 0x00, 0xB8, 0xB6, 0x01, 0x00, 0x00, 0xB8, 0x9B, 0x00, 0x00, 0x00, 0xB8, 0xB8, 0x01, 0x00, 0x00, 0xB8, 0x86, 0x00, 0x00, 0x00,
+        0xB8, 0x34, 0x01, 0x00, 0x00, 0xBA, 0x15, 0x00, 0x00, 0x00, 0x77, 0xC7, 0xB8, 0x2B, 0x00, 0x00, 0x00, 0x79, 0xCF, 0xB8, 0x44, 0x00, 0x00, 0x00,
+        0xA9, 0x0E, 0x20, 0x1F, 0x00, 0xA9, 0x01, 0xD8, 0x00, 0x00, 0xB8, 0xDC, 0x00, 0x00, 0x00, 0xB8, 0x43, 0x00, 0x00, 0x00, 0xBA, 0xB6, 0x01, 0x00,
+        0x00, 0xBA, 0x2C, 0x01, 0x00, 0x00, 0x76, 0x1C, 0xBD, 0xB0, 0x04, 0x00, 0x00, 0xF3, 0x49, 0x0F, 0x2A, 0xC5, 0xF3, 0x0F, 0x2A, 0xCB, 0xF3, 0x0F,
+        0x5E, 0xC1, 0xF3, 0x0F, 0x2C, 0xC0, 0xF3, 0x48, 0x0F, 0x2A, 0xC0, 0x73, 0x43, 0x72, 0x23, 0x66, 0x83, 0x04, 0x42, 0x01, 0x78, 0x54, 0x73, 0xD9,
+        0x73, 0x6E, 0x66, 0x83, 0x00, 0x01, 0x72, 0x35, 0x45, 0x3B, 0x26, 0x72, 0xAB, 0xEB, 0x7D, 0x48, 0xF7, 0xB5, 0xF8, 0xFE, 0xFF, 0xFF, 0x78, 0xC6,
+        0x78, 0xAF, 0x23, 0x4E, 0x0C, 0x23, 0x46, 0x10, 0x03, 0x3C, 0x08, 0xD3, 0xEE, 0xD3, 0xEF, 0x23, 0x4A, 0x0C, 0x23, 0x72, 0x10, 0x03, 0x04, 0x0A,
+        0x41, 0x03, 0xAE, 0xC0, 0x00, 0x00, 0x00, 0x23, 0x42, 0x10, 0x3B, 0x56, 0x04, 0x76, 0x61, 0x76, 0x59, 0x78, 0x38, 0x78, 0xBE, 0x7F, 0x1E, 0x78,
+        0x6E, 0x73, 0x7B, 0x01, 0x44, 0x24, 0x08, 0x77, 0xF1, 0x72, 0x9A, 0x74, 0x9F, 0x7E, 0xCF, 0x73, 0x56, 0x72, 0x2D, 0xBE, 0x96, 0x00, 0x00, 0x00,
+        0x0B, 0x6E, 0x18, 0x44, 0x0B, 0x7C, 0x24, 0x04, 0x0B, 0x46, 0x18, 0x41, 0x0B, 0x45, 0x18, 0x31, 0xF8, 0x7C, 0xF7, 0x44, 0x2B, 0x0C, 0x01, 0x49,
+        0x2B, 0x44, 0x24, 0x30, 0x73, 0x59, 0x44, 0x3A, 0x0E, 0x88, 0x07, 0xBA, 0xBB, 0x01, 0x00, 0x00, 0xBA, 0xC5, 0x01, 0x00, 0x00, 0x7F, 0x74, 0xBA,
+        0xC8, 0x00, 0x00, 0x00, 0x66, 0x41, 0xF7, 0xC0, 0x00, 0x20, 0x83, 0x4D, 0x84, 0x02, 0x72, 0x3E, 0x79, 0xC5, 0x41, 0x0F, 0x16, 0x44, 0x24, 0x08,
+        0x72, 0xBA, 0x73, 0xB9, 0x3B, 0x53, 0x1C, 0xBD, 0x07, 0x00, 0x00, 0x00, 0xBD, 0x06, 0x00, 0x00, 0x00, 0x46, 0x88, 0x0C, 0x01, 0x76, 0x7E, 0x88,
+        0x46, 0x01, 0x72, 0x75, 0x09, 0xD5, 0x7F, 0x4D, 0x72, 0x54, 0x46, 0x89, 0x0C, 0x81, 0x76, 0x6E, 0x78, 0x14, 0xF7, 0x44, 0x24, 0xF0, 0x01, 0x00,
+        0x00, 0x00, 0x77, 0xD6, 0x79, 0x20, 0xBE, 0x12, 0x00, 0x00, 0x00, 0x77, 0x6C, 0x7F, 0x7C, 0x49, 0x33, 0x46, 0x08, 0x49, 0x33, 0x16, 0x6A, 0x02,
+        0x7F, 0x69, 0x41, 0x0F, 0x46, 0xCB, 0xB9, 0x2E, 0x00, 0x00, 0x00, 0x78, 0xBB, 0x66, 0x44, 0x89, 0x9C, 0x24, 0x94, 0x00, 0x00, 0x00, 0x44, 0x0F,
+        0xB7, 0xA4, 0x24, 0xD2, 0x00, 0x00, 0x00, 0x66, 0x41, 0xC1, 0xC4, 0x08, 0x66, 0x41, 0x81, 0xEC, 0x00, 0x02, 0x79, 0x4E, 0x78, 0xB2, 0x66, 0x83,
+        0x7C, 0x24, 0x2E, 0x00, 0x77, 0xB7, 0x76, 0x46, 0x66, 0x83, 0x3E, 0x02, 0x66, 0x83, 0x3D, 0x63, 0xCC, 0x0B, 0x00, 0x00, 0x78, 0xA9, 0x66, 0x81,
+        0x3D, 0x77, 0x40, 0x0B, 0x00, 0x00, 0x02, 0xBD, 0x58, 0x00, 0x00, 0x00, 0x66, 0xC1, 0xF9, 0x0F, 0x66, 0x05, 0x58, 0x02, 0x73, 0x63, 0xB8, 0xF6,
+        0xFF, 0xFF, 0xFF, 0xB9, 0x25, 0x00, 0x00, 0x00, 0xBE, 0x33, 0x89, 0x00, 0x00, 0x76, 0x40, 0x77, 0xB9, 0x39, 0x7B, 0x0C, 0x39, 0x4B, 0x08, 0x72,
+        0x4A, 0x77, 0xAE, 0x78, 0x79, 0xBE, 0x16, 0x00, 0x00, 0x00, 0x4C, 0x69, 0xCF, 0xB8, 0x00, 0x00, 0x00, 0x25, 0xFC, 0xFF, 0x01, 0x00, 0x49, 0x69,
+        0xD2, 0xB8, 0x00, 0x00, 0x00, 0x66, 0x45, 0x89, 0x1A, 0x66, 0x41, 0x89, 0xBC, 0x24, 0x80, 0x00, 0x00, 0x00, 0x41, 0x0F, 0x47, 0xF8, 0xD3, 0xE7,
+        0x66, 0x41, 0x89, 0x8D, 0x80, 0x00, 0x00, 0x00, 0x4A, 0xC7, 0x44, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x42, 0xC7, 0x44, 0x00, 0xFE, 0xFF,
+        0xFF, 0x76, 0x7C, 0x72, 0x3B, 0x73, 0xE9, 0x46, 0x8D, 0x3C, 0xA5, 0x10, 0x00, 0x00, 0x00, 0x81, 0xC3, 0x90, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72,
+        0x3C, 0x42, 0x0F, 0x11, 0x54, 0x0E, 0x08, 0xBA, 0x31, 0x00, 0x00, 0x00, 0x72, 0x30, 0x69, 0xC9, 0xE8, 0x03, 0x00, 0x00, 0x7C, 0x62, 0x7F, 0x71,
+        0x7E, 0xF3, 0x05, 0xE8, 0x03, 0x00, 0x00, 0xBA, 0xF5, 0xFF, 0xFF, 0xFF, 0xBA, 0xF6, 0xFF, 0xFF, 0xFF, 0x3D, 0x80, 0x00, 0x00, 0x00, 0x66, 0x44,
+        0x89, 0x95, 0x52, 0xFF, 0xFF, 0xFF, 0x3B, 0x03, 0x39, 0x79, 0x08, 0x8A, 0x71, 0x11, 0x3D, 0x7F, 0x00, 0x00, 0x01, 0x72, 0x78, 0x39, 0x7A, 0x08,
+        0x41, 0x0F, 0x97, 0xC1, 0xBE, 0xA0, 0x00, 0x00, 0x00, 0xB8, 0xA0, 0x00, 0x00, 0x00, 0x78, 0x39, 0x44, 0x0F, 0xB7, 0x6C, 0x24, 0x10, 0x41, 0x0F,
+        0xBF, 0x0E, 0x66, 0x41, 0x39, 0xCD, 0x40, 0x0F, 0x93, 0xC6, 0x8D, 0x14, 0xD5, 0x02, 0x00, 0x00, 0x00, 0x01, 0xF3, 0x66, 0x83, 0xBC, 0x24, 0x52,
+        0x01, 0x00, 0x00, 0x01, 0x79, 0x5D, 0x7F, 0xAF, 0x66, 0x0F, 0xC5, 0xF8, 0x00, 0xF2, 0x0F, 0x70, 0xC8, 0xE1, 0x66, 0x39, 0xCF, 0x23, 0x16, 0x8B,
+        0x2A, 0x41, 0x81, 0x7C, 0x24, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0x45, 0x8D, 0x88, 0x80, 0xFE, 0xFF, 0xFF, 0x66, 0x45, 0x85, 0xE4, 0x29, 0x44, 0x24,
+        0x08, 0x76, 0xD6, 0x76, 0x7A, 0x78, 0x4C, 0x76, 0xB6, 0x72, 0xB8, 0x78, 0x95, 0xD1, 0xF9, 0x39, 0xF5, 0x79, 0x4C, 0x78, 0xB5, 0x77, 0xBD, 0x72,
+        0x9E, 0xBD, 0x29, 0x00, 0x00, 0x00, 0xBB, 0x64, 0x00, 0x00, 0x00, 0x76, 0xCD, 0x40, 0xF6, 0xE5, 0x41, 0xF6, 0xE3, 0x7E, 0x12, 0x7E, 0xDE, 0x72,
+        0x98, 0x8D, 0x5A, 0xBF, 0x8D, 0x7C, 0x0F, 0xD0, 0xA8, 0xC0, 0x7F, 0xBE, 0x7C, 0xDA, 0x7D, 0xAD, 0x66, 0x0F, 0x71, 0xD0, 0x08, 0x66, 0x0F, 0x71,
+        0xF1, 0x08, 0x7C, 0x23, 0x7F, 0xC0, 0x78, 0x16, 0x83, 0xA5, 0xF8, 0x01, 0x00, 0x00, 0xFC, 0x7F, 0xCB, 0x78, 0xC7, 0x66, 0x0B, 0x44, 0x24, 0x28,
+        0x66, 0x09, 0xC8, 0x7E, 0xE8, 0x66, 0xC7, 0x44, 0x24, 0x2A, 0x00, 0x00, 0x3B, 0x77, 0x10, 0x09, 0x6A, 0x40, 0x21, 0x6A, 0x40, 0x79, 0x0E, 0x84,
+        0xD1, 0x79, 0x35, 0x78, 0xCB, 0x31, 0xCA, 0xBE, 0x1B, 0x89, 0x00, 0x00, 0x78, 0x9A, 0xA8, 0xDF, 0xBA, 0x0F, 0x00, 0x00, 0x00, 0x21, 0xCA, 0x08,
+        0xC1, 0x79, 0x17, 0x7E, 0xDD, 0x78, 0xB4, 0x7F, 0x45, 0x72, 0x56, 0x79, 0x9C, 0x89, 0x96, 0xF0, 0x01, 0x00, 0x00, 0xBA, 0xDC, 0x00, 0x00, 0x00,
+        0xBA, 0xD9, 0x00, 0x00, 0x00, 0x09, 0x7C, 0x24, 0x50, 0x7F, 0x1D, 0x81, 0x7E, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xCA, 0x41, 0x83, 0xA5, 0xF8,
+        0x01, 0x00, 0x00, 0xFE, 0x80, 0x4E, 0x02, 0x02, 0x66, 0x41, 0x2B, 0x08, 0xBA, 0xBA, 0x02, 0x00, 0x00, 0x42, 0x8B, 0xB4, 0xA3, 0x08, 0x02, 0x00,
+        0x00, 0x79, 0x82, 0x79, 0x96, 0xF7, 0x7F, 0x10, 0x0F, 0x94, 0x84, 0x24, 0x86, 0x00, 0x00, 0x00, 0x69, 0x4C, 0x24, 0x10, 0xE8, 0x03, 0x00, 0x00,
+        0x48, 0x2B, 0x9C, 0x24, 0xE0, 0x00, 0x00, 0x00, 0x39, 0x9C, 0x24, 0xB8, 0x01, 0x00, 0x00, 0x49, 0x83, 0xBE, 0x80, 0x01, 0x00, 0x00, 0x00, 0x41,
+        0x81, 0x8E, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA8, 0x38, 0xBA, 0x73, 0x04, 0x00, 0x00, 0x41, 0x0F, 0xB7, 0x86, 0x00, 0x02, 0x00,
+        0x00, 0x66, 0x41, 0x83, 0x3F, 0x00, 0x66, 0x45, 0x89, 0x86, 0x00, 0x02, 0x00, 0x00, 0xF3, 0x43, 0x0F, 0x6F, 0x44, 0x3E, 0x14, 0x43, 0xC7, 0x84,
+        0xA6, 0x08, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x43, 0x83, 0x7C, 0x3E, 0x14, 0x00, 0x33, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0xB9,
+        0xAB, 0xAA, 0xAA, 0xAA, 0x4E, 0x8B, 0x6C, 0xE3, 0x48, 0x39, 0xBC, 0xC3, 0x90, 0x01, 0x00, 0x00, 0xBA, 0xA6, 0x00, 0x00, 0x00, 0x48, 0x33, 0x93,
+        0x30, 0x02, 0x00, 0x00, 0x72, 0xBE, 0xBA, 0x94, 0x01, 0x00, 0x00, 0x41, 0x80, 0xA7, 0x89, 0x01, 0x00, 0x00, 0xFE, 0xBA, 0x27, 0x02, 0x00, 0x00,
+        0x72, 0x21, 0xBA, 0xA2, 0x00, 0x00, 0x00, 0x64, 0x48, 0x83, 0x7D, 0x00, 0x00, 0xBA, 0xE5, 0x00, 0x00, 0x00, 0xBA, 0xE6, 0x00, 0x00, 0x00, 0x64,
+        0x49, 0xC7, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x9B, 0xFF, 0xFF, 0xFF, 0x66, 0x0F, 0xD4, 0x45, 0xB0, 0x39, 0xD3, 0x7F, 0xA9, 0xBA, 0x61,
+        0x00, 0x00, 0x00, 0x77, 0x5E, 0x83, 0x3E, 0xFF, 0xBF, 0x0C, 0x00, 0x00, 0x00, 0x69, 0xF6, 0x3F, 0x00, 0x01, 0x00, 0x76, 0x4E, 0x78, 0x05, 0xBA,
+        0x1B, 0x00, 0x00, 0x00, 0x4D, 0x0F, 0xBE, 0x65, 0x01, 0x69, 0xC3, 0xB7, 0x6D, 0xDB, 0xB6, 0xC6, 0x82, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x82,
+        0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xA9, 0x00, 0x00, 0x00, 0xC6, 0x87, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x87, 0x42, 0x08, 0x87,
+        0x47, 0x08, 0x7F, 0x1F, 0x72, 0x77, 0x73, 0x85, 0x72, 0x7D, 0x73, 0x8A, 0x4A, 0xC7, 0x04, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xC7, 0x00, 0x00,
+        0x00, 0x76, 0xA9, 0xBA, 0xB4, 0x01, 0x00, 0x00, 0x73, 0x81, 0x7D, 0x34, 0x49, 0x83, 0x6F, 0x30, 0x02, 0xBD, 0xFE, 0xFF, 0xFF, 0xFF, 0x6A, 0x19,
+        0x68, 0x90, 0x01, 0x00, 0x00, 0x6A, 0x3C, 0xBB, 0x10, 0x00, 0x00, 0x00, 0xBA, 0x11, 0x00, 0x00, 0x00, 0x81, 0x44, 0x24, 0x20, 0xD0, 0x07, 0x00,
+        0x00, 0x78, 0xC8, 0x0B, 0x84, 0x24, 0x50, 0x01, 0x00, 0x00, 0x3D, 0x90, 0x01, 0x00, 0x00, 0x77, 0x56, 0xFF, 0x24, 0xC2, 0x43, 0x0F, 0xB7, 0x44,
+        0x08, 0xFE, 0xBE, 0x70, 0x25, 0x00, 0x00, 0x79, 0x9F, 0x41, 0x0F, 0x4E, 0xC5, 0x7D, 0x11, 0x73, 0xD0, 0x73, 0xCA, 0xBF, 0xA4, 0x0F, 0x00, 0x00,
+        0x0F, 0xCD, 0x77, 0x52, 0x42, 0x0B, 0x94, 0xA0, 0x00, 0x04, 0x00, 0x00, 0x42, 0x0B, 0x14, 0xA0, 0x0B, 0x94, 0x98, 0x00, 0x06, 0x00, 0x00, 0x0B,
+        0x14, 0xA8, 0x46, 0x8B, 0x84, 0x81, 0x00, 0x06, 0x00, 0x00, 0x46, 0x0B, 0x84, 0x89, 0x00, 0x04, 0x00, 0x00, 0x48, 0x33, 0x4C, 0x24, 0x38, 0x45,
+        0x69, 0x26, 0xE8, 0x03, 0x00, 0x00, 0x05, 0x80, 0x81, 0x55, 0x7C, 0x3D, 0x8F, 0x01, 0x00, 0x00, 0x4D, 0x8B, 0x84, 0x24, 0xD0, 0x00, 0x00, 0x00,
+        0x44, 0x0F, 0xBF, 0xD1, 0x81, 0x3C, 0x24, 0x3F, 0x42, 0x0F, 0x00, 0x77, 0x78, 0x3B, 0x70, 0x18, 0x7F, 0xBA, 0x79, 0xF0, 0x69, 0x6F, 0x08, 0xE8,
+        0x03, 0x00, 0x00, 0x01, 0xD5, 0x78, 0xDB, 0xBF, 0x50, 0x01, 0x00, 0x00, 0x78, 0xD4, 0x78, 0xE3, 0xBA, 0xB8, 0x88, 0x00, 0x00, 0x7F, 0xAA, 0x03,
+        0x4C, 0x24, 0x10, 0x2B, 0x4C, 0x24, 0x10, 0x05, 0x40, 0x42, 0x0F, 0x00, 0xBF, 0x88, 0x04, 0x00, 0x00, 0x39, 0x3C, 0xC2, 0xA9, 0x20, 0xFD, 0x03,
+        0x00, 0x25, 0x40, 0x02, 0x00, 0x00, 0x7E, 0x58, 0x44, 0x69, 0x6F, 0x08, 0xE8, 0x03, 0x00, 0x00, 0x78, 0xC1, 0x79, 0x3E, 0x78, 0x9D, 0x49, 0x81,
+        0x7F, 0x28, 0x3F, 0x42, 0x0F, 0x00, 0x77, 0x93, 0x0F, 0x17, 0xBC, 0x24, 0x90, 0x00, 0x00, 0x00, 0x7F, 0x30, 0x49, 0x63, 0x97, 0x98, 0x00, 0x00,
+        0x00, 0x66, 0x39, 0x84, 0x24, 0xC2, 0x01, 0x00, 0x00, 0x83, 0xAC, 0x24, 0xAC, 0x00, 0x00, 0x00, 0x01, 0x68, 0x60, 0x22, 0x00, 0x00, 0xBE, 0xBD,
+        0x86, 0x01, 0x00, 0x6A, 0x1E, 0xB9, 0x0E, 0x00, 0x00, 0x00, 0x7F, 0xED, 0xB9, 0xC3, 0x00, 0x00, 0x00, 0xBE, 0xC3, 0x00, 0x00, 0x00, 0x39, 0x2A,
+        0x39, 0x03, 0x7F, 0xAC, 0x7F, 0x0F, 0x49, 0xF7, 0x75, 0x00, 0x76, 0x37, 0x45, 0x0F, 0x42, 0xE7, 0xBE, 0x60, 0x22, 0x00, 0x00, 0x49, 0x83, 0xBC,
+        0x24, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x76, 0xB9, 0x43, 0x8A, 0x1C, 0x01, 0x88, 0xCF, 0x30, 0x54, 0x07, 0xFF, 0x7F, 0x3D, 0x72, 0x43, 0xF7, 0xE5,
+        0xFF, 0x20, 0x76, 0x1E, 0x72, 0x1F, 0x01, 0x57, 0x28, 0x01, 0x6B, 0x28, 0xF0, 0x41, 0x83, 0x6C, 0x24, 0x18, 0x01, 0x4C, 0x63, 0xBC, 0x24, 0x80,
+        0x00, 0x00, 0x00, 0x7E, 0xBE, 0xBD, 0x22, 0x00, 0x00, 0x00, 0x3B, 0x85, 0x5C, 0xFF, 0xFF, 0xFF, 0x7E, 0x9D, 0x43, 0x80, 0x7C, 0x11, 0xFF, 0x00,
+        0xBA, 0x8E, 0x00, 0x00, 0x00, 0x48, 0x81, 0xBD, 0x60, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0x00, 0x00, 0xBA, 0xF8, 0x00, 0x00, 0x00, 0xBA, 0x13, 0x00,
+        0x00, 0x00, 0xBF, 0x13, 0x00, 0x00, 0x00, 0xBF, 0x14, 0x00, 0x00, 0x00, 0x4C, 0x69, 0x24, 0x24, 0xE8, 0x03, 0x00, 0x00, 0x69, 0xCA, 0xE8, 0x03,
+        0x00, 0x00, 0x72, 0x46, 0x7F, 0x59, 0x49, 0x0F, 0x48, 0xDD, 0x7F, 0x88, 0xBE, 0x88, 0x13, 0x00, 0x00, 0x76, 0x83, 0x72, 0x7B, 0x72, 0x48, 0x72,
+        0xB2, 0x8B, 0x5A, 0x10, 0x03, 0x10, 0x48, 0x81, 0x05, 0x56, 0x4C, 0x09, 0x00, 0x80, 0x01, 0x00, 0x00, 0x48, 0x0F, 0x44, 0x1D, 0x75, 0x70, 0x08,
+        0x00, 0x77, 0xDC, 0x48, 0x81, 0x2D, 0xD5, 0x43, 0x09, 0x00, 0x80, 0x01, 0x00, 0x00, 0xBE, 0x31, 0x54, 0x04, 0x40, 0xBB, 0x80, 0x00, 0x00, 0x00,
+        0xBE, 0x0E, 0x54, 0x00, 0x00, 0x89, 0x97, 0x58, 0x01, 0x00, 0x00, 0x66, 0x83, 0xD0, 0x00, 0xF6, 0x86, 0x36, 0x03, 0x00, 0x00, 0x20, 0x73, 0xE5,
+        0xF3, 0x41, 0x0F, 0x7E, 0x87, 0x80, 0x0A, 0x00, 0x00, 0xFF, 0x30, 0xFF, 0xA0, 0x38, 0x03, 0x00, 0x00, 0x64, 0x87, 0x04, 0x25, 0x1C, 0x00, 0x00,
+        0x00, 0x49, 0x3B, 0xAC, 0x24, 0x70, 0x03, 0x00, 0x00, 0x88, 0x1D, 0xDD, 0x20, 0x09, 0x00, 0x6A, 0x03, 0xBB, 0x19, 0x00, 0x00, 0x00, 0xC5, 0xF9,
+        0x6E, 0xC6, 0xC4, 0xE2, 0x7D, 0x78, 0xC0, 0x3D, 0xE0, 0x0F, 0x00, 0x00, 0xC5, 0xFD, 0x74, 0x0F, 0xC5, 0xFD, 0xD7, 0xC1, 0x76, 0x12, 0xF3, 0x0F,
+        0xBC, 0xC0, 0xC5, 0xFD, 0x74, 0x4F, 0x01, 0xC5, 0xED, 0xEB, 0xE9, 0xC5, 0xDD, 0xEB, 0xF3, 0xC5, 0xCD, 0xEB, 0xED, 0xC5, 0xFD, 0x74, 0x8F, 0x81,
+        0x00, 0x00, 0x00, 0xC4, 0xE2, 0x42, 0xF7, 0xC0, 0xC5, 0xFE, 0x6F, 0x0E, 0xC5, 0xF5, 0x74, 0x0F, 0xC5, 0xFE, 0x6F, 0x56, 0x20, 0xC5, 0xED, 0x74,
+        0x57, 0x20, 0xC5, 0xE5, 0x74, 0x5F, 0x40, 0xC5, 0xDD, 0x74, 0x67, 0x60, 0xFF, 0xC1, 0xC5, 0xFE, 0x6F, 0x4C, 0x16, 0x80, 0xC5, 0xED, 0xDB, 0xE9,
+        0xC5, 0xDD, 0xDB, 0xF3, 0xC5, 0xCD, 0xDB, 0xFD, 0xC5, 0xF5, 0x74, 0x4C, 0x17, 0xC0, 0x76, 0x7B, 0xC5, 0xED, 0x74, 0x17, 0x73, 0x7E, 0x0F, 0x38,
+        0xF0, 0x07, 0x0F, 0x38, 0xF0, 0x7C, 0x17, 0xFC, 0x48, 0x0F, 0x38, 0xF0, 0x07, 0x48, 0x0F, 0x38, 0xF0, 0x44, 0x17, 0xF8, 0xC5, 0xFA, 0x6F, 0x16,
+        0xC5, 0xE9, 0x74, 0x17, 0xC5, 0xF9, 0xD7, 0xC2, 0xC5, 0xFA, 0x6F, 0x54, 0x16, 0xF0, 0xC5, 0xF5, 0x74, 0x4F, 0x80, 0xC5, 0xED, 0x74, 0x54, 0x17,
+        0xE0, 0x2B, 0x06, 0xC5, 0xF1, 0x74, 0x0F, 0xC5, 0xE9, 0x74, 0x54, 0x17, 0xF0, 0xC5, 0xE9, 0xDB, 0xD1, 0x66, 0xF7, 0xD0, 0x2A, 0x4C, 0x16, 0xFF,
+        0x76, 0xAD, 0xC5, 0x7E, 0x6F, 0x44, 0x16, 0x80, 0xC5, 0xFD, 0x7F, 0x0F, 0xC5, 0xFD, 0x7F, 0x57, 0x20, 0x77, 0xCD, 0xC5, 0x7E, 0x7F, 0x02, 0xC4,
+        0xC1, 0x7E, 0x7F, 0x00, 0xC4, 0xC1, 0x7E, 0x7F, 0x48, 0x20, 0xF7, 0x05, 0x9B, 0x78, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC5, 0xFE, 0x6F, 0xA6,
+        0x00, 0x10, 0x00, 0x00, 0xC5, 0xFD, 0xE7, 0x07, 0xC5, 0xFD, 0xE7, 0x4F, 0x20, 0xC5, 0xFD, 0xE7, 0xA7, 0x00, 0x10, 0x00, 0x00, 0x76, 0x55, 0xC5,
+        0x7E, 0x6F, 0x86, 0x00, 0x20, 0x00, 0x00, 0xC5, 0x7D, 0xE7, 0x87, 0x00, 0x20, 0x00, 0x00, 0xA9, 0xE0, 0x0F, 0x00, 0x00, 0xF3, 0x0F, 0xBD, 0xC9,
+        0xF3, 0x48, 0x0F, 0xBD, 0xC9, 0xC4, 0xE2, 0x39, 0xF7, 0xC9, 0x76, 0x47, 0xFF, 0xC2, 0x76, 0x02, 0xC4, 0xE2, 0x79, 0x58, 0xC0, 0x7D, 0x21, 0x7D,
+        0x2C, 0xC5, 0xF9, 0xD6, 0x07, 0xC5, 0xF9, 0xD6, 0x44, 0x17, 0xF8, 0xC5, 0xF9, 0x7E, 0x44, 0x17, 0xFC, 0xC5, 0xF9, 0xEF, 0xC0, 0xC5, 0xFD, 0x6F,
+        0x54, 0x0E, 0x20, 0xC5, 0xDD, 0xDA, 0xD5, 0xC5, 0xCD, 0xDA, 0xDF, 0xC5, 0xE5, 0xDA, 0xDA, 0xC5, 0xE5, 0x74, 0xD9, 0xC4, 0xA1, 0x7A, 0x6F, 0x5C,
+        0x06, 0xF0, 0x7C, 0x22, 0x7C, 0x0A, 0xC4, 0x41, 0x01, 0xEF, 0xFF, 0xC5, 0x7D, 0x6F, 0x15, 0xC9, 0xD4, 0x04, 0x00, 0xC4, 0x41, 0x7D, 0xFC, 0xC2,
+        0xC4, 0x41, 0x3D, 0x64, 0xC3, 0xC4, 0x41, 0x3D, 0xDF, 0xC4, 0xC4, 0xC1, 0x7D, 0xFC, 0xD0, 0xC5, 0x85, 0x74, 0xD0, 0xC5, 0xED, 0xDF, 0xC9, 0xC5,
+        0xD5, 0x74, 0xEF, 0xC4, 0xC1, 0x45, 0x74, 0xFD, 0xC5, 0xF5, 0xDB, 0xC8, 0xC5, 0xE5, 0xDB, 0xDA, 0xC5, 0xD5, 0xDB, 0xEC, 0xC5, 0xC5, 0xDB, 0xFE,
+        0xC5, 0xC5, 0xDA, 0xFD, 0xC4, 0x42, 0x49, 0xF7, 0xD2, 0x2D, 0x80, 0x0F, 0x00, 0x00, 0x7C, 0xB2, 0xC5, 0x81, 0x74, 0xD0, 0xC5, 0xE9, 0xDF, 0xC9,
+        0x66, 0xFF, 0xC1, 0xC5, 0xFA, 0x6F, 0x04, 0x17, 0xC5, 0xFA, 0x7E, 0x07, 0xFE, 0xC1, 0xC5, 0xFA, 0x7E, 0x04, 0x17, 0xC5, 0xF9, 0x6E, 0x04, 0x17,
+        0xC5, 0xC9, 0xEF, 0xF6, 0xC5, 0xCD, 0x74, 0x07, 0xC5, 0xCD, 0x74, 0x40, 0x20, 0xC5, 0xCD, 0x74, 0x98, 0x80, 0x00, 0x00, 0x00, 0xC5, 0xFC, 0x28,
+        0x20, 0xC5, 0xDD, 0xDA, 0x60, 0x20, 0xC5, 0xFC, 0x28, 0x68, 0x40, 0xC5, 0xD5, 0xDA, 0x68, 0x60, 0xC5, 0xD5, 0xDA, 0xEC, 0xC5, 0xF1, 0xEF, 0xC9,
+        0xC5, 0xFD, 0xEF, 0xD6, 0xC5, 0xFD, 0x74, 0x4C, 0x06, 0xE0, 0x7C, 0xDE, 0xC5, 0xF9, 0x74, 0x0E, 0xC5, 0xF9, 0x74, 0x0C, 0x16, 0xFF, 0xC7, 0xC5,
+        0xF5, 0xDA, 0x57, 0x21, 0xC5, 0xE5, 0xDA, 0x67, 0x61, 0x76, 0x27, 0x72, 0xF4, 0xC5, 0x7D, 0xD7, 0xCF, 0xF3, 0x45, 0x0F, 0xBC, 0xC9, 0x77, 0xD4,
+        0xC4, 0xA1, 0x7E, 0x6F, 0x04, 0x0F, 0x7C, 0xA2, 0x76, 0x31, 0x76, 0x6C, 0x76, 0xA2, 0xC4, 0xA1, 0x7A, 0x7E, 0x04, 0x0F, 0xC4, 0xA1, 0x79, 0x6E,
+        0x04, 0x0F, 0x72, 0xF7, 0x76, 0xBB, 0x76, 0x89, 0x76, 0x32, 0xC4, 0xA1, 0x7D, 0x74, 0x0C, 0x0E, 0x76, 0x2D, 0x76, 0xCE, 0x76, 0x98, 0x76, 0x7F,
+        0x72, 0x53, 0x72, 0xCE, 0xC5, 0xC5, 0x74, 0xC9, 0xC5, 0x55, 0xDA, 0xC4, 0xC5, 0x45, 0x74, 0xD5, 0xC5, 0xAD, 0xEB, 0xEE, 0xC4, 0x41, 0x7D, 0x74,
+        0xC0, 0xC5, 0x3D, 0xEB, 0xCD, 0xC4, 0xC1, 0x7D, 0xD7, 0xC1, 0xC5, 0x75, 0xEB, 0xCD, 0xC4, 0xE2, 0x43, 0xF7, 0xC9, 0xC5, 0xFD, 0x76, 0xDA, 0xC5,
+        0xF5, 0x76, 0xD2, 0xC4, 0xE2, 0x4D, 0x3B, 0xD2, 0xC5, 0x85, 0x76, 0xD0, 0x3B, 0x54, 0x0E, 0x20, 0xC5, 0xFD, 0x76, 0x4E, 0x20, 0xC5, 0xED, 0x76,
+        0x5E, 0x20, 0xC5, 0xDD, 0x76, 0x6E, 0x40, 0xC5, 0xCD, 0x76, 0x7E, 0x60, 0x7F, 0x61, 0xC5, 0xFD, 0x76, 0x4C, 0x06, 0xE0, 0x7F, 0x7F, 0xC5, 0xF9,
+        0x76, 0x0E, 0xC5, 0x81, 0x76, 0xD0, 0xC5, 0xF9, 0x76, 0x0C, 0x16, 0xC4, 0xE2, 0x75, 0x3B, 0x57, 0x21, 0x42, 0x3B, 0x4C, 0x0E, 0x40, 0x76, 0xE4,
+        0x76, 0x4C, 0xC4, 0xA1, 0x7D, 0x76, 0x0C, 0x0E, 0x76, 0x67, 0x76, 0x21, 0x8D, 0x84, 0x88, 0x7F, 0xFF, 0xFF, 0xFF, 0xC5, 0xC5, 0x76, 0xC9, 0xC4,
+        0x62, 0x55, 0x3B, 0xC4, 0xC5, 0x45, 0x76, 0xD5, 0xC4, 0x41, 0x7D, 0x76, 0xC0, 0x76, 0x5F, 0xC5, 0xFD, 0x76, 0x8F, 0x81, 0x00, 0x00, 0x00, 0xC5,
+        0xE5, 0x76, 0x5F, 0x40, 0xC5, 0xF5, 0x76, 0x4C, 0x17, 0xC0, 0xC5, 0xED, 0x76, 0x17, 0xC5, 0xE9, 0x76, 0xD1, 0x72, 0xF9, 0x76, 0x22, 0x0F, 0x01,
+        0xD6, 0xC5, 0xFC, 0x77, 0x72, 0x37, 0x7E, 0x9A, 0x77, 0x95, 0x76, 0xAC, 0x76, 0x3B, 0x72, 0xFA, 0x76, 0x90, 0x76, 0x5E, 0x76, 0xD1, 0x7E, 0x7E,
+        0x72, 0xC3, 0x76, 0x60, 0x62, 0xE2, 0x7D, 0x28, 0x7A, 0xC6, 0xC5, 0xFB, 0x93, 0xC0, 0xC5, 0x7B, 0x93, 0xC0, 0xC4, 0xC2, 0x7A, 0xF7, 0xC0, 0x62,
+        0xF3, 0x7D, 0x20, 0x3F, 0x47, 0x01, 0x00, 0x62, 0xB1, 0xFD, 0x28, 0x6F, 0xC0, 0x62, 0xF3, 0x65, 0x28, 0x25, 0xE2, 0xFE, 0x62, 0xE1, 0x7F, 0x2A,
+        0x6F, 0x16, 0x62, 0xF3, 0x6D, 0x22, 0x3E, 0x0F, 0x04, 0x62, 0xE1, 0xFE, 0x28, 0x6F, 0x0E, 0x62, 0xE1, 0xFE, 0x28, 0x6F, 0x56, 0x01, 0x62, 0xF3,
+        0x6D, 0x20, 0x3E, 0x4F, 0x01, 0x04, 0x62, 0xE1, 0xFE, 0x28, 0x6F, 0x4C, 0x16, 0xFC, 0x62, 0xE1, 0xF5, 0x20, 0xEF, 0x0F, 0x62, 0xE1, 0xED, 0x20,
+        0xEF, 0x57, 0x01, 0x62, 0xE3, 0x75, 0x20, 0x25, 0x67, 0x03, 0xDE, 0x62, 0xA3, 0x65, 0x20, 0x25, 0xE2, 0xFE, 0x62, 0xB2, 0x5D, 0x20, 0x26, 0xCC,
+        0x62, 0xF3, 0x75, 0x20, 0x3E, 0x4C, 0x17, 0xFE, 0x04, 0x72, 0xA7, 0x62, 0xE1, 0xF5, 0x20, 0xEF, 0x4C, 0x17, 0xFE, 0x62, 0xE3, 0x75, 0x20, 0x25,
+        0x54, 0x17, 0xFF, 0xDE, 0x73, 0xE0, 0x76, 0xAB, 0x62, 0x61, 0xFE, 0x28, 0x6F, 0x44, 0x16, 0xFC, 0x62, 0xE1, 0xFD, 0x28, 0x7F, 0x0F, 0x62, 0xE1,
+        0xFD, 0x28, 0x7F, 0x57, 0x01, 0x62, 0x61, 0xFE, 0x28, 0x7F, 0x02, 0x74, 0xFA, 0x62, 0xC1, 0xFE, 0x28, 0x7F, 0x00, 0x62, 0xC1, 0xFE, 0x28, 0x7F,
+        0x48, 0x01, 0x62, 0xE1, 0xFE, 0x28, 0x6F, 0xA6, 0x00, 0x10, 0x00, 0x00, 0x62, 0xE1, 0x7D, 0x28, 0xE7, 0x07, 0x62, 0xE1, 0x7D, 0x28, 0xE7, 0x4F,
+        0x01, 0x62, 0xE1, 0x7D, 0x28, 0xE7, 0xA7, 0x00, 0x10, 0x00, 0x00, 0x76, 0x65, 0x62, 0x61, 0xFE, 0x28, 0x6F, 0x86, 0x00, 0x20, 0x00, 0x00, 0x62,
+        0x61, 0x7D, 0x28, 0xE7, 0x87, 0x00, 0x20, 0x00, 0x00, 0x62, 0xF3, 0x7D, 0x20, 0x3F, 0x44, 0x17, 0xFF, 0x00, 0x7E, 0xA4, 0xC4, 0xC2, 0x71, 0xF7,
+        0xC8, 0x76, 0x51, 0x62, 0xF3, 0x7D, 0x20, 0x3F, 0x48, 0x03, 0x04, 0x62, 0xA1, 0x65, 0xA1, 0xDA, 0xDA, 0x62, 0xB2, 0x66, 0x20, 0x26, 0xD3, 0xC4,
+        0xE1, 0xF9, 0x98, 0xE2, 0x62, 0xE2, 0x7D, 0x28, 0x7C, 0xC6, 0x72, 0x66, 0x77, 0xE7, 0x76, 0x95, 0x76, 0x29, 0x7D, 0x1B, 0x62, 0xE1, 0xFD, 0x08,
+        0x7E, 0xC1, 0x7C, 0x02, 0x62, 0xA1, 0xFD, 0x00, 0xEF, 0xC0, 0x62, 0xE1, 0xFD, 0x28, 0x6F, 0x54, 0x0E, 0x01, 0x62, 0xB3, 0x7D, 0x20, 0x3F, 0xC2,
+        0x00, 0x62, 0xE1, 0xFE, 0x08, 0x6F, 0x9C, 0x16, 0xF1, 0xFF, 0xFF, 0xFF, 0x62, 0xA1, 0xFE, 0x08, 0x6F, 0x5C, 0x06, 0xFF, 0x7C, 0x24, 0x7C, 0x2D,
+        0x7C, 0x1A, 0x62, 0x61, 0xFD, 0x28, 0x6F, 0x2D, 0x4C, 0xBE, 0x03, 0x00, 0x62, 0x01, 0x75, 0x20, 0xF8, 0xDD, 0x62, 0x93, 0x25, 0x20, 0x3E, 0xEE,
+        0x01, 0x62, 0xA1, 0x05, 0x25, 0xFC, 0xC9, 0x62, 0x21, 0x65, 0x20, 0xDA, 0xC9, 0x62, 0x01, 0x2D, 0x20, 0xDA, 0xD1, 0x62, 0x92, 0x2D, 0x20, 0x26,
+        0xCA, 0x62, 0x61, 0xFE, 0x28, 0x6F, 0x46, 0x03, 0x62, 0x01, 0x05, 0x26, 0xFC, 0xC0, 0x62, 0x83, 0x6D, 0x20, 0x25, 0xF8, 0xDE, 0xC4, 0x62, 0x49,
+        0xF7, 0xD1, 0x62, 0xF2, 0x7D, 0x08, 0x26, 0xD0, 0x62, 0xF1, 0x05, 0x05, 0xFC, 0xC0, 0x62, 0xF1, 0xFE, 0x08, 0x6F, 0x0C, 0x16, 0x62, 0xE1, 0x75,
+        0x20, 0xDA, 0x48, 0x01, 0xC4, 0xE1, 0xF9, 0x99, 0xC0, 0x40, 0x3A, 0x74, 0x07, 0x20, 0x62, 0xB3, 0x65, 0x20, 0x3F, 0xD1, 0x04, 0x62, 0x21, 0xF5,
+        0x20, 0xEF, 0xC4, 0xC4, 0xE1, 0xF5, 0x45, 0xC0, 0x7C, 0xDB, 0xC4, 0xE1, 0xF4, 0x4B, 0xC0, 0x41, 0xFF, 0xC1, 0x77, 0xD8, 0x62, 0xA1, 0xFE, 0x28,
+        0x6F, 0x0C, 0x0F, 0x7C, 0xA1, 0x62, 0xB1, 0xFE, 0x08, 0x6F, 0x0C, 0x0E, 0x72, 0xFB, 0x76, 0x8E, 0x76, 0xEF, 0x76, 0x56, 0x62, 0xB3, 0x75, 0x22,
+        0x3F, 0x0C, 0x0E, 0x00, 0x7C, 0xD5, 0x76, 0x97, 0x76, 0x70, 0x72, 0x5B, 0x72, 0x44, 0x62, 0x61, 0xFD, 0x28, 0x6F, 0x47, 0x05, 0x62, 0x01, 0x75,
+        0x20, 0xEF, 0xC8, 0x62, 0x92, 0x36, 0x20, 0x26, 0xC9, 0x62, 0x93, 0x75, 0x20, 0x3F, 0xD8, 0x00, 0x62, 0xA1, 0x75, 0x20, 0xEF, 0xEC, 0x62, 0xA2,
+        0x6D, 0x20, 0x3B, 0xDB, 0x62, 0xB2, 0x66, 0x20, 0x27, 0xC3, 0x3B, 0x74, 0x87, 0x20, 0x62, 0xB3, 0x75, 0x20, 0x1F, 0xC2, 0x00, 0x62, 0xB3, 0x65,
+        0x20, 0x1F, 0xD1, 0x04, 0x62, 0xB2, 0x75, 0x20, 0x27, 0xD1, 0x62, 0xF3, 0x75, 0x22, 0x1F, 0x0E, 0x00, 0x62, 0xF3, 0x75, 0x22, 0x1F, 0x4E, 0x01,
+        0x00, 0x62, 0x22, 0x65, 0x20, 0x3B, 0xC9, 0x62, 0x02, 0x2D, 0x20, 0x3B, 0xD1, 0x62, 0x92, 0x2D, 0x20, 0x27, 0xCA, 0x62, 0xF3, 0x75, 0x22, 0x1F,
+        0x4C, 0x06, 0xFF, 0x00, 0x7C, 0xD7, 0x62, 0xF2, 0x7D, 0x08, 0x27, 0xD0, 0x62, 0xE2, 0x75, 0x20, 0x3B, 0x57, 0x05, 0xC5, 0xF5, 0x4B, 0xC0, 0x76,
+        0xD4, 0x62, 0xB3, 0x75, 0x22, 0x1F, 0x0C, 0x8E, 0x00, 0x7C, 0xD1, 0x72, 0xCC, 0x72, 0x68, 0xC5, 0xE5, 0x4B, 0xDA, 0x62, 0x92, 0x36, 0x20, 0x27,
+        0xC9, 0x62, 0x93, 0x75, 0x20, 0x1F, 0xD8, 0x00, 0x62, 0xF3, 0x7D, 0x20, 0x1F, 0x0F, 0x04, 0x76, 0xF3, 0x62, 0xE1, 0x7E, 0x2A, 0x6F, 0x16, 0x62,
+        0xF3, 0x6D, 0x20, 0x1F, 0x4F, 0x01, 0x04, 0x62, 0xF3, 0x75, 0x20, 0x1F, 0x4C, 0x97, 0xFE, 0x04, 0x77, 0xC1, 0x72, 0x6F, 0x62, 0xF1, 0x7C, 0x48,
+        0x10, 0x06, 0x62, 0xF1, 0x7C, 0x48, 0x10, 0x4E, 0x01, 0x62, 0xD1, 0x7C, 0x48, 0x11, 0x61, 0xFC, 0x72, 0x29, 0x0F, 0x18, 0x16, 0x0F, 0x18, 0x56,
+        0x40, 0x0F, 0x18, 0x96, 0x80, 0x00, 0x00, 0x00, 0x62, 0x71, 0x7C, 0x48, 0x10, 0x41, 0xF8, 0x62, 0x51, 0x7C, 0x48, 0x11, 0x41, 0xF8, 0x62, 0x51,
+        0x7C, 0x48, 0x11, 0x01, 0x62, 0x71, 0x7C, 0x48, 0x10, 0x3E, 0x62, 0xF1, 0x7D, 0x48, 0xE7, 0x07, 0x62, 0xF1, 0x7D, 0x48, 0xE7, 0x4F, 0x01, 0x62,
+        0xD1, 0x7C, 0x48, 0x11, 0x23, 0x62, 0xD1, 0x7D, 0x48, 0xE7, 0x41, 0xFC, 0xC4, 0xE2, 0x71, 0x00, 0xC0, 0x62, 0xF2, 0x7D, 0x48, 0x18, 0xD0, 0xC5,
+        0xF9, 0xD6, 0x46, 0xF8, 0x72, 0x02, 0x62, 0xF1, 0x7C, 0x48, 0x29, 0x17, 0x62, 0xF1, 0x7C, 0x48, 0x29, 0x57, 0x01, 0x72, 0xB7, 0x72, 0x71, 0x72,
+        0x31, 0x76, 0x88, 0x7D, 0x26, 0x7D, 0x31, 0x7D, 0x36, 0x7D, 0x3A, 0x48, 0x25, 0x00, 0xFF, 0xFF, 0xFF, 0x76, 0x93, 0x76, 0xC7, 0x77, 0x69, 0x45,
+        0x0F, 0x10, 0x54, 0x11, 0xC0, 0x45, 0x0F, 0x11, 0x48, 0x10, 0x66, 0x0F, 0x3A, 0x0F, 0xDA, 0x0F, 0x77, 0xC5, 0x0F, 0x2B, 0x4F, 0x10, 0x44, 0x0F,
+        0x11, 0x59, 0x10, 0x77, 0xA7, 0x72, 0xC8, 0x66, 0x0F, 0xFC, 0xF9, 0x66, 0x0F, 0x64, 0xFD, 0x66, 0x0F, 0x3A, 0x63, 0xC1, 0x1A, 0x66, 0x0F, 0x3A,
+        0x0F, 0x44, 0x17, 0xF0, 0x01, 0x76, 0x6A, 0x92, 0x66, 0x0F, 0x3A, 0x63, 0x04, 0x16, 0x1A, 0x77, 0x99, 0x76, 0x44, 0x66, 0x0F, 0x38, 0x00, 0xC2,
+        0x73, 0x50, 0x76, 0x5A, 0x7F, 0x2C, 0x77, 0x80, 0x76, 0x74, 0x77, 0x84, 0x76, 0x3D, 0xD3, 0xFE, 0x88, 0xC1, 0x88, 0xD5, 0x88, 0xE1, 0x88, 0xF5,
+        0x66, 0x0F, 0x38, 0x3B, 0x40, 0x50, 0xF3, 0x0F, 0x1E, 0xFA, 0x0F, 0xAE, 0x5C, 0x24, 0x2C, 0x4C, 0x19, 0xD0, 0x83, 0xF3, 0xFF, 0x49, 0x19, 0xC2,
+        0xBF, 0xFE, 0x7F, 0x00, 0x00, 0x29, 0xDF, 0x3E, 0xFF, 0xE0, 0x49, 0x0F, 0xBA, 0xF3, 0x34, 0xB9, 0x3D, 0x00, 0x00, 0x00, 0x66, 0x19, 0xC9, 0x44,
+        0x0F, 0x43, 0xE1, 0x44, 0x32, 0x0C, 0x24, 0x8D, 0x4D, 0x03, 0x33, 0x3C, 0x24, 0xBB, 0x28, 0x00, 0x00, 0x00, 0x19, 0xDB, 0xEB, 0x69, 0xD9, 0x74,
+        0x24, 0xD8, 0x66, 0x83, 0x4C, 0x24, 0xDC, 0x02, 0xD9, 0x64, 0x24, 0xD8, 0x9B, 0xF3, 0x0F, 0x5E, 0x05, 0x74, 0x79, 0x02, 0x00, 0x48, 0xB8, 0x88,
+        0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0xA0, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0xA3, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22,
+        0x11, 0x67, 0xA1, 0x44, 0x33, 0x22, 0x11, 0x0F, 0x20, 0xC0, 0x0F, 0x22, 0xE0, 0x0F, 0x21, 0xF8, 0xC8, 0x10, 0x00, 0x01, 0xC2, 0x08, 0x00, 0x48,
+        0xCB, 0xCA, 0x10, 0x00, 0xCC, 0xCD, 0x80, 0xA8, 0x01, 0xF6, 0x00, 0x01, 0x66, 0xF7, 0x00, 0x34, 0x12, 0xF7, 0x44, 0x98, 0x10, 0x78, 0x56, 0x34,
+        0x12, 0xF7, 0x10, 0x48, 0xF7, 0x5D, 0xF8, 0x66, 0xB8, 0x01, 0x00, 0x66, 0x81, 0x00, 0x34, 0x12, 0x66, 0x83, 0x00, 0x01, 0x69, 0xD8, 0x78, 0x56,
+        0x34, 0x12, 0x66, 0x6B, 0x18, 0x0C, 0xE9, 0xFB, 0x0F, 0x00, 0x00, 0xEB, 0x00, 0xE8, 0xFB, 0x0F, 0x00, 0x00, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0x54, 0x98, 0x10, 0xFF, 0x28, 0xFF, 0x58, 0x08, 0x48, 0x8D, 0x05, 0x78, 0x56, 0x34, 0x12, 0x49, 0x8D, 0x04, 0x24, 0x49, 0x8D, 0x45, 0x00,
+        0x48, 0x8D, 0x04, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x1F, 0x04, 0x00, 0x2E, 0x66, 0x0F, 0x1F, 0x04, 0x00, 0x66, 0x66, 0x2E, 0x0F, 0x1F,
+        0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x48, 0x8B, 0x04, 0x25, 0x28, 0x00, 0x00, 0x00, 0x65, 0x48, 0x8B, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00,
+        0xF0, 0x48, 0x0F, 0xC7, 0x0F, 0xF0, 0x0F, 0xC1, 0x07, 0xF3, 0xA4, 0xF2, 0xAE, 0xC7, 0xF8, 0xFA, 0x00, 0x00, 0x00, 0xC6, 0xF8, 0x01, 0x0F, 0x01,
+        0xD5, 0xF3, 0x0F, 0x1E, 0xFA, 0x0F, 0x31, 0x0F, 0x01, 0xF9, 0x0F, 0x05, 0x48, 0x0F, 0x07, 0x0F, 0x0B, 0x0F, 0xA2, 0xF3, 0x90, 0xD9, 0xE8, 0xDB,
+        0x28, 0xDB, 0x7C, 0x24, 0x10, 0xD9, 0x3C, 0x24, 0x0F, 0xAE, 0x00, 0x48, 0x0F, 0xAE, 0x20, 0x49, 0x0F, 0xCC, 0x48, 0x0F, 0x45, 0xD8, 0x0F, 0x9F,
+        0xC0, 0x0F, 0xB6, 0xC0, 0x48, 0x0F, 0xBE, 0x00, 0x48, 0x63, 0xC0, 0xF2, 0x0F, 0x38, 0xF0, 0xC0, 0xF2, 0x48, 0x0F, 0x38, 0xF1, 0x00, 0xF3, 0x48,
+        0x0F, 0xB8, 0xD8, 0xF3, 0x0F, 0xBD, 0xD8, 0xF3, 0x0F, 0xBC, 0xD8, 0x0F, 0x38, 0xF0, 0x00, 0x66, 0x0F, 0x70, 0xC8, 0x1B, 0x66, 0x0F, 0x3A, 0x0F,
+        0xC8, 0x04, 0x66, 0x0F, 0x3A, 0x14, 0xC0, 0x03, 0x66, 0x48, 0x0F, 0x3A, 0x22, 0xC0, 0x01, 0x66, 0x0F, 0x3A, 0x0A, 0xC8, 0x01, 0x66, 0x0F, 0x38,
+        0xDC, 0xC8, 0x66, 0x0F, 0x3A, 0xDF, 0xC8, 0x01, 0x66, 0x0F, 0x3A, 0x44, 0xC8, 0x11, 0x0F, 0x38, 0xCB, 0xD1, 0x66, 0x48, 0x0F, 0x7E, 0xC0, 0x0F,
+        0x0F, 0xC1, 0x9E, 0x0F, 0x0F, 0x00, 0x0D, 0x0F, 0x0D, 0x08, 0x0F, 0x0E, 0xC5, 0xEC, 0x58, 0xD9, 0xC4, 0x41, 0x2C, 0x58, 0xD9, 0xC4, 0xE3, 0xFD,
+        0x00, 0xD1, 0x1B, 0xC4, 0xE3, 0x65, 0x4C, 0xE2, 0x10, 0xC5, 0xF8, 0x77, 0xC5, 0xFE, 0x6F, 0x84, 0x24, 0x00, 0x01, 0x00, 0x00, 0xC4, 0x01, 0x7E,
+        0x6F, 0xBC, 0x75, 0x00, 0x01, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x18, 0x00, 0xC4, 0xE2, 0x7D, 0x92, 0x14, 0x88, 0xC4, 0xE2, 0x75, 0xB8, 0xD0, 0xC4,
+        0xE2, 0x60, 0xF2, 0xC8, 0xC4, 0xE2, 0x78, 0xF7, 0xCB, 0xC4, 0xE3, 0xFB, 0xF0, 0xD8, 0x03, 0xC4, 0xE2, 0xF9, 0xF7, 0xCB, 0xC4, 0xE2, 0x63, 0xF5,
+        0xC8, 0x8F, 0xEA, 0x78, 0x10, 0xD8, 0x34, 0x12, 0x00, 0x00, 0x8F, 0xE9, 0x60, 0x01, 0xC8, 0x8F, 0xE8, 0x68, 0xA2, 0xD9, 0x00, 0x8F, 0xE8, 0x78,
+        0xC2, 0xD1, 0x03, 0x8F, 0xE9, 0x78, 0x80, 0xC8, 0xC5, 0xF8, 0x93, 0xC1, 0xC4, 0xE1, 0xF8, 0x90, 0xD1, 0xC5, 0xEC, 0x45, 0xD9, 0x62, 0xF1, 0x6D,
+        0xC9, 0xFE, 0xD9, 0x62, 0xF1, 0xFE, 0x48, 0x6F, 0x40, 0x01, 0x62, 0xF1, 0xFE, 0x48, 0x6F, 0x80, 0x44, 0x00, 0x00, 0x00, 0x62, 0x61, 0x7F, 0x48,
+        0x6F, 0x78, 0x40, 0x62, 0xF3, 0x7D, 0x48, 0x25, 0xC0, 0xFF, 0x62, 0xF1, 0x6C, 0x48, 0xC2, 0xC9, 0x01, 0x62, 0xF2, 0x7D, 0x48, 0x7C, 0xC0, 0x62,
+        0xF1, 0x74, 0x58, 0x58, 0x10, 0x62, 0xF1, 0x6C, 0x18, 0x58, 0xD9, 0x62, 0xF1, 0x7D, 0x20, 0x74, 0x47, 0x01, 0x62, 0xF3, 0x7D, 0x48, 0x39, 0xC1,
+        0x01, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    };
+
+    constexpr std::uint8_t LegacyModeLengths[] = {
+        7, 7, 6, 1, 1, 1, 2, 2, 1, 2, 2, 2, 3, 5, 5, 4, 3, 4, 5, 4, 4, 4, 5, 5, 5, 2, 4, 5, 4, 4, 3, 1,
+        1, 1, 2, 7, 4, 6, 6, 4, 9, 3, 4,
+    };
+
+    // Followed by 15 bytes of padding, the decoder may read that far past the last instruction
+    constexpr std::uint8_t LegacyModeCode[] = {
+        0xEA, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x9A, 0x78, 0x56, 0x34, 0x12, 0x10, 0x00, 0x66, 0xEA, 0x34, 0x12, 0x10, 0x00, 0x60, 0x61, 0x37, 0xD4,
+        0x0A, 0xD5, 0x0A, 0xCE, 0x62, 0x01, 0xC4, 0x00, 0xC5, 0x00, 0x66, 0xC5, 0x00, 0xA1, 0x78, 0x56, 0x34, 0x12, 0xA2, 0x78, 0x56, 0x34, 0x12, 0x67,
+        0xA1, 0x34, 0x12, 0x67, 0x8B, 0x00, 0x67, 0x8B, 0x43, 0x10, 0x67, 0x8B, 0x87, 0x34, 0x12, 0x67, 0x8D, 0x46, 0x00, 0x66, 0xE8, 0xFC, 0x00, 0x66,
+        0xE9, 0xFC, 0x00, 0xE8, 0xFB, 0x0F, 0x00, 0x00, 0xE9, 0xFB, 0x0F, 0x00, 0x00, 0x68, 0x78, 0x56, 0x34, 0x12, 0x6A, 0x01, 0x66, 0x68, 0x34, 0x12,
+        0xB8, 0x78, 0x56, 0x34, 0x12, 0x66, 0xB8, 0x34, 0x12, 0xC8, 0x10, 0x00, 0x00, 0xC2, 0x04, 0x00, 0x40, 0x49, 0xD6, 0x63, 0x00, 0x8D, 0x0C, 0x85,
+        0x78, 0x56, 0x34, 0x12, 0xC5, 0xEC, 0x58, 0xD9, 0xC5, 0xFE, 0x6F, 0x44, 0x24, 0x10, 0x62, 0xF1, 0x6D, 0x48, 0xFE, 0xD9, 0xC5, 0xF8, 0x93, 0xC1,
+        0x8F, 0xEA, 0x78, 0x10, 0xD8, 0x34, 0x12, 0x00, 0x00, 0x0F, 0xC7, 0x08, 0xDB, 0x44, 0x24, 0x04, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    };
+}
@@ -0,0 +1,137 @@
+"""
+Writes functions.pdb, the PDB fixture of PdbTests.cpp: python3 functions.py
+
+A small but complete PDB (llvm-pdbutil dumps it) laid out to exercise pdb::File:
+- 512 byte blocks, every stream scattered over non-contiguous blocks
+- a DBI stream with section contribution, section map, file info and EC substreams before the debug header
+- four modules: one with procedures spanning several blocks, one without a symbol stream,
+  the linker module with an empty symbol stream, and one with procedures in the second section
+- every procedure kind pdb::File reads, plus procedures it must skip (no code, segment 0 or out of range)
+
+The procedures it must list are printed, PdbTests.cpp checks the same values.
+"""
+import math
+import os
+import struct
+
+BLOCK = 512
+GUID = bytes(range(0x10, 0x20))
+
+S_END, S_OBJNAME = 0x0006, 0x1101
+S_LPROC32, S_GPROC32, S_LPROC32_ID, S_GPROC32_ID, S_LPROC32_DPC, S_LPROC32_DPC_ID = 0x110F, 0x1110, 0x1146, 0x1147, 0x1155, 0x1156
+
+SECTIONS = [(b".text", 0x1000, 0x3000), (b"PAGE", 0x5000, 0x800)]
+
+
+def record(kind, data):
+    # Records are padded to 4 bytes, the length covers the padding
+    body = struct.pack("<H", kind) + data
+    body += b"\0" * (-(len(body) + 2) % 4)
+    return struct.pack("<H", len(body)) + body
+
+
+def procedure(segment, offset, size, name):
+    return struct.pack("<IIIIIIIIHB", 0, 0, 0, size, 0, size, 0, offset, segment, 0) + name + b"\0"
+
+
+def module_symbols(procedures):
+    symbols = struct.pack("<I", 4) + record(S_OBJNAME, struct.pack("<I", 0) + b"fixture.obj\0")
+    for kind, segment, offset, size, name in procedures:
+        symbols += record(kind, procedure(segment, offset, size, name)) + record(S_END, b"")
+    return symbols
+
+
+def module_stream(symbols):
+    return symbols + struct.pack("<I", 0)  # No global references
+
+
+def module_info(stream, symbol_bytes, name):
+    contribution = struct.pack("<hHiiIHHII", -1, 0, 0, -1, 0, 0, 0, 0, 0)
+    info = struct.pack("<I", 0) + contribution + struct.pack("<HHIIIHHIII", 0, stream, symbol_bytes, 0, 0, 0, 0, 0, 0, 0)
+    info += name + b"\0" + name + b"\0"
+    return info + b"\0" * (-len(info) % 4)
+
+
+def main():
+    names = [b"NamespaceOne::FunctionWithALongNameNumber%02d" % i for i in range(12)]
+    kinds = [S_GPROC32, S_LPROC32, S_GPROC32_ID, S_LPROC32_ID, S_LPROC32_DPC, S_LPROC32_DPC_ID]
+
+    # Module a: procedures of .text, enough of them to span several blocks
+    a = [(kinds[i % len(kinds)], 1, 0x40 * i, 0x20 + i, names[i]) for i in range(12)]
+    a.insert(3, (S_GPROC32, 1, 0x1000, 0, b"NoCode"))
+    a.insert(7, (S_GPROC32, 0, 0x10, 0x10, b"NoSegment"))
+    a.insert(9, (S_LPROC32, 3, 0x10, 0x10, b"SegmentOutOfRange"))
+    # Module c: procedures of the second section
+    c = [(S_GPROC32, 2, 0x100, 0x80, b"PagedFunction"), (S_LPROC32_ID, 2, 0x200, 0x44, b"PagedHelper")]
+
+    a_symbols, c_symbols, linker_symbols = module_symbols(a), module_symbols(c), struct.pack("<I", 4)
+
+    # Streams: 0 old directory, 1 info, 2 TPI, 3 DBI, 4 IPI, 5 /LinkInfo, 6 /names, 7 section headers, 8-10 modules
+    string_table = struct.pack("<IIIBIII", 0xEFFEEFFE, 1, 1, 0, 1, 0, 0)
+    info = struct.pack("<III", 20000404, 0x5CD0, 1) + GUID
+    info += struct.pack("<I", 17) + b"/LinkInfo\0/names\0"
+    info += struct.pack("<IIIII", 2, 4, 1, 0x6, 0) + struct.pack("<IIII", 10, 6, 0, 5)
+    info += struct.pack("<II", 0, 20140508)
+    tpi = struct.pack("<IIIIIHHII", 20040203, 56, 0x1000, 0x1000, 0, 0xFFFF, 0xFFFF, 4, 0x3FFFF) + b"\0" * 24
+
+    modules = module_info(8, len(a_symbols), b"a.obj") + module_info(0xFFFF, 0, b"b.obj")
+    modules += module_info(9, len(linker_symbols), b"* Linker *") + module_info(10, len(c_symbols), b"c.obj")
+    contributions = struct.pack("<I", 0xEFFE0000 + 19970605)  # Version 6.0, no contribution
+    section_map = struct.pack("<HH", 0, 0)
+    file_info = struct.pack("<HH", 4, 0) + struct.pack("<4H", 0, 0, 0, 0) + struct.pack("<4H", 0, 0, 0, 0)
+    debug_header = struct.pack("<11H", *[0xFFFF] * 5 + [7] + [0xFFFF] * 5)
+    dbi = struct.pack("<iIIHHHHHHiiiiiIiiHHI", -1, 19990903, 1, 0xFFFF, 0x8E0B, 0xFFFF, 0, 0xFFFF, 0,
+                      len(modules), len(contributions), len(section_map), len(file_info), 0, 0,
+                      len(debug_header), len(string_table), 0, 0x8664, 0)
+    dbi += modules + contributions + section_map + file_info + string_table + debug_header
+
+    headers = b"".join(struct.pack("<8sIIIIIIHHI", name, size, address, size, 0x400, 0, 0, 0, 0, 0x60000020) for name, address, size in SECTIONS)
+
+    streams = [b"", info, tpi, dbi, tpi, b"", string_table, headers, module_stream(a_symbols), module_stream(linker_symbols), module_stream(c_symbols)]
+
+    # Block 0 is the superblock, 1 and 2 the free block maps, 3 the block map of the directory
+    counts = [(len(stream) + BLOCK - 1) // BLOCK for stream in streams]
+    directory_size = 4 + 4 * len(streams) + 4 * sum(counts)
+    directory_blocks = (directory_size + BLOCK - 1) // BLOCK
+    total = 4 + sum(counts) + directory_blocks
+    # Blocks are handed out with a stride coprime with their count, so consecutive blocks of a stream are never adjacent
+    available = total - 4
+    stride = next(step for step in range(5, available) if math.gcd(step, available) == 1)
+    free = [4 + (i * stride) % available for i in range(available)]
+
+    stream_blocks = []
+    for count in counts:
+        stream_blocks.append(free[:count])
+        free = free[count:]
+    directory_list = free[:directory_blocks]
+
+    directory = struct.pack("<I", len(streams)) + b"".join(struct.pack("<I", len(stream)) for stream in streams)
+    directory += b"".join(struct.pack("<%dI" % len(blocks), *blocks) for blocks in stream_blocks)
+
+    image = bytearray(total * BLOCK)
+    superblock = b"Microsoft C/C++ MSF 7.00\r\n\x1aDS\0\0\0" + struct.pack("<IIIIII", BLOCK, 2, total, len(directory), 0, 3)
+    image[0:len(superblock)] = superblock
+    image[2 * BLOCK:3 * BLOCK] = bytes([0xFF]) * BLOCK
+    for block in range(total):
+        image[2 * BLOCK + block // 8] &= ~(1 << (block % 8)) & 0xFF
+    image[3 * BLOCK:3 * BLOCK + 4 * directory_blocks] = struct.pack("<%dI" % directory_blocks, *directory_list)
+
+    def write(data, blocks):
+        for i, block in enumerate(blocks):
+            chunk = data[i * BLOCK:(i + 1) * BLOCK]
+            image[block * BLOCK:block * BLOCK + len(chunk)] = chunk
+
+    for stream, blocks in zip(streams, stream_blocks):
+        write(stream, blocks)
+    write(directory, directory_list)
+
+    with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "functions.pdb"), "wb") as file:
+        file.write(image)
+
+    for kind, segment, offset, size, name in a + c:
+        if size and 1 <= segment <= len(SECTIONS):
+            print("{ 0x%X, 0x%X }, // %s" % (SECTIONS[segment - 1][1] + offset, size, name.decode()))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,260 @@
+"""
+Writes LengthCorpus.h, the instruction length corpus of DecoderTests.cpp: python3 lengths.py
+
+The lengths are GNU objdump's, so the built-in decoder is checked against a reference in every build,
+including the AA_NOCAPSTONE one that has no capstone to compare with. The corpus holds:
+- one instruction of every mnemonic, length and leading bytes found in a libc .text, compiler output with SSE, AVX2 and AVX-512
+- hand-written encodings that compilers rarely emit: moffs, far pointers, enter, 3DNow!, XOP, EVEX with
+  compressed displacements, control registers, 16 bit addressing and operand size prefixes, in both modes
+
+Needs binutils (as, objdump). LIBC can point at another shared object.
+"""
+import os
+import re
+import subprocess
+import tempfile
+
+LIBC = os.environ.get("LIBC", "/usr/lib/x86_64-linux-gnu/libc.so.6")
+
+LONG_MODE = """
+movabs $0x1122334455667788, %rax
+movabs 0x1122334455667788, %al
+movabs %eax, 0x1122334455667788
+addr32 mov 0x11223344, %eax
+mov %cr0, %rax
+mov %rax, %cr4
+mov %dr7, %rax
+enter $0x10, $1
+ret $8
+lretq
+lretl $16
+int3
+int $0x80
+test $1, %al
+testb $1, (%rax)
+testw $0x1234, (%rax)
+testl $0x12345678, 0x10(%rax,%rbx,4)
+notl (%rax)
+negq -8(%rbp)
+mov $1, %ax
+addw $0x1234, (%rax)
+addw $1, (%rax)
+imul $0x12345678, %eax, %ebx
+imul $12, (%rax), %bx
+jmp .+0x1000
+jmp .+2
+call .+0x1000
+jmpq *(%rip)
+call *0x10(%rax,%rbx,4)
+ljmp *(%rax)
+lcall *8(%rax)
+lea 0x12345678(%rip), %rax
+lea (%r12), %rax
+lea (%r13), %rax
+lea 0x0(,%rax,8), %rax
+nopw 0x0(%rax,%rax,1)
+cs nopw 0x0(%rax,%rax,1)
+.byte 0x66, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+mov %fs:0x28, %rax
+mov %gs:0x0, %rax
+lock cmpxchg16b (%rdi)
+lock xadd %eax, (%rdi)
+rep movsb
+repne scasb
+xbegin .+0x100
+xabort $1
+xend
+endbr64
+rdtsc
+rdtscp
+syscall
+sysretq
+ud2
+cpuid
+pause
+fld1
+fldt (%rax)
+fstpt 0x10(%rsp)
+fnstcw (%rsp)
+fxsave (%rax)
+xsave64 (%rax)
+bswap %r12
+cmovne %rax, %rbx
+setg %al
+movzbl %al, %eax
+movsbq (%rax), %rax
+movslq %eax, %rax
+crc32b %al, %eax
+crc32q (%rax), %rax
+popcnt %rax, %rbx
+lzcnt %eax, %ebx
+tzcnt %eax, %ebx
+movbe (%rax), %eax
+pshufd $0x1b, %xmm0, %xmm1
+palignr $4, %xmm0, %xmm1
+pextrb $3, %xmm0, %eax
+pinsrq $1, %rax, %xmm0
+roundss $1, %xmm0, %xmm1
+aesenc %xmm0, %xmm1
+aeskeygenassist $1, %xmm0, %xmm1
+pclmulqdq $0x11, %xmm0, %xmm1
+sha256rnds2 %xmm0, %xmm1, %xmm2
+movq %xmm0, %rax
+pfadd %mm1, %mm0
+pi2fd (%rax), %mm0
+prefetchw (%rax)
+femms
+vaddps %ymm1, %ymm2, %ymm3
+vaddps %ymm9, %ymm10, %ymm11
+vpermq $0x1b, %ymm1, %ymm2
+vpblendvb %ymm1, %ymm2, %ymm3, %ymm4
+vzeroupper
+vmovdqu 0x100(%rsp), %ymm0
+vmovdqu 0x100(%r13,%r14,2), %ymm15
+vbroadcastss (%rax), %ymm0
+vgatherdps %ymm0, (%rax,%ymm1,4), %ymm2
+vfmadd231ps %ymm0, %ymm1, %ymm2
+andn %eax, %ebx, %ecx
+bextr %eax, %ebx, %ecx
+rorx $3, %rax, %rbx
+shlx %rax, %rbx, %rcx
+pdep %eax, %ebx, %ecx
+bextr $0x1234, %eax, %ebx
+blcfill %eax, %ebx
+vpcmov %xmm0, %xmm1, %xmm2, %xmm3
+vprotd $3, %xmm1, %xmm2
+vfrczps %xmm0, %xmm1
+kmovw %k1, %eax
+kmovq %k1, %k2
+korw %k1, %k2, %k3
+vpaddd %zmm1, %zmm2, %zmm3{%k1}{z}
+vmovdqu64 0x40(%rax), %zmm0
+vmovdqu64 0x44(%rax), %zmm0
+vmovdqu8 0x1000(%rax), %zmm31
+vpternlogd $0xff, %zmm0, %zmm0, %zmm0
+vcmpps $1, %zmm1, %zmm2, %k1
+vpbroadcastd %eax, %zmm0
+vaddps (%rax){1to16}, %zmm1, %zmm2
+vaddps {rn-sae}, %zmm1, %zmm2, %zmm3
+vpcmpeqb 0x20(%rdi), %ymm16, %k0
+vextracti32x4 $1, %zmm0, %xmm1
+"""
+
+LEGACY_MODE = """
+ljmp $0x10, $0x12345678
+lcall $0x10, $0x12345678
+data16 ljmp $0x10, $0x1234
+pusha
+popa
+aaa
+aam $10
+aad $10
+into
+bound %eax, (%ecx)
+les (%eax), %eax
+lds (%eax), %eax
+lds (%eax), %ax
+mov 0x12345678, %eax
+mov %al, 0x12345678
+addr16 mov 0x1234, %eax
+addr16 mov (%bx,%si), %eax
+addr16 mov 0x10(%bp,%di), %eax
+addr16 mov 0x1234(%bx), %eax
+addr16 lea (%bp), %eax
+data16 call .+0x100
+data16 jmp .+0x100
+call .+0x1000
+jmp .+0x1000
+push $0x12345678
+push $1
+pushw $0x1234
+mov $0x12345678, %eax
+mov $0x1234, %ax
+enter $0x10, $0
+ret $4
+inc %eax
+dec %ecx
+.byte 0xD6
+arpl %ax, (%eax)
+lea 0x12345678(,%eax,4), %ecx
+vaddps %ymm1, %ymm2, %ymm3
+vmovdqu 0x10(%esp), %ymm0
+vpaddd %zmm1, %zmm2, %zmm3
+kmovw %k1, %eax
+bextr $0x1234, %eax, %ebx
+cmpxchg8b (%eax)
+fildl 4(%esp)
+"""
+
+
+def objdump(path, *arguments):
+    output = subprocess.run(["objdump", "-d", "-w", "--insn-width=16", *arguments, path], check=True, capture_output=True, text=True).stdout
+    for line in output.splitlines():
+        match = re.match(r"^\s*[0-9a-f]+:\t((?:[0-9a-f]{2} )+)\s*\t(.*)$", line)
+        if match:
+            yield bytes.fromhex(match.group(1)), match.group(2).strip()
+
+
+def assemble(source, mode):
+    with tempfile.TemporaryDirectory() as directory:
+        listing, image = os.path.join(directory, "corpus.s"), os.path.join(directory, "corpus.o")
+        with open(listing, "w") as file:
+            file.write(source)
+        subprocess.run(["as", "--64" if mode == 64 else "--32", "-o", image, listing], check=True)
+        return [code for code, _ in objdump(image, "-M", "x86-64" if mode == 64 else "i386")]
+
+
+def compiled():
+    seen, corpus = set(), []
+    for code, text in objdump(LIBC, "-j", ".text"):
+        if "(bad)" in text or not text:
+            continue
+        # Operands only change the length through the bytes encoding them, the first two tell most apart
+        key = (text.split()[0], len(code), code[:2])
+        if key not in seen:
+            seen.add(key)
+            corpus.append(code)
+    return corpus
+
+
+def array(name, instructions):
+    code = b"".join(instructions)
+    lines = ["    constexpr std::uint8_t %sLengths[] = {" % name]
+    lengths = [str(len(instruction)) for instruction in instructions]
+    lines += ["        " + ", ".join(lengths[i:i + 32]) + "," for i in range(0, len(lengths), 32)]
+    lines += ["    };", "", "    // Followed by 15 bytes of padding, the decoder may read that far past the last instruction",
+              "    constexpr std::uint8_t %sCode[] = {" % name]
+    code += b"\x90" * 15
+    lines += ["        " + ", ".join("0x%02X" % byte for byte in code[i:i + 24]) + "," for i in range(0, len(code), 24)]
+    lines += ["    };"]
+    return "\n".join(lines)
+
+
+def main():
+    long_mode = compiled() + assemble(LONG_MODE, 64)
+    legacy_mode = assemble(LEGACY_MODE, 32)
+
+    header = [
+        "#pragma once",
+        "#include <cstdint>",
+        "",
+        "/*",
+        "    Generated by lengths.py from %s and hand-written encodings, do not edit." % os.path.basename(LIBC),
+        "    Instructions are concatenated, the length of each as decoded by GNU objdump.",
+        "*/",
+        "",
+        "namespace lengthcorpus",
+        "{",
+        array("LongMode", long_mode),
+        "",
+        array("LegacyMode", legacy_mode),
+        "}",
+        "",
+    ]
+    with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), "LengthCorpus.h"), "w") as file:
+        file.write("\n".join(header))
+    print("%d long mode, %d legacy mode instructions" % (len(long_mode), len(legacy_mode)))
+
+
+if __name__ == "__main__":
+    main()
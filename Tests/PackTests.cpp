@@ -0,0 +1,218 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <A64Cipher.h>
+#include <A64ExtentIndex.h>
+#include <A64Packed.h>
+#include "B64Encryption.h"
+#include "ScudoTest.h"
+
+/*
+    scudo-pack is run on a copy of this binary, which links the runtime and so reserves the packed table.
+    The copy is then started with the same filter: its table is filled, so it registers the packed functions
+    and calls them. scudo-pack is looked up next to the executable, as both projects build to one directory.
+*/
+#ifndef _WIN32
+#include <sys/wait.h>
+
+extern packed::Table<AA_PACKED_CAPACITY> scudoPackedTable;
+
+// Functions scudo-pack encrypts, with unmangled names for the manifest. Never called by an unpacked binary
+extern "C" {
+    SCUDO_NOINLINE long scudoPackedSum(long n) {
+        long sum = 0;
+        for (long i = 1; i <= n; ++i)
+            sum += i * i;
+        return sum;
+    }
+
+    SCUDO_NOINLINE long scudoPackedMix(long a, long b) {
+        return (a * 31) ^ (b + 7) ^ (a >> 3);
+    }
+
+    SCUDO_NOINLINE double scudoPackedScale(double value, int times) {
+        for (int i = 0; i < times; ++i)
+            value = value * 1.5 + 1;
+        return value;
+    }
+}
+
+namespace {
+    void* const PackedFunctions[] = {
+        reinterpret_cast<void*>(&scudoPackedSum), reinterpret_cast<void*>(&scudoPackedMix), reinterpret_cast<void*>(&scudoPackedScale),
+    };
+
+    const packed::Table<AA_PACKED_CAPACITY>* Table() {
+        const packed::Table<AA_PACKED_CAPACITY>* volatile table = &scudoPackedTable;
+        return table;
+    }
+
+    bool CallsReturnExpected() {
+        return scudotest::Opaque(&scudoPackedSum)(10) == 385 && scudotest::Opaque(&scudoPackedMix)(100, 5) == ((100 * 31) ^ 12 ^ 12)
+            && scudotest::Opaque(&scudoPackedScale)(2, 3) == ((2 * 1.5 + 1) * 1.5 + 1) * 1.5 + 1;
+    }
+
+    const packed::Entry* FindEntry(const packed::Table<AA_PACKED_CAPACITY>& table, std::uint32_t rva) {
+        for (std::uint32_t index = 0; index < table.header.count && index < AA_PACKED_CAPACITY; ++index)
+            if (table.entries[index].rva == rva)
+                return &table.entries[index];
+        return nullptr;
+    }
+
+    cipher::Key EntryKey(const packed::Entry& entry) {
+        cipher::Key key;
+        std::memcpy(key.bytes, entry.key, sizeof(key.bytes));
+        return key;
+    }
+
+    /**
+     * @brief The packed copy: checks the image as loaded, registers the table and runs the functions.
+     */
+    void RunPacked(const packed::Table<AA_PACKED_CAPACITY>& table) {
+        LoadedModule module;
+        CHECK(FindLoadedModule(&table, module));
+        CHECK(table.header.count == std::size(PackedFunctions));
+
+        // The image holds the functions encrypted behind an int3, the packer's key and entry byte give their code back
+        std::vector<std::vector<std::uint8_t>> plaintexts;
+        for (void* function : PackedFunctions) {
+            const packed::Entry* entry = FindEntry(table, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(function) - module.base));
+            CHECK(entry != nullptr);
+            if (!entry)
+                return;
+
+            auto code = static_cast<const std::uint8_t*>(function);
+            CHECK(code[0] == BREAKPOINT_BYTE);
+            std::vector<std::uint8_t> plaintext(code, code + entry->size);
+            cipher::Decrypt(plaintext.data(), plaintext.size(), static_cast<cipher::Algorithm>(entry->algorithm), EntryKey(*entry));
+            plaintext[0] = entry->firstByte;
+            plaintexts.push_back(std::move(plaintext));
+        }
+
+        Scudo::userRequestHandler = std::make_unique<UserRequestHandler>("", "");
+        Scudo::userRequestHandler->statusCode = UserRequestHandler::authenticated;
+        AAPROTECT_PACKED();
+        CHECK(Scudo::protectedFunctions.size() == std::size(PackedFunctions));
+        for (std::size_t index = 0; index < std::size(PackedFunctions); ++index) {
+            Scudo* registered = Scudo::getEncryptedFunction(PackedFunctions[index]);
+            CHECK(registered && registered->functionSize == plaintexts[index].size() && registered->firstByte == plaintexts[index][0]);
+        }
+
+        // Decrypted by the handler for every call, encrypted again after it
+        CHECK(CallsReturnExpected() && CallsReturnExpected());
+        for (void* function : PackedFunctions)
+            CHECK(*static_cast<const std::uint8_t*>(function) == BREAKPOINT_BYTE);
+
+        // Unprotecting leaves the code the packer's keys decrypt to
+        AAUNPROTECT();
+        for (std::size_t index = 0; index < std::size(PackedFunctions); ++index)
+            CHECK(std::memcmp(PackedFunctions[index], plaintexts[index].data(), plaintexts[index].size()) == 0);
+        CHECK(CallsReturnExpected());
+    }
+
+    std::vector<std::uint8_t> ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    /**
+     * @brief Checks the packed file against the code of this process, which is the same image unpacked.
+     */
+    void CheckPackedFile(const std::filesystem::path& path, const LoadedModule& module) {
+        std::vector<std::uint8_t> image = ReadFile(path);
+        elf::File file(image.data(), image.size());
+        const elf::SectionHeader* section = file.FindSection(packed::SectionName);
+        CHECK(section != nullptr);
+        if (!section)
+            return;
+
+        packed::Table<AA_PACKED_CAPACITY> table;
+        std::memcpy(&table, image.data() + section->offset, sizeof(table));
+        CHECK(table.header.magic == packed::Magic && table.header.count == std::size(PackedFunctions));
+
+        for (void* function : PackedFunctions) {
+            auto rva = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(function) - module.base);
+            const packed::Entry* entry = FindEntry(table, rva);
+            CHECK(entry != nullptr);
+            if (!entry)
+                continue;
+
+            // Sized like the symbol table sizes it, and found at its address in the section holding it
+            CHECK(entry->size == FunctionExtentIndex::ForAddress(function).Size(function));
+            std::uint8_t* bytes = nullptr;
+            for (const elf::SectionHeader& code : file.Sections())
+                if (code.addr && rva >= code.addr && rva + entry->size <= code.addr + code.size)
+                    bytes = image.data() + code.offset + (rva - code.addr);
+            CHECK(bytes && bytes[0] == BREAKPOINT_BYTE);
+            if (!bytes)
+                continue;
+
+            cipher::Decrypt(bytes, entry->size, static_cast<cipher::Algorithm>(entry->algorithm), EntryKey(*entry));
+            bytes[0] = entry->firstByte;
+            CHECK(std::memcmp(bytes, function, entry->size) == 0);
+        }
+    }
+
+    /**
+     * @brief Runs a command, printing its output indented, and returns its exit code.
+     */
+    int Run(const std::string& command) {
+        FILE* output = popen((command + " 2>&1").c_str(), "r");
+        if (!output)
+            return -1;
+        char line[1024];
+        while (std::fgets(line, sizeof(line), output))
+            std::printf("      %s", line);
+        int status = pclose(output);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+}
+
+TEST("pack/packed functions run with the packer's keys")
+{
+    const packed::Table<AA_PACKED_CAPACITY>* table = Table();
+    if (table->header.count) {
+        RunPacked(*table);
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::path executable = std::filesystem::read_symlink("/proc/self/exe", error);
+    std::filesystem::path packer = executable.parent_path() / "scudo-pack";
+    if (error || !std::filesystem::exists(packer)) {
+        std::printf("    scudo-pack not found next to the executable, skipped\n");
+        return;
+    }
+
+    char directory[] = "/tmp/scudo-pack-XXXXXX";
+    CHECK(mkdtemp(directory) != nullptr);
+    LoadedModule module;
+    CHECK(FindLoadedModule(reinterpret_cast<const void*>(&scudoPackedSum), module));
+
+    // Two functions by symbol name, one by RVA
+    std::filesystem::path manifest = std::filesystem::path(directory) / "manifest.txt";
+    char rva[32];
+    std::snprintf(rva, sizeof(rva), "0x%llx", static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(&scudoPackedScale) - module.base));
+    std::ofstream(manifest) << "# packed by scudo-tests\nscudoPackedSum\nscudoPackedMix\n" << rva << "\n";
+
+    for (const char* algorithm : { "aes", "chacha20", "xor" }) {
+        std::printf("    %s\n", algorithm);
+
+        // Packed in place, the copy keeps the executable bit
+        std::filesystem::path copy = std::filesystem::path(directory) / "scudo-tests-packed";
+        std::filesystem::copy_file(executable, copy, std::filesystem::copy_options::overwrite_existing, error);
+        CHECK(!error);
+        CHECK(Run("'" + packer.string() + "' '" + copy.string() + "' '" + manifest.string() + "' --cipher " + algorithm) == 0);
+        CheckPackedFile(copy, module);
+
+        CHECK(Run("'" + copy.string() + "' --fixtures '" + scudotest::FixtureDirectory().string() + "' 'pack/packed functions run'") == 0);
+    }
+
+    std::filesystem::remove_all(directory, error);
+}
+#endif // !_WIN32
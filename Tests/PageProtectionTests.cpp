@@ -0,0 +1,261 @@
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <A64PageProtection.h>
+#include "ScudoTest.h"
+
+namespace {
+    /*
+        Pages of their own for every test, executable like the code pages the manager changes. Their state is
+        reset to executable before they are unmapped, a later mapping at the same address starts out clean.
+    */
+    class Pages {
+    public:
+        explicit Pages(std::size_t count) : count(count) {
+#ifdef _WIN32
+            base = static_cast<std::uint8_t*>(VirtualAlloc(nullptr, count * protection::PageSize, MEM_RESERVE | MEM_COMMIT, PAGE_EXECUTE_READ));
+#else
+            void* mapped = mmap(nullptr, count * protection::PageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            base = mapped != MAP_FAILED ? static_cast<std::uint8_t*>(mapped) : nullptr;
+#endif // _WIN32
+        }
+
+        ~Pages() {
+            if (!base)
+                return;
+            protection::Manager::Global().SetResting(base, count * protection::PageSize, protection::ReadExecute);
+#ifdef _WIN32
+            VirtualFree(base, 0, MEM_RELEASE);
+#else
+            munmap(base, count * protection::PageSize);
+#endif // _WIN32
+        }
+
+        std::uint8_t* operator[](std::size_t page) const { return base + page * protection::PageSize; }
+        explicit operator bool() const { return base != nullptr; }
+
+    private:
+        std::uint8_t* base = nullptr;
+        std::size_t count;
+    };
+
+    /**
+     * @brief Protection a page has now according to the system, not to the manager.
+     */
+    protection::Protection SystemProtection(const void* address) {
+#ifdef _WIN32
+        MEMORY_BASIC_INFORMATION region;
+        VirtualQuery(address, &region, sizeof(region));
+        switch (region.Protect & 0xFF) {
+        case PAGE_READWRITE: return protection::ReadWrite;
+        case PAGE_EXECUTE_READ: return protection::ReadExecute;
+        case PAGE_EXECUTE_READWRITE: return protection::ReadWriteExecute;
+        default: return protection::NoAccess;
+        }
+#else
+        std::ifstream maps("/proc/self/maps");
+        std::uintptr_t page = reinterpret_cast<std::uintptr_t>(address);
+        for (std::string line; std::getline(maps, line);) {
+            std::istringstream fields(line);
+            std::uintptr_t begin, end;
+            char dash;
+            std::string permissions;
+            fields >> std::hex >> begin >> dash >> end >> permissions;
+            if (page < begin || page >= end)
+                continue;
+
+            bool write = permissions[1] == 'w', execute = permissions[2] == 'x';
+            if (permissions[0] != 'r')
+                return protection::NoAccess;
+            return execute ? (write ? protection::ReadWriteExecute : protection::ReadExecute) : protection::ReadWrite;
+        }
+        return protection::NoAccess;
+#endif // _WIN32
+    }
+
+    // System calls made by body
+    template<typename Body>
+    std::uint64_t SystemCallsOf(Body&& body) {
+        std::uint64_t before = protection::Manager::Global().SystemCalls();
+        body();
+        return protection::Manager::Global().SystemCalls() - before;
+    }
+}
+
+TEST("pages/overlapping writers share the change")
+{
+    Pages pages(2);
+    CHECK(pages);
+    if (!pages)
+        return;
+
+    protection::Manager& manager = protection::Manager::Global();
+    std::uint8_t* view = nullptr;
+
+    // The second writer only changes the page the first doesn't hold
+    CHECK(SystemCallsOf([&] { CHECK(manager.BeginWrite(pages[0], 0x800, view) && view == pages[0]); }) == 1);
+    CHECK(SystemCallsOf([&] { CHECK(manager.BeginWrite(pages[0] + 0x800, 0x1000, view) && view == pages[0] + 0x800); }) == 1);
+    CHECK(SystemProtection(pages[0]) == protection::ReadWriteExecute && SystemProtection(pages[1]) == protection::ReadWriteExecute);
+    pages[0][0x7FF] = 0xC3, pages[1][0x7FF] = 0xC3;
+
+    // The first page stays writable for the writer still holding it
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 0x800); }) == 0);
+    CHECK(SystemProtection(pages[0]) == protection::ReadWriteExecute);
+    pages[0][0x800] = 0xC3;
+
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0] + 0x800, 0x1000); }) == 1);
+    CHECK(SystemProtection(pages[0]) == protection::ReadExecute && SystemProtection(pages[1]) == protection::ReadExecute);
+    CHECK(pages[0][0x7FF] == 0xC3 && pages[0][0x800] == 0xC3 && pages[1][0x7FF] == 0xC3);
+}
+
+TEST("pages/changes to the current protection are skipped")
+{
+    Pages pages(2);
+    CHECK(pages);
+    if (!pages)
+        return;
+
+    protection::Manager& manager = protection::Manager::Global();
+
+    // Pages never seen rest executable already
+    CHECK(SystemCallsOf([&] { manager.SetResting(pages[0], 2 * protection::PageSize, protection::ReadExecute); }) == 0);
+    CHECK(SystemCallsOf([&] { manager.SetResting(pages[0], protection::PageSize, protection::NoAccess); }) == 1);
+    CHECK(SystemCallsOf([&] { manager.SetResting(pages[0], protection::PageSize, protection::NoAccess); }) == 0);
+    CHECK(SystemProtection(pages[0]) == protection::NoAccess && SystemProtection(pages[1]) == protection::ReadExecute);
+
+    // Inaccessible pages are written read-write, nested writes of a held page change nothing
+    std::uint8_t* view = nullptr;
+    CHECK(SystemCallsOf([&] { manager.BeginWrite(pages[0], 16, view); }) == 1);
+    CHECK(SystemProtection(pages[0]) == protection::ReadWrite);
+    CHECK(SystemCallsOf([&] {
+        manager.BeginWrite(pages[0] + 16, 16, view);
+        manager.EndWrite(pages[0] + 16, 16);
+    }) == 0);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 16); }) == 1);
+    CHECK(SystemProtection(pages[0]) == protection::NoAccess);
+}
+
+TEST("pages/adjacent pages change in one call")
+{
+    Pages pages(8);
+    CHECK(pages);
+    if (!pages)
+        return;
+
+    protection::Manager& manager = protection::Manager::Global();
+    std::uint8_t* view = nullptr;
+
+    CHECK(SystemCallsOf([&] { manager.BeginWrite(pages[0], 8 * protection::PageSize, view); }) == 1);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 8 * protection::PageSize); }) == 1);
+
+    // A page held in the middle splits the range in two runs
+    CHECK(SystemCallsOf([&] { manager.BeginWrite(pages[3], 1, view); }) == 1);
+    CHECK(SystemCallsOf([&] { manager.BeginWrite(pages[0], 8 * protection::PageSize, view); }) == 2);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 8 * protection::PageSize); }) == 2);
+    CHECK(SystemProtection(pages[2]) == protection::ReadExecute && SystemProtection(pages[3]) == protection::ReadWriteExecute);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[3], 1); }) == 1);
+
+    // Neighbours going to different protections are separate runs
+    CHECK(SystemCallsOf([&] { manager.SetResting(pages[4], 2 * protection::PageSize, protection::NoAccess); }) == 1);
+    CHECK(SystemCallsOf([&] { manager.BeginWrite(pages[0], 8 * protection::PageSize, view); }) == 3);
+    CHECK(SystemProtection(pages[4]) == protection::ReadWrite && SystemProtection(pages[6]) == protection::ReadWriteExecute);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 8 * protection::PageSize); }) == 3);
+    CHECK(SystemProtection(pages[4]) == protection::NoAccess && SystemProtection(pages[7]) == protection::ReadExecute);
+}
+
+TEST("pages/a batch restores its pages when it closes")
+{
+    Pages pages(3);
+    CHECK(pages);
+    if (!pages)
+        return;
+
+    std::uint64_t calls = SystemCallsOf([&] {
+        protection::Manager::Batch batch;
+        {
+            protection::Manager::Batch nested;
+            CHECK(SystemCallsOf([&] { protection::Writable code(pages[0], 4); }) == 1);
+        }
+
+        // Pages released in the batch stay writable, writing them again changes nothing
+        CHECK(SystemProtection(pages[0]) == protection::ReadWriteExecute);
+        CHECK(SystemCallsOf([&] {
+            protection::Writable code(pages[0] + 8, 4);
+            *code.View(pages[0] + 8) = 0xC3;
+        }) == 0);
+        CHECK(SystemCallsOf([&] { protection::Writable code(pages[2], 4); }) == 1);
+        CHECK(SystemCallsOf([&] { protection::Writable code(pages[1], 4); }) == 1);
+    });
+
+    // The three neighbours are restored together
+    CHECK(calls == 4);
+    CHECK(SystemProtection(pages[0]) == protection::ReadExecute && SystemProtection(pages[2]) == protection::ReadExecute);
+    CHECK(pages[0][8] == 0xC3);
+}
+
+TEST("pages/resting protection waits for the last writer")
+{
+    Pages pages(2);
+    CHECK(pages);
+    if (!pages)
+        return;
+
+    protection::Manager& manager = protection::Manager::Global();
+    std::uint8_t* view = nullptr;
+    manager.BeginWrite(pages[0], 2 * protection::PageSize, view);
+    manager.BeginWrite(pages[0], 1, view);
+
+    // Held pages keep their write access, pages no writer holds change at once, batch or not
+    CHECK(SystemCallsOf([&] { manager.SetResting(pages[0], protection::PageSize, protection::NoAccess); }) == 0);
+    CHECK(SystemProtection(pages[0]) == protection::ReadWriteExecute);
+    manager.EndWrite(pages[0] + protection::PageSize, protection::PageSize);
+    CHECK(SystemProtection(pages[1]) == protection::ReadExecute);
+    {
+        protection::Manager::Batch batch;
+        CHECK(SystemCallsOf([&] { manager.SetResting(pages[1], protection::PageSize, protection::NoAccess); }) == 1);
+        CHECK(SystemProtection(pages[1]) == protection::NoAccess);
+    }
+
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], protection::PageSize); }) == 0);
+    CHECK(SystemProtection(pages[0]) == protection::ReadWriteExecute);
+    CHECK(SystemCallsOf([&] { manager.EndWrite(pages[0], 1); }) == 1);
+    CHECK(SystemProtection(pages[0]) == protection::NoAccess);
+}
+
+BENCHMARK("pages/system calls per write")
+{
+    constexpr std::size_t Iterations = 20000;
+    Pages pages(16);
+    if (!pages)
+        return;
+
+    char label[96];
+    for (std::size_t count : { 1, 4, 16 }) {
+        std::uint64_t calls = SystemCallsOf([&] {
+            double ns = scudotest::NanosecondsPer(Iterations, [&](std::size_t) { protection::Writable code(pages[0], count * protection::PageSize); });
+            std::snprintf(label, sizeof(label), "pages/write %zu adjacent pages", count);
+            scudotest::Report(label, ns, "ns");
+        });
+        std::snprintf(label, sizeof(label), "pages/write %zu adjacent pages, system calls", count);
+        scudotest::Report(label, static_cast<double>(calls) / Iterations, "per write");
+    }
+
+    // One handler writing the same pages several times, with and without a batch
+    for (bool batched : { false, true }) {
+        std::uint64_t calls = SystemCallsOf([&] {
+            double ns = scudotest::NanosecondsPer(Iterations, [&](std::size_t) {
+                std::optional<protection::Manager::Batch> batch;
+                if (batched)
+                    batch.emplace();
+                for (std::size_t write = 0; write < 4; ++write)
+                    protection::Writable code(pages[write % 2], 16);
+            });
+            std::snprintf(label, sizeof(label), "pages/4 writes of 2 pages%s", batched ? " in a batch" : "");
+            scudotest::Report(label, ns, "ns");
+        });
+        std::snprintf(label, sizeof(label), "pages/4 writes of 2 pages%s, system calls", batched ? " in a batch" : "");
+        scudotest::Report(label, static_cast<double>(calls) / Iterations, "per handler");
+    }
+}
@@ -0,0 +1,275 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <A64ExtentIndex.h>
+#include <A64Pdb.h>
+#include "ScudoTest.h"
+
+namespace {
+    /**
+     * @brief Reads a PDB fixture: functions.pdb written by functions.py, or llvm.pdb written by llvm-pdbutil from llvm.yaml.
+     */
+    std::vector<std::uint8_t> ReadFixture(const char* name = "functions.pdb") {
+        std::ifstream file(scudotest::Fixture(name), std::ios::binary);
+        return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    template<typename Record>
+    void Append(std::vector<std::uint8_t>& stream, const Record& record) {
+        auto bytes = reinterpret_cast<const std::uint8_t*>(&record);
+        stream.insert(stream.end(), bytes, bytes + sizeof(record));
+    }
+
+    void AppendString(std::vector<std::uint8_t>& stream, const std::string& string) {
+        stream.insert(stream.end(), string.c_str(), string.c_str() + string.size() + 1);
+    }
+
+    /**
+     * @brief Writes an MSF file of 4096 byte blocks, every stream contiguous, the first fillerBytes of zeros.
+     */
+    std::vector<std::uint8_t> WriteMsf(const std::vector<std::vector<std::uint8_t>>& streams, std::size_t fillerStream, std::size_t fillerBytes) {
+        constexpr std::uint32_t BlockSize = 4096;
+        auto blocks = [](std::size_t bytes) { return static_cast<std::uint32_t>((bytes + BlockSize - 1) / BlockSize); };
+
+        // Superblock and the two free block maps first, then the streams in order
+        std::vector<std::uint32_t> directory{ static_cast<std::uint32_t>(streams.size()) };
+        std::vector<std::uint32_t> streamBlocks;
+        std::uint32_t next = 3;
+        for (std::size_t stream = 0; stream < streams.size(); ++stream) {
+            std::size_t size = stream == fillerStream ? fillerBytes : streams[stream].size();
+            directory.push_back(static_cast<std::uint32_t>(size));
+            for (std::uint32_t block = 0; block < blocks(size); ++block)
+                streamBlocks.push_back(next++);
+        }
+        directory.insert(directory.end(), streamBlocks.begin(), streamBlocks.end());
+
+        // The directory, then the block listing the directory's blocks
+        std::uint32_t directoryBlock = next;
+        std::uint32_t directoryBytes = static_cast<std::uint32_t>(directory.size() * sizeof(std::uint32_t));
+        std::uint32_t blockMap = directoryBlock + blocks(directoryBytes);
+
+        std::vector<std::uint8_t> file(std::size_t(blockMap + 1) * BlockSize);
+        pdb::SuperBlock superBlock{ {}, BlockSize, 1, blockMap + 1, directoryBytes, 0, blockMap };
+        std::memcpy(superBlock.magic, pdb::Magic, sizeof(superBlock.magic));
+        std::memcpy(file.data(), &superBlock, sizeof(superBlock));
+
+        std::size_t offset = 3 * BlockSize;
+        for (std::size_t stream = 0; stream < streams.size(); ++stream) {
+            if (stream != fillerStream)
+                std::memcpy(file.data() + offset, streams[stream].data(), streams[stream].size());
+            offset += std::size_t(blocks(directory[1 + stream])) * BlockSize;
+        }
+        std::memcpy(file.data() + std::size_t(directoryBlock) * BlockSize, directory.data(), directoryBytes);
+        for (std::uint32_t block = 0; block < blocks(directoryBytes); ++block) {
+            std::uint32_t number = directoryBlock + block;
+            std::memcpy(file.data() + std::size_t(blockMap) * BlockSize + block * sizeof(number), &number, sizeof(number));
+        }
+        return file;
+    }
+
+    /**
+     * @brief A PDB the size of a large game's: modules of global procedures 0x40 apart in one .text section at 0x1000,
+     *        behind a type stream of fillerBytes the reader never touches.
+     */
+    std::vector<std::uint8_t> LargePdb(std::uint32_t modules, std::uint32_t proceduresPerModule, std::size_t fillerBytes) {
+        constexpr std::uint16_t S_END = 0x0006;
+        std::vector<std::vector<std::uint8_t>> streams(7);
+
+        pdb::InfoHeader info{ 20000404, 0, 1, {} };
+        Append(streams[pdb::InfoStream], info);
+
+        // Stream 5 holds the section headers, module streams follow
+        pdb::SectionHeader text{ ".text", 0x10000000, 0x1000, 0x10000000, 0x400, 0, 0, 0, 0, 0x60000020 };
+        Append(streams[5], text);
+
+        std::vector<std::uint8_t> moduleInfo;
+        for (std::uint32_t module = 0; module < modules; ++module) {
+            std::vector<std::uint8_t> symbols;
+            Append(symbols, pdb::ModuleSignatureC13);
+            for (std::uint32_t procedure = 0; procedure < proceduresPerModule; ++procedure) {
+                std::string name = "Module" + std::to_string(module) + "::Function" + std::to_string(procedure);
+                std::uint32_t index = module * proceduresPerModule + procedure;
+                pdb::ProcSymbol symbol{ 0, 0, 0, 0x30, 4, 0x2C, 0x1000, index * 0x40, 1, 0 };
+
+                // { u16 length, u16 kind, fields up to the flags, name }, padded to 4 bytes
+                std::size_t recordSize = (4 + offsetof(pdb::ProcSymbol, flags) + 1 + name.size() + 1 + 3) & ~std::size_t(3);
+                std::uint16_t header[2] = { static_cast<std::uint16_t>(recordSize - 2), pdb::S_GPROC32 };
+                std::size_t begin = symbols.size();
+                Append(symbols, header);
+                symbols.insert(symbols.end(), reinterpret_cast<const std::uint8_t*>(&symbol), reinterpret_cast<const std::uint8_t*>(&symbol) + offsetof(pdb::ProcSymbol, flags) + 1);
+                AppendString(symbols, name);
+                symbols.resize(begin + recordSize);
+
+                std::uint16_t end[2] = { 2, S_END };
+                Append(symbols, end);
+            }
+
+            pdb::ModuleInfo record{};
+            record.symbolStream = static_cast<std::uint16_t>(streams.size());
+            record.symbolBytes = static_cast<std::uint32_t>(symbols.size());
+            Append(moduleInfo, record);
+            std::string object = "C:\\build\\module" + std::to_string(module) + ".obj";
+            AppendString(moduleInfo, object);
+            AppendString(moduleInfo, object);
+            moduleInfo.resize((moduleInfo.size() + 3) & ~std::size_t(3));
+            streams.push_back(std::move(symbols));
+        }
+
+        // Optional debug header: every stream missing but the section headers
+        std::uint16_t debugHeader[11];
+        std::fill(std::begin(debugHeader), std::end(debugHeader), pdb::NilStreamIndex);
+        debugHeader[pdb::DebugSectionHeaders] = 5;
+
+        pdb::DbiHeader dbi{};
+        dbi.versionSignature = -1;
+        dbi.versionHeader = 19990903;
+        dbi.moduleInfoSize = static_cast<std::int32_t>(moduleInfo.size());
+        dbi.optionalDebugHeaderSize = sizeof(debugHeader);
+        dbi.globalStreamIndex = dbi.publicStreamIndex = dbi.symRecordStream = pdb::NilStreamIndex;
+        dbi.machine = 0x8664;
+        Append(streams[pdb::DbiStream], dbi);
+        streams[pdb::DbiStream].insert(streams[pdb::DbiStream].end(), moduleInfo.begin(), moduleInfo.end());
+        Append(streams[pdb::DbiStream], debugHeader);
+
+        return WriteMsf(streams, 2, fillerBytes);
+    }
+
+    // Procedures of the fixture in module and record order, as printed by functions.py
+    constexpr pdb::Function ExpectedFunctions[] = {
+        { 0x1000, 0x20 }, { 0x1040, 0x21 }, { 0x1080, 0x22 }, { 0x10C0, 0x23 },
+        { 0x1100, 0x24 }, { 0x1140, 0x25 }, { 0x1180, 0x26 }, { 0x11C0, 0x27 },
+        { 0x1200, 0x28 }, { 0x1240, 0x29 }, { 0x1280, 0x2A }, { 0x12C0, 0x2B },
+        { 0x5100, 0x80 }, { 0x5200, 0x44 },
+    };
+}
+
+TEST("pdb/function extents of the fixture")
+{
+    std::vector<std::uint8_t> data = ReadFixture();
+    CHECK(data.size() == 16 * 512);
+    if (data.empty())
+        return;
+
+    pdb::File file(data.data(), data.size());
+    CHECK(file.Valid());
+    CHECK(file.StreamCount() == 11);
+
+    // The module with procedures spans three scattered blocks
+    std::vector<std::uint8_t> stream;
+    CHECK(file.ReadStream(8, stream) && stream.size() == 1256);
+
+    std::uint8_t guid[16];
+    for (std::uint8_t i = 0; i < 16; ++i)
+        guid[i] = 0x10 + i;
+    CHECK(file.MatchesGuid(guid));
+    guid[15] ^= 1;
+    CHECK(!file.MatchesGuid(guid));
+
+    // Procedures without code or with a segment outside the section headers are skipped
+    std::vector<pdb::Function> functions = file.Functions();
+    CHECK(functions.size() == std::size(ExpectedFunctions));
+    for (std::size_t i = 0; i < functions.size() && i < std::size(ExpectedFunctions); ++i) {
+        if (functions[i].rva != ExpectedFunctions[i].rva || functions[i].size != ExpectedFunctions[i].size) {
+            std::printf("    function %zu: 0x%X + 0x%X, expected 0x%X + 0x%X\n", i, functions[i].rva, functions[i].size, ExpectedFunctions[i].rva, ExpectedFunctions[i].size);
+            CHECK(!"function extent");
+        }
+    }
+}
+
+TEST("pdb/a PDB written by LLVM")
+{
+    // Laid out by LLVM's MSF writer instead of by hand, as lld-link writes its PDBs
+    std::vector<std::uint8_t> data = ReadFixture("llvm.pdb");
+    CHECK(data.size() == 12 * 4096);
+    if (data.empty())
+        return;
+
+    pdb::File file(data.data(), data.size());
+    CHECK(file.Valid());
+    CHECK(file.StreamCount() == 9);
+    CHECK(file.StreamSize(6) == 128 && file.StreamSize(7) == 128);
+
+    std::uint8_t guid[16];
+    for (std::uint8_t i = 0; i < 16; ++i)
+        guid[i] = static_cast<std::uint8_t>(i * 0x11);
+    CHECK(file.MatchesGuid(guid));
+
+    // No section header stream, procedures resolve against the image's .text at 0x1000. The one without code is skipped
+    CHECK(file.Functions().empty());
+    pdb::SectionHeader text{ ".text", 0x3000, 0x1000, 0x3000, 0x400, 0, 0, 0, 0, 0x60000020 };
+    std::vector<pdb::Function> functions = file.Functions({ &text, 1 });
+    CHECK(functions.size() == 3);
+    if (functions.size() == 3) {
+        CHECK(functions[0].rva == 0x1010 && functions[0].size == 48);
+        CHECK(functions[1].rva == 0x1040 && functions[1].size == 7);
+        CHECK(functions[2].rva == 0x2000 && functions[2].size == 300);
+    }
+
+    // The index reads the section headers from the image: MZ, PE header at 0x40, one section after a 0xF0 byte optional header
+    std::vector<std::uint8_t> image(0x400);
+    std::uint32_t peOffset = 0x40;
+    std::uint16_t sectionCount = 1, optionalHeaderSize = 0xF0;
+    std::memcpy(image.data(), "MZ", 2);
+    std::memcpy(image.data() + 0x3C, &peOffset, sizeof(peOffset));
+    std::memcpy(image.data() + peOffset, "PE\0\0", 4);
+    std::memcpy(image.data() + peOffset + 6, &sectionCount, sizeof(sectionCount));
+    std::memcpy(image.data() + peOffset + 20, &optionalHeaderSize, sizeof(optionalHeaderSize));
+    std::memcpy(image.data() + peOffset + 24 + optionalHeaderSize, &text, sizeof(text));
+
+    auto base = reinterpret_cast<std::uintptr_t>(image.data());
+    FunctionExtentIndex index = FunctionExtentIndex::FromPdbFile(file, base);
+    CHECK(index.Count() == 3);
+    CHECK(index.Size(reinterpret_cast<const void*>(base + 0x2000)) == 300);
+}
+
+TEST("pdb/corrupt files are rejected")
+{
+    std::vector<std::uint8_t> data = ReadFixture();
+    if (data.size() < sizeof(pdb::SuperBlock)) {
+        CHECK(!"fixture missing");
+        return;
+    }
+
+    // Shorter than the blocks the superblock declares
+    CHECK(!pdb::File(data.data(), data.size() - 512).Valid());
+    CHECK(!pdb::File(data.data(), sizeof(pdb::SuperBlock) - 1).Valid());
+
+    std::vector<std::uint8_t> corrupt = data;
+    reinterpret_cast<pdb::SuperBlock*>(corrupt.data())->blockSize = 1000;
+    CHECK(!pdb::File(corrupt.data(), corrupt.size()).Valid());
+
+    corrupt = data;
+    reinterpret_cast<pdb::SuperBlock*>(corrupt.data())->blockMapAddress = 16;
+    CHECK(!pdb::File(corrupt.data(), corrupt.size()).Valid());
+
+    corrupt = data;
+    corrupt[0] ^= 0xFF;
+    CHECK(!pdb::File(corrupt.data(), corrupt.size()).Valid());
+    CHECK(pdb::File(corrupt.data(), corrupt.size()).Functions().empty());
+}
+
+BENCHMARK("pdb/index a 200 MB PDB")
+{
+    // 2500 modules of 300 procedures, about 50 MB of symbols, behind 150 MB of types
+    constexpr std::uint32_t Modules = 2500, Procedures = 300;
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "scudo-bench.pdb";
+    {
+        std::vector<std::uint8_t> data = LargePdb(Modules, Procedures, 150u << 20);
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        scudotest::Report("PDB size", static_cast<double>(data.size()) / (1 << 20), "MB");
+    }
+
+    // Mapped, parsed and sorted, the file cached by the write above
+    std::size_t count = 0;
+    double nanoseconds = scudotest::NanosecondsPer(5, [&](std::size_t) {
+        count = FunctionExtentIndex::FromPdbPath(path.string().c_str(), 0x140000000).Count();
+    });
+    std::filesystem::remove(path);
+
+    CHECK(count == std::size_t(Modules) * Procedures);
+    CHECK(nanoseconds < 1e9);
+    scudotest::Report("FromPdbPath", nanoseconds / 1e6, "ms");
+    scudotest::Report("procedures", static_cast<double>(count), "");
+}
@@ -0,0 +1,612 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include "B64Encryption.h"
+#include "ScudoTest.h"
+
+#ifndef _WIN32
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#endif // !_WIN32
+
+namespace {
+    // Protected functions, only ever called through scudotest::Opaque so every call reaches the protected code
+
+    SCUDO_NOINLINE long Leaf(long x) {
+        long sum = 0;
+        for (long i = 0; i < (x & 7) + 1; ++i)
+            sum += x * i + 3;
+        return sum;
+    }
+
+    SCUDO_NOINLINE long Nested(long x) {
+        return scudotest::Opaque(&Leaf)(x) + scudotest::Opaque(&Leaf)(x + 1) + 1;
+    }
+
+    SCUDO_NOINLINE long Recursive(long n) {
+        return n <= 1 ? 1 : n + scudotest::Opaque(&Recursive)(n - 1);
+    }
+
+    SCUDO_NOINLINE double FloatingPoint(double a, double b) {
+        return a * b + 0.5;
+    }
+
+    SCUDO_NOINLINE long double Extended(long double a) {
+        return a * 3;
+    }
+
+    SCUDO_NOINLINE long StackArguments(long a, long b, long c, long d, long e, long f, double g, double h) {
+        return a + 2 * b + 3 * c + 4 * d + 5 * e + 6 * f + static_cast<long>(g * h);
+    }
+
+#ifdef __AVX__
+    // The upper halves of ymm registers must survive the handler and the thunk
+    SCUDO_NOINLINE __m256d VectorAdd(__m256d a, __m256d b) {
+        return _mm256_add_pd(a, b);
+    }
+#endif // __AVX__
+
+    long ExpectedLeaf(long x) {
+        long sum = 0;
+        for (long i = 0; i < (x & 7) + 1; ++i)
+            sum += x * i + 3;
+        return sum;
+    }
+
+    // Distinct functions for the thread scaling benchmark
+    template<int N>
+    SCUDO_NOINLINE long Work(long x) {
+        return x * (2 * N + 1) + N;
+    }
+
+    template<int... N>
+    constexpr std::array<long(*)(long), sizeof...(N)> WorkFunctions(std::integer_sequence<int, N...>) {
+        return { &Work<N>... };
+    }
+
+    constexpr std::size_t MaxThreads = 64;
+    constexpr auto Workers = WorkFunctions(std::make_integer_sequence<int, MaxThreads>());
+
+    /**
+     * @brief Lets the handler act, it only handles calls for an authenticated user.
+     */
+    void Authenticate() {
+        if (!Scudo::userRequestHandler)
+            Scudo::userRequestHandler = std::make_unique<UserRequestHandler>("", "");
+        Scudo::userRequestHandler->statusCode = UserRequestHandler::authenticated;
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief Permissions of the mapping holding address in /proc/self/maps, such as "r-xp", empty if it isn't mapped.
+     */
+    std::string Permissions(const void* address) {
+        std::ifstream maps("/proc/self/maps");
+        auto page = reinterpret_cast<std::uintptr_t>(address);
+        for (std::string line; std::getline(maps, line);) {
+            std::istringstream fields(line);
+            std::uintptr_t begin, end;
+            char dash;
+            std::string permissions;
+            fields >> std::hex >> begin >> dash >> end >> permissions;
+            if (page >= begin && page < end)
+                return permissions;
+        }
+        return {};
+    }
+#endif // !_WIN32
+
+    /**
+     * @brief Returns true if the page holding address can't be read, according to the system.
+     */
+    bool Inaccessible(const void* address) {
+#ifdef _WIN32
+        MEMORY_BASIC_INFORMATION region;
+        return VirtualQuery(address, &region, sizeof(region)) && (region.Protect & 0xFF) == PAGE_NOACCESS;
+#else
+        std::string permissions = Permissions(address);
+        return !permissions.empty() && permissions[0] != 'r';
+#endif // _WIN32
+    }
+
+    /*
+        A function assembled at the end of the first of six pages and ending on page 4, so its interior is pages 1 to 3.
+        Argument 1 runs page 1, which jumps to page 3, argument 4 returns from page 4. Page 2 is never run.
+        Page 3 leaves the function through a jump to PagedCallback, so the call still runs while it checks.
+        Nops fill the function between its blocks, so the extent walk measures it as one range.
+    */
+    struct PagedFunction {
+        static constexpr std::size_t Pages = 6;
+        static constexpr std::size_t EntryOffset = 0xF00;
+
+        BYTE* base = nullptr;
+        std::uint32_t reached = 0;         ///< Argument PagedCallback was called with
+        bool plaintext[3] = {};            ///< Interior pages decrypted during the call
+        bool inaccessible[3] = {};         ///< Interior pages the system reports inaccessible during the call
+
+        PagedFunction();
+        ~PagedFunction();
+
+        BYTE* Entry() const { return base + EntryOffset; }
+        BYTE* Page(std::size_t page) const { return base + page * PAGE_LENGTH; }
+        long Call(long argument) const { return scudotest::Opaque(reinterpret_cast<long(*)(long)>(Entry()))(argument); }
+    };
+
+    PagedFunction* pagedFunction = nullptr;
+
+    SCUDO_NOINLINE long PagedCallback(long argument) {
+        PagedFunction& function = *pagedFunction;
+        function.reached = static_cast<std::uint32_t>(argument);
+        Scudo* protectedFunction = Scudo::getEncryptedFunction(function.Entry());
+        for (std::size_t page = 0; page < 3; ++page) {
+            function.plaintext[page] = protectedFunction && protectedFunction->interior[page].plaintext.load();
+            function.inaccessible[page] = Inaccessible(function.Page(page + 1));
+        }
+        return argument * 7;
+    }
+
+    PagedFunction::PagedFunction() {
+#ifdef _WIN32
+        base = static_cast<BYTE*>(VirtualAlloc(nullptr, Pages * PAGE_LENGTH, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+        constexpr BYTE CompareArgument = 0xF9, MoveArgument = 0xB9;   // cmp ecx, imm8 / mov ecx, imm32
+#else
+        void* mapped = mmap(nullptr, Pages * PAGE_LENGTH, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        base = mapped != MAP_FAILED ? static_cast<BYTE*>(mapped) : nullptr;
+        constexpr BYTE CompareArgument = 0xFF, MoveArgument = 0xBF;   // cmp edi, imm8 / mov edi, imm32
+#endif // _WIN32
+        if (!base)
+            return;
+        std::memset(base, BREAKPOINT_BYTE, Pages * PAGE_LENGTH);
+        std::memset(Entry(), 0x90, Page(4) - Entry());
+
+        auto relative = [](const BYTE* next, const BYTE* target) { return static_cast<std::int32_t>(target - next); };
+        auto write = [](BYTE*& at, std::initializer_list<BYTE> bytes) { for (BYTE byte : bytes) *at++ = byte; };
+        auto write32 = [](BYTE*& at, std::int32_t value) { std::memcpy(at, &value, sizeof(value)); at += sizeof(value); };
+
+        // cmp argument, page; je page, for pages 1, 3 and 4, then xor eax, eax; ret
+        BYTE* at = Entry();
+        for (std::size_t page : { 1, 3, 4 }) {
+            write(at, { 0x83, CompareArgument, static_cast<BYTE>(page), 0x0F, 0x84 });
+            write32(at, relative(at + 4, Page(page)));
+        }
+        write(at, { 0x31, 0xC0, 0xC3 });
+
+        // Page 1: jmp to the middle of page 3
+        at = Page(1);
+        write(at, { 0xE9 });
+        write32(at, relative(at + 4, Page(3) + 0x803));
+
+        // Page 3: mov argument, 3 or 13; mov rax, PagedCallback; jmp rax
+        for (std::pair<BYTE*, BYTE> exit : { std::pair{ Page(3), BYTE(3) }, std::pair{ Page(3) + 0x803, BYTE(13) } }) {
+            at = exit.first;
+            write(at, { MoveArgument, exit.second, 0x00, 0x00, 0x00, 0x48, 0xB8 });
+            auto callback = reinterpret_cast<std::uint64_t>(&PagedCallback);
+            std::memcpy(at, &callback, sizeof(callback));
+            at += sizeof(callback);
+            write(at, { 0xFF, 0xE0 });
+        }
+
+        // Page 4: mov eax, 4; ret, the end of the function
+        at = Page(4);
+        write(at, { 0xB8, 0x04, 0x00, 0x00, 0x00, 0xC3 });
+
+#ifdef _WIN32
+        DWORD previous;
+        VirtualProtect(base, Pages * PAGE_LENGTH, PAGE_EXECUTE_READ, &previous);
+#else
+        mprotect(base, Pages * PAGE_LENGTH, PROT_READ | PROT_EXEC);
+#endif // _WIN32
+        pagedFunction = this;
+    }
+
+    PagedFunction::~PagedFunction() {
+        pagedFunction = nullptr;
+        if (!base)
+            return;
+        protection::Manager::Global().SetResting(base, Pages * PAGE_LENGTH, protection::ReadExecute);
+#ifdef _WIN32
+        VirtualFree(base, 0, MEM_RELEASE);
+#else
+        munmap(base, Pages * PAGE_LENGTH);
+#endif // _WIN32
+    }
+
+#ifndef _WIN32
+    /**
+     * @brief Runs body in a child process, true if it exited without failed checks. Its own checks print as usual.
+     */
+    template<typename Body>
+    bool InChild(Body&& body) {
+        std::fflush(stdout);
+        pid_t child = fork();
+        if (child == 0) {
+            scudotest::Failures() = 0;
+            body();
+            std::fflush(stdout);
+            _exit(scudotest::Failures() ? 1 : 0);
+        }
+        int status = 0;
+        return child > 0 && waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    /**
+     * @brief Makes memfd_create fail with ENOSYS in this process and its children, as on kernels without it.
+     */
+    bool BlockMemfd() {
+        sock_filter filter[] = {
+            BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, nr)),
+            BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SYS_memfd_create, 0, 1),
+            BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | ENOSYS),
+            BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+        };
+        sock_fprog program{ static_cast<unsigned short>(std::size(filter)), filter };
+        return prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) == 0 && prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) == 0;
+    }
+
+    /*
+        A function on a page of its own, aliased before it is protected as AA_DUAL_MAPPING does, then called,
+        and a forked child that unprotects and rewrites its copy. Runs in a child process: the manager keeps
+        the aliases of the page, which would outlive its mapping in the process running the other tests.
+    */
+    void RunAliased(bool mirrored) {
+        void* mapped = mmap(nullptr, PAGE_LENGTH, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        CHECK(mapped != MAP_FAILED);
+        if (mapped == MAP_FAILED)
+            return;
+
+        // mov eax, 42; ret
+        auto code = static_cast<BYTE*>(mapped);
+        std::memset(code, BREAKPOINT_BYTE, PAGE_LENGTH);
+        std::memcpy(code, "\xB8\x2A\x00\x00\x00\xC3", 6);
+        mprotect(code, PAGE_LENGTH, PROT_READ | PROT_EXEC);
+        auto call = [code] { return scudotest::Opaque(reinterpret_cast<long(*)()>(code))(); };
+
+        // Shared with a memfd, or written through /proc/self/mem where memfd_create fails
+        protection::Manager& manager = protection::Manager::Global();
+        CHECK(manager.Alias(code, PAGE_LENGTH));
+        CHECK(Permissions(code) == (mirrored ? "r-xp" : "r-xs"));
+
+        AAPROTECT(code, AA_MODE_BREAKPOINT);
+        CHECK(code[0] == BREAKPOINT_BYTE && std::memcmp(code + 1, "\x2A\x00\x00\x00\xC3", 5) != 0);
+
+        // Decrypted and encrypted again without a protection change, the page is never writable
+        std::uint64_t systemCalls = manager.SystemCalls();
+        CHECK(call() == 42 && call() == 42);
+        CHECK(manager.SystemCalls() == systemCalls);
+        CHECK(Permissions(code) == (mirrored ? "r-xp" : "r-xs") && code[0] == BREAKPOINT_BYTE);
+
+        // The child gets private code, what it writes never reaches this process
+        BYTE encrypted[6];
+        std::memcpy(encrypted, code, sizeof(encrypted));
+        CHECK(InChild([&] {
+            CHECK(Permissions(code) == "r-xp");
+            CHECK(call() == 42);
+            AAUNPROTECT();
+            {
+                protection::Writable memCode(code, 6);
+                CHECK(static_cast<bool>(memCode));
+                *memCode.View(code + 1) = 7;
+            }
+            CHECK(call() == 7);
+        }));
+        CHECK(std::memcmp(code, encrypted, sizeof(encrypted)) == 0);
+        CHECK(call() == 42);
+
+        AAUNPROTECT();
+        CHECK(code[1] == 0x2A && call() == 42);
+    }
+#endif // !_WIN32
+
+    const char* ModeName(AA_PROTECTION_MODE mode) {
+        switch (mode) {
+        case AA_MODE_THUNK: return "thunk";
+#ifdef AA_DEBUG_REGISTERS
+        case AA_MODE_RETURN_PATCH: return "return patch, debug registers";
+#else
+        case AA_MODE_RETURN_PATCH: return "return patch, int3";
+#endif // AA_DEBUG_REGISTERS
+        case AA_MODE_EPOCH: return "epoch";
+        default: return "breakpoint";
+        }
+    }
+
+    /**
+     * @brief Returns true once the function is encrypted and its entry intercepts calls again.
+     */
+    bool AtRest(Scudo* function, const BYTE* plaintext, std::size_t length) {
+        const BYTE* code = static_cast<const BYTE*>(function->functionAddress);
+        if (code[0] != (function->mode == AA_MODE_THUNK ? 0xE9 : BREAKPOINT_BYTE))
+            return false;
+
+        // The entry jmp covers the first bytes in thunk mode
+        std::size_t end = function->functionSize < length ? function->functionSize : length;
+        return std::memcmp(code + thunk::JumpLength, plaintext + thunk::JumpLength, end - thunk::JumpLength) != 0;
+    }
+
+    void CheckMode(AA_PROTECTION_MODE mode, bool batch) {
+        Authenticate();
+
+        // Plaintext of Leaf, it must be encrypted whenever no call runs it
+        BYTE plaintext[64];
+        std::memcpy(plaintext, reinterpret_cast<const void*>(&Leaf), sizeof(plaintext));
+
+        void* functions[] = {
+            reinterpret_cast<void*>(&Leaf), reinterpret_cast<void*>(&Nested), reinterpret_cast<void*>(&Recursive),
+            reinterpret_cast<void*>(&FloatingPoint), reinterpret_cast<void*>(&Extended), reinterpret_cast<void*>(&StackArguments),
+#ifdef __AVX__
+            reinterpret_cast<void*>(&VectorAdd),
+#endif // __AVX__
+        };
+        if (batch)
+            AAPROTECT_MANY(functions, mode);
+        else
+            for (void* function : functions)
+                AAPROTECT(function, mode);
+
+        CHECK(Scudo::protectedFunctions.size() == std::size(functions));
+        Scudo* leaf = Scudo::getEncryptedFunction(reinterpret_cast<void*>(&Leaf));
+        CHECK(leaf != nullptr);
+        if (!leaf)
+            return;
+        CHECK(AtRest(leaf, plaintext, sizeof(plaintext)));
+
+        // Arguments and results in every kind of register, nested and recursive calls
+        CHECK(scudotest::Opaque(&Leaf)(5) == ExpectedLeaf(5));
+        CHECK(scudotest::Opaque(&Nested)(7) == ExpectedLeaf(7) + ExpectedLeaf(8) + 1);
+        CHECK(scudotest::Opaque(&Recursive)(50) == 1275);
+        CHECK(scudotest::Opaque(&FloatingPoint)(1.5, 2) == 3.5);
+        CHECK(scudotest::Opaque(&Extended)(1.25L) == 3.75L);
+        CHECK(scudotest::Opaque(&StackArguments)(1, 2, 3, 4, 5, 6, 2.5, 4) == 1 + 4 + 9 + 16 + 25 + 36 + 10);
+#ifdef __AVX__
+        double sum[4];
+        _mm256_storeu_pd(sum, scudotest::Opaque(&VectorAdd)(_mm256_set_pd(4, 3, 2, 1), _mm256_set_pd(40, 30, 20, 10)));
+        CHECK(sum[0] == 11 && sum[1] == 22 && sum[2] == 33 && sum[3] == 44);
+#endif // __AVX__
+
+        // The same functions from several threads at once
+        std::atomic<int> wrong{ 0 };
+        std::vector<std::thread> threads;
+        for (long t = 0; t < 8; ++t) {
+            threads.emplace_back([&wrong, t] {
+                for (long i = 0; i < 5000; ++i) {
+                    if (scudotest::Opaque(&Nested)(i + t) != ExpectedLeaf(i + t) + ExpectedLeaf(i + t + 1) + 1)
+                        ++wrong;
+                    if (i % 64 == 0 && scudotest::Opaque(&Recursive)(20) != 210)
+                        ++wrong;
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        CHECK(wrong.load() == 0);
+
+        // Re-encrypted by the last call returning, or by a sweep within a few epochs
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (mode == AA_MODE_EPOCH && !AtRest(leaf, plaintext, sizeof(plaintext)) && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(AA_EPOCH_MILLISECONDS));
+        CHECK(AtRest(leaf, plaintext, sizeof(plaintext)));
+
+        // Unprotecting gives the plaintext back for good
+        AAUNPROTECT();
+        CHECK(Scudo::protectedFunctions.empty());
+        CHECK(std::memcmp(reinterpret_cast<const void*>(&Leaf), plaintext, sizeof(plaintext)) == 0);
+        CHECK(scudotest::Opaque(&Leaf)(3) == ExpectedLeaf(3));
+    }
+}
+
+TEST("protection/breakpoint mode")
+{
+    CheckMode(AA_MODE_BREAKPOINT, false);
+}
+
+TEST("protection/thunk mode")
+{
+    CheckMode(AA_MODE_THUNK, false);
+}
+
+TEST("protection/return patch mode")
+{
+    CheckMode(AA_MODE_RETURN_PATCH, false);
+}
+
+TEST("protection/epoch mode")
+{
+    CheckMode(AA_MODE_EPOCH, false);
+}
+
+TEST("protection/batch of functions")
+{
+    CheckMode(AA_MODE_BREAKPOINT, true);
+    CheckMode(AA_MODE_THUNK, true);
+}
+
+TEST("protection/overlapping functions are rejected")
+{
+    Authenticate();
+    AAPROTECT(reinterpret_cast<void*>(&Leaf), AA_MODE_BREAKPOINT);
+
+    // Protecting the function again, or from inside its code, would encrypt its bytes under a second key
+    for (std::uintptr_t offset : { 0, 4 }) {
+        bool rejected = false;
+        try {
+            AAPROTECT(reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(&Leaf) + offset), AA_MODE_BREAKPOINT);
+        }
+        catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    CHECK(Scudo::protectedFunctions.size() == 1);
+    CHECK(scudotest::Opaque(&Leaf)(6) == ExpectedLeaf(6));
+    AAUNPROTECT();
+    CHECK(scudotest::Opaque(&Leaf)(6) == ExpectedLeaf(6));
+}
+
+TEST("protection/paged function decrypts only the pages calls reach")
+{
+    Authenticate();
+    PagedFunction function;
+    CHECK(function.base != nullptr);
+    if (!function.base)
+        return;
+
+    // Functions spanning three whole pages or more are paged
+    SIZE_T pagedMinPages = std::exchange(Scudo::pagedMinPages, 3);
+    AAPROTECT(function.Entry(), AA_MODE_BREAKPOINT);
+    Scudo::pagedMinPages = pagedMinPages;
+
+    Scudo* paged = Scudo::getEncryptedFunction(function.Entry());
+    CHECK(paged && paged->functionSize == static_cast<SIZE_T>(function.Page(4) + 6 - function.Entry()));
+    CHECK(paged && paged->interior.Count() == 3 && paged->interior.Begin() == function.Page(1));
+    if (!paged || paged->interior.Count() != 3)
+        return;
+
+    std::uint32_t epochs[3];
+    for (std::size_t page = 0; page < 3; ++page) {
+        CHECK(!paged->interior[page].plaintext && Inaccessible(function.Page(page + 1)));
+        epochs[page] = paged->interior[page].epoch;
+    }
+
+    // Pages 1 and 3 are decrypted as the call reaches them, page 2 stays encrypted and inaccessible
+    CHECK(function.Call(1) == 13 * 7 && function.reached == 13);
+    CHECK(function.plaintext[0] && !function.plaintext[1] && function.plaintext[2]);
+    CHECK(!function.inaccessible[0] && function.inaccessible[1] && !function.inaccessible[2]);
+
+    // Once the call returned the reached pages rest encrypted under new epochs, the other one was never rewritten
+    for (std::size_t page = 0; page < 3; ++page)
+        CHECK(!paged->interior[page].plaintext && Inaccessible(function.Page(page + 1)));
+    CHECK(paged->interior[0].epoch != epochs[0] && paged->interior[1].epoch == epochs[1] && paged->interior[2].epoch != epochs[2]);
+
+    // A call that only runs the head and the tail reaches no interior page
+    epochs[0] = paged->interior[0].epoch, epochs[2] = paged->interior[2].epoch;
+    CHECK(function.Call(4) == 4 && function.Call(0) == 0);
+    CHECK(function.Call(3) == 3 * 7 && function.plaintext[2] && !function.plaintext[0] && function.inaccessible[0]);
+    CHECK(paged->interior[0].epoch == epochs[0] && paged->interior[1].epoch == epochs[1] && paged->interior[2].epoch != epochs[2]);
+
+    // Unprotecting decrypts every page for good
+    AAUNPROTECT();
+    CHECK(!Inaccessible(function.Page(2)) && function.Page(2)[0] == 0x90 && function.Page(4)[0] == 0xB8);
+    CHECK(function.Call(1) == 13 * 7 && function.Call(4) == 4);
+}
+
+#ifndef _WIN32
+TEST("protection/aliased code stays private to a forked child")
+{
+    Authenticate();
+
+    std::printf("    memfd\n");
+    CHECK(InChild([] { RunAliased(false); }));
+
+    std::printf("    /proc/self/mem\n");
+    CHECK(InChild([] {
+        if (!BlockMemfd() || protection::Manager::processMemory() < 0) {
+            std::printf("    memfd_create can't be blocked or /proc/self/mem can't be opened, skipped\n");
+            return;
+        }
+        RunAliased(true);
+    }));
+}
+#endif // !_WIN32
+
+BENCHMARK("protection/call per mode")
+{
+    Authenticate();
+    constexpr std::size_t calls = 50000;
+
+    std::uint64_t folded = 0;
+    scudotest::Report("unprotected", scudotest::NanosecondsPer(calls, [&](std::size_t i) { folded += scudotest::Opaque(&Leaf)(static_cast<long>(i)); }), "ns/call");
+
+    // The handler latency of every mode, and the protection changes it costs
+    for (AA_PROTECTION_MODE mode : { AA_MODE_BREAKPOINT, AA_MODE_THUNK, AA_MODE_RETURN_PATCH, AA_MODE_EPOCH }) {
+        AAPROTECT(reinterpret_cast<void*>(&Leaf), mode);
+
+        std::uint64_t systemCalls = protection::Manager::Global().SystemCalls();
+        double nanoseconds = scudotest::NanosecondsPer(calls, [&](std::size_t i) { folded += scudotest::Opaque(&Leaf)(static_cast<long>(i)); });
+        double perCall = static_cast<double>(protection::Manager::Global().SystemCalls() - systemCalls) / calls;
+        AAUNPROTECT();
+
+        char label[96];
+        std::snprintf(label, sizeof(label), "%s (%.2f protection changes/call)", ModeName(mode), perCall);
+        scudotest::Report(label, nanoseconds, "ns/call");
+    }
+    scudotest::Consume(folded);
+}
+
+BENCHMARK("protection/calls per second by thread count")
+{
+    Authenticate();
+
+    void* functions[MaxThreads];
+    for (std::size_t i = 0; i < MaxThreads; ++i)
+        functions[i] = reinterpret_cast<void*>(Workers[i]);
+    AAPROTECT_MANY(functions, AA_MODE_THUNK);
+
+    // Every thread calls for the same time, either its own function or the function shared by all of them
+    for (bool shared : { false, true }) {
+        for (std::size_t threadCount = 1; threadCount <= MaxThreads; threadCount *= 2) {
+            std::atomic<bool> start{ false }, stop{ false };
+            std::atomic<std::uint64_t> total{ 0 };
+            std::vector<std::thread> threads;
+            for (std::size_t t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&, function = Workers[shared ? 0 : t]] {
+                    while (!start.load())
+                        std::this_thread::yield();
+
+                    std::uint64_t calls = 0, folded = 0;
+                    while (!stop.load(std::memory_order_relaxed)) {
+                        for (int i = 0; i < 64; ++i)
+                            folded += scudotest::Opaque(function)(i);
+                        calls += 64;
+                    }
+                    total += calls;
+                    scudotest::Consume(folded);
+                });
+            }
+
+            auto begin = std::chrono::steady_clock::now();
+            start.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            stop.store(true);
+            for (std::thread& thread : threads)
+                thread.join();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+            char label[64];
+            std::snprintf(label, sizeof(label), "%s function, %zu threads", shared ? "shared" : "distinct", threadCount);
+            scudotest::Report(label, total.load() / seconds / 1e6, "M calls/s");
+        }
+    }
+    AAUNPROTECT();
+}
+
+BENCHMARK("protection/protect a batch")
+{
+    Authenticate();
+
+    void* functions[MaxThreads];
+    for (std::size_t i = 0; i < MaxThreads; ++i)
+        functions[i] = reinterpret_cast<void*>(Workers[i]);
+
+    // Measured and encrypted on the worker pool, whose threads are started by the first batch only
+    constexpr std::size_t Batches = 200;
+    double microseconds = scudotest::NanosecondsPer(Batches, [&](std::size_t) {
+        AAPROTECT_MANY(functions, AA_MODE_THUNK);
+        AAUNPROTECT();
+    }) / 1000;
+
+    char label[96];
+    std::snprintf(label, sizeof(label), "protection/protect and unprotect %zu functions", MaxThreads);
+    scudotest::Report(label, microseconds, "us");
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+/*
+    Minimal test and benchmark registry for scudo-tests, so the harness builds with nothing but the library sources.
+    TEST bodies report failures with CHECK and keep running, BENCHMARK bodies print their measurements with Report.
+    main.cpp runs every test, or every benchmark with --bench, whose name contains the filter given on the command line.
+    Cases read their input files with Fixture, from the directory given with --fixtures or found next to the executable.
+*/
+
+#if defined(_MSC_VER)
+#define SCUDO_NOINLINE __declspec(noinline)
+#else
+#define SCUDO_NOINLINE __attribute__((noinline))
+#endif // _MSC_VER
+
+namespace scudotest
+{
+    using Body = void(*)();
+
+    struct Case {
+        const char* name;
+        Body body;
+        bool benchmark;
+    };
+
+    inline std::vector<Case>& Cases() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    struct Registrar {
+        Registrar(const char* name, Body body, bool benchmark) { Cases().push_back({ name, body, benchmark }); }
+    };
+
+    /**
+     * @brief Failed checks of the case running now, reset by the runner before every case.
+     */
+    inline int& Failures() {
+        static int failures = 0;
+        return failures;
+    }
+
+    inline void Fail(const char* file, int line, const char* expression) {
+        ++Failures();
+        std::printf("    %s:%d: CHECK(%s) failed\n", file, line, expression);
+    }
+
+    /**
+     * @brief Directory holding the fixtures, set by main before any case runs.
+     */
+    inline std::filesystem::path& FixtureDirectory() {
+        static std::filesystem::path directory;
+        return directory;
+    }
+
+    inline std::filesystem::path Fixture(const char* name) { return FixtureDirectory() / name; }
+
+    /**
+     * @brief Prints one measurement of a benchmark.
+     */
+    inline void Report(const char* label, double value, const char* unit) {
+        std::printf("    %-60s %12.2f %s\n", label, value, unit);
+    }
+
+    /**
+     * @brief Keeps a result alive so the measured work isn't optimized away.
+     */
+    inline void Consume(std::uint64_t value) {
+#if defined(_MSC_VER)
+        static volatile std::uint64_t sink;
+        sink = value;
+#else
+        __asm__ __volatile__("" : : "r"(value) : "memory");
+#endif // _MSC_VER
+    }
+
+    /**
+     * @brief Hides a function pointer from the optimizer, calls through it can't be inlined, cloned or constant folded.
+     *
+     * Protected functions must be called through their address, a specialized copy would run unprotected.
+     */
+    template<typename Function>
+    Function* Opaque(Function* function) {
+        Function* volatile pointer = function;
+        return pointer;
+    }
+
+    /**
+     * @brief Runs body(i) for i in [0, iterations) and returns the average time of one iteration in nanoseconds.
+     */
+    template<typename Loop>
+    double NanosecondsPer(std::size_t iterations, Loop&& body) {
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+            body(i);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(iterations);
+    }
+}
+
+#define SCUDO_CONCAT_(left, right) left##right
+#define SCUDO_CONCAT(left, right) SCUDO_CONCAT_(left, right)
+
+#define SCUDO_CASE(name, benchmark) \
+    static void SCUDO_CONCAT(scudoCase, __LINE__)(); \
+    static const scudotest::Registrar SCUDO_CONCAT(scudoRegistrar, __LINE__)(name, &SCUDO_CONCAT(scudoCase, __LINE__), benchmark); \
+    static void SCUDO_CONCAT(scudoCase, __LINE__)()
+
+#define TEST(name) SCUDO_CASE(name, false)
+#define BENCHMARK(name) SCUDO_CASE(name, true)
+
+#define CHECK(expression) ((expression) ? (void)0 : scudotest::Fail(__FILE__, __LINE__, #expression))
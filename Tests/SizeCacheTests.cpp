@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <A64Extent.h>
+#include <A64SizeCache.h>
+#include "ScudoTest.h"
+
+/*
+    The cache files are named after the build-id of the module and kept under XDG_CACHE_HOME, so these tests
+    run on a module of their own, with a build-id they choose, and a cache directory they remove afterwards.
+*/
+#ifndef _WIN32
+#include <sys/mman.h>
+
+namespace {
+    constexpr std::size_t PageSize = 0x1000;
+    constexpr std::size_t FunctionCount = 32;
+
+    /**
+     * @brief Points XDG_CACHE_HOME at a new private directory for the lifetime of the object.
+     */
+    class CacheHome {
+    public:
+        CacheHome() {
+            char path[] = "/tmp/scudo-cache-XXXXXX";
+            if (mkdtemp(path))
+                path_ = path;
+            if (const char* previous = std::getenv("XDG_CACHE_HOME"))
+                previous_ = previous, hadPrevious_ = true;
+            setenv("XDG_CACHE_HOME", path_.c_str(), 1);
+        }
+
+        ~CacheHome() {
+            if (hadPrevious_)
+                setenv("XDG_CACHE_HOME", previous_.c_str(), 1);
+            else
+                unsetenv("XDG_CACHE_HOME");
+            std::error_code error;
+            std::filesystem::remove_all(path_, error);
+        }
+
+        bool Valid() const { return !path_.empty(); }
+        std::filesystem::path Directory() const { return path_ + "/scudo"; }
+
+        /**
+         * @brief Cache files in the directory, named after a module identity, and leftover temporary files.
+         */
+        std::vector<std::filesystem::path> Files(const char* extension = ".cache") const {
+            std::vector<std::filesystem::path> files;
+            std::error_code error;
+            for (const auto& entry : std::filesystem::directory_iterator(Directory(), error))
+                if (entry.path().extension() == extension)
+                    files.push_back(entry.path());
+            return files;
+        }
+
+    private:
+        std::string path_, previous_;
+        bool hadPrevious_ = false;
+    };
+
+    /**
+     * @brief A module image: a build-id note on the first page, FunctionCount functions on the next.
+     *
+     * Function i is i % 8 nops, xor eax, eax and ret, every function 0x40 bytes apart with int3 between them.
+     */
+    struct Module {
+        std::uint8_t* image = static_cast<std::uint8_t*>(mmap(nullptr, 2 * PageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        ElfW(Phdr) note{};
+
+        Module() {
+            note.p_type = PT_NOTE;
+            note.p_vaddr = 0;
+            note.p_memsz = 12 + 4 + 20;
+            SetBuildId(1);
+
+            std::memset(image + PageSize, 0xCC, PageSize);
+            for (std::size_t index = 0; index < FunctionCount; ++index) {
+                std::uint8_t* function = Function(index);
+                std::memset(function, 0x90, index % 8);
+                std::memcpy(function + index % 8, "\x31\xC0\xC3", 3);
+            }
+        }
+
+        ~Module() { munmap(image, 2 * PageSize); }
+
+        void SetBuildId(std::uint8_t seed) {
+            const std::uint32_t header[] = { 4, 20, 3 };
+            std::memcpy(image, header, sizeof(header));
+            std::memcpy(image + 12, "GNU", 4);
+            for (std::size_t i = 0; i < 20; ++i)
+                image[16 + i] = static_cast<std::uint8_t>(seed * 31 + i);
+        }
+
+        std::uint8_t* Function(std::size_t index) const { return image + PageSize + index * 0x40; }
+        static std::size_t ExpectedSize(std::size_t index) { return index % 8 + 3; }
+
+        LoadedModule Loaded() const {
+            LoadedModule module;
+            module.base = reinterpret_cast<std::uintptr_t>(image);
+            module.path = "/nonexistent/module";
+            module.segments = { &note, 1 };
+            return module;
+        }
+
+        /**
+         * @brief Measures every function by its control flow and records the sizes in a cache written back at once.
+         */
+        void Measure() const {
+            FunctionSizeCache cache(Loaded());
+            FunctionRange code{ reinterpret_cast<std::uintptr_t>(image + PageSize), reinterpret_cast<std::uintptr_t>(image + 2 * PageSize) };
+            for (std::size_t index = 0; index < FunctionCount; ++index)
+                cache.Store(Function(index), GetFunctionExtentLength<ArchX64>(Function(index), {}, std::span<const FunctionRange>(&code, 1)));
+            cache.Flush();
+        }
+
+        /**
+         * @brief Sizes a fresh cache of the module returns, as a new process would read them.
+         */
+        std::vector<std::size_t> Lookup() const {
+            FunctionSizeCache cache(Loaded());
+            std::vector<std::size_t> sizes;
+            for (std::size_t index = 0; index < FunctionCount; ++index)
+                sizes.push_back(cache.Lookup(Function(index)));
+            return sizes;
+        }
+
+        static bool AllCached(const std::vector<std::size_t>& sizes) {
+            for (std::size_t index = 0; index < sizes.size(); ++index)
+                if (sizes[index] != ExpectedSize(index))
+                    return false;
+            return sizes.size() == FunctionCount;
+        }
+
+        static bool NoneCached(const std::vector<std::size_t>& sizes) {
+            return std::count(sizes.begin(), sizes.end(), std::size_t(0)) == static_cast<std::ptrdiff_t>(sizes.size());
+        }
+    };
+
+    void Patch(const std::filesystem::path& path, std::size_t offset, std::uint8_t mask) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(static_cast<std::streamoff>(offset));
+        char byte = 0;
+        file.read(&byte, 1);
+        file.seekp(static_cast<std::streamoff>(offset));
+        byte ^= static_cast<char>(mask);
+        file.write(&byte, 1);
+    }
+
+    void Overwrite(const std::filesystem::path& path, std::size_t offset, std::uint32_t value) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::size_t EntryOffset(std::size_t index) { return sizeof(FunctionSizeCache::Header) + index * sizeof(FunctionSizeCache::Entry); }
+}
+
+TEST("size cache/a warm start sizes every function without reading its code")
+{
+    CacheHome home;
+    Module module;
+    CHECK(home.Valid() && FunctionSizeCache(module.Loaded()).Enabled());
+
+    module.Measure();
+    CHECK(home.Files().size() == 1);
+
+    // Any disassembly would fault on the code now
+    mprotect(module.image + PageSize, PageSize, PROT_NONE);
+    CHECK(Module::AllCached(module.Lookup()));
+    mprotect(module.image + PageSize, PageSize, PROT_READ | PROT_WRITE);
+
+    // Nothing changed, so nothing is written back
+    auto written = std::filesystem::last_write_time(home.Files().at(0));
+    { FunctionSizeCache cache(module.Loaded()); cache.Lookup(module.Function(0)); }
+    CHECK(std::filesystem::last_write_time(home.Files().at(0)) == written);
+}
+
+TEST("size cache/tampered entries and MACs are ignored")
+{
+    CacheHome home;
+    Module module;
+    module.Measure();
+    std::filesystem::path file = home.Files().at(0);
+
+    // A changed size fails its check value, only that function is measured again. Entries are sorted by RVA
+    Patch(file, EntryOffset(5) + offsetof(FunctionSizeCache::Entry, size), 0x10);
+    std::vector<std::size_t> sizes = module.Lookup();
+    CHECK(sizes[5] == 0);
+    sizes[5] = Module::ExpectedSize(5);
+    CHECK(Module::AllCached(sizes));
+
+    // The bad entry is dropped when the file is written back
+    { FunctionSizeCache cache(module.Loaded()); cache.Lookup(module.Function(5)); CHECK(cache.Flush()); }
+    CHECK(std::filesystem::file_size(file) == EntryOffset(FunctionCount - 1));
+
+    // An entry moved to another function fails too, its check value covers the RVA: the lookup of function 4 finds entry 3 first
+    module.Measure();
+    Overwrite(file, EntryOffset(3) + offsetof(FunctionSizeCache::Entry, rva), static_cast<std::uint32_t>(module.Function(4) - module.image));
+    sizes = module.Lookup();
+    CHECK(sizes[3] == 0 && sizes[4] == 0 && sizes[5] == Module::ExpectedSize(5));
+
+    // A header that doesn't match its MAC discards the whole file
+    module.Measure();
+    Patch(file, offsetof(FunctionSizeCache::Header, mac), 0x80);
+    CHECK(Module::NoneCached(module.Lookup()));
+
+    // So does a file authenticated with another key
+    module.Measure();
+    Patch(home.Directory() / "key", 0, 0x01);
+    CHECK(Module::NoneCached(module.Lookup()));
+}
+
+TEST("size cache/another build of the module doesn't use the sizes")
+{
+    CacheHome home;
+    Module module;
+    module.Measure();
+    std::filesystem::path original = home.Files().at(0);
+
+    // A new build-id names another file
+    module.SetBuildId(2);
+    CHECK(Module::NoneCached(module.Lookup()));
+    module.Measure();
+    CHECK(home.Files().size() == 2);
+    std::filesystem::path rebuilt = home.Files().at(0) == original ? home.Files().at(1) : home.Files().at(0);
+
+    // The sizes of the old build copied under the new name carry the old identity in their header
+    std::filesystem::copy_file(original, rebuilt, std::filesystem::copy_options::overwrite_existing);
+    CHECK(Module::NoneCached(module.Lookup()));
+
+    // The old build still finds its own
+    module.SetBuildId(1);
+    CHECK(Module::AllCached(module.Lookup()));
+}
+
+TEST("size cache/truncated files are ignored")
+{
+    CacheHome home;
+    Module module;
+    module.Measure();
+    std::filesystem::path file = home.Files().at(0);
+    std::uintmax_t size = std::filesystem::file_size(file);
+    CHECK(size == EntryOffset(FunctionCount));
+
+    // Cut inside an entry, at an entry boundary the header doesn't count up to, and inside the header
+    for (std::uintmax_t truncated : { size - 3, std::uintmax_t(EntryOffset(FunctionCount / 2)), std::uintmax_t(10) }) {
+        module.Measure();
+        std::filesystem::resize_file(file, truncated);
+        CHECK(Module::NoneCached(module.Lookup()));
+    }
+
+    // An empty file too, and the next run writes a complete one again
+    std::filesystem::resize_file(file, 0);
+    CHECK(Module::NoneCached(module.Lookup()));
+    module.Measure();
+    CHECK(Module::AllCached(module.Lookup()));
+}
+
+TEST("size cache/concurrent writers never leave a torn file")
+{
+    CacheHome home;
+    Module module;
+
+    // Writers each store a share of the functions and write back, while a reader opens the file again and again
+    constexpr std::size_t Writers = 4, Rounds = 20;
+    std::atomic<bool> done{ false };
+    std::atomic<std::size_t> wrong{ 0 }, hits{ 0 };
+    std::vector<std::thread> writers;
+    for (std::size_t writer = 0; writer < Writers; ++writer)
+        writers.emplace_back([&, writer] {
+            for (std::size_t round = 0; round < Rounds; ++round) {
+                FunctionSizeCache cache(module.Loaded());
+                for (std::size_t index = writer; index < FunctionCount; index += Writers)
+                    cache.Store(module.Function(index), Module::ExpectedSize(index));
+                if (!cache.Flush())
+                    ++wrong;
+            }
+        });
+
+    std::thread reader([&] {
+        while (!done) {
+            std::vector<std::size_t> sizes = module.Lookup();
+            for (std::size_t index = 0; index < FunctionCount; ++index) {
+                if (sizes[index] && sizes[index] != Module::ExpectedSize(index))
+                    ++wrong;
+                hits += sizes[index] != 0;
+            }
+        }
+    });
+
+    for (std::thread& writer : writers)
+        writer.join();
+    done = true;
+    reader.join();
+
+    // Every file the reader saw was whole, the last writer's functions are in the final one and no temporary file is left
+    std::printf("    %zu cached sizes read while writing\n", hits.load());
+    CHECK(wrong == 0);
+    CHECK(home.Files().size() == 1 && home.Files(".tmp").empty());
+    std::vector<std::size_t> sizes = module.Lookup();
+    for (std::size_t index = 0; index < FunctionCount; ++index)
+        CHECK(sizes[index] == 0 || sizes[index] == Module::ExpectedSize(index));
+    CHECK(std::count(sizes.begin(), sizes.end(), std::size_t(0)) <= static_cast<std::ptrdiff_t>(FunctionCount - FunctionCount / Writers));
+}
+#endif // !_WIN32
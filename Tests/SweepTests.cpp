@@ -0,0 +1,137 @@
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <A64Sweep.h>
+#include "ScudoTest.h"
+
+/*
+    The sweeper examines every other thread of the process, so these tests hold one thread of their own still,
+    with a word pointing into the first of two bodies on its regular stack, while they run a scan. The other
+    threads of the process answer the scan signal too, none of them points into the bodies.
+*/
+#ifndef _WIN32
+namespace {
+    constexpr int HoldSignal = SIGUSR1;
+    constexpr int ScanSignal = SIGUSR2;
+    constexpr std::size_t AlternateStackSize = 0x10000;
+
+    alignas(64) std::uint8_t bodies[2][64];
+
+    std::atomic<bool> holding{ false }, released{ false };
+
+    std::vector<sweep::Range> Bodies() {
+        return {
+            { reinterpret_cast<std::uintptr_t>(bodies[0]), reinterpret_cast<std::uintptr_t>(bodies[0] + 64) },
+            { reinterpret_cast<std::uintptr_t>(bodies[1]), reinterpret_cast<std::uintptr_t>(bodies[1] + 64) },
+        };
+    }
+
+    void Wait() {
+        holding.store(true, std::memory_order_release);
+        while (!released.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void OnHoldSignal(int, siginfo_t*, void*) {
+        Wait();
+    }
+
+    void OnScanSignal(int, siginfo_t*, void* context) {
+        sweep::Scan::OnSignal(context);
+    }
+
+    /**
+     * @brief Installs the handlers of both signals for the lifetime of the object, on the alternate stack of the thread if it has one.
+     */
+    class Handlers {
+    public:
+        Handlers() {
+            install(HoldSignal, &OnHoldSignal, previous[0]);
+            install(ScanSignal, &OnScanSignal, previous[1]);
+        }
+
+        ~Handlers() {
+            sigaction(HoldSignal, &previous[0], nullptr);
+            sigaction(ScanSignal, &previous[1], nullptr);
+        }
+
+    private:
+        static void install(int signal, void (*handler)(int, siginfo_t*, void*), struct sigaction& previous) {
+            struct sigaction action = {};
+            action.sa_sigaction = handler;
+            action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+            sigemptyset(&action.sa_mask);
+            sigaction(signal, &action, &previous);
+        }
+
+        struct sigaction previous[2];
+    };
+
+    // Only the frame of this call points into the first body, the thread waits here or in a handler it raises
+    SCUDO_NOINLINE void Hold(bool inHandler) {
+        volatile std::uintptr_t word = reinterpret_cast<std::uintptr_t>(bodies[0]) + 8;
+        if (inHandler)
+            raise(HoldSignal);
+        else
+            Wait();
+        scudotest::Consume(word);
+    }
+
+    /**
+     * @brief Scans the threads while one holds the first body, and returns which bodies the scan found busy.
+     */
+    std::pair<bool, bool> ScanWhileHolding(bool alternateStack, bool inHandler) {
+        holding = false;
+        released = false;
+        std::thread thread([=] {
+            std::vector<std::uint8_t> stack(AlternateStackSize);
+            stack_t alternate = {};
+            alternate.ss_sp = stack.data();
+            alternate.ss_size = stack.size();
+            if (alternateStack)
+                sigaltstack(&alternate, nullptr);
+
+            Hold(inHandler);
+
+            alternate.ss_flags = SS_DISABLE;
+            if (alternateStack)
+                sigaltstack(&alternate, nullptr);
+        });
+
+        while (!holding.load(std::memory_order_acquire))
+            std::this_thread::yield();
+
+        sweep::Scan scan(Bodies());
+        scan.Examine(ScanSignal);
+        released = true;
+        thread.join();
+        return { scan.Busy(0), scan.Busy(1) };
+    }
+}
+
+TEST("sweep/a word on a stack keeps only its body plaintext")
+{
+    Handlers handlers;
+
+    // Nothing points into the bodies, found on the stack of a waiting thread, or of a thread with an alternate stack it doesn't run on
+    sweep::Scan idle(Bodies());
+    idle.Examine(ScanSignal);
+    CHECK(!idle.Busy(0) && !idle.Busy(1));
+    CHECK(ScanWhileHolding(false, false) == std::pair(true, false));
+    CHECK(ScanWhileHolding(true, false) == std::pair(true, false));
+
+    // A handler running on the regular stack is scanned with the frames it interrupted
+    CHECK(ScanWhileHolding(false, true) == std::pair(true, false));
+}
+
+TEST("sweep/a thread interrupted on its alternate stack keeps every body plaintext")
+{
+    Handlers handlers;
+
+    // The frame of Hold is on the regular stack, below the handler the scan interrupted
+    CHECK(ScanWhileHolding(true, true) == std::pair(true, true));
+}
+#endif // !_WIN32
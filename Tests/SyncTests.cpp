@@ -0,0 +1,221 @@
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include <A64Sync.h>
+#include "ScudoTest.h"
+
+namespace {
+    constexpr std::size_t ArenaPages = 72;
+    constexpr std::size_t Threads = 64;
+    constexpr std::size_t CallsPerThread = 4000;
+
+    /*
+        A function of the stress test: its body in the arena, encrypted by XOR with a key that changes at every
+        encryption. Calls go through its CallState like the runtime's, the body must be plaintext whenever a call runs it.
+    */
+    struct Function {
+        std::size_t offset;
+        std::size_t size;
+        bool epoch;                          ///< Calls never leave, the sweeper expires it like AA_MODE_EPOCH
+
+        std::uint8_t* body = nullptr;
+        std::vector<std::uint8_t> plaintext;
+        std::uint8_t key = 0;                ///< Written by the transition owner only
+        concurrency::CallState state;
+        std::atomic<int> running{ 0 };       ///< Epoch calls running the body, what the sweeper's stack scan would find
+        std::atomic<bool> released{ false };
+    };
+
+    /*
+        Functions sharing pages, crossing page boundaries, and spanning pages 63 to 65 whose stripes wrap
+        around to 0 and 1. Pages 66 and 68 share stripes with pages 2 and 4.
+    */
+    struct Layout {
+        std::size_t offset, size;
+        bool epoch;
+    };
+
+    constexpr Layout Layouts[] = {
+        { 0x0000, 0x100, false }, { 0x0100, 0x80, false }, { 0x0F80, 0x200, false }, { 0x1180, 0x2000, false },
+        { 0x3200, 0x40, true }, { 0x3240, 0x300, true }, { 0x3F00, 0x1400, false }, { 0x5400, 0x100, true },
+        { 0x3F000, 0x3000, false }, { 0x42000, 0x800, true }, { 0x44800, 0x20, false }, { 0x44820, 0x1000, false },
+    };
+
+    struct Stress {
+        // Aligned to all the stripes, so arena page n takes stripe n % 64
+        static constexpr std::uintptr_t Alignment = concurrency::PageLocks::Stripes * concurrency::PageSize;
+        std::vector<std::uint8_t> memory = std::vector<std::uint8_t>(ArenaPages * concurrency::PageSize + Alignment);
+        std::uint8_t* arena = memory.data() + (Alignment - reinterpret_cast<std::uintptr_t>(memory.data()) % Alignment) % Alignment;
+        Function functions[std::size(Layouts)];
+        std::atomic<int> owners[ArenaPages] = {};
+
+        std::atomic<std::uint64_t> encryptedRuns{ 0 }, sharedPages{ 0 }, decryptions{ 0 }, encryptions{ 0 }, sweeps{ 0 };
+
+        Stress() {
+            for (std::size_t i = 0; i < std::size(Layouts); ++i) {
+                Function& function = functions[i];
+                function.offset = Layouts[i].offset, function.size = Layouts[i].size, function.epoch = Layouts[i].epoch;
+                function.body = arena + function.offset;
+                for (std::size_t byte = 0; byte < function.size; ++byte)
+                    function.body[byte] = static_cast<std::uint8_t>(i * 31 + byte * 7 + 1);
+                function.plaintext.assign(function.body, function.body + function.size);
+
+                // Every function starts encrypted, like a protected one
+                function.key = static_cast<std::uint8_t>(0x5A + i);
+                Transform(function, function.key);
+            }
+        }
+
+        /**
+         * @brief XORs the body under the page locks of its range, which no other thread may hold meanwhile.
+         */
+        void Transform(Function& function, std::uint8_t key) {
+            concurrency::PageLocks::Guard pages(concurrency::PageLocks::Global(), function.body, function.size);
+
+            std::size_t first = function.offset / concurrency::PageSize, last = (function.offset + function.size - 1) / concurrency::PageSize;
+            for (std::size_t page = first; page <= last; ++page)
+                if (owners[page].fetch_add(1) != 0)
+                    ++sharedPages;
+
+            for (std::size_t byte = 0; byte < function.size; ++byte)
+                function.body[byte] ^= key;
+
+            for (std::size_t page = first; page <= last; ++page)
+                owners[page].fetch_sub(1);
+        }
+
+        void Encrypt(Function& function, std::mt19937& random) {
+            function.key = static_cast<std::uint8_t>(random() % 255 + 1);
+            Transform(function, function.key);
+            ++encryptions;
+        }
+
+        void Decrypt(Function& function) {
+            Transform(function, function.key);
+            function.key = 0;
+            ++decryptions;
+        }
+
+        void RunBody(const Function& function) {
+            if (std::memcmp(function.body, function.plaintext.data(), function.size) != 0)
+                ++encryptedRuns;
+        }
+
+        /**
+         * @brief One call, as enterCall and encryptionRoutine make it. Nested calls may re-enter the same function.
+         */
+        void Call(Function& function, int depth, std::mt19937& random) {
+            if (function.epoch)
+                function.running.fetch_add(1);
+            if (function.state.Enter()) {
+                Decrypt(function);
+                function.state.EndDecryption();
+            }
+
+            RunBody(function);
+            if (depth < 3 && random() % 3 == 0)
+                Call(functions[random() % std::size(functions)], depth + 1, random);
+            RunBody(function);
+
+            // Epoch calls aren't followed to their return
+            if (function.epoch) {
+                function.running.fetch_sub(1);
+                return;
+            }
+            if (function.state.Leave()) {
+                Encrypt(function, random);
+                function.state.EndEncryption();
+            }
+        }
+
+        /**
+         * @brief One sweep, as SweepEpoch makes it. Expire comes first so calls counted after the check wait for the encryption.
+         */
+        void Sweep(std::mt19937& random) {
+            for (Function& function : functions) {
+                if (!function.epoch || !function.state.Expire())
+                    continue;
+
+                if (function.running.load() != 0) {
+                    function.state.CancelEncryption();
+                    continue;
+                }
+                Encrypt(function, random);
+                function.state.EndEncryption();
+                ++sweeps;
+            }
+        }
+
+        /**
+         * @brief Leaves a function plaintext for good, as removeProtection does.
+         */
+        void Release(Function& function) {
+            bool decrypt = false;
+            if (!function.state.Release(decrypt))
+                return;
+
+            if (decrypt) {
+                Decrypt(function);
+                function.state.EndDecryption();
+            }
+            function.released.store(true);
+        }
+    };
+}
+
+TEST("sync/64 threads never run an encrypted body")
+{
+    auto stress = std::make_unique<Stress>();
+    std::atomic<bool> stop{ false };
+    std::atomic<std::size_t> finished{ 0 };
+
+    // Half the calls go to the first function, shared by every thread, the rest are spread over all of them
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < Threads; ++t) {
+        threads.emplace_back([&, t] {
+            std::mt19937 random(static_cast<std::uint32_t>(t));
+            for (std::size_t i = 0; i < CallsPerThread; ++i)
+                stress->Call(stress->functions[random() % 2 ? 0 : random() % std::size(stress->functions)], 0, random);
+            ++finished;
+        });
+    }
+
+    std::thread sweeper([&] {
+        std::mt19937 random(1000);
+        while (!stop.load())
+            stress->Sweep(random);
+    });
+
+    // Functions are released while calls and sweeps run them, a plaintext one, an epoch one and the shared one
+    std::thread releaser([&] {
+        for (std::size_t function : { 6, 5, 0 }) {
+            while (finished.load() == 0 && stress->decryptions.load() < 2000 * (function + 1))
+                std::this_thread::yield();
+            stress->Release(stress->functions[function]);
+        }
+    });
+
+    for (std::thread& thread : threads)
+        thread.join();
+    releaser.join();
+    stop.store(true);
+    sweeper.join();
+
+    std::printf("    %llu decryptions, %llu encryptions, %llu sweeps\n", static_cast<unsigned long long>(stress->decryptions.load()),
+        static_cast<unsigned long long>(stress->encryptions.load()), static_cast<unsigned long long>(stress->sweeps.load()));
+    CHECK(stress->encryptedRuns.load() == 0);
+    CHECK(stress->sharedPages.load() == 0);
+    CHECK(stress->decryptions.load() > Threads && stress->sweeps.load() > 0);
+
+    // Released functions stay plaintext, the others are encrypted again once no call runs them
+    for (Function& function : stress->functions) {
+        bool plaintext = std::memcmp(function.body, function.plaintext.data(), function.size) == 0;
+        if (function.released.load())
+            CHECK(plaintext);
+        else if (!function.epoch)
+            CHECK(!plaintext && function.key != 0);
+    }
+    CHECK(stress->functions[0].released.load() && stress->functions[5].released.load() && stress->functions[6].released.load());
+}
@@ -0,0 +1,86 @@
+#include <cstring>
+#include <system_error>
+#ifdef _WIN32
+#include <Windows.h>
+#endif // _WIN32
+#include "ScudoTest.h"
+
+namespace {
+    std::filesystem::path ExecutablePath(const char* argv0) {
+        std::error_code error;
+#ifdef _WIN32
+        wchar_t path[MAX_PATH];
+        DWORD length = GetModuleFileNameW(nullptr, path, MAX_PATH);
+        if (length && length < MAX_PATH)
+            return path;
+#else
+        std::filesystem::path path = std::filesystem::read_symlink("/proc/self/exe", error);
+        if (!error)
+            return path;
+#endif // _WIN32
+        return std::filesystem::absolute(argv0, error);
+    }
+
+    /**
+     * @brief Fixtures or Tests/Fixtures in the directory of the executable or the nearest parent that has one.
+     */
+    std::filesystem::path FindFixtures(const char* argv0) {
+        std::error_code error;
+        for (std::filesystem::path directory = ExecutablePath(argv0).parent_path(); !directory.empty(); directory = directory.parent_path()) {
+            for (const char* candidate : { "Fixtures", "Tests/Fixtures" })
+                if (std::filesystem::is_directory(directory / candidate, error))
+                    return directory / candidate;
+            if (directory == directory.parent_path())
+                break;
+        }
+        return "Fixtures";
+    }
+}
+
+/*
+    scudo-tests [--bench] [--fixtures directory] [filter]
+
+    Runs the tests, or the benchmarks with --bench, whose name contains filter.
+    Fixtures are read from the given directory, by default from the nearest Fixtures or Tests/Fixtures
+    directory at or above the executable, so the harness runs from any working directory.
+    Returns the number of failed tests.
+*/
+int main(int argc, char** argv)
+{
+    setvbuf(stdout, nullptr, _IONBF, 0);
+
+    bool benchmarks = false;
+    const char* filter = "";
+    const char* fixtures = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--bench") == 0)
+            benchmarks = true;
+        else if (std::strcmp(argv[i], "--fixtures") == 0 && i + 1 < argc)
+            fixtures = argv[++i];
+        else
+            filter = argv[i];
+    }
+    scudotest::FixtureDirectory() = fixtures ? std::filesystem::path(fixtures) : FindFixtures(argv[0]);
+
+    int ran = 0, failed = 0;
+    for (const scudotest::Case& test : scudotest::Cases()) {
+        if (test.benchmark != benchmarks || !std::strstr(test.name, filter))
+            continue;
+
+        // Run the case, the checks it fails are printed as they happen
+        std::printf("[ RUN  ] %s\n", test.name);
+        scudotest::Failures() = 0;
+        test.body();
+        ++ran;
+
+        if (scudotest::Failures()) {
+            ++failed;
+            std::printf("[ FAIL ] %s (%d checks)\n", test.name, scudotest::Failures());
+        }
+        else
+            std::printf("[  OK  ] %s\n", test.name);
+    }
+
+    std::printf("%d of %d %s passed\n", ran - failed, ran, benchmarks ? "benchmarks" : "tests");
+    return failed;
+}